@@ -0,0 +1,1029 @@
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+#include "NiFpga_IO.h"
+#include "SimFpga.hpp"
+
+/******************************** CONSTANTS ***********************************/
+
+/**
+ * Handle of the simulated session.
+ */
+static const NiFpga_Session SIM_SESSION = 1;
+
+/**
+ * Analog input and digital pin numbers in the IO bitfile.
+ */
+static const uint8_t NUM_ANALOG_PINS = 16;
+static const uint8_t MIN_DIGITAL_PIN = 5;
+static const uint8_t MAX_DIGITAL_PIN = 27;
+
+/**
+ * Loopback entry for a digital pin that is not wired to an output pin.
+ */
+static const uint8_t NO_LOOPBACK = UINT8_MAX;
+
+/**
+ * Array mapping analog input range control values -> range in volts. See
+ * AnalogInDevice::Range_t.
+ */
+static const float AIN_RANGE_V_ARR[] = {10, 5, 2, 1};
+static const uint8_t NUM_RANGES = 4;
+
+/**
+ * Array mapping analog pin numbers -> FPGA API fxp resource identifiers.
+ */
+static const uint32_t AIN_FXP_RESOURCE_ARR[] =
+{
+    NiFpga_IO_IndicatorFxp_inputAI0_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI1_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI2_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI3_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI4_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI5_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI6_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI7_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI8_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI9_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI10_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI11_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI12_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI13_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI14_Resource,
+    NiFpga_IO_IndicatorFxp_inputAI15_Resource,
+};
+
+/**
+ * Array mapping analog pin numbers -> FPGA API fxp type info identifiers.
+ */
+static const NiFpga_FxpTypeInfo AIN_FXP_INFO_ARR[] =
+{
+    NiFpga_IO_IndicatorFxp_inputAI0_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI1_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI2_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI3_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI4_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI5_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI6_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI7_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI8_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI9_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI10_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI11_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI12_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI13_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI14_TypeInfo,
+    NiFpga_IO_IndicatorFxp_inputAI15_TypeInfo,
+};
+
+/**
+ * Array mapping analog pin numbers -> FPGA API range control identifiers.
+ */
+static const uint32_t AIN_RANGE_ARR[] =
+{
+    NiFpga_IO_ControlU8_rangeAI0,
+    NiFpga_IO_ControlU8_rangeAI1,
+    NiFpga_IO_ControlU8_rangeAI2,
+    NiFpga_IO_ControlU8_rangeAI3,
+    NiFpga_IO_ControlU8_rangeAI4,
+    NiFpga_IO_ControlU8_rangeAI5,
+    NiFpga_IO_ControlU8_rangeAI6,
+    NiFpga_IO_ControlU8_rangeAI7,
+    NiFpga_IO_ControlU8_rangeAI8,
+    NiFpga_IO_ControlU8_rangeAI9,
+    NiFpga_IO_ControlU8_rangeAI10,
+    NiFpga_IO_ControlU8_rangeAI11,
+    NiFpga_IO_ControlU8_rangeAI12,
+    NiFpga_IO_ControlU8_rangeAI13,
+    NiFpga_IO_ControlU8_rangeAI14,
+    NiFpga_IO_ControlU8_rangeAI15,
+};
+
+/**
+ * FPGA API identifiers of a digital pin.
+ */
+typedef struct
+{
+    uint32_t control;       // Value driven.
+    uint32_t outputEnable;  // Whether the pin is an output.
+    uint32_t indicator;     // Value read.
+} DioIds_t;
+
+/**
+ * Array mapping (digital pin number - MIN_DIGITAL_PIN) -> FPGA API
+ * identifiers.
+ */
+static const DioIds_t DIO_IDS_ARR[] =
+{
+    {NiFpga_IO_ControlBool_outDIO5, NiFpga_IO_ControlBool_outputEnableDIO5,
+     NiFpga_IO_IndicatorBool_inDIO5},
+    {NiFpga_IO_ControlBool_outDIO6, NiFpga_IO_ControlBool_outputEnableDIO6,
+     NiFpga_IO_IndicatorBool_inDIO6},
+    {NiFpga_IO_ControlBool_outDIO7, NiFpga_IO_ControlBool_outputEnableDIO7,
+     NiFpga_IO_IndicatorBool_inDIO7},
+    {NiFpga_IO_ControlBool_outDIO8, NiFpga_IO_ControlBool_outputEnableDIO8,
+     NiFpga_IO_IndicatorBool_inDIO8},
+    {NiFpga_IO_ControlBool_outDIO9, NiFpga_IO_ControlBool_outputEnableDIO9,
+     NiFpga_IO_IndicatorBool_inDIO9},
+    {NiFpga_IO_ControlBool_outDIO10, NiFpga_IO_ControlBool_outputEnableDIO10,
+     NiFpga_IO_IndicatorBool_inDIO10},
+    {NiFpga_IO_ControlBool_outDIO11, NiFpga_IO_ControlBool_outputEnableDIO11,
+     NiFpga_IO_IndicatorBool_inDIO11},
+    {NiFpga_IO_ControlBool_outDIO12, NiFpga_IO_ControlBool_outputEnableDIO12,
+     NiFpga_IO_IndicatorBool_inDIO12},
+    {NiFpga_IO_ControlBool_outDIO13, NiFpga_IO_ControlBool_outputEnableDIO13,
+     NiFpga_IO_IndicatorBool_inDIO13},
+    {NiFpga_IO_ControlBool_outDIO14, NiFpga_IO_ControlBool_outputEnableDIO14,
+     NiFpga_IO_IndicatorBool_inDIO14},
+    {NiFpga_IO_ControlBool_outDIO15, NiFpga_IO_ControlBool_outputEnableDIO15,
+     NiFpga_IO_IndicatorBool_inDIO15},
+    {NiFpga_IO_ControlBool_outDIO16, NiFpga_IO_ControlBool_outputEnableDIO16,
+     NiFpga_IO_IndicatorBool_inDIO16},
+    {NiFpga_IO_ControlBool_outDIO17, NiFpga_IO_ControlBool_outputEnableDIO17,
+     NiFpga_IO_IndicatorBool_inDIO17},
+    {NiFpga_IO_ControlBool_outDIO18, NiFpga_IO_ControlBool_outputEnableDIO18,
+     NiFpga_IO_IndicatorBool_inDIO18},
+    {NiFpga_IO_ControlBool_outDIO19, NiFpga_IO_ControlBool_outputEnableDIO19,
+     NiFpga_IO_IndicatorBool_inDIO19},
+    {NiFpga_IO_ControlBool_outDIO20, NiFpga_IO_ControlBool_outputEnableDIO20,
+     NiFpga_IO_IndicatorBool_inDIO20},
+    {NiFpga_IO_ControlBool_outDIO21, NiFpga_IO_ControlBool_outputEnableDIO21,
+     NiFpga_IO_IndicatorBool_inDIO21},
+    {NiFpga_IO_ControlBool_outDIO22, NiFpga_IO_ControlBool_outputEnableDIO22,
+     NiFpga_IO_IndicatorBool_inDIO22},
+    {NiFpga_IO_ControlBool_outDIO23, NiFpga_IO_ControlBool_outputEnableDIO23,
+     NiFpga_IO_IndicatorBool_inDIO23},
+    {NiFpga_IO_ControlBool_outDIO24, NiFpga_IO_ControlBool_outputEnableDIO24,
+     NiFpga_IO_IndicatorBool_inDIO24},
+    {NiFpga_IO_ControlBool_outDIO25, NiFpga_IO_ControlBool_outputEnableDIO25,
+     NiFpga_IO_IndicatorBool_inDIO25},
+    {NiFpga_IO_ControlBool_outDIO26, NiFpga_IO_ControlBool_outputEnableDIO26,
+     NiFpga_IO_IndicatorBool_inDIO26},
+    {NiFpga_IO_ControlBool_outDIO27, NiFpga_IO_ControlBool_outputEnableDIO27,
+     NiFpga_IO_IndicatorBool_inDIO27},
+};
+
+/**
+ * Simulated target-to-host FIFO. The ring is stored twice back-to-back so that
+ * any run of up to depth elements starting in the first copy is contiguous,
+ * like the FIFO's DMA memory on the target. head, tail and acquired count
+ * elements pushed, released and acquired, respectively.
+ */
+typedef struct
+{
+    std::vector<uint32_t> mirroredRing;
+    size_t depth;
+    uint64_t head;
+    uint64_t tail;
+    uint64_t acquired;
+    bool started;
+} Fifo_t;
+
+/********************************* GLOBALS ************************************/
+
+/**
+ * Guards all simulation state below except for the latencies and call count.
+ */
+static std::mutex gMutex;
+
+/**
+ * Signalled when IRQs are asserted, when FIFO elements are pushed, and when
+ * the periodic IRQ thread should stop, respectively.
+ */
+static std::condition_variable gIrqCv;
+static std::condition_variable gFifoCv;
+static std::condition_variable gPeriodicCv;
+
+/**
+ * Whether the session is open.
+ */
+static bool gSessionOpen = false;
+
+/**
+ * Values of plain controls and indicators, keyed by identifier.
+ */
+static std::unordered_map<uint32_t, uint64_t> gRegisters;
+
+/**
+ * Scripted analog waveform of each analog pin.
+ */
+static SimFpga::Waveform_t gWaveforms[NUM_ANALOG_PINS] = {};
+
+/**
+ * Scripted level and loopback output pin of each digital pin, indexed by pin
+ * number.
+ */
+static bool gDigitalIn[MAX_DIGITAL_PIN + 1] = {};
+static uint8_t gLoopback[MAX_DIGITAL_PIN + 1] = {};
+
+/**
+ * FIFOs, keyed by identifier.
+ */
+static std::unordered_map<uint32_t, Fifo_t> gFifos;
+
+/**
+ * Asserted and not yet acknowledged IRQs.
+ */
+static uint32_t gIrqsAsserted = 0;
+
+/**
+ * Frozen simulation time, if frozen.
+ */
+static bool gTimeFrozen = false;
+static uint64_t gFrozenTimeNs = 0;
+
+/**
+ * Periodic IRQ thread and its stop flag.
+ */
+static std::thread gPeriodicThread;
+static bool gPeriodicStop = false;
+
+/**
+ * Per-call latencies and call count.
+ */
+static std::atomic<uint32_t> gReadLatencyNs (0);
+static std::atomic<uint32_t> gWriteLatencyNs (0);
+static std::atomic<uint64_t> gNumCalls (0);
+
+/**
+ * Stops the periodic IRQ thread, if running.
+ */
+static void stopPeriodicIrqs ()
+{
+    if (gPeriodicThread.joinable () == false)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock (gMutex);
+        gPeriodicStop = true;
+    }
+    gPeriodicCv.notify_all ();
+    gPeriodicThread.join ();
+}
+
+/**
+ * Stops the periodic IRQ thread at program exit. Declared after the thread so
+ * that it is destroyed first.
+ */
+static struct PeriodicIrqsAtExit
+{
+    ~PeriodicIrqsAtExit ()
+    {
+        stopPeriodicIrqs ();
+    }
+} gPeriodicIrqsAtExit;
+
+/**
+ * Gets the monotonic clock time in ns.
+ *
+ * @ret     Monotonic time.
+ */
+static uint64_t getMonotonicNs ()
+{
+    timespec ts = {};
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * Busy-waits for a simulated call's latency and counts the call.
+ *
+ * @param   kLatencyNs   Latency in ns.
+ */
+static void simulateCall (uint32_t kLatencyNs)
+{
+    gNumCalls.fetch_add (1, std::memory_order_relaxed);
+    if (kLatencyNs == 0)
+    {
+        return;
+    }
+
+    uint64_t endNs = getMonotonicNs () + kLatencyNs;
+    while (getMonotonicNs () < endNs)
+    {
+    }
+}
+
+/**
+ * Checks that a session is the open simulated session. Caller must hold
+ * gMutex.
+ *
+ * @param   kSession   Session to check.
+ *
+ * @ret     Whether the session is valid.
+ */
+static bool isSessionValid (NiFpga_Session kSession)
+{
+    return gSessionOpen == true && kSession == SIM_SESSION;
+}
+
+/**
+ * Gets a plain register's value. Caller must hold gMutex.
+ *
+ * @param   kId   Control or indicator identifier.
+ *
+ * @ret     Last value written, or 0.
+ */
+static uint64_t getRegister (uint32_t kId)
+{
+    std::unordered_map<uint32_t, uint64_t>::iterator it = gRegisters.find (kId);
+    return it == gRegisters.end () ? 0 : it->second;
+}
+
+/**
+ * Evaluates a waveform at a simulation time.
+ *
+ * @param   kWaveform   Waveform.
+ * @param   kTimeNs     Simulation time in ns.
+ *
+ * @ret     Voltage.
+ */
+static float evaluateWaveform (const SimFpga::Waveform_t& kWaveform,
+                               uint64_t kTimeNs)
+{
+    double phase = fmod (kTimeNs * 1e-9 * kWaveform.freqHz, 1.0);
+    switch (kWaveform.wave)
+    {
+        case SimFpga::WAVE_SINE:
+            return kWaveform.offsetV +
+                   kWaveform.amplitudeV * (float) sin (2 * M_PI * phase);
+        case SimFpga::WAVE_SQUARE:
+            return phase < 0.5 ? kWaveform.offsetV + kWaveform.amplitudeV
+                               : kWaveform.offsetV - kWaveform.amplitudeV;
+        case SimFpga::WAVE_RAMP:
+            return kWaveform.offsetV - kWaveform.amplitudeV +
+                   2 * kWaveform.amplitudeV * (float) phase;
+        default:
+            return kWaveform.offsetV;
+    }
+}
+
+/**
+ * Reads an analog pin's fxp value. Caller must hold gMutex.
+ *
+ * @param   kPin   Analog pin number.
+ *
+ * @ret     Fxp value.
+ */
+static uint64_t readAnalog (uint8_t kPin)
+{
+    uint64_t timeNs = gTimeFrozen == true ? gFrozenTimeNs : getMonotonicNs ();
+    float volts = evaluateWaveform (gWaveforms[kPin], timeNs);
+
+    // Clip to the pin's configured range.
+    uint64_t range = std::min (getRegister (AIN_RANGE_ARR[kPin]),
+                               (uint64_t) NUM_RANGES - 1);
+    float rangeV = AIN_RANGE_V_ARR[range];
+    volts = std::max (-rangeV, std::min (rangeV, volts));
+
+    return NiFpga_ConvertFromFloatToFxp (AIN_FXP_INFO_ARR[kPin], volts);
+}
+
+/**
+ * Gets the value driven on a digital pin. Caller must hold gMutex.
+ *
+ * @param   kPin   Digital pin number.
+ *
+ * @ret     Value driven, or false if the pin is not an output.
+ */
+static bool getDriven (uint8_t kPin)
+{
+    const DioIds_t& ids = DIO_IDS_ARR[kPin - MIN_DIGITAL_PIN];
+    return getRegister (ids.outputEnable) != 0 &&
+           getRegister (ids.control) != 0;
+}
+
+/**
+ * Reads a digital pin. See note (2) in SimFpga.hpp. Caller must hold gMutex.
+ *
+ * @param   kPin   Digital pin number.
+ *
+ * @ret     Value read.
+ */
+static bool readDigital (uint8_t kPin)
+{
+    const DioIds_t& ids = DIO_IDS_ARR[kPin - MIN_DIGITAL_PIN];
+    if (getRegister (ids.outputEnable) != 0)
+    {
+        return getRegister (ids.control) != 0;
+    }
+    if (gLoopback[kPin] != NO_LOOPBACK)
+    {
+        return getDriven (gLoopback[kPin]);
+    }
+    return gDigitalIn[kPin];
+}
+
+/**
+ * Reads a control or indicator.
+ *
+ * @param   kSession   Session.
+ * @param   kId        Control or indicator identifier.
+ * @param   kValRet    Value read.
+ *
+ * @ret     NiFpga status.
+ */
+static NiFpga_Status readRegister (NiFpga_Session kSession, uint32_t kId,
+                                   uint64_t& kValRet)
+{
+    simulateCall (gReadLatencyNs.load (std::memory_order_relaxed));
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (kSession) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+
+    for (uint8_t pin = 0; pin < NUM_ANALOG_PINS; pin++)
+    {
+        if (kId == AIN_FXP_RESOURCE_ARR[pin])
+        {
+            kValRet = readAnalog (pin);
+            return NiFpga_Status_Success;
+        }
+    }
+    for (uint8_t pin = MIN_DIGITAL_PIN; pin <= MAX_DIGITAL_PIN; pin++)
+    {
+        if (kId == DIO_IDS_ARR[pin - MIN_DIGITAL_PIN].indicator)
+        {
+            kValRet = readDigital (pin);
+            return NiFpga_Status_Success;
+        }
+    }
+    kValRet = getRegister (kId);
+    return NiFpga_Status_Success;
+}
+
+/**
+ * Writes a control.
+ *
+ * @param   kSession   Session.
+ * @param   kId        Control identifier.
+ * @param   kVal       Value to write.
+ *
+ * @ret     NiFpga status.
+ */
+static NiFpga_Status writeRegister (NiFpga_Session kSession, uint32_t kId,
+                                    uint64_t kVal)
+{
+    simulateCall (gWriteLatencyNs.load (std::memory_order_relaxed));
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (kSession) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+
+    gRegisters[kId] = kVal;
+    return NiFpga_Status_Success;
+}
+
+/**
+ * Resets all simulation state except the session. Caller must hold gMutex.
+ */
+static void resetState ()
+{
+    gRegisters.clear ();
+    std::fill (std::begin (gWaveforms), std::end (gWaveforms),
+               SimFpga::Waveform_t {SimFpga::WAVE_CONSTANT, 0, 0, 0});
+    std::fill (std::begin (gDigitalIn), std::end (gDigitalIn), false);
+    std::fill (std::begin (gLoopback), std::end (gLoopback), NO_LOOPBACK);
+    gFifos.clear ();
+    gIrqsAsserted = 0;
+    gTimeFrozen = false;
+    gFrozenTimeNs = 0;
+}
+
+/**
+ * Checks that a digital pin number is in the IO bitfile.
+ *
+ * @param   kPin   Digital pin number.
+ *
+ * @ret     Whether the pin is valid.
+ */
+static bool isDigitalPinValid (uint8_t kPin)
+{
+    return kPin >= MIN_DIGITAL_PIN && kPin <= MAX_DIGITAL_PIN;
+}
+
+/****************************** SIMULATION API ********************************/
+
+Error_t SimFpga::setAnalogIn (uint8_t kPin, const Waveform_t& kWaveform)
+{
+    if (kPin >= NUM_ANALOG_PINS)
+    {
+        return E_OUT_OF_BOUNDS;
+    }
+    if (kWaveform.wave >= WAVE_LAST)
+    {
+        return E_INVALID_ENUM;
+    }
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    gWaveforms[kPin] = kWaveform;
+    return E_SUCCESS;
+}
+
+Error_t SimFpga::setDigitalIn (uint8_t kPin, bool kVal)
+{
+    if (isDigitalPinValid (kPin) == false)
+    {
+        return E_OUT_OF_BOUNDS;
+    }
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    gDigitalIn[kPin] = kVal;
+    return E_SUCCESS;
+}
+
+Error_t SimFpga::setLoopback (uint8_t kInPin, uint8_t kOutPin)
+{
+    if (isDigitalPinValid (kInPin) == false ||
+        isDigitalPinValid (kOutPin) == false)
+    {
+        return E_OUT_OF_BOUNDS;
+    }
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    gLoopback[kInPin] = kOutPin;
+    return E_SUCCESS;
+}
+
+Error_t SimFpga::getDigitalOut (uint8_t kPin, bool& kValRet)
+{
+    if (isDigitalPinValid (kPin) == false)
+    {
+        return E_OUT_OF_BOUNDS;
+    }
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    kValRet = getDriven (kPin);
+    return E_SUCCESS;
+}
+
+void SimFpga::setLatencyNs (uint32_t kReadNs, uint32_t kWriteNs)
+{
+    gReadLatencyNs.store (kReadNs, std::memory_order_relaxed);
+    gWriteLatencyNs.store (kWriteNs, std::memory_order_relaxed);
+}
+
+void SimFpga::setTimeNs (uint64_t kNs)
+{
+    std::lock_guard<std::mutex> lock (gMutex);
+    gTimeFrozen = true;
+    gFrozenTimeNs = kNs;
+}
+
+void SimFpga::useRealTime ()
+{
+    std::lock_guard<std::mutex> lock (gMutex);
+    gTimeFrozen = false;
+}
+
+void SimFpga::assertIrqs (uint32_t kIrqs)
+{
+    {
+        std::lock_guard<std::mutex> lock (gMutex);
+        gIrqsAsserted |= kIrqs;
+    }
+    gIrqCv.notify_all ();
+}
+
+Error_t SimFpga::setPeriodicIrqs (uint32_t kIrqs, uint64_t kPeriodNs)
+{
+    stopPeriodicIrqs ();
+    if (kPeriodNs == 0)
+    {
+        return E_SUCCESS;
+    }
+
+    gPeriodicStop = false;
+    try
+    {
+        gPeriodicThread = std::thread ([kIrqs, kPeriodNs] ()
+        {
+            std::chrono::nanoseconds period (kPeriodNs);
+            std::chrono::steady_clock::time_point next =
+                std::chrono::steady_clock::now () + period;
+            std::unique_lock<std::mutex> lock (gMutex);
+            while (gPeriodicStop == false)
+            {
+                if (gPeriodicCv.wait_until (lock, next) ==
+                        std::cv_status::timeout)
+                {
+                    gIrqsAsserted |= kIrqs;
+                    gIrqCv.notify_all ();
+                    next += period;
+                }
+            }
+        });
+    }
+    catch (const std::system_error&)
+    {
+        return E_FAILED_TO_CREATE_THREAD;
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t SimFpga::pushFifo (uint32_t kFifo, const std::vector<uint32_t>& kElems)
+{
+    {
+        std::lock_guard<std::mutex> lock (gMutex);
+        std::unordered_map<uint32_t, Fifo_t>::iterator it =
+            gFifos.find (kFifo);
+        if (it == gFifos.end () || it->second.started == false)
+        {
+            return E_FPGA_FIFO;
+        }
+
+        Fifo_t& fifo = it->second;
+        if (fifo.head - fifo.tail + kElems.size () > fifo.depth)
+        {
+            return E_FPGA_FIFO;
+        }
+
+        // Write each element to both copies of the ring.
+        for (uint32_t elem : kElems)
+        {
+            size_t idx = fifo.head % fifo.depth;
+            fifo.mirroredRing[idx] = elem;
+            fifo.mirroredRing[idx + fifo.depth] = elem;
+            fifo.head++;
+        }
+    }
+    gFifoCv.notify_all ();
+
+    return E_SUCCESS;
+}
+
+uint64_t SimFpga::getNumCalls ()
+{
+    return gNumCalls.load (std::memory_order_relaxed);
+}
+
+void SimFpga::reset ()
+{
+    stopPeriodicIrqs ();
+    SimFpga::setLatencyNs (0, 0);
+    gNumCalls.store (0, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    resetState ();
+}
+
+/******************************* NIFPGA API ***********************************/
+
+NiFpga_Status NiFpga_Initialize (void)
+{
+    std::lock_guard<std::mutex> lock (gMutex);
+    resetState ();
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_Finalize (void)
+{
+    stopPeriodicIrqs ();
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_Open (const char* bitfile, const char* signature,
+                           const char* resource, uint32_t attribute,
+                           NiFpga_Session* session)
+{
+    if (session == nullptr)
+    {
+        return NiFpga_Status_InvalidParameter;
+    }
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    gSessionOpen = true;
+    *session = SIM_SESSION;
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_Close (NiFpga_Session session, uint32_t attribute)
+{
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+
+    gSessionOpen = false;
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_Run (NiFpga_Session session, uint32_t attribute)
+{
+    std::lock_guard<std::mutex> lock (gMutex);
+    return isSessionValid (session) == true ? NiFpga_Status_Success
+                                            : NiFpga_Status_InvalidSession;
+}
+
+NiFpga_Status NiFpga_Abort (NiFpga_Session session)
+{
+    std::lock_guard<std::mutex> lock (gMutex);
+    return isSessionValid (session) == true ? NiFpga_Status_Success
+                                            : NiFpga_Status_InvalidSession;
+}
+
+NiFpga_Status NiFpga_Reset (NiFpga_Session session)
+{
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+
+    gRegisters.clear ();
+    return NiFpga_Status_Success;
+}
+
+/**
+ * Defines NiFpga_Read<kName> and NiFpga_Write<kName> for a scalar type.
+ *
+ * @param   kName   Type name in the NiFpga API.
+ * @param   kType   C type.
+ */
+#define SIM_READ_WRITE(kName, kType)                                           \
+NiFpga_Status NiFpga_Read##kName (NiFpga_Session session, uint32_t indicator,  \
+                                  kType* value)                                \
+{                                                                              \
+    if (value == nullptr)                                                      \
+    {                                                                          \
+        return NiFpga_Status_InvalidParameter;                                 \
+    }                                                                          \
+    uint64_t val = 0;                                                          \
+    NiFpga_Status status = readRegister (session, indicator, val);             \
+    *value = (kType) val;                                                      \
+    return status;                                                             \
+}                                                                              \
+                                                                               \
+NiFpga_Status NiFpga_Write##kName (NiFpga_Session session, uint32_t control,   \
+                                   kType value)                                \
+{                                                                              \
+    return writeRegister (session, control, (uint64_t) value);                 \
+}
+
+SIM_READ_WRITE (Bool, NiFpga_Bool)
+SIM_READ_WRITE (I8,   int8_t)
+SIM_READ_WRITE (U8,   uint8_t)
+SIM_READ_WRITE (I16,  int16_t)
+SIM_READ_WRITE (U16,  uint16_t)
+SIM_READ_WRITE (I32,  int32_t)
+SIM_READ_WRITE (U32,  uint32_t)
+SIM_READ_WRITE (I64,  int64_t)
+SIM_READ_WRITE (U64,  uint64_t)
+
+NiFpga_Status NiFpga_ConfigureFifo2 (NiFpga_Session session, uint32_t fifo,
+                                     size_t requestedDepth,
+                                     size_t* actualDepth)
+{
+    simulateCall (gWriteLatencyNs.load (std::memory_order_relaxed));
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+    if (requestedDepth == 0)
+    {
+        return NiFpga_Status_BadDepth;
+    }
+
+    Fifo_t& newFifo = gFifos[fifo];
+    newFifo.mirroredRing.assign (2 * requestedDepth, 0);
+    newFifo.depth = requestedDepth;
+    newFifo.head = 0;
+    newFifo.tail = 0;
+    newFifo.acquired = 0;
+    newFifo.started = false;
+    if (actualDepth != nullptr)
+    {
+        *actualDepth = requestedDepth;
+    }
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_StartFifo (NiFpga_Session session, uint32_t fifo)
+{
+    simulateCall (gWriteLatencyNs.load (std::memory_order_relaxed));
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+    std::unordered_map<uint32_t, Fifo_t>::iterator it = gFifos.find (fifo);
+    if (it == gFifos.end ())
+    {
+        return NiFpga_Status_ResourceNotInitialized;
+    }
+
+    it->second.started = true;
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_StopFifo (NiFpga_Session session, uint32_t fifo)
+{
+    simulateCall (gWriteLatencyNs.load (std::memory_order_relaxed));
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+    std::unordered_map<uint32_t, Fifo_t>::iterator it = gFifos.find (fifo);
+    if (it == gFifos.end ())
+    {
+        return NiFpga_Status_ResourceNotInitialized;
+    }
+
+    // Stopping a FIFO discards its elements.
+    it->second.started = false;
+    it->second.tail = it->second.head;
+    it->second.acquired = 0;
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_AcquireFifoReadElementsU32 (
+                                            NiFpga_Session session,
+                                            uint32_t fifo,
+                                            uint32_t** elements,
+                                            size_t elementsRequested,
+                                            uint32_t timeout,
+                                            size_t* elementsAcquired,
+                                            size_t* elementsRemaining)
+{
+    simulateCall (gReadLatencyNs.load (std::memory_order_relaxed));
+
+    if (elements == nullptr || elementsAcquired == nullptr)
+    {
+        return NiFpga_Status_InvalidParameter;
+    }
+    *elementsAcquired = 0;
+
+    std::unique_lock<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+    std::unordered_map<uint32_t, Fifo_t>::iterator it = gFifos.find (fifo);
+    if (it == gFifos.end () || it->second.started == false)
+    {
+        return NiFpga_Status_ResourceNotInitialized;
+    }
+    Fifo_t& simFifo = it->second;
+    if (elementsRequested > simFifo.depth)
+    {
+        return NiFpga_Status_BadReadWriteCount;
+    }
+
+    // Wait for enough unacquired elements.
+    auto available = [&simFifo, elementsRequested] ()
+    {
+        return simFifo.head - simFifo.tail - simFifo.acquired >=
+               elementsRequested;
+    };
+    if (timeout == NiFpga_InfiniteTimeout)
+    {
+        gFifoCv.wait (lock, available);
+    }
+    else if (gFifoCv.wait_for (lock, std::chrono::milliseconds (timeout),
+                               available) == false)
+    {
+        return NiFpga_Status_FifoTimeout;
+    }
+
+    // Acquire from the first copy of the ring. The run is contiguous since
+    // it is at most depth elements long.
+    uint64_t first = simFifo.tail + simFifo.acquired;
+    *elements = &simFifo.mirroredRing[first % simFifo.depth];
+    *elementsAcquired = elementsRequested;
+    simFifo.acquired += elementsRequested;
+    if (elementsRemaining != nullptr)
+    {
+        *elementsRemaining = simFifo.head - first - elementsRequested;
+    }
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_ReleaseFifoElements (NiFpga_Session session,
+                                          uint32_t fifo,
+                                          size_t elements)
+{
+    simulateCall (gReadLatencyNs.load (std::memory_order_relaxed));
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+    std::unordered_map<uint32_t, Fifo_t>::iterator it = gFifos.find (fifo);
+    if (it == gFifos.end () || elements > it->second.acquired)
+    {
+        return NiFpga_Status_InvalidParameter;
+    }
+
+    it->second.tail += elements;
+    it->second.acquired -= elements;
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_ReserveIrqContext (NiFpga_Session session,
+                                        NiFpga_IrqContext* context)
+{
+    if (context == nullptr)
+    {
+        return NiFpga_Status_InvalidParameter;
+    }
+
+    // The simulation keeps no per-context state, but callers expect a
+    // non-null context.
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+    *context = &gIrqsAsserted;
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_UnreserveIrqContext (NiFpga_Session session,
+                                          NiFpga_IrqContext context)
+{
+    std::lock_guard<std::mutex> lock (gMutex);
+    return isSessionValid (session) == true ? NiFpga_Status_Success
+                                            : NiFpga_Status_InvalidSession;
+}
+
+NiFpga_Status NiFpga_WaitOnIrqs (NiFpga_Session session,
+                                 NiFpga_IrqContext context,
+                                 uint32_t irqs,
+                                 uint32_t timeout,
+                                 uint32_t* irqsAsserted,
+                                 NiFpga_Bool* timedOut)
+{
+    simulateCall (gReadLatencyNs.load (std::memory_order_relaxed));
+
+    if (context == nullptr)
+    {
+        return NiFpga_Status_ResourceNotInitialized;
+    }
+
+    std::unique_lock<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+
+    auto asserted = [irqs] ()
+    {
+        return (gIrqsAsserted & irqs) != 0;
+    };
+    bool gotIrqs = true;
+    if (timeout == NiFpga_InfiniteTimeout)
+    {
+        gIrqCv.wait (lock, asserted);
+    }
+    else
+    {
+        gotIrqs = gIrqCv.wait_for (lock, std::chrono::milliseconds (timeout),
+                                   asserted);
+    }
+
+    if (irqsAsserted != nullptr)
+    {
+        *irqsAsserted = gIrqsAsserted & irqs;
+    }
+    if (timedOut != nullptr)
+    {
+        *timedOut = (NiFpga_Bool) (gotIrqs == false);
+    }
+    return NiFpga_Status_Success;
+}
+
+NiFpga_Status NiFpga_AcknowledgeIrqs (NiFpga_Session session, uint32_t irqs)
+{
+    simulateCall (gWriteLatencyNs.load (std::memory_order_relaxed));
+
+    std::lock_guard<std::mutex> lock (gMutex);
+    if (isSessionValid (session) == false)
+    {
+        return NiFpga_Status_InvalidSession;
+    }
+
+    gIrqsAsserted &= ~irqs;
+    return NiFpga_Status_Success;
+}
@@ -0,0 +1,197 @@
+/**
+ * Simulated FPGA for running Device Node code on a host without an sbRIO.
+ * SimFpga.cpp implements the subset of the NiFpga C API used by the flight
+ * software against an in-memory model of the IO bitfile, and is linked in
+ * place of NiFpga.c. Nothing else changes: FPGASession, the Devices, the
+ * Device Node loop, the FPGA unit tests and the FPGA profiling scripts all run
+ * unmodified against the simulation.
+ *
+ * The Test_Sim build configuration builds against the simulation. It compiles
+ * fsw/fpga/sim/SimFpga.cpp instead of
+ * "fsw/fpga/generic/FPGA Bitfiles/NiFpga.c", adds fsw/fpga/sim to the include
+ * path, and runs the tests in fsw/tests/src/fpga and fsw/tests/src/sim on the
+ * host. Every other configuration excludes fsw/fpga/sim and fsw/tests/src/sim.
+ * NiFpga.h and NiFpga_IO.h are still used unchanged.
+ *
+ * The model:
+ *
+ *   (1) Analog inputs. Each analog input pin reads a scripted waveform,
+ *       evaluated at the simulation time of the read, clipped to the pin's
+ *       configured range and converted to the pin's fxp type. Pins read 0V
+ *       until scripted.
+ *
+ *   (2) Digital IO. A pin with its output enabled reads back the value it
+ *       drives. An input pin reads the value driven by the output pin it is
+ *       wired to, if any, and otherwise a scripted level.
+ *
+ *   (3) Every other control and indicator is a plain register: reads return
+ *       the last value written, or 0.
+ *
+ *   (4) Latency. Each simulated NiFpga call busy-waits for a configurable
+ *       time, so that benchmarks see the cost of a bus transaction. The
+ *       default is 0.
+ *
+ *   (5) IRQs. IRQs are asserted by assertIrqs or periodically by a simulation
+ *       thread, and are waited on and acknowledged through the NiFpga IRQ
+ *       API.
+ *
+ *   (6) DMA FIFOs. Any FIFO identifier may be configured and started.
+ *       Elements pushed through pushFifo are acquired and released through
+ *       the NiFpga FIFO API.
+ *
+ *   (7) Simulation time is the monotonic clock, unless frozen with setTimeNs
+ *       so that waveforms are deterministic in tests.
+ *
+ * All functions are thread-safe.
+ */
+
+#ifndef SIM_FPGA_HPP
+#define SIM_FPGA_HPP
+
+#include <stdint.h>
+#include <vector>
+
+#include "Errors.hpp"
+#include "NiFpga.h"
+
+namespace SimFpga
+{
+    /**
+     * Analog input waveform shape.
+     */
+    typedef enum : uint8_t
+    {
+        WAVE_CONSTANT, // offset
+        WAVE_SINE,     // offset + amplitude * sin (2 pi f t)
+        WAVE_SQUARE,   // offset +/- amplitude, high for first half period
+        WAVE_RAMP,     // offset - amplitude to offset + amplitude each period
+
+        WAVE_LAST
+    } Wave_t;
+
+    /**
+     * Analog input waveform.
+     */
+    typedef struct
+    {
+        Wave_t wave;       // Shape.
+        float offsetV;     // Mean voltage.
+        float amplitudeV;  // Peak deviation from mean voltage.
+        float freqHz;      // Frequency. Ignored for WAVE_CONSTANT.
+    } Waveform_t;
+
+    /**
+     * Set the waveform read on an analog input pin.
+     *
+     * @param   kPin             Analog input pin number.
+     * @param   kWaveform        Waveform.
+     *
+     * @ret     E_SUCCESS        Waveform set.
+     *          E_OUT_OF_BOUNDS  Pin number out of bounds.
+     *          E_INVALID_ENUM   Invalid wave shape.
+     */
+    Error_t setAnalogIn (uint8_t kPin, const Waveform_t& kWaveform);
+
+    /**
+     * Set the level read on a digital input pin that is not wired to an
+     * output pin.
+     *
+     * @param   kPin             Digital pin number.
+     * @param   kVal             Level.
+     *
+     * @ret     E_SUCCESS        Level set.
+     *          E_OUT_OF_BOUNDS  Pin number out of bounds.
+     */
+    Error_t setDigitalIn (uint8_t kPin, bool kVal);
+
+    /**
+     * Wire a digital input pin to a digital output pin, so that the input pin
+     * reads the value driven by the output pin.
+     *
+     * @param   kInPin           Digital pin read.
+     * @param   kOutPin          Digital pin driven.
+     *
+     * @ret     E_SUCCESS        Pins wired.
+     *          E_OUT_OF_BOUNDS  Pin number out of bounds.
+     */
+    Error_t setLoopback (uint8_t kInPin, uint8_t kOutPin);
+
+    /**
+     * Get the value driven on a digital pin. A pin without its output enabled
+     * drives false.
+     *
+     * @param   kPin             Digital pin number.
+     * @param   kValRet          Value driven.
+     *
+     * @ret     E_SUCCESS        Value returned.
+     *          E_OUT_OF_BOUNDS  Pin number out of bounds.
+     */
+    Error_t getDigitalOut (uint8_t kPin, bool& kValRet);
+
+    /**
+     * Set the time each simulated NiFpga read and write call takes. FIFO and
+     * IRQ calls take the read latency.
+     *
+     * @param   kReadNs   Read latency in ns.
+     * @param   kWriteNs  Write latency in ns.
+     */
+    void setLatencyNs (uint32_t kReadNs, uint32_t kWriteNs);
+
+    /**
+     * Freeze simulation time at kNs. Call again to advance it.
+     *
+     * @param   kNs   Simulation time in ns.
+     */
+    void setTimeNs (uint64_t kNs);
+
+    /**
+     * Unfreeze simulation time so that it follows the monotonic clock again.
+     */
+    void useRealTime ();
+
+    /**
+     * Assert IRQs, waking any thread waiting on one of them.
+     *
+     * @param   kIrqs   Bitmask of IRQs. See NiFpga_Irq.
+     */
+    void assertIrqs (uint32_t kIrqs);
+
+    /**
+     * Assert IRQs every kPeriodNs from a simulation thread, replacing any
+     * previous periodic IRQs. A period of 0 stops them.
+     *
+     * @param   kIrqs                      Bitmask of IRQs. See NiFpga_Irq.
+     * @param   kPeriodNs                  Period in ns.
+     *
+     * @ret     E_SUCCESS                  Periodic IRQs set.
+     *          E_FAILED_TO_CREATE_THREAD  Failed to start simulation thread.
+     */
+    Error_t setPeriodicIrqs (uint32_t kIrqs, uint64_t kPeriodNs);
+
+    /**
+     * Push elements onto a target-to-host FIFO, as the FPGA would.
+     *
+     * @param   kFifo        FIFO identifier.
+     * @param   kElems       Elements to push.
+     *
+     * @ret     E_SUCCESS    Elements pushed.
+     *          E_FPGA_FIFO  FIFO not started, or would overflow.
+     */
+    Error_t pushFifo (uint32_t kFifo, const std::vector<uint32_t>& kElems);
+
+    /**
+     * Get the number of simulated NiFpga calls since the last reset.
+     *
+     * @ret     Number of calls.
+     */
+    uint64_t getNumCalls ();
+
+    /**
+     * Reset the simulation to its initial state: all registers 0, all pins
+     * unscripted and unwired, no FIFOs, no IRQs, no latency, real time. The
+     * FPGA session, if open, stays open.
+     */
+    void reset ();
+}
+
+#endif
@@ -0,0 +1,168 @@
+/**
+ * Device to read a bank of analog input pins together. Each channel is
+ * configured as an AnalogInDevice. Run method reads every channel's pin in one
+ * pass, converts all of them to voltage and then to engineering unit in
+ * batches, and then writes all of the outputs to the Data Vector while holding
+ * its lock once.
+ *
+ * Use this instead of one AnalogInDevice per pin when a Device Node reads many
+ * analog inputs, so that the per-device overhead of reading the FPGA and
+ * locking the Data Vector is paid once per bank instead of once per pin.
+ *
+ * NOTES:
+ *
+ *   (1) The FPGA bitfile exposes each analog input as a separate scalar
+ *       indicator, so the pins are still read with one NiFpga_ReadU32 each.
+ *       The reads are issued back-to-back with a single status check. If the
+ *       bitfile gains an array indicator for the analog inputs, only
+ *       readPins needs to change to read it with NiFpga_ReadArrayU32.
+ *
+ *   (2) Oversampling channels are not supported. See AnalogInDevice.hpp.
+ *
+ *   (3) Conversion is done in stages over flat arrays, one stage per kind of
+ *       work, rather than channel by channel, so that per-channel constants
+ *       are computed once at construction and each stage is a tight loop that
+ *       does not branch on the channel's conversion:
+ *
+ *         a) Every fxp value is converted to voltage with a sign extending
+ *            shift and a multiply by the fxp delta, both precomputed per
+ *            channel. The result is identical to NiFpga_ConvertFromFxpToFloat.
+ *         b) Every polynomial calibration is evaluated at once with Horner's
+ *            method, over coefficients stored term by term across channels
+ *            and zero padded to the highest degree in the bank.
+ *         c) Piecewise-linear calibrations, then transfer functions, are
+ *            evaluated channel by channel.
+ *
+ *       Only signed fxp types of up to 32 bits are supported, which covers
+ *       every analog input in the bitfile.
+ */
+
+#ifndef ANALOG_IN_BANK_DEVICE_HPP
+#define ANALOG_IN_BANK_DEVICE_HPP
+
+#include <memory>
+#include <vector>
+
+#include "AnalogInDevice.hpp"
+
+class AnalogInBankDevice final : public Device
+{
+public:
+    /**
+     * Device configuration. One AnalogInDevice config per channel.
+     */
+    typedef std::vector<AnalogInDevice::Config_t> Config_t;
+
+    /**
+     * Derived device constructor. This must be public so that it is visible to
+     * Device::createNew.
+     *
+     * @param   kSession    Initialized and open FPGA session.
+     * @param   kDataVector Node's Data Vector.
+     * @param   kConfig     Device config.
+     * @param   kRet        E_SUCCESS            Config valid.
+     *                      E_EMPTY_CONFIG       No channels.
+     *                      E_DUPLICATE_PIN      Pin used by more than one
+     *                                           channel.
+     *                      E_INVALID_CONFIG     Channel oversamples, or pin fxp
+     *                                           type not supported. See note
+     *                                           (3) at the top of this file.
+     *                      [other]              Channel config invalid. See
+     *                                           AnalogInDevice.hpp.
+     */
+    AnalogInBankDevice (NiFpga_Session& kSession,
+                        std::shared_ptr<DataVector> kPDataVector,
+                        Config_t& kConfig,
+                        Error_t& kRet);
+
+    /**
+     * Validates the bank config. Each channel's config is validated when its
+     * AnalogInDevice is created.
+     *
+     * @param   kConfig              Config to validate.
+     *
+     * @ret     E_SUCCESS            Config valid.
+     *          E_EMPTY_CONFIG       No channels.
+     *          E_DUPLICATE_PIN      Pin used by more than one channel.
+     *          E_INVALID_CONFIG     Channel oversamples.
+     */
+    Error_t verifyConfig (Config_t& kConfig);
+
+    /**
+     * Reads every channel's input voltage, converts each to engineering unit,
+     * and writes all of them to the DV.
+     *
+     * @ret     E_SUCCESS           Run succeeded.
+     *          E_FPGA_READ         Failed to read from FPGA.
+     *          E_DATA_VECTOR_WRITE Failed to write to DV.
+     *          [other]             Error generated by transfer function.
+     */
+    Error_t run ();
+
+private:
+    /**
+     * Channels. Used for their pin and conversion config.
+     */
+    std::vector<std::unique_ptr<AnalogInDevice>> mPChannels;
+
+    /**
+     * Raw fxp value read from each channel's pin.
+     */
+    std::vector<uint32_t> mFxpVals;
+
+    /**
+     * Each channel's shift to sign extend its fxp value from the fxp word
+     * length to 32 bits, and the voltage of one fxp count.
+     */
+    std::vector<uint32_t> mFxpShifts;
+    std::vector<float> mFxpDeltas;
+
+    /**
+     * Every channel's voltage, followed by every channel's engineering unit.
+     * Sized on construction so that the bindings to them stay valid.
+     */
+    std::vector<float> mOutputs;
+
+    /**
+     * Channels with a polynomial calibration, and their coefficients stored
+     * term by term: coefficient k of polynomial channel j is at
+     * mPolyCoeffs[k * mPolyChannels.size () + j].
+     */
+    std::vector<uint32_t> mPolyChannels;
+    std::vector<float> mPolyCoeffs;
+    uint32_t mPolyNumCoeffs;
+
+    /**
+     * Voltages and engineering units of the polynomial channels, gathered from
+     * and scattered to mOutputs so that they are contiguous.
+     */
+    std::vector<float> mPolyVolts;
+    std::vector<float> mPolyEngr;
+
+    /**
+     * Channels with a piecewise-linear calibration, and channels with a
+     * transfer function.
+     */
+    std::vector<uint32_t> mTableChannels;
+    std::vector<uint32_t> mFuncChannels;
+
+    /**
+     * Bindings from each channel's output elems to mOutputs.
+     */
+    std::vector<DataVector::ElementBinding_t> mOutputBindings;
+
+    /**
+     * Read every channel's pin into mFxpVals.
+     *
+     * @ret     E_SUCCESS    Pins read.
+     *          E_FPGA_READ  Failed to read from FPGA.
+     */
+    Error_t readPins ();
+
+    /**
+     * Evaluate every polynomial calibration.
+     */
+    void evaluatePolynomials ();
+};
+
+#endif
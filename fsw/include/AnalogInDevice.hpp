@@ -2,8 +2,8 @@
  * Device to control an analog input pin. Constructor configures the input mode
  * (RSE vs. differential) and input range (+/- 10V, 5V, 2V, or 1V) of the pin.
  * Run method reads the voltage on the pin, converts this voltage to an
- * engineering unit with the device's transfer function, and then writes this
- * voltage and engineering unit to the Data Vector.
+ * engineering unit with the device's calibration or transfer function, and
+ * then writes this voltage and engineering unit to the Data Vector.
  *
  * NOTES:
  *
@@ -15,16 +15,47 @@
  *
  *   (2) In a static test setting with minimal EMI, AnalogInDevice voltage
  *       measurements were accurate to around +/- 0.005V.
+ *
+ *   (3) If oversampleRingSize is non-zero, the device oversamples. Each call to
+ *       sample reads one raw sample into a preallocated ring, and each run
+ *       drains the ring and writes the mean voltage (and its engineering unit),
+ *       min and max voltage, and number of samples to the Data Vector. This 
+ *       reduces noise without sending more data over the network. sample is
+ *       called by the Device Node's fast loop, so oversampling requires it to
+ *       be enabled, and the number of samples per run is the fast loop 
+ *       multiple times the device's rate divisor. The Device Node grows the 
+ *       ring to fit them with reserveSamples, so oversampleRingSize is a 
+ *       minimum. sample and run may be called from different threads, but 
+ *       each from only one. If no samples were taken since the last run, run
+ *       takes one itself. If the ring is full, new samples are dropped until 
+ *       the next run.
+ *
+ *   (4) The engineering unit conversion is either declared in the config as a
+ *       calibration (see Calibration.hpp) or given as a transfer function. A
+ *       calibration is preferred: AnalogInBankDevice evaluates calibrations
+ *       for all of its channels in one pass, but must call transfer functions
+ *       one channel at a time. If the calibration type is not CAL_NONE, it is
+ *       used and pTransferFunc may be null.
  */
 
 #ifndef ANALOG_IN_DEVICE_HPP
 #define ANALOG_IN_DEVICE_HPP
 
+#include <atomic>
+#include <vector>
+
+#include "Calibration.hpp"
 #include "Device.hpp"
 #include "NiFpga_IO.h"
 
 class AnalogInDevice final : public Device
 {
+    /**
+     * Reads the pins of several AnalogInDevices in one pass. See 
+     * AnalogInBankDevice.hpp.
+     */
+    friend class AnalogInBankDevice;
+
 public:
     /**
      * Function for converting voltage to engineering unit.
@@ -70,7 +101,10 @@ public:
     static const uint8_t MAX_PIN_NUMBER;
 
     /**
-     * Device configuration.
+     * Device configuration. The oversampling fields are only used if 
+     * oversampleRingSize is non-zero. See note (3) at the top of this file.
+     * The calibration is used instead of the transfer function unless its type
+     * is CAL_NONE. See note (4) at the top of this file.
      */
     typedef struct
     {
@@ -80,6 +114,13 @@ public:
         TransferFunc_t* pTransferFunc;         // Voltage -> engr unit func.
         Range_t range;                         // Input voltage range.
         Mode_t mode;                           // Differential or RSE.
+        uint32_t oversampleRingSize;           // Power of 2, or 0 to disable.
+        DataVectorElement_t dvElemOutputMin;   // Elem to write min volts to.
+        DataVectorElement_t dvElemOutputMax;   // Elem to write max volts to.
+        DataVectorElement_t dvElemNumSamples;  // Elem to write sample count 
+                                               // to (uint32_t).
+        Calibration::Config_t calibration;     // Voltage -> engr unit 
+                                               // calibration.
     } Config_t;
 
     /**
@@ -94,11 +135,16 @@ public:
      *                      E_INVALID_ENUM       Invalid range or mode.
      *                      E_INVALID_ELEM       Output elems not in DV or wrong
      *                                           type.
-     *                      E_INVALID_POINTER    Null transfer func pointer.
+     *                      E_INVALID_POINTER    Null transfer func pointer
+     *                                           and no calibration.
+     *                      [other]              Calibration invalid. See
+     *                                           Calibration.hpp.
      *                      E_FPGA_WRITE         Failed to configure pin.
      *                      E_PIN_NOT_CONFIGURED Differential mode is only for
      *                                           devices on pins < 8. See note
      *                                           (1) at the top of this file.
+     *                      E_INCORRECT_SIZE     Oversample ring size not a 
+     *                                           power of 2.
      */
     AnalogInDevice (NiFpga_Session& kSession,
                     std::shared_ptr<DataVector> kPDataVector,
@@ -114,15 +160,19 @@ public:
      *          E_OUT_OF_BOUNDS      Pin number out of bounds.
      *          E_INVALID_ENUM       Invalid range or mode.
      *          E_INVALID_ELEM       Output elems not in DV or wrong type.
-     *          E_INVALID_POINTER    Null transfer func pointer.
+     *          E_INVALID_POINTER    Null transfer func pointer and no
+     *                               calibration.
+     *          [other]              Calibration invalid. See Calibration.hpp.
      *          E_PIN_NOT_CONFIGURED Differential mode is only for pins < 8.
      *                               See note (1) at the top of this file.
+     *          E_INCORRECT_SIZE     Oversample ring size not a power of 2.
      */
     Error_t verifyConfig (Config_t& kConfig);
     
     /**
      * Reads input voltage, converts to engineering unit, and writes
-     * engineering unit to DV.
+     * engineering unit to DV. If oversampling, instead aggregates the samples
+     * taken since the last run. See note (3) at the top of this file.
      *
      * @ret     E_SUCCESS           Run succeeded.
      *          E_FPGA_READ         Failed to read from FPGA.
@@ -131,6 +181,24 @@ public:
      */
     Error_t run ();
 
+    /**
+     * If oversampling, reads one sample into the ring. Otherwise does nothing.
+     *
+     * @ret     E_SUCCESS           Sample taken.
+     *          E_FPGA_READ         Failed to read from FPGA.
+     *          E_SAMPLE_RING_FULL  Ring full. Sample dropped.
+     */
+    Error_t sample ();
+
+    /**
+     * If oversampling, grow the ring to the next power of 2 that holds at 
+     * least kNumSamples samples. Samples not yet aggregated are dropped, so 
+     * call this before sampling starts.
+     *
+     * @param   kNumSamples   Max number of samples taken between runs.
+     */
+    void reserveSamples (uint32_t kNumSamples);
+
 private:
     /**
      * DV element to which device output in volts is written.
@@ -147,6 +215,12 @@ private:
      */
     TransferFunc_t* mPTransferFunc;
 
+    /**
+     * Calibration for converting voltage to engineering unit. Used instead of
+     * the transfer function unless its type is CAL_NONE.
+     */
+    Calibration::Config_t mCalibration;
+
     /**
      * Pin fxp resource identifier.
      */
@@ -156,6 +230,71 @@ private:
      * Pin fxp type info identifier.
      */
     NiFpga_FxpTypeInfo mFxpTypeInfoId;
+
+    /**
+     * DV elements to which oversampling stats are written.
+     */
+    DataVectorElement_t mDvElemOutputMin;
+    DataVectorElement_t mDvElemOutputMax;
+    DataVectorElement_t mDvElemNumSamples;
+
+    /**
+     * Ring of raw fxp samples taken since the last run. Empty if not 
+     * oversampling. Its size is a power of 2 so that the free-running indices
+     * below can be masked into it across wraparound.
+     */
+    std::vector<uint32_t> mRing;
+
+    /**
+     * Number of samples written to and read from the ring. Written only by 
+     * sample and run, respectively.
+     */
+    std::atomic<uint32_t> mRingHead;
+    std::atomic<uint32_t> mRingTail;
+
+    /**
+     * Read the pin's raw fxp value.
+     *
+     * @param   kFxpValRet   Raw fxp value.
+     *
+     * @ret     E_SUCCESS    Value read.
+     *          E_FPGA_READ  Failed to read from FPGA.
+     */
+    Error_t readFxp (uint32_t& kFxpValRet);
+
+    /**
+     * Convert a voltage to engineering unit with the calibration or transfer
+     * function.
+     *
+     * @param   kVoltage   Voltage.
+     * @param   kEngrRet   Engineering unit.
+     *
+     * @ret     E_SUCCESS  Voltage converted.
+     *          [other]    Error generated by transfer function.
+     */
+    Error_t convert (float kVoltage, float& kEngrRet);
+
+    /**
+     * Convert a voltage to engineering unit and write both to the DV.
+     *
+     * @param   kVoltage            Voltage.
+     *
+     * @ret     E_SUCCESS           Values written.
+     *          E_DATA_VECTOR_WRITE Failed to write to DV.
+     *          [other]             Error generated by transfer function.
+     */
+    Error_t writeOutput (float kVoltage);
+
+    /**
+     * Drain the ring and write the mean, min, and max voltage and the number
+     * of samples to the DV.
+     *
+     * @ret     E_SUCCESS           Run succeeded.
+     *          E_FPGA_READ         Failed to read from FPGA.
+     *          E_DATA_VECTOR_WRITE Failed to write to DV.
+     *          [other]             Error generated by transfer function.
+     */
+    Error_t runOversampled ();
 };
 
 #endif
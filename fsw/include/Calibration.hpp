@@ -0,0 +1,72 @@
+/**
+ * Calibrations for converting a sensor voltage to an engineering unit. A
+ * calibration is declared in a device's config as data, either polynomial
+ * coefficients or a piecewise-linear table, so that devices can convert many
+ * channels in one pass. See AnalogInBankDevice.hpp.
+ *
+ * NOTICE: evaluate does not use the Error Handling Framework. The config must
+ * first be checked with verifyConfig. See the guidelines in GNCUtils.hpp.
+ */
+
+#ifndef CALIBRATION_HPP
+#define CALIBRATION_HPP
+
+#include <stdint.h>
+#include <vector>
+
+#include "Errors.hpp"
+
+namespace Calibration
+{
+    /**
+     * Calibration type.
+     */
+    typedef enum : uint8_t
+    {
+        CAL_NONE,             // No calibration.
+        CAL_POLYNOMIAL,       // c0 + c1 v + c2 v^2 + ...
+        CAL_PIECEWISE_LINEAR, // Linear interpolation between table points.
+
+        CAL_LAST
+    } Type_t;
+
+    /**
+     * Calibration config. Only the fields used by the type need be set.
+     */
+    typedef struct
+    {
+        Type_t type;                   // Calibration type.
+        std::vector<float> coeffs;     // Polynomial coefficients, constant
+                                       // term first.
+        std::vector<float> pointsV;    // Table voltages, strictly increasing.
+        std::vector<float> pointsEngr; // Table engr unit at each voltage.
+    } Config_t;
+
+    /**
+     * Validates a calibration config.
+     *
+     * @param   kConfig             Config to validate.
+     *
+     * @ret     E_SUCCESS           Config valid.
+     *          E_INVALID_ENUM      Invalid type.
+     *          E_EMPTY_CONFIG      Polynomial without coefficients, or table
+     *                              with fewer than 2 points.
+     *          E_INCORRECT_SIZE    Table voltage and engr unit counts differ.
+     *          E_INVALID_CONFIG    Table voltages not strictly increasing.
+     */
+    Error_t verifyConfig (const Config_t& kConfig);
+
+    /**
+     * Converts a voltage to engineering unit. A table is extrapolated beyond
+     * its first and last points along its first and last segments. A config
+     * of type CAL_NONE returns the voltage.
+     *
+     * @param   kConfig   Verified config.
+     * @param   kV        Voltage.
+     *
+     * @ret     Engineering unit.
+     */
+    float evaluate (const Config_t& kConfig, float kV);
+}
+
+#endif
@@ -8,7 +8,7 @@
  * 
  *
  * The current implementation follows the Platform v1 design, with the
- * following network configuration:
+ * following default network configuration:
  *
  *                       Device Node 0
  *                         /
@@ -18,21 +18,21 @@
  *                         \
  *                       Device Node 2
  *
- * Every loop, the Control Node sends out the following data:
+ * The set of Device Nodes is configurable (see DeviceNodeConfig_t), up to the 
+ * number of Device Nodes in Node_t. Every loop, the Control Node sends out the
+ * following data:
  *
- *     1) A copy of DV_REG_CN_TO_DN0 to Device Node 0
- *     2) A copy of DV_REG_CN_TO_DN1 to Device Node 1
- *     3) A copy of DV_REG_CN_TO_DN2 to Device Node 2
- *     4) A copy of the entire Data Vector to Ground
+ *     1) A copy of DV_REG_CN_TO_DNx to each Device Node x
+ *     2) A copy of the entire Data Vector to Ground
  *
  * And attempts to receive the following data:
  *
- *     1) A copy of DV_REG_DN0_TO_CN from Device Node 0
- *     2) A copy of DV_REG_DN1_TO_CN from Device Node 1
- *     3) A copy of DV_REG_DN2_TO_CN from Device Node 2
- *     4) A copy of DV_REG_GND_TO_CN fom Ground
+ *     1) A copy of DV_REG_DNx_TO_CN from each Device Node x
+ *     2) A copy of DV_REG_GND_TO_CN fom Ground
  *
- * The Network Manager configuration MUST include these 5 nodes and 4 channels.
+ * The Network Manager configuration MUST include the Control Node, each 
+ * configured Device Node, and Ground, and a channel between the Control Node 
+ * and each other node.
  *
  *
  *            ---- REQUIRED DATA VECTOR REGIONS & ELEMENTS ----
@@ -45,17 +45,11 @@
  *           DV_ELEM_CN_TIME_NS
  *           DV_ELEM_CN_LOOP_COUNT
  *           DV_ELEM_CN_ERROR_COUNT
- *           DV_ELEM_DN0_RX_MISS_COUNT
- *           DV_ELEM_DN1_RX_MISS_COUNT
- *           DV_ELEM_DN2_RX_MISS_COUNT
+ *           DV_ELEM_DNx_RX_MISS_COUNT  (for each Device Node x)
  *           DV_ELEM_CN_LOOP_DEADLINE_MISS_COUNT
  *           DV_ELEM_CN_COMMS_DEADLINE_MISS_COUNT
- *       DV_REG_CN_TO_DN0
- *       DV_REG_CN_TO_DN1
- *       DV_REG_CN_TO_DN2
- *       DV_REG_DN0_TO_CN
- *       DV_REG_DN1_TO_CN
- *       DV_REG_DN2_TO_CN
+ *       DV_REG_CN_TO_DNx                   (for each Device Node x)
+ *       DV_REG_DNx_TO_CN                   (for each Device Node x)
  *       DV_REG_GND_TO_CN
  *
  *
@@ -73,7 +67,69 @@
  *        caller.
  *
  *     #3 The loop thread is run on CPU 1 to avoid being interrupted by the 
- *        kernel's Ethernet thread, which runs on CPU 0.
+ *        kernel's Ethernet thread, which runs on CPU 0. In 
+ *        COMMS_MODE_DEDICATED_THREAD, the comms thread runs on CPU 0.
+ *
+ *     #4 By default the communications step ends as soon as all Device Nodes 
+ *        have reported, giving the rest of the comms time slice to the State
+ *        Machine and Controllers. Set Options_t::commsMode to 
+ *        COMMS_MODE_FIXED_SLICE to instead always consume the full slice.
+ *
+ *     #5 Without same-frame actuation, Controller outputs in DV_REG_CN_TO_DNx 
+ *        are not sent until the next loop's communications step, adding a full
+ *        loop period to every sensor to actuator path. With same-frame 
+ *        actuation enabled, the regions are sent again right after the 
+ *        Controllers run and the Device Nodes run their actuators on receipt.
+ *
+ *     #6 If the Data Vector contains the DV_ELEM_CN_<phase>_{WALL,CPU}_*_NS 
+ *        elements, each loop phase (comms, Command Handler, State Machine, 
+ *        Controllers, same-frame actuation, and the full loop) and each of the
+ *        first 4 Controllers is timed with the Phase Profiler and the stats are
+ *        written to those elements.
+ *
+ *     #7 If the Data Vector contains the DV_ELEM_CN_LOOP_{JITTER,EXEC,
+ *        RESPONSE}_{MAX,P99}_NS elements, the loop thread's release jitter,
+ *        execution time, and response time recorded by the Thread Manager are
+ *        written to those elements every LOOP_THREAD_STATS_WRITE_PERIOD loops.
+ *
+ *     #8 Controllers are run at the rate set with Controller::setRate, which
+ *        defaults to every loop. See RateGroupExecutive.hpp. If the Data 
+ *        Vector contains DV_ELEM_CN_OVERRUN_RATE_DIVISOR, on each loop 
+ *        deadline miss the divisor of the rate group that took the most time 
+ *        in that loop is written to it (0 if no Controller ran).
+ *
+ *     #9 Before the loop starts, all memory is locked in RAM and prefaulted 
+ *        (see MemoryManager.hpp). If the Data Vector contains the 
+ *        DV_ELEM_CN_{MINOR,MAJOR}_PAGE_FAULT_COUNT elements, the number of 
+ *        page faults the process has taken since the first loop is written to
+ *        them whenever it changes. Any non-zero count indicates memory that 
+ *        was not prefaulted.
+ *
+ *    #10 The overrun policy sets what the loop does after a deadline miss. See
+ *        OverrunPolicy_t. With OVERRUN_POLICY_DEGRADE, each loop after a miss
+ *        skips the Controllers marked low priority (see 
+ *        Controller::setLowPriority) and the Ground link, until 
+ *        DEGRADE_RECOVERY_FRAMES consecutive loops finish within 
+ *        DEGRADE_RECOVERY_LOOP_TIME_NS. Commands from Ground are not received
+ *        while degraded. If the Data Vector contains 
+ *        DV_ELEM_CN_DEGRADED_LOOP_COUNT, it is incremented each degraded loop.
+ *
+ *    #11 With parallel Controllers enabled, the Controllers are run level by
+ *        level as ordered by the Controller Graph (see ControllerGraph.hpp), 
+ *        using the Data Vector elements each declared in 
+ *        Controller::createNew. The Controllers scheduled in a level run in 
+ *        parallel on the loop thread and the Task Pool's workers, and their
+ *        errors and times are then recorded in Controller order. A level with
+ *        one scheduled Controller runs it on the loop thread. Controllers run
+ *        by a worker are timed on the worker, and the loop thread records 
+ *        their samples in the Phase Profiler.
+ *
+ *    #12 If the Data Vector contains DV_ELEM_CN_TO_DNx_FRAME, it is 
+ *        incremented each loop before DV_REG_CN_TO_DNx is sent, so that a 
+ *        time-triggered Device Node can discard stale messages. If it 
+ *        contains DV_ELEM_CN_TO_DNx_ACTUATION_MSG, it is set to true in the
+ *        same-frame actuation message and false otherwise, so that Device 
+ *        Nodes can tell the two messages apart.
  */
 
 #ifndef CONTROL_NODE_HPP
@@ -89,9 +145,95 @@
 #include "CommandHandler.hpp"
 #include "StateMachine.hpp"
 #include "Controller.hpp"
+#include "ControllerGraph.hpp"
+#include "PhaseProfiler.hpp"
+#include "RateGroupExecutive.hpp"
+#include "MemoryManager.hpp"
+#include "TaskPool.hpp"
 
 namespace ControlNode
 {
+    /**
+     * Communications step timing modes.
+     *
+     *   COMMS_MODE_EARLY_EXIT   The communications step ends as soon as every
+     *                           Device Node has reported (or the comms time 
+     *                           slice expires). The remainder of the slice is
+     *                           given to the Command Handler, State Machine, 
+     *                           and Controllers.
+     *   COMMS_MODE_FIXED_SLICE  The communications step always consumes the 
+     *                           full comms time slice, spinning until the 
+     *                           deadline if all data arrived early. Use for 
+     *                           strict time-triggered determinism of when the 
+     *                           State Machine and Controllers run.
+     *   COMMS_MODE_DEDICATED_THREAD
+     *                           Network send and receive run on a separate 
+     *                           comms thread on CPU 0. The loop thread and 
+     *                           comms thread exchange data through two sets of
+     *                           buffers swapped at each frame boundary, so the
+     *                           loop has nearly the full period for control 
+     *                           logic. Device Node data received during frame 
+     *                           N is used by the Controllers in frame N + 1.
+     */
+    enum CommsMode_t : uint8_t
+    {
+        COMMS_MODE_EARLY_EXIT,
+        COMMS_MODE_FIXED_SLICE,
+        COMMS_MODE_DEDICATED_THREAD,
+
+        COMMS_MODE_LAST
+    };
+
+    /**
+     * Loop overrun policies. All policies increment 
+     * DV_ELEM_CN_LOOP_DEADLINE_MISS_COUNT on a deadline miss.
+     *
+     *   OVERRUN_POLICY_SKIP      Skip the loops whose release times passed 
+     *                            during the overrun. 
+     *   OVERRUN_POLICY_CATCH_UP  Run the loops whose release times passed 
+     *                            during the overrun back-to-back. See 
+     *                            ThreadManager::OverrunPolicy_t.
+     *   OVERRUN_POLICY_DEGRADE   Skip as in OVERRUN_POLICY_SKIP, then shed 
+     *                            low priority Controllers and the Ground link
+     *                            until the loop time recovers. See note #10.
+     */
+    enum OverrunPolicy_t : uint8_t
+    {
+        OVERRUN_POLICY_SKIP,
+        OVERRUN_POLICY_CATCH_UP,
+        OVERRUN_POLICY_DEGRADE,
+
+        OVERRUN_POLICY_LAST
+    };
+
+    /**
+     * Device Node specific Data Vector Regions and Elements.
+     *
+     *   node             Device Node.
+     *   cnToDnRegion     Region sent to the Device Node each loop.
+     *   dnToCnRegion     Region received from the Device Node each loop.
+     *   rxMissCountElem  Element incremented when no message is received from
+     *                    the Device Node in a loop.
+     */
+    typedef struct DeviceNodeConfig
+    {
+        Node_t              node;
+        DataVectorRegion_t  cnToDnRegion;
+        DataVectorRegion_t  dnToCnRegion;
+        DataVectorElement_t rxMissCountElem;
+    } DeviceNodeConfig_t;
+
+    /**
+     * Platform v1 Device Nodes (Device Nodes 0, 1, and 2).
+     */
+    extern const std::vector<DeviceNodeConfig_t> PLATFORM_V1_DEVICE_NODES;
+
+    /**
+     * Platform v1 Task Pool config for parallel Controllers. One worker on 
+     * CPU 0, since the loop thread runs on CPU 1.
+     */
+    extern const TaskPool::Config_t PLATFORM_V1_CTRL_POOL;
+
     /**
      * Function pointer type to pass to entry function for initializing 
      * Controllers. 
@@ -106,22 +248,65 @@ namespace ControlNode
                          std::shared_ptr<DataVector> kPDv, 
                          std::vector<std::unique_ptr<Controller>>& kPCtrlsRet);
 
+    /**
+     * Optional Control Node settings. A default constructed Options_t runs the
+     * Platform v1 Device Nodes with every optional feature disabled. Set only 
+     * the fields that differ from the defaults, e.g.
+     *
+     *     ControlNode::Options_t options;
+     *     options.commsMode = ControlNode::COMMS_MODE_DEDICATED_THREAD;
+     *
+     *   commsMode           Communications step timing mode. Default 
+     *                       COMMS_MODE_EARLY_EXIT.
+     *   sameFrameActuation  If true, send DV_REG_CN_TO_DNx to the Device Nodes
+     *                       a second time each loop, right after the 
+     *                       Controllers run. The Device Nodes must also be 
+     *                       started with same-frame actuation enabled. Default
+     *                       false.
+     *   deviceNodes         Device Nodes to communicate with each loop. Must 
+     *                       be non-empty and contain no duplicate nodes, 
+     *                       regions, or elements. Default 
+     *                       PLATFORM_V1_DEVICE_NODES.
+     *   hugePageDv          If true, advise the kernel to back the Data Vector
+     *                       with huge pages. Default false.
+     *   overrunPolicy       What the loop does after a deadline miss. Default
+     *                       OVERRUN_POLICY_SKIP.
+     *   parallelCtrls       If true, run independent Controllers in parallel. 
+     *                       See note #11. Default false.
+     *   ctrlPoolConfig      Worker CPUs and priority of the Task Pool used to 
+     *                       run Controllers in parallel. Default 
+     *                       PLATFORM_V1_CTRL_POOL.
+     */
+    typedef struct Options
+    {
+        CommsMode_t                     commsMode = COMMS_MODE_EARLY_EXIT;
+        bool                            sameFrameActuation = false;
+        std::vector<DeviceNodeConfig_t> deviceNodes = PLATFORM_V1_DEVICE_NODES;
+        bool                            hugePageDv = false;
+        OverrunPolicy_t                 overrunPolicy = OVERRUN_POLICY_SKIP;
+        bool                            parallelCtrls = false;
+        TaskPool::Config_t              ctrlPoolConfig = PLATFORM_V1_CTRL_POOL;
+    } Options_t;
+
     /**
      * Entry point for the Control Node. Initializes all software components and 
      * begins periodic loop. Exits program on failure and does not return on
      * success.
      *
-     * @param  kNmConfig          Network Manager config.
-     * @param  kDvConfig          Data Vector config.
-     * @param  kChConfig          Command Handler config.
-     * @param  kSmConfig          State Machine config.
-     * @param  kFInitControllers  Function pointer to controller init function.
+     * @param  kNmConfig            Network Manager config.
+     * @param  kDvConfig            Data Vector config.
+     * @param  kChConfig            Command Handler config.
+     * @param  kSmConfig            State Machine config.
+     * @param  kFInitControllers    Function pointer to controller init 
+     *                              function.
+     * @param  kOptions             Optional settings. See Options_t.
      */
     void entry (NetworkManager::Config_t kNmConfig, 
                 DataVector::Config_t     kDvConfig,
                 CommandHandler::Config_t kChConfig,
                 StateMachine::Config_t   kSmConfig,
-                fInitializeControllers_t kFInitControllers);
+                fInitializeControllers_t kFInitControllers,
+                Options_t                kOptions = Options_t ());
 
 };
 
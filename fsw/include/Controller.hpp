@@ -3,9 +3,11 @@
 
 #include <stdint.h>
 #include <memory>
+#include <vector>
 
 #include "DataVector.hpp"
 #include "Errors.hpp"
+#include "RateGroupExecutive.hpp"
 
 /**
  * Base controller class for implementing high-level controllers on the rocket
@@ -19,6 +21,15 @@
  *    YourController on initialization.
  * 3. Implement the constructor,  runEnabled, runSafed, and verifyConfig 
  *    methods.
+ * 4. Optionally implement bindIo to bind the Data Vector elements the 
+ *    controller reads and writes to member fields using bindInput and 
+ *    bindOutput. If any element is bound, run reads the mode and every input
+ *    from the Data Vector in one locked pass before runEnabled or runSafed,
+ *    and writes every output in one locked pass after, instead of the 
+ *    controller reading and writing elements one at a time. Inputs are then
+ *    a consistent snapshot. Outputs are only written if runEnabled or 
+ *    runSafed succeeds, and are written every run, so output fields must 
+ *    always hold the value to write.
  *
  * See TestController in the tests directory for an example.
  *
@@ -32,7 +43,19 @@
  *       config is validated before the controller is used.
  *
  * 2. Set the controller's mode (ENABLED or SAFED) using setMode.
- * 3. Call YourController->run () for each loop of your main periodic thread.
+ * 3. Optionally set the controller's rate using setRate. By default, the 
+ *    Control and Device Nodes run a controller every loop. Optionally mark
+ *    the controller independent using setIndependent to allow the Device 
+ *    Node to run it in parallel. Optionally mark the controller low priority
+ *    using setLowPriority to allow the Control Node to shed it when 
+ *    overloaded. Optionally mark the controller fast loop using setFastLoop
+ *    to have the Device Node run it at a multiple of the loop rate.
+ *
+ *       Note: To allow the Control Node to run the controller in parallel 
+ *       with other Controllers, pass the Data Vector elements it reads and 
+ *       writes to createNew. See ControllerGraph.hpp.
+ *
+ * 4. Call YourController->run () for each loop of your main periodic thread.
  *
  */
 
@@ -70,18 +93,29 @@ class Controller
          * @param   kDvModeElem         Data Vector element to read to 
          *                              determine controller's mode.
          * @param   kPControllerRet     Pointer to return controller.
+         * @param   kInputs             Data Vector elements the controller 
+         *                              reads. The mode element is added. 
+         *                              Optional.
+         * @param   kOutputs            Data Vector elements the controller 
+         *                              writes. Optional. If neither kInputs 
+         *                              nor kOutputs is passed, the controller
+         *                              is treated as reading and writing every
+         *                              element.
          *
          * @ret    E_SUCCESS            Controller successfully created.
          *         E_DATA_VECTOR_NULL   Data Vector ptr null.
-         *         E_INVALID_ELEM       Invalid DV mode elem.
+         *         E_INVALID_ELEM       Invalid DV mode, input, or output elem.
          *         [other]              Initialization or validation error 
          *                              returned by controller.
         */
         template <class T_Controller, class T_Config>
-        static Error_t createNew (T_Config kConfig,
-                                  std::shared_ptr<DataVector> kPDataVector,
-                                  DataVectorElement_t kDvModeElem,
-                                  std::unique_ptr<T_Controller>& kPControllerRet)
+        static Error_t createNew (
+                        T_Config kConfig,
+                        std::shared_ptr<DataVector> kPDataVector,
+                        DataVectorElement_t kDvModeElem,
+                        std::unique_ptr<T_Controller>& kPControllerRet,
+                        const std::vector<DataVectorElement_t>& kInputs = {},
+                        const std::vector<DataVectorElement_t>& kOutputs = {})
         {
             Error_t ret = E_SUCCESS;
 
@@ -95,10 +129,33 @@ class Controller
                 return E_INVALID_ELEM;
             }
 
+            // Verify declared inputs and outputs.
+            for (const std::vector<DataVectorElement_t>* pElems : 
+                     {&kInputs, &kOutputs})
+            {
+                for (DataVectorElement_t elem : *pElems)
+                {
+                    if (kPDataVector->elementExists (elem) != E_SUCCESS)
+                    {
+                        return E_INVALID_ELEM;
+                    }
+                }
+            }
+
             // Create controller.
             kPControllerRet.reset (new T_Controller (kConfig, kPDataVector, 
                                                      kDvModeElem));
 
+            // Store declared inputs and outputs.
+            if (kInputs.empty () == false || kOutputs.empty () == false)
+            {
+                Controller* pController = kPControllerRet.get ();
+                pController->mIoDeclared = true;
+                pController->mInputs = kInputs;
+                pController->mInputs.push_back (kDvModeElem);
+                pController->mOutputs = kOutputs;
+            }
+
             // Verify kConfig.
             ret = kPControllerRet->verifyConfig ();
             if (ret != E_SUCCESS)
@@ -108,15 +165,28 @@ class Controller
                 return ret;
             }
 
+            // Bind inputs and outputs.
+            ret = static_cast<Controller*> (kPControllerRet.get ())
+                      ->initBindings ();
+            if (ret != E_SUCCESS)
+            {
+                // Free controller.
+                kPControllerRet.reset (nullptr);
+                return ret;
+            }
+
             return E_SUCCESS;
         }
 
         /**
-         * Run controller logic once.
+         * Run controller logic once. If the controller bound any elements, 
+         * first reads the mode and inputs and then writes the outputs.
          *
          * @ret     E_SUCCESS           Controller ran successfully.
-         *          E_DATA_VECTOR_READ  Failed to read controller's mode from 
-         *                              Data Vector.
+         *          E_DATA_VECTOR_READ  Failed to read controller's mode or
+         *                              inputs from Data Vector.
+         *          E_DATA_VECTOR_WRITE Failed to write controller's outputs
+         *                              to Data Vector.
          *          E_INVALID_ENUM      Invalid mode.
          *          [other]             Error returned by controller.
          */
@@ -134,6 +204,99 @@ class Controller
          */
         Error_t getMode (Mode_t& modeRet);
 
+        /**
+         * Set the rate the Control or Device Node loop runs this controller 
+         * at. The rate is validated when the node's Rate Group Executive is
+         * created. See RateGroupExecutive.hpp.
+         *
+         * @param    kRate    Rate.
+         */
+        void setRate (RateGroupExecutive::Rate_t kRate);
+
+        /**
+         * Get the rate the Control or Device Node loop runs this controller 
+         * at.
+         *
+         * @ret      Rate.
+         */
+        RateGroupExecutive::Rate_t getRate ();
+
+        /**
+         * Mark whether this controller is independent of the other 
+         * Controllers on its node, i.e. it does not read Data Vector elements
+         * they write and they do not read elements it writes. The Device Node
+         * may run independent Controllers in parallel. See TaskPool.hpp.
+         *
+         * @param    kIndependent    True if independent.
+         */
+        void setIndependent (bool kIndependent);
+
+        /**
+         * Check whether this controller is independent of the other
+         * Controllers on its node.
+         *
+         * @ret      True if independent.
+         */
+        bool isIndependent ();
+
+        /**
+         * Mark whether this controller is low priority. With 
+         * OVERRUN_POLICY_DEGRADE, the Control Node stops running low priority
+         * Controllers after a loop deadline miss until the loop recovers. See
+         * ControlNode.hpp.
+         *
+         * @param    kLowPriority    True if low priority.
+         */
+        void setLowPriority (bool kLowPriority);
+
+        /**
+         * Check whether this controller is low priority.
+         *
+         * @ret      True if low priority.
+         */
+        bool isLowPriority ();
+
+        /**
+         * Mark whether the Device Node runs this controller in its fast loop 
+         * instead of its comms loop. Ignored by the Control Node. See 
+         * DeviceNode.hpp.
+         *
+         * @param    kFastLoop    True if run in the fast loop.
+         */
+        void setFastLoop (bool kFastLoop);
+
+        /**
+         * Check whether the Device Node runs this controller in its fast 
+         * loop.
+         *
+         * @ret      True if run in the fast loop.
+         */
+        bool isFastLoop ();
+
+        /**
+         * Check whether the Data Vector elements this controller reads and
+         * writes were declared in createNew.
+         *
+         * @ret      True if declared.
+         */
+        bool isIoDeclared ();
+
+        /**
+         * Get the Data Vector elements this controller reads, including its
+         * mode element. Empty if not declared.
+         *
+         * @ret      Input elements.
+         */
+        const std::vector<DataVectorElement_t>& getInputs ();
+
+        /**
+         * Get the Data Vector elements this controller writes. Empty if not 
+         * declared.
+         *
+         * @ret      Output elements.
+         */
+        const std::vector<DataVectorElement_t>& getOutputs ();
+
         /**
          * Verify config.
          *
@@ -161,6 +324,60 @@ class Controller
         Controller (std::shared_ptr<DataVector> kPDataVector, 
                     DataVectorElement_t kDvModeElem);
 
+        /**
+         * Bind an element the controller reads to a member field. Should only
+         * be called from bindIo. Defined in the header so that the 
+         * templatized functions do not need to each be instantiated 
+         * explicitly.
+         *
+         * @param   kElem               Element to bind.
+         * @param   kValue              Field to bind element to.
+         *
+         * @ret     E_SUCCESS           Element bound.
+         *          [other]             Error returned by DataVector::bind.
+         */
+        template <class Elem_T>
+        Error_t bindInput (DataVectorElement_t kElem, Elem_T& kValue)
+        {
+            DataVector::ElementBinding_t binding;
+            Error_t ret = mPDataVector->bind (kElem, kValue, binding);
+            if (ret != E_SUCCESS)
+            {
+                return ret;
+            }
+
+            mInputBindings.push_back (binding);
+
+            return E_SUCCESS;
+        }
+
+        /**
+         * Bind an element the controller writes to a member field. Should 
+         * only be called from bindIo. Defined in the header so that the 
+         * templatized functions do not need to each be instantiated 
+         * explicitly.
+         *
+         * @param   kElem               Element to bind.
+         * @param   kValue              Field to bind element to.
+         *
+         * @ret     E_SUCCESS           Element bound.
+         *          [other]             Error returned by DataVector::bind.
+         */
+        template <class Elem_T>
+        Error_t bindOutput (DataVectorElement_t kElem, Elem_T& kValue)
+        {
+            DataVector::ElementBinding_t binding;
+            Error_t ret = mPDataVector->bind (kElem, kValue, binding);
+            if (ret != E_SUCCESS)
+            {
+                return ret;
+            }
+
+            mOutputBindings.push_back (binding);
+
+            return E_SUCCESS;
+        }
+
     private:
 
         /**
@@ -168,6 +385,57 @@ class Controller
          */
         DataVectorElement_t mDvModeElem;
 
+        /**
+         * Rate to run controller at.
+         */
+        RateGroupExecutive::Rate_t mRate;
+
+        /**
+         * True if controller can run in parallel with other Controllers.
+         */
+        bool mIndependent;
+
+        /**
+         * True if controller can be shed when the Control Node is overloaded.
+         */
+        bool mLowPriority;
+
+        /**
+         * True if controller is run in the Device Node's fast loop.
+         */
+        bool mFastLoop;
+
+        /**
+         * True if mInputs and mOutputs were declared in createNew.
+         */
+        bool mIoDeclared;
+
+        /**
+         * Data Vector elements the controller reads.
+         */
+        std::vector<DataVectorElement_t> mInputs;
+
+        /**
+         * Data Vector elements the controller writes.
+         */
+        std::vector<DataVectorElement_t> mOutputs;
+
+        /**
+         * Controller's mode, read with the inputs if any element is bound.
+         */
+        uint8_t mMode;
+
+        /**
+         * Bound inputs, including the mode element. Empty if no element is
+         * bound.
+         */
+        std::vector<DataVector::ElementBinding_t> mInputBindings;
+
+        /**
+         * Bound outputs.
+         */
+        std::vector<DataVector::ElementBinding_t> mOutputBindings;
+
         /**
          * Method that is called by run when controller is ENABLED.
          *
@@ -189,6 +457,37 @@ class Controller
          *          [other]      Error returned by controller.
          */
         virtual Error_t runSafed () = 0;
+
+        /**
+         * Method that is called by createNew to bind the elements the 
+         * controller reads and writes using bindInput and bindOutput. The 
+         * default binds nothing.
+         *
+         * @ret     E_SUCCESS    Elements bound successfully.
+         *          [other]      Error returned by controller.
+         */
+        virtual Error_t bindIo ();
+
+        /**
+         * Bind the controller's elements. If any element is bound, also binds
+         * the mode element and, if the controller's inputs and outputs were
+         * not declared in createNew, declares the bound elements.
+         *
+         * @ret     E_SUCCESS    Elements bound successfully.
+         *          [other]      Error returned by bindIo or bindInput.
+         */
+        Error_t initBindings ();
+
+        /**
+         * Run runEnabled or runSafed based on a mode.
+         *
+         * @param   kMode           Mode.
+         *
+         * @ret     E_SUCCESS       Controller ran successfully.
+         *          E_INVALID_ENUM  Invalid mode.
+         *          [other]         Error returned by controller.
+         */
+        Error_t runMode (Mode_t kMode);
 };
 
 #endif
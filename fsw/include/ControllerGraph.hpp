@@ -0,0 +1,118 @@
+/**
+ * The Controller Graph orders a node's Controllers into levels that can each
+ * be run in parallel, using the Data Vector elements each Controller declared
+ * in Controller::createNew.
+ *
+ * Controller j must run before Controller i (j < i) if i reads an element j 
+ * writes, or if i writes an element j reads. These dependencies form a DAG 
+ * whose edges always point from a lower to a higher Controller index. Each 
+ * Controller is placed in the level after the last level of the Controllers 
+ * it depends on, so the Controllers in a level are independent of each other.
+ * Running the levels in order, and the Controllers within a level in any order
+ * or concurrently, leaves the Data Vector in the same state as running the 
+ * Controllers in vector order.
+ *
+ * Two Controllers that write the same element are rejected, since the final
+ * value would otherwise depend on run order only through their position in
+ * the vector, which is easy to change by accident.
+ *
+ * A Controller that did not declare its elements is treated as reading and 
+ * writing every element. It runs alone in its level, after every Controller
+ * before it and before every Controller after it.
+ *
+ * How to use:
+ *
+ *     Controller::createNew<YourController> (config, pDv, 
+ *                                            DV_ELEM_YOUR_CONTROLLER_MODE,
+ *                                            pController,
+ *                                            {DV_ELEM_IN0, DV_ELEM_IN1},
+ *                                            {DV_ELEM_OUT0});
+ *     ...
+ *     std::unique_ptr<ControllerGraph> pGraph;
+ *     ControllerGraph::createNew (pCtrls, pGraph);
+ *
+ *     // Each loop:
+ *     for (const std::vector<uint32_t>& level : pGraph->getLevels ())
+ *     {
+ *         // Run Controllers in level in parallel.
+ *     }
+ *
+ * NOTES:
+ *
+ *     #1 Levels list Controllers in ascending index order. Results from a 
+ *        level should be committed (e.g. errors logged) in this order so that
+ *        logging is deterministic.
+ */
+
+#ifndef CONTROLLER_GRAPH_HPP
+#define CONTROLLER_GRAPH_HPP
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "Controller.hpp"
+#include "Errors.hpp"
+
+class ControllerGraph final
+{
+
+public:
+
+    /**
+     * Levels of Controller indices. Level i must run before level i + 1.
+     */
+    typedef std::vector<std::vector<uint32_t>> Levels_t;
+
+    /**
+     * Entry point for creating a new Controller Graph. Builds the dependency
+     * DAG from the Controllers' declared inputs and outputs.
+     *
+     * @param   kPCtrls             Controllers, in the order they would run
+     *                              serially.
+     * @param   kPGraphRet          Pointer to store resulting Controller Graph
+     *                              in.
+     *
+     * @ret     E_SUCCESS           Controller Graph successfully created.
+     *          E_CONTROLLER_NULL   A Controller ptr is null.
+     *          E_WRITE_CONFLICT    Two Controllers write the same element.
+     */
+    static Error_t createNew (
+                        const std::vector<std::unique_ptr<Controller>>& kPCtrls,
+                        std::unique_ptr<ControllerGraph>& kPGraphRet);
+
+    /**
+     * Get the levels of the graph.
+     *
+     * @ret     Levels.
+     */
+    const Levels_t& getLevels () const;
+
+private:
+
+    /**
+     * Levels of Controller indices.
+     */
+    Levels_t mLevels;
+
+    /**
+     * Constructor.
+     *
+     * @param   kLevels  Levels of Controller indices.
+     */
+    ControllerGraph (const Levels_t& kLevels);
+
+    /**
+     * Check whether two sets of elements share an element.
+     *
+     * @param   kElemsA  First set.
+     * @param   kElemsB  Second set.
+     *
+     * @ret     true     Sets share an element.
+     *          false    Sets are disjoint.
+     */
+    static bool intersect (const std::vector<DataVectorElement_t>& kElemsA,
+                           const std::vector<DataVectorElement_t>& kElemsB);
+};
+
+#endif
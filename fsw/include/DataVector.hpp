@@ -74,6 +74,7 @@
 #include "Errors.hpp"
 #include "DataVectorEnums.hpp"
 #include "EnumClassHash.hpp"
+#include "MemoryManager.hpp"
 
 /*********************** HELPER MACROS FOR DV CONFIG **************************/
 /***************** See DataVectorTest.cpp for example usage *******************/
@@ -224,6 +225,20 @@ public:
      */
     typedef std::vector<RegionConfig_t> Config_t;
 
+    /**
+     * An element bound to a variable with bind. The element's location in the
+     * Data Vector is resolved and its type verified when bound, so bound 
+     * elements can be copied to and from their variables in one locked pass 
+     * with readBindings and writeBindings.
+     */
+    typedef struct ElementBinding
+    {
+        DataVectorElement_t elem;
+        void*               pValue;
+        uint32_t            startIdx;
+        uint32_t            sizeBytes;
+    } ElementBinding_t;
+
     /**
      *  Copy of passed in Data Vector config. Used by DataVectorLogger.
      */
@@ -439,6 +454,69 @@ public:
         return this->releaseLock ();
     }
 
+    /**
+     * Bind an element to a variable. The variable must outlive the binding.
+     * Defined in the header so that the templatized functions do not need to
+     * each be instantiated explicitly.
+     *
+     * @param   kElem                         Element to bind.
+     * @param   kValue                        Variable to bind element to.
+     * @param   kBindingRet                   Binding to initialize.
+     *
+     * @ret     E_SUCCESS                     Element bound successfully.
+     *          E_INVALID_ELEM                Element not in Data Vector.
+     *          E_INVALID_TYPE                Elem_t not supported by Data
+     *                                        Vector.
+     *          E_INCORRECT_TYPE              Elem_t does not match expected 
+     *                                        element type.
+     */
+    template<class Elem_T>
+    Error_t bind (DataVectorElement_t kElem, Elem_T& kValue, 
+                  ElementBinding_t& kBindingRet)
+    {
+        Error_t ret = this->verifyElement (kElem, kValue); 
+        if (ret != E_SUCCESS)
+        {
+            return ret;
+        }
+
+        kBindingRet = {kElem, &kValue, 
+                       mElementToElementInfo[kElem].startIdx, 
+                       sizeof (kValue)};
+
+        return E_SUCCESS;
+    }
+
+    /**
+     * Copy each bound element's value to its variable, holding the lock once
+     * for all of the elements so that the values are a consistent snapshot.
+     *
+     * NOTE: Calling this method can result in the current thread blocking.
+     *
+     * @param   kBindings                     Bindings created with bind.
+     *
+     * @ret     E_SUCCESS                     Elements read successfully.
+     *          E_FAILED_TO_LOCK              Failed to lock.
+     *          E_FAILED_TO_UNLOCK            Read succeeded but failed to 
+     *                                        unlock.
+     */
+    Error_t readBindings (const std::vector<ElementBinding_t>& kBindings);
+
+    /**
+     * Copy each bound variable's value to its element, holding the lock once
+     * for all of the elements.
+     *
+     * NOTE: Calling this method can result in the current thread blocking.
+     *
+     * @param   kBindings                     Bindings created with bind.
+     *
+     * @ret     E_SUCCESS                     Elements written successfully.
+     *          E_FAILED_TO_LOCK              Failed to lock.
+     *          E_FAILED_TO_UNLOCK            Write succeeded but failed to 
+     *                                        unlock.
+     */
+    Error_t writeBindings (const std::vector<ElementBinding_t>& kBindings);
+
     /**
      * Increment an element's value by 1. Float, double, and bool cannot be
      * incremented. If element's value is already max value, element will not
@@ -502,9 +580,71 @@ public:
      *           E_FAILED_TO_UNLOCK            Read succeeded but failed to 
      *                                         unlock.
      */
-    Error_t writeRegion (DataVectorRegion_t kRegion, 
+    Error_t writeRegion (DataVectorRegion_t kRegion,
                          std::vector<uint8_t>& kRegionBuf);
 
+    /**
+     * Read an element from a buffer holding a copy of the specified region,
+     * e.g. a region received from another node, without writing the buffer
+     * to the Data Vector. The Data Vector's buffer is not accessed, so the
+     * lock is not acquired.
+     *
+     * @param    kRegion                       Region kRegionBuf is a copy of.
+     * @param    kRegionBuf                    Buffer to read element from.
+     * @param    kElem                         Element to read.
+     * @param    kValueRet                     Variable to store element's
+     *                                         value.
+     *
+     * @ret      E_SUCCESS                     Element read successfully.
+     *           E_INVALID_REGION              Region enum not in Data Vector.
+     *           E_INCORRECT_SIZE              Vector provided does not have
+     *                                         same size as region.
+     *           E_INVALID_ELEM                Element not in Data Vector or
+     *                                         not in region.
+     *           E_INVALID_TYPE                Elem_t not supported by Data
+     *                                         Vector.
+     *           E_INCORRECT_TYPE              Elem_t does not match expected
+     *                                         element type.
+     */
+    template<class Elem_T>
+    Error_t readFromRegionBuf (DataVectorRegion_t kRegion,
+                               const std::vector<uint8_t>& kRegionBuf,
+                               DataVectorElement_t kElem, Elem_T& kValueRet)
+    {
+        // 1) Verify region and buffer size.
+        if (mRegionToRegionInfo.find (kRegion) == mRegionToRegionInfo.end ())
+        {
+            return E_INVALID_REGION;
+        }
+        RegionInfo_t* pRegionInfo = &mRegionToRegionInfo[kRegion];
+        if (kRegionBuf.size () != pRegionInfo->sizeBytes)
+        {
+            return E_INCORRECT_SIZE;
+        }
+
+        // 2) Verify element and that it is in the region.
+        Error_t ret = this->verifyElement (kElem, kValueRet);
+        if (ret != E_SUCCESS)
+        {
+            return ret;
+        }
+        ElementInfo_t* pElementInfo = &mElementToElementInfo[kElem];
+        if (pElementInfo->startIdx < pRegionInfo->startIdx ||
+            pElementInfo->startIdx + sizeof (kValueRet) >
+                pRegionInfo->startIdx + pRegionInfo->sizeBytes)
+        {
+            return E_INVALID_ELEM;
+        }
+
+        // 3) Store element's value in kValueRet.
+        std::memcpy (&kValueRet,
+                     &kRegionBuf[pElementInfo->startIdx -
+                                 pRegionInfo->startIdx],
+                     sizeof (kValueRet));
+
+        return E_SUCCESS;
+    }
+
     /**
      * Returns a copy the Data Vector's underlying byte buffer. The vector
      * passed in to copy the underlying buffer to must already have a size
@@ -541,6 +681,28 @@ public:
      */
     Error_t writeDataVector (std::vector<uint8_t>& kDvBuf);
 
+    /**
+     * Fault in the Data Vector's underlying buffer so that the loop does not
+     * take page faults on it. See MemoryManager.hpp.
+     *
+     * NOTE: Calling this method can result in the current thread blocking.
+     *
+     * @param    kUseHugePages                 If true, advise the kernel to 
+     *                                         back the buffer with huge 
+     *                                         pages. The buffer is first 
+     *                                         moved to a new, huge page 
+     *                                         aligned buffer, since advice 
+     *                                         has no effect on pages already 
+     *                                         faulted in. Must be called 
+     *                                         before memory is locked.
+     *
+     * @ret      E_SUCCESS                     Buffer prefaulted.
+     *           E_FAILED_TO_ADVISE_MEMORY     Huge page advice failed.
+     *           E_FAILED_TO_LOCK              Failed to lock.
+     *           E_FAILED_TO_UNLOCK            Failed to unlock.
+     */
+    Error_t prefault (bool kUseHugePages);
+
     /**
      * PUBLIC FOR TESTING PURPOSES ONLY -- DO NOT USE OUTSIDE OF DATA VECTOR
      *
@@ -651,10 +813,17 @@ private:
         uint32_t sizeBytes;
     } RegionInfo_t;
 
+    /**
+     * Buffer type. Allocated huge page aligned once prefaulted with huge 
+     * pages.
+     */
+    typedef std::vector<uint8_t, MemoryManager::HugePageAllocator<uint8_t>> 
+        Buffer_t;
+
     /**
      * Buffer containing Data Vector element data.
      */
-    std::vector<uint8_t> mBuffer;
+    Buffer_t mBuffer;
 
     /**
      * Map from region to region's info, which contains the region's starting
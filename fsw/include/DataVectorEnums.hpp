@@ -9,6 +9,84 @@
 
 #include <stdint.h>
 
+/******************************** MACROS **************************************/
+
+/**
+ * Invoke kMacro on the Phase Profiler element prefix of each Control Node 
+ * Controller, in Controller order. The number of entries is the number of 
+ * Controllers that can be profiled individually.
+ *
+ * @param  kMacro  Macro taking a single element prefix.
+ */
+#define DV_CN_CTRL_PHASE_PREFIXES(kMacro)                                      \
+    kMacro (DV_ELEM_CN_CTRL0)                                                  \
+    kMacro (DV_ELEM_CN_CTRL1)                                                  \
+    kMacro (DV_ELEM_CN_CTRL2)                                                  \
+    kMacro (DV_ELEM_CN_CTRL3)                                                  \
+    kMacro (DV_ELEM_CN_CTRL4)                                                  \
+    kMacro (DV_ELEM_CN_CTRL5)                                                  \
+    kMacro (DV_ELEM_CN_CTRL6)                                                  \
+    kMacro (DV_ELEM_CN_CTRL7)                                                  \
+    kMacro (DV_ELEM_CN_CTRL8)                                                  \
+    kMacro (DV_ELEM_CN_CTRL9)                                                  \
+    kMacro (DV_ELEM_CN_CTRL10)                                                 \
+    kMacro (DV_ELEM_CN_CTRL11)                                                 \
+    kMacro (DV_ELEM_CN_CTRL12)                                                 \
+    kMacro (DV_ELEM_CN_CTRL13)                                                 \
+    kMacro (DV_ELEM_CN_CTRL14)                                                 \
+    kMacro (DV_ELEM_CN_CTRL15)
+
+/**
+ * Invoke kMacro on the Phase Profiler element prefix of each Device Node loop
+ * phase.
+ *
+ * @param  kMacro  Macro taking a single element prefix.
+ * @param  kNode   Device Node, e.g. DN0.
+ */
+#define DV_DN_PHASE_PREFIXES(kMacro, kNode)                                    \
+    kMacro (DV_ELEM_##kNode##_COMMS)                                           \
+    kMacro (DV_ELEM_##kNode##_SENSORS)                                         \
+    kMacro (DV_ELEM_##kNode##_CTRLS)                                           \
+    kMacro (DV_ELEM_##kNode##_ACTUATORS)                                       \
+    kMacro (DV_ELEM_##kNode##_LOOP)
+
+/**
+ * Invoke kMacro on every Phase Profiler element prefix. This is the single 
+ * list the loop phase timing elements and their names in DataVectorLogger are
+ * generated from.
+ *
+ * @param  kMacro  Macro taking a single element prefix.
+ */
+#define DV_PHASE_PROFILER_PREFIXES(kMacro)                                     \
+    kMacro (DV_ELEM_CN_COMMS)                                                  \
+    kMacro (DV_ELEM_CN_CMD_HANDLER)                                            \
+    kMacro (DV_ELEM_CN_STATE_MACHINE)                                          \
+    kMacro (DV_ELEM_CN_CTRLS)                                                  \
+    kMacro (DV_ELEM_CN_ACTUATION)                                              \
+    kMacro (DV_ELEM_CN_LOOP)                                                   \
+    DV_CN_CTRL_PHASE_PREFIXES (kMacro)                                         \
+    DV_DN_PHASE_PREFIXES (kMacro, DN0)                                         \
+    DV_DN_PHASE_PREFIXES (kMacro, DN1)                                         \
+    DV_DN_PHASE_PREFIXES (kMacro, DN2)                                         \
+    DV_DN_PHASE_PREFIXES (kMacro, DN3)                                         \
+    DV_DN_PHASE_PREFIXES (kMacro, DN4)                                         \
+    DV_DN_PHASE_PREFIXES (kMacro, DN5)                                         \
+    DV_DN_PHASE_PREFIXES (kMacro, DN6)                                         \
+    DV_DN_PHASE_PREFIXES (kMacro, DN7)
+
+/**
+ * Declare the 6 Phase Profiler elements of a prefix. See PhaseProfiler.hpp.
+ *
+ * @param  kPrefix  Element prefix, e.g. DV_ELEM_CN_COMMS.
+ */
+#define DV_PHASE_PROFILER_ELEMS(kPrefix)                                       \
+    kPrefix##_WALL_MIN_NS,                                                     \
+    kPrefix##_WALL_MAX_NS,                                                     \
+    kPrefix##_WALL_P99_NS,                                                     \
+    kPrefix##_CPU_MIN_NS,                                                      \
+    kPrefix##_CPU_MAX_NS,                                                      \
+    kPrefix##_CPU_P99_NS,
+
 /**
  * Data Vector element type enumeration.
  */
@@ -48,10 +126,20 @@ enum DataVectorRegion_t : uint32_t
     DV_REG_DN0_TO_CN,
     DV_REG_DN1_TO_CN,
     DV_REG_DN2_TO_CN,
+    DV_REG_DN3_TO_CN,
+    DV_REG_DN4_TO_CN,
+    DV_REG_DN5_TO_CN,
+    DV_REG_DN6_TO_CN,
+    DV_REG_DN7_TO_CN,
     DV_REG_GROUND_TO_CN,
     DV_REG_CN_TO_DN0,
     DV_REG_CN_TO_DN1,
     DV_REG_CN_TO_DN2,
+    DV_REG_CN_TO_DN3,
+    DV_REG_CN_TO_DN4,
+    DV_REG_CN_TO_DN5,
+    DV_REG_CN_TO_DN6,
+    DV_REG_CN_TO_DN7,
     DV_REG_GROUND,
 
     DV_REG_LAST
@@ -1039,15 +1127,143 @@ enum DataVectorElement_t : uint32_t
     DV_ELEM_DN2_ERROR_COUNT,
     DV_ELEM_DN2_MSG_TX_COUNT,
     DV_ELEM_DN2_MSG_RX_COUNT,
+    DV_ELEM_DN3_LOOP_COUNT,
+    DV_ELEM_DN3_ERROR_COUNT,
+    DV_ELEM_DN3_MSG_TX_COUNT,
+    DV_ELEM_DN3_MSG_RX_COUNT,
+    DV_ELEM_DN4_LOOP_COUNT,
+    DV_ELEM_DN4_ERROR_COUNT,
+    DV_ELEM_DN4_MSG_TX_COUNT,
+    DV_ELEM_DN4_MSG_RX_COUNT,
+    DV_ELEM_DN5_LOOP_COUNT,
+    DV_ELEM_DN5_ERROR_COUNT,
+    DV_ELEM_DN5_MSG_TX_COUNT,
+    DV_ELEM_DN5_MSG_RX_COUNT,
+    DV_ELEM_DN6_LOOP_COUNT,
+    DV_ELEM_DN6_ERROR_COUNT,
+    DV_ELEM_DN6_MSG_TX_COUNT,
+    DV_ELEM_DN6_MSG_RX_COUNT,
+    DV_ELEM_DN7_LOOP_COUNT,
+    DV_ELEM_DN7_ERROR_COUNT,
+    DV_ELEM_DN7_MSG_TX_COUNT,
+    DV_ELEM_DN7_MSG_RX_COUNT,
     DV_ELEM_GROUND_MSG_TX_COUNT,
     DV_ELEM_GROUND_MSG_RX_COUNT,
     DV_ELEM_DN0_RX_MISS_COUNT,
     DV_ELEM_DN1_RX_MISS_COUNT,
     DV_ELEM_DN2_RX_MISS_COUNT,
+    DV_ELEM_DN3_RX_MISS_COUNT,
+    DV_ELEM_DN4_RX_MISS_COUNT,
+    DV_ELEM_DN5_RX_MISS_COUNT,
+    DV_ELEM_DN6_RX_MISS_COUNT,
+    DV_ELEM_DN7_RX_MISS_COUNT,
 
     /* Time */
     DV_ELEM_CN_TIME_NS,
 
+    /* Loop Phase Timing */
+    DV_PHASE_PROFILER_PREFIXES (DV_PHASE_PROFILER_ELEMS)
+
+    /* Loop Thread Stats */
+    DV_ELEM_CN_LOOP_JITTER_MAX_NS,
+    DV_ELEM_CN_LOOP_JITTER_P99_NS,
+    DV_ELEM_CN_LOOP_EXEC_MAX_NS,
+    DV_ELEM_CN_LOOP_EXEC_P99_NS,
+    DV_ELEM_CN_LOOP_RESPONSE_MAX_NS,
+    DV_ELEM_CN_LOOP_RESPONSE_P99_NS,
+
+    /* Rate Group Executive */
+    DV_ELEM_CN_OVERRUN_RATE_DIVISOR,
+
+    /* Page Faults */
+    DV_ELEM_CN_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_CN_MAJOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN0_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN0_MAJOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN1_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN1_MAJOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN2_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN2_MAJOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN3_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN3_MAJOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN4_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN4_MAJOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN5_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN5_MAJOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN6_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN6_MAJOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN7_MINOR_PAGE_FAULT_COUNT,
+    DV_ELEM_DN7_MAJOR_PAGE_FAULT_COUNT,
+
+    /* Overrun Policy */
+    DV_ELEM_CN_DEGRADED_LOOP_COUNT,
+
+    /* Time-Triggered Device Node */
+    DV_ELEM_DN0_CN_RX_MISS_COUNT,
+    DV_ELEM_DN1_CN_RX_MISS_COUNT,
+    DV_ELEM_DN2_CN_RX_MISS_COUNT,
+    DV_ELEM_DN3_CN_RX_MISS_COUNT,
+    DV_ELEM_DN4_CN_RX_MISS_COUNT,
+    DV_ELEM_DN5_CN_RX_MISS_COUNT,
+    DV_ELEM_DN6_CN_RX_MISS_COUNT,
+    DV_ELEM_DN7_CN_RX_MISS_COUNT,
+
+    /* Control Node Frame */
+    DV_ELEM_CN_TO_DN0_FRAME,
+    DV_ELEM_CN_TO_DN1_FRAME,
+    DV_ELEM_CN_TO_DN2_FRAME,
+    DV_ELEM_CN_TO_DN3_FRAME,
+    DV_ELEM_CN_TO_DN4_FRAME,
+    DV_ELEM_CN_TO_DN5_FRAME,
+    DV_ELEM_CN_TO_DN6_FRAME,
+    DV_ELEM_CN_TO_DN7_FRAME,
+
+    /* Control Node Message Type */
+    DV_ELEM_CN_TO_DN0_ACTUATION_MSG,
+    DV_ELEM_CN_TO_DN1_ACTUATION_MSG,
+    DV_ELEM_CN_TO_DN2_ACTUATION_MSG,
+    DV_ELEM_CN_TO_DN3_ACTUATION_MSG,
+    DV_ELEM_CN_TO_DN4_ACTUATION_MSG,
+    DV_ELEM_CN_TO_DN5_ACTUATION_MSG,
+    DV_ELEM_CN_TO_DN6_ACTUATION_MSG,
+    DV_ELEM_CN_TO_DN7_ACTUATION_MSG,
+
+    /* Device Node Fast Loop */
+    DV_ELEM_DN0_FAST_LOOP_COUNT,
+    DV_ELEM_DN0_FAST_LOOP_MISS_COUNT,
+    DV_ELEM_DN1_FAST_LOOP_COUNT,
+    DV_ELEM_DN1_FAST_LOOP_MISS_COUNT,
+    DV_ELEM_DN2_FAST_LOOP_COUNT,
+    DV_ELEM_DN2_FAST_LOOP_MISS_COUNT,
+    DV_ELEM_DN3_FAST_LOOP_COUNT,
+    DV_ELEM_DN3_FAST_LOOP_MISS_COUNT,
+    DV_ELEM_DN4_FAST_LOOP_COUNT,
+    DV_ELEM_DN4_FAST_LOOP_MISS_COUNT,
+    DV_ELEM_DN5_FAST_LOOP_COUNT,
+    DV_ELEM_DN5_FAST_LOOP_MISS_COUNT,
+    DV_ELEM_DN6_FAST_LOOP_COUNT,
+    DV_ELEM_DN6_FAST_LOOP_MISS_COUNT,
+    DV_ELEM_DN7_FAST_LOOP_COUNT,
+    DV_ELEM_DN7_FAST_LOOP_MISS_COUNT,
+
+    /* Device Node Sample Trigger */
+    DV_ELEM_DN0_SAMPLE_TIME_NS,
+    DV_ELEM_DN0_SAMPLE_MISS_COUNT,
+    DV_ELEM_DN1_SAMPLE_TIME_NS,
+    DV_ELEM_DN1_SAMPLE_MISS_COUNT,
+    DV_ELEM_DN2_SAMPLE_TIME_NS,
+    DV_ELEM_DN2_SAMPLE_MISS_COUNT,
+    DV_ELEM_DN3_SAMPLE_TIME_NS,
+    DV_ELEM_DN3_SAMPLE_MISS_COUNT,
+    DV_ELEM_DN4_SAMPLE_TIME_NS,
+    DV_ELEM_DN4_SAMPLE_MISS_COUNT,
+    DV_ELEM_DN5_SAMPLE_TIME_NS,
+    DV_ELEM_DN5_SAMPLE_MISS_COUNT,
+    DV_ELEM_DN6_SAMPLE_TIME_NS,
+    DV_ELEM_DN6_SAMPLE_MISS_COUNT,
+    DV_ELEM_DN7_SAMPLE_TIME_NS,
+    DV_ELEM_DN7_SAMPLE_MISS_COUNT,
+
     /* State Machine */
     DV_ELEM_STATE,
 
@@ -31,7 +31,12 @@
  *                           struct YourDevice::YourConfig> with an initialized
  *    FPGA session, Data Vector, the relevant device config data, and a 
  *    unique_ptr to store the initialized device pointer in.
- * 2. Call YourDevice->run () for each loop of your main periodic thread.
+ * 2. Optionally set the device's rate using setRate. By default, the Device
+ *    Node runs a device every loop. Optionally mark the device independent 
+ *    using setIndependent to allow the Device Node to run it in parallel.
+ *    Optionally mark the device fast loop using setFastLoop to have the 
+ *    Device Node run it at a multiple of the loop rate.
+ * 3. Call YourDevice->run () for each loop of your main periodic thread.
  *
  * WARNINGS:
  *
@@ -57,6 +62,7 @@
 #include "Errors.hpp"
 #include "NiFpga.h"
 #include "DataVector.hpp"
+#include "RateGroupExecutive.hpp"
 
 class Device
 {
@@ -113,6 +119,76 @@ class Device
          */
         virtual Error_t run () = 0;;
 
+        /**
+         * Take one sample for the device to aggregate in its next run. The 
+         * Device Node's fast loop calls this each period for the sensor 
+         * Devices it does not run. Devices that do not oversample do not 
+         * override this.
+         *
+         * @ret     E_SUCCESS   Sampled successfully.
+         *          [other]     Error returned by device.
+         */
+        virtual Error_t sample ();
+
+        /**
+         * Prepare to take up to kNumSamples samples between runs. The Device
+         * Node calls this at init for the sensor Devices it samples. Devices
+         * that do not oversample do not override this.
+         *
+         * @param   kNumSamples   Max number of samples taken between runs.
+         */
+        virtual void reserveSamples (uint32_t kNumSamples);
+
+        /**
+         * Set the rate the Device Node loop runs this device at. The rate is 
+         * validated when the node's Rate Group Executive is created. See 
+         * RateGroupExecutive.hpp.
+         *
+         * @param    kRate    Rate.
+         */
+        void setRate (RateGroupExecutive::Rate_t kRate);
+
+        /**
+         * Get the rate the Device Node loop runs this device at.
+         *
+         * @ret      Rate.
+         */
+        RateGroupExecutive::Rate_t getRate ();
+
+        /**
+         * Mark whether this device is independent of the other Devices in 
+         * its phase (sensors or actuators), i.e. it does not read Data Vector
+         * elements they write and they do not read elements it writes. The
+         * Device Node may run independent Devices in parallel. See 
+         * TaskPool.hpp.
+         *
+         * @param    kIndependent    True if independent.
+         */
+        void setIndependent (bool kIndependent);
+
+        /**
+         * Check whether this device is independent of the other Devices in
+         * its phase.
+         *
+         * @ret      True if independent.
+         */
+        bool isIndependent ();
+
+        /**
+         * Mark whether the Device Node runs this device in its fast loop 
+         * instead of its comms loop. See DeviceNode.hpp.
+         *
+         * @param    kFastLoop    True if run in the fast loop.
+         */
+        void setFastLoop (bool kFastLoop);
+
+        /**
+         * Check whether the Device Node runs this device in its fast loop.
+         *
+         * @ret      True if run in the fast loop.
+         */
+        bool isFastLoop ();
+
     protected:
 
         /**
@@ -130,6 +206,23 @@ class Device
          */
         Device (NiFpga_Session& kSession, 
                 std::shared_ptr<DataVector> kPDataVector);
+
+    private:
+
+        /**
+         * Rate to run device at.
+         */
+        RateGroupExecutive::Rate_t mRate;
+
+        /**
+         * True if device can run in parallel with other Devices.
+         */
+        bool mIndependent;
+
+        /**
+         * True if device is run in the Device Node's fast loop.
+         */
+        bool mFastLoop;
 };
 
 #endif
@@ -18,11 +18,31 @@
  *                         \
  *                       Device Node 2
  *
+ * Up to eight Device Nodes (NODE_DEVICE0 through NODE_DEVICE_LAST) are 
+ * supported. The Control Node is configured with the set of Device Nodes in 
+ * use. Supporting another Device Node requires adding its index to 
+ * NODE_DEVICE_INDICES in NetworkManager.hpp, which generates its Node_t entry
+ * and its entries in the Control and Device Node tables, and adding its 
+ * regions and elements to DataVectorEnums.hpp and DataVectorLogger.cpp.
+ *
  * Every loop, each Device Node x blocks until it receives a copy of 
  * DV_REG_CN_TO_DNx. This synchronizes the Device Node x loop to the Control
  * Node Loop. After unblocking, each Device Node sends a copy of 
  * DV_REG_DNx_TO_CN to the Control Node.
  *
+ * If same-frame actuation is enabled, the Control Node sends DV_REG_CN_TO_DNx 
+ * a second time right after its Controllers run. After running its actuator 
+ * Devices, each Device Node waits for this message and runs its actuator 
+ * Devices again as soon as it arrives. If the Data Vector contains 
+ * DV_ELEM_CN_TO_DNx_ACTUATION_MSG (a bool in DV_REG_CN_TO_DNx), it marks 
+ * which message is which, so that a late actuation message is discarded 
+ * instead of being taken as the next frame's message.
+ *
+ * If time-triggered, each Device Node instead runs its own periodic loop 
+ * phase-locked to the Control Node's frame. It runs its sensor Devices and 
+ * sends DV_REG_DNx_TO_CN shortly before the Control Node's frame starts, then 
+ * waits a bounded time for DV_REG_CN_TO_DNx. See note #9.
+ *
  * The Network Manager configuration MUST support this topology.
  *
  *
@@ -57,6 +77,77 @@
  *
  *     #4 The loop thread is run on CPU 1 to avoid being interrupted by the 
  *        kernel's Ethernet thread, which runs on CPU 0.
+ *
+ *     #5 If the Data Vector contains the DV_ELEM_DNx_<phase>_{WALL,CPU}_*_NS 
+ *        elements, each loop phase (comms, sensors, Controllers, actuators, 
+ *        and the full loop) is timed with the Phase Profiler and the stats are
+ *        written to those elements. Include them in DV_REG_DNx_TO_CN to 
+ *        downlink them with the rest of the Control Node's telemetry.
+ *
+ *     #6 Controllers and Devices are run at the rate set with setRate, which
+ *        defaults to every loop. See RateGroupExecutive.hpp. Each node counts
+ *        its own minor frames from its first loop, so a Device Node's minor 
+ *        frames are not aligned with the Control Node's or other Device 
+ *        Nodes'.
+ *
+ *     #7 If parallel tasks are enabled, the sensor Devices, Controllers, and 
+ *        actuator Devices marked with setIndependent run in parallel within 
+ *        their phase on a Task Pool, by default with one worker on CPU 0. 
+ *        Phase ordering is unchanged. A worker on CPU 0 shares it with the 
+ *        kernel's Ethernet thread (see #4), so only enable this when a 
+ *        phase's work outweighs that interference. The Phase Profiler's CPU
+ *        time stats only include the loop thread's share of the work.
+ *
+ *     #8 Before the loop starts, all memory is locked in RAM and prefaulted 
+ *        (see MemoryManager.hpp). If the Data Vector contains the 
+ *        DV_ELEM_DNx_{MINOR,MAJOR}_PAGE_FAULT_COUNT elements, the number of 
+ *        page faults the process has taken since the first loop is written to
+ *        them whenever it changes. Any non-zero count indicates memory that 
+ *        was not prefaulted.
+ *
+ *     #9 If time-triggered, the loop is phase-locked to the receipt time of 
+ *        DV_REG_CN_TO_DNx rather than to an absolute schedule, since the 
+ *        clocks are only synchronized once at startup and drift apart. Each 
+ *        frame, a bounded fraction of the phase error is corrected. A frame 
+ *        whose message does not arrive within the receive window is run on 
+ *        the last received data, and if the Data Vector contains 
+ *        DV_ELEM_DNx_CN_RX_MISS_COUNT, the miss is counted there. Only the
+ *        newest queued message is used, and the phase is locked to a message
+ *        received after the loop starts. If the Data Vector contains 
+ *        DV_ELEM_CN_TO_DNx_FRAME (a uint32 in DV_REG_CN_TO_DNx), messages 
+ *        from frames already received are discarded. The loop period is 
+ *        NetworkManager::LOOP_PERIOD_NS, the same constant the Control Node 
+ *        runs its loop at. Requires clock sync.
+ *
+ *    #10 If the fast loop is enabled, Controllers and Devices marked with 
+ *        setFastLoop are run by a separate periodic thread at a multiple of 
+ *        the loop rate (period NetworkManager::LOOP_PERIOD_NS / the multiple)
+ *        instead of by the loop, so that control loops that 
+ *        need 500 Hz to 1 kHz can close locally on the Device Node with the
+ *        Control Node only supplying setpoints. The fast loop runs its sensor
+ *        Devices, Controllers, and actuator Devices in order every period, 
+ *        ignoring their rates. It shares the Data Vector with the loop, which
+ *        sends the fast loop's latest values to the Control Node each loop, 
+ *        decimating them to the loop rate. The fast loop runs on the loop's 
+ *        CPU at a higher priority, so it preempts the loop. It is not 
+ *        phase-aligned with the loop. If the Data Vector contains 
+ *        DV_ELEM_DNx_FAST_LOOP_COUNT or DV_ELEM_DNx_FAST_LOOP_MISS_COUNT, fast
+ *        loops and fast loop deadline misses are counted there. Each period,
+ *        the fast loop also samples the loop's sensor Devices, which lets 
+ *        oversampling Devices (e.g. AnalogInDevice) aggregate several samples
+ *        per loop. See Device::sample.
+ *
+ *    #11 If sample alignment is enabled, the FPGA latches its inputs at a 
+ *        periodic tick and asserts the given IRQs, and the sensor phase waits
+ *        for the next tick before running the sensor Devices, so that they 
+ *        read a coherent sample set whose phase does not depend on network 
+ *        jitter. The tick time is written to DV_ELEM_DNx_SAMPLE_TIME_NS, and
+ *        ticks that do not arrive within SAMPLE_TICK_TIMEOUT_MS are counted
+ *        in DV_ELEM_DNx_SAMPLE_MISS_COUNT. Both elements are then required. 
+ *        The tick period bounds the added latency, so it should be short 
+ *        relative to the loop period, and if time-triggered, to the sensor 
+ *        lead time. The fast loop is not aligned. Requires a bitfile that 
+ *        generates the ticks. See SampleTrigger.hpp.
  */
 
 #ifndef DEVICE_NODE_HPP
@@ -73,9 +164,20 @@
 #include "FPGASession.hpp"
 #include "Controller.hpp"
 #include "Device.hpp"
+#include "PhaseProfiler.hpp"
+#include "RateGroupExecutive.hpp"
+#include "TaskPool.hpp"
+#include "MemoryManager.hpp"
+#include "SampleTrigger.hpp"
 
 namespace DeviceNode
 {
+    /**
+     * Platform v1 Task Pool config for parallel tasks. One worker on CPU 0, 
+     * since the loop thread runs on CPU 1.
+     */
+    extern const TaskPool::Config_t PLATFORM_V1_TASK_POOL;
+
     /**
      * Function pointer type to pass to entry function for initializing 
      * Controllers and Devices.  
@@ -96,6 +198,47 @@ namespace DeviceNode
                          std::vector<std::unique_ptr<Device>>& kPSensorDevs,
                          std::vector<std::unique_ptr<Device>>& kPActuatorDevs);
 
+    /**
+     * Optional Device Node settings. A default constructed Options_t disables
+     * all of them. Set only the fields that differ from the defaults, e.g.
+     *
+     *     DeviceNode::Options_t options;
+     *     options.timeTriggered = true;
+     *
+     *   sameFrameActuation  If true, after running the actuator Devices each
+     *                       loop, wait for the Control Node's same-frame 
+     *                       actuation message and run the actuator Devices 
+     *                       again on receipt. Must match the Control Node's
+     *                       setting. Default false.
+     *   parallelTasks       If true, run independent Devices and Controllers
+     *                       in parallel on a Task Pool. See note #7. Default
+     *                       false.
+     *   hugePageDv          If true, advise the kernel to back the Data 
+     *                       Vector with huge pages. Default false.
+     *   timeTriggered       If true, run a periodic loop phase-locked to the
+     *                       Control Node's frame instead of blocking on its 
+     *                       messages. See note #9. Default false.
+     *   fastLoopMultiple    Fast loop rate as a multiple of the loop rate, up 
+     *                       to 10. 0 to disable the fast loop. See note #10. 
+     *                       Default 0.
+     *   sampleIrqs          IRQs the FPGA asserts at each sample tick, e.g. 
+     *                       NiFpga_Irq_0. 0 to disable sample alignment. See
+     *                       note #11. Default 0.
+     *   taskPoolConfig      Worker CPUs and priority of the Task Pool used if
+     *                       parallelTasks is true. Default 
+     *                       PLATFORM_V1_TASK_POOL.
+     */
+    typedef struct Options
+    {
+        bool               sameFrameActuation = false;
+        bool               parallelTasks      = false;
+        bool               hugePageDv         = false;
+        bool               timeTriggered      = false;
+        uint8_t            fastLoopMultiple   = 0;
+        uint32_t           sampleIrqs         = 0;
+        TaskPool::Config_t taskPoolConfig     = PLATFORM_V1_TASK_POOL;
+    } Options_t;
+
     /**
      * Entry point for the Device Nodes. Initializes all software components and 
      * begins loop. Exits program on failure and does not return on success.
@@ -109,11 +252,14 @@ namespace DeviceNode
      *
      * @param  kSkipClockSync      Skip clock synchronization step to enable
      *                             single sbRIO unit testing.
+     *
+     * @param  kOptions            Optional settings. See Options_t.
      */
     void entry (NetworkManager::Config_t  kNmConfig, 
                 DataVector::Config_t      kDvConfig,
                 fInitializeCtrlsAndDevs_t kFInitCtrlsAndDevs,
-                bool                      kSkipClockSync);
+                bool                      kSkipClockSync,
+                Options_t                 kOptions = Options_t ());
 
 };
 
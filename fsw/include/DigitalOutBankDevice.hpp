@@ -0,0 +1,127 @@
+/**
+ * Device to control a bank of digital output pins together. Each channel is
+ * configured as a DigitalOutDevice. Run method first reads every channel's
+ * control value from the Data Vector while holding its lock once, then sets
+ * the pins whose control value changed and reads back the pins whose feedback
+ * is due, and finally writes every feedback value to the Data Vector while
+ * holding its lock once.
+ *
+ * Use this instead of one DigitalOutDevice per pin when a Device Node controls
+ * many digital outputs, so that the per-device overhead of accessing the FPGA
+ * and locking the Data Vector is paid once per bank instead of once per pin.
+ *
+ * NOTES:
+ *
+ *     #1 The control values are gathered into a bitmask of the bank's pins,
+ *        indexed by pin number, and compared with the last bitmask written.
+ *        Only the pins whose bits differ are written, so a run with no
+ *        changed control value makes no FPGA write. The FPGA bitfile exposes
+ *        each digital pin as a separate scalar control and indicator rather
+ *        than one port-wide register, so each changed pin is still written
+ *        with one NiFpga call. The writes and the reads are each issued
+ *        back-to-back with a single status check.
+ *
+ *     #2 Each channel's feedback is read at the rate set by its
+ *        feedbackDivisor. See DigitalOutDevice.hpp. If no channel's feedback
+ *        is due, the Data Vector is not written.
+ *
+ *     #3 All pins are set before any are read back, so each feedback value is
+ *        read later after its write than with DigitalOutDevice. See the note
+ *        on feedback delay in DigitalOutDevice::run.
+ */
+
+#ifndef DIGITAL_OUT_BANK_DEVICE_HPP
+#define DIGITAL_OUT_BANK_DEVICE_HPP
+
+#include <memory>
+#include <vector>
+
+#include "DigitalOutDevice.hpp"
+
+class DigitalOutBankDevice final : public Device
+{
+
+    public:
+
+        /**
+         * Device configuration. One DigitalOutDevice config per channel.
+         */
+        typedef std::vector<DigitalOutDevice::Config_t> Config_t;
+
+        /**
+         * Sets every digital output value and reads every current pin value.
+         *
+         * @ret   E_SUCCESS             Device ran successfully.
+         *        E_DATA_VECTOR_READ    Failed to read from DV.
+         *        E_DATA_VECTOR_WRITE   Failed to write to DV.
+         *        E_FPGA_READ           Failed to read from FPGA.
+         *        E_FPGA_WRITE          Failed to write to FPGA.
+         */
+        virtual Error_t run ();
+
+        /**
+         * Verify config is valid. Each channel's config is verified when its
+         * DigitalOutDevice is created.
+         *
+         * @param kConfig               Config to verify.
+         *
+         * @ret   E_SUCCESS             Config valid.
+         *        E_EMPTY_CONFIG        No channels.
+         *        E_DUPLICATE_PIN       Pin used by more than one channel.
+         */
+        Error_t verifyConfig (Config_t& kConfig);
+
+        /**
+         * Derived device constructor. This must be public so that it is visible
+         * to Device::createNew.
+         *
+         * @param  kSession      Initialized and open FPGA session.
+         * @param  kDataVector   Node's Data Vector.
+         * @param  kConfig       Device config.
+         * @param  kRet          E_SUCCESS            Config valid.
+         *                       E_EMPTY_CONFIG       No channels.
+         *                       E_DUPLICATE_PIN      Pin used by more than
+         *                                            one channel.
+         *                       E_INVALID_ELEM       Channel elem not in DV.
+         *                       [other]              Channel config invalid.
+         *                                            See
+         *                                            DigitalOutDevice.hpp.
+         */
+        DigitalOutBankDevice (NiFpga_Session& kSession,
+                              std::shared_ptr<DataVector> kPDataVector,
+                              Config_t& kConfig,
+                              Error_t& kRet);
+
+    private:
+
+        /**
+         * Channels. Used for their pin config.
+         */
+        std::vector<std::unique_ptr<DigitalOutDevice>> mPChannels;
+
+        /**
+         * Each channel's control and feedback value. Allocated on
+         * construction so that the bindings to them stay valid.
+         */
+        std::unique_ptr<bool[]> mControlVals;
+        std::unique_ptr<bool[]> mFeedbackVals;
+
+        /**
+         * Bindings from each channel's control and feedback elems to
+         * mControlVals and mFeedbackVals.
+         */
+        std::vector<DataVector::ElementBinding_t> mControlBindings;
+        std::vector<DataVector::ElementBinding_t> mFeedbackBindings;
+
+        /**
+         * Each channel's bit in the bank's control bitmask.
+         */
+        std::vector<uint32_t> mPinMasks;
+
+        /**
+         * Control bitmask last written to the FPGA.
+         */
+        uint32_t mLastControlMask;
+};
+
+#endif
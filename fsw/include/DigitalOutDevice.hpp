@@ -9,6 +9,18 @@
  *
  *     #1 This Device will only work for code running on an sbRIO-9637. The 9627
  *        without the RMC connector only supports DIO 0 - 3.
+ *
+ * NOTES:
+ *
+ *     #1 The control value is only written to the FPGA when it differs from the
+ *        last value written, so a run with an unchanged control value makes
+ *        no FPGA write. This assumes nothing else writes the pin's FPGA
+ *        control.
+ *
+ *     #2 If feedbackDivisor is greater than 1, the pin value is only read and
+ *        written to the feedback value DV element every feedbackDivisor runs,
+ *        starting with the first. On other runs the feedback value is left
+ *        unchanged.
  */
 
 #ifndef DIGITAL_OUT_DEVICE_HPP
@@ -19,6 +31,12 @@
 class DigitalOutDevice final : public Device
 {
 
+    /**
+     * Accesses the pins of several DigitalOutDevices in one pass. See 
+     * DigitalOutBankDevice.hpp.
+     */
+    friend class DigitalOutBankDevice;
+
     public:
 
         /**
@@ -41,6 +59,8 @@ class DigitalOutDevice final : public Device
             DataVectorElement_t dvElemControlVal;
             DataVectorElement_t dvElemFeedbackVal;
             uint8_t pinNumber;
+            uint32_t feedbackDivisor; // Runs per feedback read. 0 or 1 reads
+                                      // every run. See note #2 above.
         } Config_t;
 
         /**
@@ -111,13 +131,44 @@ class DigitalOutDevice final : public Device
         uint32_t mFpgaIndicator;
 
         /**
-         * Read control value from Data Vector and write to FPGA.
+         * Last control value written to the FPGA, and whether one has been
+         * written.
+         */
+        bool mLastControlVal;
+        bool mControlWritten;
+
+        /**
+         * Runs per feedback read, and runs left until the next one.
+         */
+        uint32_t mFeedbackDivisor;
+        uint32_t mRunsUntilFeedback;
+
+        /**
+         * Read control value from Data Vector and write to FPGA if it changed.
          *
          * @ret   E_SUCCESS             Device ran successfully.
          *        E_DATA_VECTOR_READ   Failed to read from DV.
          *        E_FPGA_WRITE          Failed to write to FPGA.
          */
         Error_t updateFpgaControlValue ();
+
+        /**
+         * Write control value to FPGA if it differs from the last value
+         * written.
+         *
+         * @param kVal                  Control value.
+         *
+         * @ret   E_SUCCESS             Value written or unchanged.
+         *        E_FPGA_WRITE          Failed to write to FPGA.
+         */
+        Error_t writeControlValue (bool kVal);
+
+        /**
+         * Count a run towards the next feedback read.
+         *
+         * @ret   Whether feedback should be read this run.
+         */
+        bool isFeedbackDue ();
 };
 
 #endif
@@ -61,13 +61,11 @@ enum Error_t : uint32_t
     E_FAILED_TO_DESTROY_THREAD_ATTR,
     E_FAILED_TO_WAIT_ON_THREAD,
     E_THREAD_NOT_FOUND,
-    E_FAILED_TO_CREATE_TIMERFD,
-    E_FAILED_TO_ARM_TIMERFD,
-    E_FAILED_TO_GET_TIMER_FLAGS,
-    E_FAILED_TO_SET_TIMER_FLAGS,
-    E_FAILED_TO_READ_TIMERFD,
-    E_TIMER_EXPIRED_MORE_THAN_ONCE,
+    E_INVALID_PERIOD,
+    E_FAILED_TO_SLEEP,
     E_MISSED_SCHEDULER_DEADLINE,
+    E_NOT_PERIODIC_THREAD,
+    E_IRQ_NOT_FOUND,
 
     /* Network Manager */
     E_EMPTY_NODE_CONFIG = 50,
@@ -134,6 +132,10 @@ enum Error_t : uint32_t
     E_FPGA_NO_SESSION,
     E_FPGA_CLOSE_SESSION,
     E_PIN_NOT_CONFIGURED,
+    E_SAMPLE_RING_FULL,
+    E_DUPLICATE_PIN,
+    E_FPGA_FIFO,
+    E_FPGA_IRQ,
 
     /* Time */
     E_FAILED_TO_GET_TIME = 175,
@@ -165,6 +167,40 @@ enum Error_t : uint32_t
     E_INVALID_ARGUMENT,
     E_FAILED_TO_CANCEL_ABORT,
 
+    /* Control Node */
+    E_FAILED_TO_SIGNAL_COND = 240,
+    E_FAILED_TO_WAIT_ON_COND,
+
+    /* Phase Profiler */
+    E_INVALID_PHASE = 250,
+    E_PHASE_NOT_STARTED,
+
+    /* Rate Group Executive */
+    E_INVALID_RATE = 260,
+    E_INVALID_OFFSET,
+    E_INVALID_TASK,
+
+    /* Task Pool */
+    E_INVALID_NUM_WORKERS = 270,
+    E_FAILED_TO_INIT_COND,
+
+    /* Memory Manager */
+    E_FAILED_TO_SET_MALLOC_OPT = 280,
+    E_FAILED_TO_LOCK_MEMORY,
+    E_FAILED_TO_ALLOC_RESERVE,
+    E_FAILED_TO_ADVISE_MEMORY,
+    E_FAILED_TO_GET_USAGE,
+
+    /* Thread Manager (continued) */
+    E_INVALID_DEADLINE = 290,
+    E_DEADLINE_ADMISSION_FAILED,
+    E_FAILED_TO_SET_DEADLINE,
+    E_DEADLINE_SWITCH_TIMED_OUT,
+
+    /* Controller Graph */
+    E_CONTROLLER_NULL = 300,
+    E_WRITE_CONFLICT,
+
     E_LAST
 };
 
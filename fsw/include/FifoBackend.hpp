@@ -0,0 +1,101 @@
+/**
+ * Source of elements from a target-to-host DMA FIFO. StreamingDevice reads its
+ * FIFO through this interface so that it can be run against a mock FIFO off
+ * target. NiFpgaFifoBackend reads a FIFO on the FPGA.
+ *
+ * Elements are acquired in place: acquire returns a pointer into the FIFO's
+ * host memory, which stays valid until the elements are released. Acquire and
+ * release must be called from the same thread, and each acquire must be
+ * followed by a release before the next acquire.
+ */
+
+#ifndef FIFO_BACKEND_HPP
+#define FIFO_BACKEND_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Errors.hpp"
+#include "NiFpga.h"
+
+class FifoBackend
+{
+public:
+    virtual ~FifoBackend () {}
+
+    /**
+     * Set the host-side depth of the FIFO and start it.
+     *
+     * @param   kDepth       Requested depth in elements.
+     *
+     * @ret     E_SUCCESS    FIFO started.
+     *          E_FPGA_FIFO  Failed to configure or start FIFO.
+     */
+    virtual Error_t start (size_t kDepth) = 0;
+
+    /**
+     * Acquire exactly kNumElems elements without waiting. If fewer are
+     * available, none are acquired.
+     *
+     * @param   kNumElems         Number of elements to acquire.
+     * @param   kPElemsRet        Acquired elements. Valid until released.
+     * @param   kAcquiredRet      Whether the elements were acquired.
+     * @param   kNumRemainingRet  Number of elements left in the FIFO.
+     *
+     * @ret     E_SUCCESS         Elements acquired or none available.
+     *          E_FPGA_FIFO       Failed to read FIFO.
+     */
+    virtual Error_t acquire (size_t kNumElems, const uint32_t*& kPElemsRet,
+                             bool& kAcquiredRet, size_t& kNumRemainingRet) = 0;
+
+    /**
+     * Release elements returned by the last acquire back to the FIFO.
+     *
+     * @param   kNumElems    Number of elements to release.
+     *
+     * @ret     E_SUCCESS    Elements released.
+     *          E_FPGA_FIFO  Failed to release elements.
+     */
+    virtual Error_t release (size_t kNumElems) = 0;
+};
+
+class NiFpgaFifoBackend final : public FifoBackend
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param   kSession    Initialized and open FPGA session.
+     * @param   kFifo       Target-to-host FIFO resource identifier.
+     */
+    NiFpgaFifoBackend (NiFpga_Session& kSession, uint32_t kFifo);
+
+    /**
+     * Inherited from base.
+     */
+    Error_t start (size_t kDepth);
+
+    /**
+     * Inherited from base.
+     */
+    Error_t acquire (size_t kNumElems, const uint32_t*& kPElemsRet,
+                     bool& kAcquiredRet, size_t& kNumRemainingRet);
+
+    /**
+     * Inherited from base.
+     */
+    Error_t release (size_t kNumElems);
+
+private:
+    /**
+     * FPGA session.
+     */
+    NiFpga_Session& mSession;
+
+    /**
+     * FIFO resource identifier.
+     */
+    uint32_t mFifo;
+};
+
+#endif
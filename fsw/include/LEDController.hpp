@@ -43,7 +43,6 @@ public:
      * LED is on when controller is enabled.
      *
      * @ret     E_SUCCESS            Success.
-     *          E_DATA_VECTOR_WRITE Failed to write to DV.
      */
     Error_t runEnabled ();
 
@@ -51,10 +50,18 @@ public:
      * LED is off when controller is safed.
      *
      * @ret     E_SUCCESS            Success.
-     *          E_DATA_VECTOR_WRITE Failed to write to DV.
      */
     Error_t runSafed ();
 
+    /**
+     * Binds the LED control value to the DV element in the config. The value
+     * is written to the DV after each run.
+     *
+     * @ret     E_SUCCESS         Elements bound.
+     *          [other]           Error returned by bindOutput.
+     */
+    Error_t bindIo ();
+
 private:
 
     /**
@@ -63,14 +70,9 @@ private:
     DataVectorElement_t mDvElemControlVal;
 
     /**
-     * Writes an LED control value to the DV.
-     *
-     * @param   kControlVal          Control value to write.
-     *
-     * @ret     E_SUCCESS            Successfully set LED.
-     *          E_DATA_VECTOR_WRITE Failed to write to DV.
+     * LED control value. Bound to mDvElemControlVal.
      */
-    Error_t setLED (bool kControlVal);
+    bool mControlVal;
 };
 
 # endif
@@ -0,0 +1,267 @@
+/**
+ * The Memory Manager prepares a node's memory for real-time execution. A page
+ * fault in the 10ms loop costs tens of microseconds, so before the loop starts
+ * all of the process's memory is locked in RAM and faulted in, and the loop
+ * then counts any page faults that still occur.
+ *
+ * Locking memory does the following:
+ *
+ *     1) Configures malloc to never return freed memory to the kernel and to
+ *        never use mmap for allocations, and limits malloc to a single arena.
+ *        This keeps freed heap memory locked so that later allocations do not
+ *        fault.
+ *     2) Calls mlockall with MCL_CURRENT and MCL_FUTURE. All memory currently
+ *        mapped, including every buffer allocated so far and the full stack
+ *        of every thread created so far, is faulted in and locked. Memory
+ *        mapped afterwards, including the stacks of threads created later, is
+ *        faulted in and locked when mapped.
+ *     3) Prefaults the calling thread's stack. The main thread's stack grows
+ *        on demand, so it is not covered by 2.
+ *     4) Prefaults a heap reserve by allocating, touching, and freeing it.
+ *        Allocations made after init are then served from locked memory.
+ *
+ * How to use:
+ *
+ *     // After allocating buffers and before starting the loop:
+ *     MemoryManager::lockAll (MemoryManager::STACK_PREFAULT_BYTES,
+ *                             MemoryManager::HEAP_RESERVE_BYTES);
+ *     MemoryManager::PageFaults_t baseline;
+ *     MemoryManager::getPageFaults (baseline);
+ *
+ *     // Each loop:
+ *     MemoryManager::PageFaults_t faults;
+ *     MemoryManager::getPageFaults (faults);
+ *     // faults - baseline is the number of faults since init.
+ *
+ * NOTES:
+ *
+ *     #1 Locking memory requires root or CAP_IPC_LOCK, as does the Thread
+ *        Manager.
+ *
+ *     #2 Huge page advice (see prefault) only takes effect if the kernel is
+ *        built with transparent huge pages, only for pages that have not been
+ *        faulted in yet, and only for the parts of the buffer that cover a 
+ *        full, aligned huge page. Pages already faulted in, e.g. by zero-
+ *        filling the buffer or by locking memory, keep their small pages. To
+ *        back a buffer with huge pages, allocate it with a huge page aligned
+ *        HugePageAllocator and prefault it with advice before first writing
+ *        it. See DataVector::prefault.
+ */
+
+#ifndef MEMORY_MANAGER_HPP
+#define MEMORY_MANAGER_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <new>
+#include <type_traits>
+
+#include "Errors.hpp"
+
+class MemoryManager final
+{
+
+public:
+
+    /**
+     * Default number of bytes of the calling thread's stack to prefault.
+     */
+    static const uint32_t STACK_PREFAULT_BYTES = 256 * 1024;
+
+    /**
+     * Default number of bytes of heap to reserve and prefault.
+     */
+    static const uint32_t HEAP_RESERVE_BYTES = 2 * 1024 * 1024;
+
+    /**
+     * Size of a transparent huge page.
+     */
+    static const size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+    /**
+     * Allocator for containers that may need to be backed by huge pages. If
+     * constructed huge page aligned, each allocation is aligned to and 
+     * rounded up to whole huge pages (see toHugePageBytes), so that huge page
+     * advice covers all of it. Otherwise allocates with malloc. Allocations 
+     * are not written, so advice given before the container first writes its
+     * storage takes effect. See note #2.
+     *
+     * As with std::allocator, throws std::bad_alloc if out of memory. The 
+     * alignment moves with the storage when a container is moved or swapped.
+     */
+    template <class T>
+    class HugePageAllocator
+    {
+    public:
+
+        typedef T value_type;
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type propagate_on_container_swap;
+
+        /**
+         * Constructor.
+         *
+         * @param   kHugePageAligned    If true, align allocations to huge 
+         *                              pages.
+         */
+        explicit HugePageAllocator (bool kHugePageAligned = false) : 
+            mHugePageAligned (kHugePageAligned) {}
+
+        /**
+         * Copy an allocator of another type.
+         */
+        template <class U>
+        HugePageAllocator (const HugePageAllocator<U>& kOther) :
+            mHugePageAligned (kOther.isHugePageAligned ()) {}
+
+        /**
+         * Allocate storage for kNum objects.
+         */
+        T* allocate (size_t kNum)
+        {
+            void* pBuf = nullptr;
+            if (mHugePageAligned == true)
+            {
+                if (posix_memalign (&pBuf, HUGE_PAGE_BYTES, 
+                                    toHugePageBytes (kNum * sizeof (T))) != 0)
+                {
+                    pBuf = nullptr;
+                }
+            }
+            else
+            {
+                pBuf = malloc (kNum * sizeof (T));
+            }
+            if (pBuf == nullptr)
+            {
+                throw std::bad_alloc ();
+            }
+
+            return static_cast<T*> (pBuf);
+        }
+
+        /**
+         * Free storage returned by allocate.
+         */
+        void deallocate (T* kPBuf, size_t kNum)
+        {
+            free (kPBuf);
+        }
+
+        /**
+         * @ret     True if allocations are aligned to huge pages.
+         */
+        bool isHugePageAligned () const
+        {
+            return mHugePageAligned;
+        }
+
+    private:
+
+        bool mHugePageAligned;
+    };
+
+    /**
+     * Round a size up to a whole number of huge pages.
+     *
+     * @param   kNumBytes   Size in bytes.
+     *
+     * @ret     Size in bytes rounded up to a multiple of HUGE_PAGE_BYTES.
+     */
+    static size_t toHugePageBytes (size_t kNumBytes)
+    {
+        return (kNumBytes + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * 
+               HUGE_PAGE_BYTES;
+    }
+
+    /**
+     * Page fault counts.
+     */
+    typedef struct PageFaults
+    {
+        uint64_t minor;
+        uint64_t major;
+    } PageFaults_t;
+
+    /**
+     * Lock all current and future memory in RAM, and prefault the calling
+     * thread's stack and a heap reserve.
+     *
+     * @param   kStackBytes                 Bytes of the calling thread's stack
+     *                                      to prefault.
+     * @param   kHeapBytes                  Bytes of heap to reserve and
+     *                                      prefault.
+     *
+     * @ret     E_SUCCESS                   Memory locked.
+     *          E_FAILED_TO_SET_MALLOC_OPT  Failed to configure malloc.
+     *          E_FAILED_TO_LOCK_MEMORY     Failed to lock memory.
+     *          E_FAILED_TO_ALLOC_RESERVE   Failed to allocate heap reserve.
+     */
+    static Error_t lockAll (uint32_t kStackBytes, uint32_t kHeapBytes);
+
+    /**
+     * Fault in every page of a buffer by writing each page's first byte back
+     * to itself. The buffer's contents are unchanged, but the buffer must not
+     * be written by another thread during the call.
+     *
+     * @param   kPBuf                       Buffer to prefault.
+     * @param   kNumBytes                   Size of buffer in bytes.
+     * @param   kUseHugePages               If true, advise the kernel to back
+     *                                      the buffer with huge pages before
+     *                                      faulting it in. Only affects pages
+     *                                      not yet faulted in. See note #2.
+     *
+     * @ret     E_SUCCESS                   Buffer prefaulted.
+     *          E_INVALID_POINTER           Buffer null.
+     *          E_FAILED_TO_ADVISE_MEMORY   Huge page advice failed.
+     */
+    static Error_t prefault (void* kPBuf, size_t kNumBytes,
+                             bool kUseHugePages);
+
+    /**
+     * Get the number of minor and major page faults taken by the process
+     * since it started.
+     *
+     * @param   kFaultsRet                  Struct to store fault counts in.
+     *
+     * @ret     E_SUCCESS                   Counts stored in kFaultsRet.
+     *          E_FAILED_TO_GET_USAGE       Failed to read resource usage.
+     */
+    static Error_t getPageFaults (PageFaults_t& kFaultsRet);
+
+private:
+
+    /**
+     * Prefault the calling thread's stack. Not inlined so that the prefaulted
+     * region is below the caller's frame.
+     *
+     * @param   kNumBytes  Bytes of stack to prefault.
+     */
+    static void prefaultStack (uint32_t kNumBytes) __attribute__ ((noinline));
+
+    /**
+     * Not instantiable.
+     */
+    MemoryManager () = delete;
+};
+
+/**
+ * Huge page allocators are equal if they have the same alignment, so that a 
+ * container assigned from another keeps its own alignment.
+ */
+template <class T, class U>
+bool operator== (const MemoryManager::HugePageAllocator<T>& kA,
+                 const MemoryManager::HugePageAllocator<U>& kB)
+{
+    return kA.isHugePageAligned () == kB.isHugePageAligned ();
+}
+
+template <class T, class U>
+bool operator!= (const MemoryManager::HugePageAllocator<T>& kA,
+                 const MemoryManager::HugePageAllocator<U>& kB)
+{
+    return !(kA == kB);
+}
+
+#endif
@@ -70,19 +70,46 @@
 #include "Errors.hpp"
 #include "Time.hpp"
 
+/******************************** MACROS **************************************/
+
+/**
+ * Invoke kMacro on the index of each Device Node, in node order. The Device 
+ * Node entries of Node_t and the Control and Device Node tables keyed by 
+ * Device Node are generated from this list.
+ *
+ * @param  kMacro  Macro taking a single Device Node index, e.g. 0 for 
+ *                 NODE_DEVICE0.
+ */
+#define NODE_DEVICE_INDICES(kMacro)                                            \
+    kMacro (0)                                                                 \
+    kMacro (1)                                                                 \
+    kMacro (2)                                                                 \
+    kMacro (3)                                                                 \
+    kMacro (4)                                                                 \
+    kMacro (5)                                                                 \
+    kMacro (6)                                                                 \
+    kMacro (7)
+
+/**
+ * Declare the Node_t entry of a Device Node.
+ *
+ * @param  kIdx  Device Node index.
+ */
+#define NODE_DEVICE_ENUM(kIdx) NODE_DEVICE##kIdx,
+
 /**
  * Allowed network nodes. Defined outside of class to enable more succinct
- * usage.
+ * usage. The Device Nodes are NODE_DEVICE0 through NODE_DEVICE_LAST.
  */
 enum Node_t : uint8_t
 {
     NODE_CONTROL,
-    NODE_DEVICE0,
-    NODE_DEVICE1,
-    NODE_DEVICE2,
+    NODE_DEVICE_INDICES (NODE_DEVICE_ENUM)
     NODE_GROUND,
 
-    NODE_LAST
+    NODE_LAST,
+
+    NODE_DEVICE_LAST = NODE_GROUND - 1
 };
 
 class NetworkManager final 
@@ -116,6 +143,13 @@ public:
      */
     static const uint16_t MAX_RECV_BYTES;
 
+    /**
+     * Period of the flight network's loop. The Control Node runs its loop at
+     * this period and the Device Nodes run one loop per Control Node message,
+     * so both nodes must use this constant rather than their own copies.
+     */
+    static const Time::TimeNs_t LOOP_PERIOD_NS = 10 * Time::NS_IN_MS;
+
     /**
      * IPv4 address type. This is expected to be in "x.x.x.x" format, which each
      * x being a uint8 represented as a string.
@@ -217,6 +251,32 @@ public:
      */
     Error_t send (Node_t kNode, std::vector<uint8_t>& kBuf);
 
+    /**
+     * Send a message to each of the provided nodes. Equivalent to calling send
+     * for each node, except all messages are sent before any of the no-op 
+     * messages so that the last node's message is not delayed by the no-ops 
+     * of the nodes before it. kNodes and kBufs must be the same size. 
+     * Increments message send count once per message sent.
+     *
+     * WARNING: This method will block if the OS send buffer is full.
+     *
+     * @param   kNodes                      Nodes to send messages to.
+     * @param   kBufs                       Data to send to each node.
+     *
+     * @ret     E_SUCCESS                   Messages successfully sent.
+     *          E_VECTORS_DIFF_SIZES        Vector params have different sizes.
+     *          E_EMPTY_BUFFER              One or more of the buffers empty.
+     *          E_INVALID_NODE              One or more node has no channel.
+     *          E_FAILED_TO_SEND_MSG        Failed to send message. Returns as
+     *                                      soon as failure occurs.
+     *          E_UNEXPECTED_SEND_SIZE      Message send length != kBuf size.
+     *                                      Returns as soon as failure occurs.
+     *          E_DATA_VECTOR_WRITE         Failed to increment msgs sent 
+     *                                      counter.
+     */
+    Error_t sendMult (std::vector<Node_t>& kNodes, 
+                      std::vector<std::vector<uint8_t>>& kBufs);
+
     /**
      * Receive a message from a node. kBufRet must already have size equal to
      * expected message size. Blocks until a message is received.
@@ -270,6 +330,10 @@ public:
      * kBufsRet must already have size equal to the expected message size. 
      * kNodes, kBufsRet, and kMsgReceived must be the same size.
      *
+     * If kReturnOnAllReceived is true, returns as soon as at least one message
+     * has been received from every node in kNodes instead of waiting for the
+     * timeout to expire.
+     *
      * Note: The select call has up to 250us of overhead.
      *
      * @param   kTimeoutNs                  Timeout in nanoseconds. Max timeout 
@@ -279,9 +343,13 @@ public:
      * @param   kBufsRet                    Buffers to fill with messages.
      * @param   kNumMsgsReceivedRet         Number of messages received from 
      *                                      each node.
+     * @param   kReturnOnAllReceived        If true, return once every node
+     *                                      has sent at least one message.
      *
      * @ret     E_SUCCESS                   Messages successfully received and
-     *                                      timeout expired.
+     *                                      timeout expired or, if 
+     *                                      kReturnOnAllReceived, all nodes
+     *                                      reported.
      *          E_TIMEOUT_TOO_LARGE         Timeout greater than max.
      *          E_VECTORS_DIFF_SIZES        Vector params have different sizes.
      *          E_EMPTY_BUFFER              One or more of the buffers empty.
@@ -300,7 +368,8 @@ public:
     Error_t recvMult (Time::TimeNs_t kTimeoutNs,
                       std::vector<Node_t> kNodes, 
                       std::vector<std::vector<uint8_t>>& kBufsRet, 
-                      std::vector<uint32_t>& kNumMsgsReceivedRet);
+                      std::vector<uint32_t>& kNumMsgsReceivedRet,
+                      bool kReturnOnAllReceived = false);
 
     /**
      * PUBLIC FOR TESTING PURPOSES ONLY -- DO NOT USE OUTSIDE OF NETWORK MANAGER
@@ -0,0 +1,268 @@
+/**
+ * The Phase Profiler measures how long each phase of a node's loop takes and
+ * writes the results to the Data Vector so that loop overhead is visible in
+ * telemetry. For each phase, both wall time (CLOCK_MONOTONIC) and thread CPU
+ * time (CLOCK_THREAD_CPUTIME_ID) are measured, and the following stats are
+ * written:
+ *
+ *     1) Minimum since the profiler was created.
+ *     2) Maximum since the profiler was created.
+ *     3) 99th percentile of a rolling window of the most recent WINDOW_SIZE
+ *        samples.
+ *
+ * To keep overhead low, stats are only written to the Data Vector every
+ * WRITE_PERIOD samples, starting once the window first fills. Each phase
+ * measurement costs 4 clock_gettime calls.
+ *
+ * How to use:
+ *
+ *     PhaseProfiler::Config_t config =
+ *     {
+ *         PHASE_PROFILER_PHASE_CONFIG (DV_ELEM_CN_COMMS),
+ *         PHASE_PROFILER_PHASE_CONFIG (DV_ELEM_CN_LOOP),
+ *     };
+ *     std::unique_ptr<PhaseProfiler> pPp;
+ *     PhaseProfiler::createNew (config, pDv, pPp);
+ *
+ *     pPp->startPhase (0);
+ *     ...
+ *     pPp->endPhase (0);
+ *
+ * NOTES:
+ *
+ *     #1 Stats are truncated to uint32_t nanoseconds (~4.3 seconds).
+ *
+ *     #2 Wall time includes time the thread was blocked or preempted during the
+ *        phase. CPU time only includes time the thread was running.
+ *
+ *     #3 The profiler must only be used by one thread. To profile a phase run
+ *        on another thread, time it there with getTimes and pass the result to
+ *        addSample from the profiler's thread.
+ */
+
+#ifndef PHASE_PROFILER_HPP
+#define PHASE_PROFILER_HPP
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "DataVector.hpp"
+#include "Errors.hpp"
+#include "Time.hpp"
+
+/********************************* MACROS *************************************/
+
+/**
+ * Create a phase config from an element prefix. The Data Vector must contain
+ * the 6 elements <prefix>_WALL_MIN_NS, <prefix>_WALL_MAX_NS,
+ * <prefix>_WALL_P99_NS, <prefix>_CPU_MIN_NS, <prefix>_CPU_MAX_NS, and
+ * <prefix>_CPU_P99_NS.
+ *
+ * @param  kPrefix  Element prefix, e.g. DV_ELEM_CN_COMMS.
+ */
+#define PHASE_PROFILER_PHASE_CONFIG(kPrefix)                                   \
+    {                                                                          \
+        kPrefix##_WALL_MIN_NS,                                                 \
+        kPrefix##_WALL_MAX_NS,                                                 \
+        kPrefix##_WALL_P99_NS,                                                 \
+        kPrefix##_CPU_MIN_NS,                                                  \
+        kPrefix##_CPU_MAX_NS,                                                  \
+        kPrefix##_CPU_P99_NS                                                   \
+    }
+
+class PhaseProfiler final
+{
+
+public:
+
+    /**
+     * Number of most recent samples per phase used to calculate the 99th
+     * percentile.
+     */
+    static const uint32_t WINDOW_SIZE = 100;
+
+    /**
+     * Number of samples per phase between writes of the phase's stats to the
+     * Data Vector once the window has filled.
+     */
+    static const uint32_t WRITE_PERIOD = 10;
+
+    /**
+     * Data Vector elements to write a phase's stats to. All must be
+     * DV_T_UINT32.
+     */
+    typedef struct PhaseConfig
+    {
+        DataVectorElement_t wallMinNs;
+        DataVectorElement_t wallMaxNs;
+        DataVectorElement_t wallP99Ns;
+        DataVectorElement_t cpuMinNs;
+        DataVectorElement_t cpuMaxNs;
+        DataVectorElement_t cpuP99Ns;
+    } PhaseConfig_t;
+
+    /**
+     * Config. Phase i is configured by element i.
+     */
+    typedef std::vector<PhaseConfig_t> Config_t;
+
+    /**
+     * Entry point for creating a new Phase Profiler. Validates the passed in
+     * config.
+     *
+     * @param   kConfig             Config.
+     * @param   kPDv                Ptr to initialized Data Vector.
+     * @param   kPPpRet             Pointer to store resulting Phase Profiler
+     *                              in.
+     *
+     * @ret     E_SUCCESS           Phase Profiler successfully created.
+     *          E_DATA_VECTOR_NULL  Data Vector ptr null.
+     *          E_EMPTY_CONFIG      Config has no phases.
+     *          E_INVALID_PHASE     More phases than fit in a uint8_t.
+     *          E_INVALID_ELEM      Invalid DV elem in config.
+     *          E_DATA_VECTOR_READ  Failed to read elem types from DV.
+     *          E_INVALID_TYPE      DV elem in config not DV_T_UINT32.
+     */
+    static Error_t createNew (Config_t& kConfig,
+                              std::shared_ptr<DataVector> kPDv,
+                              std::unique_ptr<PhaseProfiler>& kPPpRet);
+
+    /**
+     * Start timing a phase.
+     *
+     * @param   kPhase                Phase to start.
+     *
+     * @ret     E_SUCCESS             Phase started.
+     *          E_INVALID_PHASE       Phase not in config.
+     *          E_FAILED_TO_GET_TIME  Failed to read clocks.
+     */
+    Error_t startPhase (uint8_t kPhase);
+
+    /**
+     * End timing a phase and record the sample in the phase's window. If the
+     * window is full and WRITE_PERIOD samples have been recorded since the
+     * last write, writes the phase's stats to the Data Vector.
+     *
+     * @param   kPhase                Phase to end.
+     *
+     * @ret     E_SUCCESS             Phase ended.
+     *          E_INVALID_PHASE       Phase not in config.
+     *          E_PHASE_NOT_STARTED   Phase not started since last end.
+     *          E_FAILED_TO_GET_TIME  Failed to read clocks.
+     *          E_DATA_VECTOR_WRITE   Failed to write stats to Data Vector.
+     */
+    Error_t endPhase (uint8_t kPhase);
+
+    /**
+     * Record a sample of a phase that was timed with getTimes on another 
+     * thread. Writes the phase's stats to the Data Vector when due, as in
+     * endPhase.
+     *
+     * @param   kPhase               Phase to record.
+     * @param   kWallNs              Wall time of the phase in ns.
+     * @param   kCpuNs               Thread CPU time of the phase in ns.
+     *
+     * @ret     E_SUCCESS            Sample recorded.
+     *          E_INVALID_PHASE      Phase not in config.
+     *          E_DATA_VECTOR_WRITE  Failed to write stats to Data Vector.
+     */
+    Error_t addSample (uint8_t kPhase, uint32_t kWallNs, uint32_t kCpuNs);
+
+    /**
+     * Read wall and thread CPU time. Used to time a phase on a thread other
+     * than the one that owns the profiler. See addSample.
+     *
+     * @param   kWallNsRet            Wall time in ns.
+     * @param   kCpuNsRet             Thread CPU time in ns.
+     *
+     * @ret     E_SUCCESS             Successfully read clocks.
+     *          E_FAILED_TO_GET_TIME  Failed to read clocks.
+     */
+    static Error_t getTimes (Time::TimeNs_t& kWallNsRet,
+                             Time::TimeNs_t& kCpuNsRet);
+
+private:
+
+    /**
+     * Stats for a single phase.
+     */
+    typedef struct PhaseStats
+    {
+        bool                  started;
+        Time::TimeNs_t        wallStartNs;
+        Time::TimeNs_t        cpuStartNs;
+        uint32_t              wallMinNs;
+        uint32_t              wallMaxNs;
+        uint32_t              cpuMinNs;
+        uint32_t              cpuMaxNs;
+        std::vector<uint32_t> wallWindowNs;
+        std::vector<uint32_t> cpuWindowNs;
+        uint32_t              windowIdx;
+        uint32_t              numWindowSamples;
+        uint32_t              numUnwrittenSamples;
+    } PhaseStats_t;
+
+    /**
+     * Data Vector.
+     */
+    std::shared_ptr<DataVector> mPDv;
+
+    /**
+     * Config.
+     */
+    Config_t mConfig;
+
+    /**
+     * Stats for each phase. Phase i's stats are at index i.
+     */
+    std::vector<PhaseStats_t> mStats;
+
+    /**
+     * Scratch buffer used to calculate percentiles without reordering a
+     * window. Windows are ring buffers, so their order must be preserved.
+     */
+    std::vector<uint32_t> mScratchNs;
+
+    /**
+     * Constructor.
+     *
+     * @param   kConfig             Config.
+     * @param   kPDv                Ptr to initialized Data Vector.
+     */
+    PhaseProfiler (Config_t& kConfig, std::shared_ptr<DataVector> kPDv);
+
+    /**
+     * Update a phase's min and max and record a sample in its window. Writes 
+     * the phase's stats if they are due.
+     *
+     * @param   kPhase               Phase to record. Must be valid.
+     * @param   kWallNs              Wall time of the phase in ns.
+     * @param   kCpuNs               Thread CPU time of the phase in ns.
+     *
+     * @ret     E_SUCCESS            Sample recorded.
+     *          E_DATA_VECTOR_WRITE  Failed to write stats to Data Vector.
+     */
+    Error_t recordSample (uint8_t kPhase, uint32_t kWallNs, uint32_t kCpuNs);
+
+    /**
+     * Calculate the 99th percentile of a window.
+     *
+     * @param   kWindowNs  Window of samples. Not modified.
+     *
+     * @ret     99th percentile of samples.
+     */
+    uint32_t calcP99 (std::vector<uint32_t>& kWindowNs);
+
+    /**
+     * Write a phase's stats to the Data Vector.
+     *
+     * @param   kPhase               Phase to write.
+     *
+     * @ret     E_SUCCESS            Successfully wrote stats.
+     *          E_DATA_VECTOR_WRITE  Failed to write stats.
+     */
+    Error_t writeStats (uint8_t kPhase);
+};
+
+#endif
@@ -0,0 +1,244 @@
+/**
+ * The Rate Group Executive decides which tasks (Controllers or Devices) run in
+ * each loop, or minor frame, so that tasks that do not need to run every loop
+ * do not take the same CPU time as tasks that do.
+ *
+ * Each task has a rate divisor d and a phase offset o, and runs in minor frame
+ * f if f % d == o. Tasks with the same divisor form a rate group. A major
+ * frame is MINOR_FRAMES_PER_MAJOR_FRAME minor frames, so every divisor must
+ * evenly divide it. With a 10ms loop:
+ *
+ *      Divisor     Rate
+ *      1           100 Hz
+ *      2            50 Hz
+ *      10           10 Hz
+ *      100           1 Hz
+ *
+ * A task with offset OFFSET_AUTO is assigned the offset that minimizes the
+ * maximum number of tasks running in any minor frame, which spreads slow
+ * tasks across minor frames instead of running them all in frame 0.
+ *
+ * The executive also times each rate group within a minor frame so that if a
+ * frame overruns, the rate group responsible can be identified.
+ *
+ * How to use:
+ *
+ *     RateGroupExecutive::Config_t config =
+ *     {
+ *         {1,   0},                                  // Task 0 at 100 Hz.
+ *         {100, RateGroupExecutive::OFFSET_AUTO},    // Task 1 at 1 Hz.
+ *     };
+ *     std::unique_ptr<RateGroupExecutive> pRge;
+ *     RateGroupExecutive::createNew (config, pRge);
+ *
+ *     // Each loop:
+ *     pRge->startFrame ();
+ *     for (uint32_t i = 0; i < numTasks; i++)
+ *     {
+ *         if (pRge->isScheduled (i) == true)
+ *         {
+ *             pRge->startTask (i);
+ *             ...
+ *             pRge->endTask (i);
+ *         }
+ *     }
+ */
+
+#ifndef RATE_GROUP_EXECUTIVE_HPP
+#define RATE_GROUP_EXECUTIVE_HPP
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "Errors.hpp"
+#include "Time.hpp"
+
+class RateGroupExecutive final
+{
+
+public:
+
+    /**
+     * Number of minor frames in a major frame. Every rate divisor must evenly
+     * divide this.
+     */
+    static const uint8_t MINOR_FRAMES_PER_MAJOR_FRAME = 100;
+
+    /**
+     * Offset value indicating the executive should choose the task's offset.
+     */
+    static const uint8_t OFFSET_AUTO = 0xFF;
+
+    /**
+     * A task's rate. The default runs the task every minor frame.
+     */
+    typedef struct Rate
+    {
+        uint8_t divisor;
+        uint8_t offset;
+    } Rate_t;
+
+    /**
+     * Rate that runs a task every minor frame.
+     */
+    static const Rate_t RATE_EVERY_FRAME;
+
+    /**
+     * Config. Task i's rate is element i.
+     */
+    typedef std::vector<Rate_t> Config_t;
+
+    /**
+     * Entry point for creating a new Rate Group Executive. Validates the
+     * passed in config and assigns offsets to OFFSET_AUTO tasks.
+     *
+     * @param   kConfig             Config.
+     * @param   kPRgeRet            Pointer to store resulting Rate Group
+     *                              Executive in.
+     *
+     * @ret     E_SUCCESS           Rate Group Executive successfully created.
+     *          E_INVALID_RATE      Divisor is 0 or does not evenly divide
+     *                              MINOR_FRAMES_PER_MAJOR_FRAME.
+     *          E_INVALID_OFFSET    Offset is not OFFSET_AUTO and is >= the
+     *                              divisor.
+     */
+    static Error_t createNew (const Config_t& kConfig,
+                              std::unique_ptr<RateGroupExecutive>& kPRgeRet);
+
+    /**
+     * Start the next minor frame. Must be called once per loop before any
+     * tasks run. The first call starts minor frame 0.
+     */
+    void startFrame ();
+
+    /**
+     * Check if a task is scheduled to run in the current minor frame.
+     *
+     * @param   kTask   Task index.
+     *
+     * @ret     true    Task scheduled.
+     *          false   Task not scheduled or invalid.
+     */
+    bool isScheduled (uint32_t kTask) const;
+
+    /**
+     * Get a task's rate, including the offset assigned to OFFSET_AUTO tasks.
+     *
+     * @param   kTask                Task index.
+     * @param   kRateRet             Task's rate.
+     *
+     * @ret     E_SUCCESS            Rate returned.
+     *          E_INVALID_TASK       Task index out of range.
+     */
+    Error_t getRate (uint32_t kTask, Rate_t& kRateRet) const;
+
+    /**
+     * Start timing a task's execution in the current minor frame.
+     *
+     * @param   kTask                Task index.
+     *
+     * @ret     E_SUCCESS            Task timing started.
+     *          E_INVALID_TASK       Task index out of range.
+     *          E_FAILED_TO_GET_TIME Failed to read clock.
+     */
+    Error_t startTask (uint32_t kTask);
+
+    /**
+     * End timing a task's execution and add it to its rate group's time in the
+     * current minor frame.
+     *
+     * @param   kTask                Task index.
+     *
+     * @ret     E_SUCCESS            Task timing ended.
+     *          E_INVALID_TASK       Task index out of range.
+     *          E_FAILED_TO_GET_TIME Failed to read clock.
+     */
+    Error_t endTask (uint32_t kTask);
+
+    /**
+     * Add a task's execution time, measured by the caller, to its rate 
+     * group's time in the current minor frame. Used instead of startTask and
+     * endTask for tasks run in parallel off of the calling thread.
+     *
+     * @param   kTask                Task index.
+     * @param   kTimeNs              Task's execution time.
+     *
+     * @ret     E_SUCCESS            Task time added.
+     *          E_INVALID_TASK       Task index out of range.
+     */
+    Error_t addTaskTime (uint32_t kTask, Time::TimeNs_t kTimeNs);
+
+    /**
+     * Get the divisor of the rate group that took the most execution time in
+     * the current minor frame. Call on a frame overrun, before the next
+     * startFrame, to identify the rate group responsible.
+     *
+     * @param   kDivisorRet  Divisor of rate group. 0 if no task was timed in
+     *                       the current minor frame, which indicates the
+     *                       overrun was caused by work outside of the tasks.
+     */
+    void getHeaviestRateGroup (uint8_t& kDivisorRet) const;
+
+private:
+
+    /**
+     * Rate of each task with offsets assigned.
+     */
+    Config_t mRates;
+
+    /**
+     * Rate group index of each task.
+     */
+    std::vector<uint8_t> mTaskGroups;
+
+    /**
+     * Divisor of each rate group.
+     */
+    std::vector<uint8_t> mGroupDivisors;
+
+    /**
+     * Execution time of each rate group in the current minor frame.
+     */
+    std::vector<Time::TimeNs_t> mGroupTimesNs;
+
+    /**
+     * Start time of the task being timed.
+     */
+    Time::TimeNs_t mTaskStartNs;
+
+    /**
+     * Current minor frame.
+     */
+    uint8_t mFrame;
+
+    /**
+     * Constructor.
+     *
+     * @param   kRates   Rate of each task with offsets assigned.
+     */
+    RateGroupExecutive (const Config_t& kRates);
+
+    /**
+     * Assign an offset to each OFFSET_AUTO task. Tasks with fixed offsets are
+     * placed first, then OFFSET_AUTO tasks in ascending divisor order, since
+     * faster tasks have fewer offsets to choose from. Each is given the offset
+     * that minimizes the maximum number of tasks in the minor frames it runs
+     * in, with ties going to the lowest offset.
+     *
+     * @param   kRates   Rates to assign offsets in.
+     */
+    static void assignOffsets (Config_t& kRates);
+
+    /**
+     * Read the monotonic clock.
+     *
+     * @param   kTimeNsRet            Time in ns.
+     *
+     * @ret     E_SUCCESS             Successfully read clock.
+     *          E_FAILED_TO_GET_TIME  Failed to read clock.
+     */
+    static Error_t getTimeNs (Time::TimeNs_t& kTimeNsRet);
+};
+
+#endif
@@ -0,0 +1,175 @@
+/**
+ * The Sample Trigger aligns a node's sensor sampling to a tick generated by
+ * the FPGA. At each tick the FPGA latches its inputs and asserts an IRQ. The
+ * node waits on the IRQ with waitForTick and then runs its sensor Devices, so
+ * that every Device reads the same latched sample set and the sample-to-frame
+ * phase no longer depends on when the network woke the node.
+ *
+ * How to use:
+ *
+ *     SampleTrigger::Config_t config =
+ *     {
+ *         NiFpga_Irq_0,
+ *         2,
+ *         DV_ELEM_DN0_SAMPLE_TIME_NS,
+ *         DV_ELEM_DN0_SAMPLE_MISS_COUNT,
+ *     };
+ *     std::unique_ptr<SampleTrigger> pSt;
+ *     SampleTrigger::createNew (config, session, pDv, pSt);
+ *
+ *     bool ticked = false;
+ *     pSt->waitForTick (ticked);
+ *     ...run sensor Devices...
+ *
+ * NOTES:
+ *
+ *     #1 A tick asserted before waitForTick is called is stale, since its
+ *        sample set may be up to a tick period old. waitForTick acknowledges
+ *        stale ticks before waiting so that it always returns on a fresh one.
+ *        The tick period therefore bounds the latency added to the caller's
+ *        loop.
+ *
+ *     #2 A tick's IRQs are left asserted until the next waitForTick. A
+ *        bitfile that waits for its IRQs to be acknowledged before latching
+ *        again therefore holds the sample set while the node reads it.
+ *
+ *     #3 The sample time written to the Data Vector is the node's time (see
+ *        Time.hpp) when the tick was observed. It includes the IRQ wakeup
+ *        latency but not the network jitter of the node's loop. The IO
+ *        bitfile does not latch a timestamp with its inputs. If a bitfile
+ *        gains one, only waitForTick needs to change to read it.
+ *
+ *     #4 The IO bitfile does not yet generate ticks. Until it does, the Sample
+ *        Trigger can be exercised against the simulated FPGA. See SimFpga.hpp.
+ *
+ *     #5 If no tick arrives within the timeout, waitForTick returns without a
+ *        tick and counts the miss so that the caller's loop keeps running.
+ */
+
+#ifndef SAMPLE_TRIGGER_HPP
+#define SAMPLE_TRIGGER_HPP
+
+#include <stdint.h>
+#include <memory>
+
+#include "DataVector.hpp"
+#include "Errors.hpp"
+#include "NiFpga.h"
+#include "Time.hpp"
+
+class SampleTrigger final
+{
+
+public:
+
+    /**
+     * Config.
+     */
+    typedef struct Config
+    {
+        uint32_t irqs;                          // IRQs asserted each tick.
+                                                // See NiFpga_Irq.
+        uint32_t timeoutMs;                     // Max time to wait for a
+                                                // tick.
+        DataVectorElement_t dvElemSampleTimeNs; // Elem to write tick time to
+                                                // (uint64_t).
+        DataVectorElement_t dvElemMissCount;    // Elem to count missed ticks
+                                                // in (uint32_t).
+    } Config_t;
+
+    /**
+     * Entry point for creating a new Sample Trigger. Validates the passed in
+     * config and reserves an IRQ context. The Time Module must be
+     * initialized first.
+     *
+     * @param   kConfig             Config.
+     * @param   kSession            Initialized and open FPGA session.
+     * @param   kPDv                Ptr to initialized Data Vector.
+     * @param   kPStRet             Pointer to store resulting Sample Trigger
+     *                              in.
+     *
+     * @ret     E_SUCCESS           Sample Trigger successfully created.
+     *          E_DATA_VECTOR_NULL  Data Vector ptr null.
+     *          E_INVALID_CONFIG    No IRQs, or timeout of 0.
+     *          E_INVALID_ELEM      DV elem in config not in DV or wrong type.
+     *          [other]             Failed to get Time Module.
+     *          E_FPGA_IRQ          Failed to reserve IRQ context.
+     */
+    static Error_t createNew (Config_t& kConfig,
+                              NiFpga_Session& kSession,
+                              std::shared_ptr<DataVector> kPDv,
+                              std::unique_ptr<SampleTrigger>& kPStRet);
+
+    /**
+     * Destructor. Unreserves the IRQ context.
+     */
+    ~SampleTrigger ();
+
+    /**
+     * Acknowledge stale ticks, then wait for the next tick. On a tick, writes
+     * its time to the DV. On timeout, increments the DV miss count.
+     *
+     * @param   kTickedRet            True if a tick arrived, false on timeout.
+     *
+     * @ret     E_SUCCESS             Tick arrived or timed out.
+     *          E_FPGA_IRQ            Failed to acknowledge or wait on IRQs.
+     *          E_FAILED_TO_GET_TIME  Failed to get tick time.
+     *          E_DATA_VECTOR_WRITE   Failed to write to DV.
+     */
+    Error_t waitForTick (bool& kTickedRet);
+
+private:
+
+    /**
+     * FPGA session.
+     */
+    NiFpga_Session mSession;
+
+    /**
+     * Reserved IRQ context.
+     */
+    NiFpga_IrqContext mIrqContext;
+
+    /**
+     * IRQs asserted each tick.
+     */
+    uint32_t mIrqs;
+
+    /**
+     * Max time to wait for a tick.
+     */
+    uint32_t mTimeoutMs;
+
+    /**
+     * DV elems to write tick time and count missed ticks in.
+     */
+    DataVectorElement_t mDvElemSampleTimeNs;
+    DataVectorElement_t mDvElemMissCount;
+
+    /**
+     * Data Vector.
+     */
+    std::shared_ptr<DataVector> mPDv;
+
+    /**
+     * Time Module.
+     */
+    Time* mPTime;
+
+    /**
+     * Constructor. Use createNew.
+     *
+     * @param   kConfig       Verified config.
+     * @param   kSession      FPGA session.
+     * @param   kIrqContext   Reserved IRQ context.
+     * @param   kPDv          Ptr to initialized Data Vector.
+     * @param   kPTime        Time Module.
+     */
+    SampleTrigger (Config_t& kConfig,
+                   NiFpga_Session& kSession,
+                   NiFpga_IrqContext kIrqContext,
+                   std::shared_ptr<DataVector> kPDv,
+                   Time* kPTime);
+};
+
+#endif
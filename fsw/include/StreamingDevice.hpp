@@ -0,0 +1,182 @@
+/**
+ * Device to read a high-rate sensor stream from a target-to-host DMA FIFO.
+ * The FIFO carries raw fxp samples, which the FPGA writes at a rate far higher
+ * than the Device Node loop. Run method drains every full block of samples
+ * from the FIFO, writes the mean, min and max value and the number of samples
+ * to the Data Vector, and copies each block into a preallocated recorder ring.
+ * The full-rate stream is then written to a local file by recordBlocks, which
+ * should be called from a low-priority thread so that file I/O never runs in
+ * the loop.
+ *
+ * NOTES:
+ *
+ *   (1) Blocks are acquired from the FIFO without waiting and aggregated in
+ *       place in the FIFO's DMA memory, so the samples are never copied
+ *       between the FPGA and the decimated outputs. Each block is copied once,
+ *       into the recorder ring, before it is released back to the FIFO.
+ *
+ *   (2) A run drains at most as many blocks as fit in the FIFO, so its
+ *       duration is bounded even if the FPGA writes faster than the loop
+ *       drains. Samples that do not fill a block are left for the next run.
+ *       If no full block was available, the stats are left unchanged and the
+ *       sample count is written as 0.
+ *
+ *   (3) run and recordBlocks may be called from different threads, but each
+ *       from only one. If the recorder ring is full, the block is dropped from
+ *       the recording (but not from the stats) and counted in the dropped
+ *       blocks elem.
+ *
+ *   (4) The FIFO is read through a FifoBackend. If the config does not
+ *       provide one, the device reads the FPGA FIFO given by the config. The
+ *       bitfile in this tree has no DMA FIFO, so the device is exercised off
+ *       target through a mock backend. See MockFifoBackend.hpp in
+ *       fsw/tests/include.
+ */
+
+#ifndef STREAMING_DEVICE_HPP
+#define STREAMING_DEVICE_HPP
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "Device.hpp"
+#include "FifoBackend.hpp"
+
+class StreamingDevice final : public Device
+{
+public:
+    /**
+     * Device configuration.
+     */
+    typedef struct
+    {
+        uint32_t fifo;                         // FPGA FIFO resource id.
+        std::shared_ptr<FifoBackend> pFifo;    // FIFO backend, or nullptr to
+                                               // read the FPGA FIFO.
+        uint32_t fifoDepth;                    // Host FIFO depth in samples.
+        uint32_t blockSize;                    // Samples per block.
+        uint32_t numRecorderBlocks;            // Power of 2.
+        NiFpga_FxpTypeInfo fxpTypeInfo;        // Fxp type of each sample.
+        DataVectorElement_t dvElemOutputMean;  // Elem to write mean to.
+        DataVectorElement_t dvElemOutputMin;   // Elem to write min to.
+        DataVectorElement_t dvElemOutputMax;   // Elem to write max to.
+        DataVectorElement_t dvElemNumSamples;  // Elem to write sample count
+                                               // to (uint32_t).
+        DataVectorElement_t dvElemNumDropped;  // Elem to write dropped block
+                                               // count to (uint32_t).
+    } Config_t;
+
+    /**
+     * Derived device constructor. This must be public so that it is visible to
+     * Device::createNew.
+     *
+     * @param   kSession    Initialized and open FPGA session.
+     * @param   kDataVector Node's Data Vector.
+     * @param   kConfig     Device config.
+     * @param   kRet        E_SUCCESS            Config valid.
+     *                      E_INVALID_ELEM       Output elems not in DV or wrong
+     *                                           type.
+     *                      E_INCORRECT_SIZE     Block size 0, FIFO depth not a
+     *                                           multiple of block size, or
+     *                                           recorder ring size not a power
+     *                                           of 2.
+     *                      E_FPGA_FIFO          Failed to start FIFO.
+     */
+    StreamingDevice (NiFpga_Session& kSession,
+                     std::shared_ptr<DataVector> kPDataVector,
+                     Config_t& kConfig,
+                     Error_t& kRet);
+
+    /**
+     * Validates the device config.
+     *
+     * @param   kConfig              Config to validate.
+     *
+     * @ret     E_SUCCESS            Config valid.
+     *          E_INVALID_ELEM       Output elems not in DV or wrong type.
+     *          E_INCORRECT_SIZE     Block size 0, FIFO depth not a multiple of
+     *                               block size, or recorder ring size not a
+     *                               power of 2.
+     */
+    Error_t verifyConfig (Config_t& kConfig);
+
+    /**
+     * Drains full blocks from the FIFO, writes their stats to the DV, and
+     * queues them for the recorder. See note (2) at the top of this file.
+     *
+     * @ret     E_SUCCESS           Run succeeded.
+     *          E_FPGA_FIFO         Failed to read FIFO.
+     *          E_DATA_VECTOR_WRITE Failed to write to DV.
+     */
+    Error_t run ();
+
+    /**
+     * Writes every block queued since the last call to kOut as raw samples,
+     * then frees their slots in the recorder ring.
+     *
+     * @param   kOut                    Stream to write to.
+     * @param   kNumBlocksRet           Number of blocks written.
+     *
+     * @ret     E_SUCCESS               Blocks written.
+     *          E_FAILED_TO_WRITE_FILE  Failed to write to stream.
+     */
+    Error_t recordBlocks (std::ostream& kOut, uint32_t& kNumBlocksRet);
+
+private:
+    /**
+     * FIFO backend.
+     */
+    std::shared_ptr<FifoBackend> mPFifo;
+
+    /**
+     * Samples per block and max blocks drained per run.
+     */
+    uint32_t mBlockSize;
+    uint32_t mMaxBlocksPerRun;
+
+    /**
+     * Fxp type of each sample.
+     */
+    NiFpga_FxpTypeInfo mFxpTypeInfo;
+
+    /**
+     * DV elements to which stats are written.
+     */
+    DataVectorElement_t mDvElemOutputMean;
+    DataVectorElement_t mDvElemOutputMin;
+    DataVectorElement_t mDvElemOutputMax;
+    DataVectorElement_t mDvElemNumSamples;
+    DataVectorElement_t mDvElemNumDropped;
+
+    /**
+     * Total blocks dropped from the recording.
+     */
+    uint32_t mNumDropped;
+
+    /**
+     * Ring of blocks waiting to be recorded. Its size in blocks is a power of
+     * 2 so that the free-running block indices below can be masked into it
+     * across wraparound.
+     */
+    std::vector<uint32_t> mRecorderRing;
+    uint32_t mRecorderMask;
+
+    /**
+     * Number of blocks written to and read from the recorder ring. Written
+     * only by run and recordBlocks, respectively.
+     */
+    std::atomic<uint32_t> mRecorderHead;
+    std::atomic<uint32_t> mRecorderTail;
+
+    /**
+     * Queue one block for the recorder, or count it as dropped if the ring is
+     * full.
+     *
+     * @param   kPBlock   Block of mBlockSize samples.
+     */
+    void queueBlock (const uint32_t* kPBlock);
+};
+
+#endif
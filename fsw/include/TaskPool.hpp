@@ -0,0 +1,243 @@
+/**
+ * The Task Pool runs a batch of independent tasks in parallel on a small set of
+ * pinned worker threads and the calling thread, and returns once every task in
+ * the batch has finished. It is used by the Device Node to run independent
+ * Devices and Controllers on both of the sbRIO's cores.
+ *
+ * Scheduling is work-stealing. When a batch starts, its tasks are split into
+ * one contiguous range per participant (the caller and each worker). Each
+ * participant runs tasks from the back of its own range and, once its range is
+ * empty, steals tasks from the front of the other participants' ranges. This
+ * balances uneven task times without a shared queue. Each range is a single
+ * atomic word, so taking or stealing a task is one compare-and-swap.
+ *
+ * How to use:
+ *
+ *     TaskPool::Config_t config = {{ThreadManager::Affinity_t::CORE_0},
+ *                                  ThreadManager::MIN_NEW_THREAD_PRIORITY};
+ *     std::unique_ptr<TaskPool> pPool;
+ *     TaskPool::createNew (config, pPool);
+ *
+ *     // Each loop:
+ *     std::vector<TaskPool::Task_t> tasks = {{fTask, pArg, E_SUCCESS}, ...};
+ *     pPool->run (tasks);
+ *     // tasks[i].ret now contains task i's return value.
+ *
+ * NOTES:
+ *
+ *     #1 Tasks in a batch may run in any order and concurrently, so they must
+ *        not depend on each other's results. Any shared state they access must
+ *        be thread-safe. The Data Vector is.
+ *
+ *     #2 Workers block between batches, so an idle pool uses no CPU time. The
+ *        caller always participates in a batch, so a pool with 0 workers runs
+ *        the batch serially on the calling thread.
+ *
+ *     #3 run must only be called by one thread at a time.
+ */
+
+#ifndef TASK_POOL_HPP
+#define TASK_POOL_HPP
+
+#include <pthread.h>
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Errors.hpp"
+#include "ThreadManager.hpp"
+
+class TaskPool final
+{
+
+public:
+
+    /**
+     * Max number of worker threads.
+     */
+    static const uint8_t MAX_WORKERS = 8;
+
+    /**
+     * Task function type.
+     *
+     * @param   kPArg   Task argument.
+     *
+     * @ret     Task's return value.
+     */
+    typedef Error_t (*TaskFunc_t) (void* kPArg);
+
+    /**
+     * A task. ret is set to the task function's return value when the task
+     * runs.
+     */
+    typedef struct Task
+    {
+        TaskFunc_t func;
+        void*      pArg;
+        Error_t    ret;
+    } Task_t;
+
+    /**
+     * Config. One worker thread is created per affinity in workerAffinities.
+     */
+    typedef struct Config
+    {
+        std::vector<ThreadManager::Affinity_t> workerAffinities;
+        ThreadManager::Priority_t              priority;
+    } Config_t;
+
+    /**
+     * Entry point for creating a new Task Pool. Validates the passed in config
+     * and creates the worker threads.
+     *
+     * @param   kConfig                 Config.
+     * @param   kPPoolRet               Pointer to store resulting Task Pool
+     *                                  in.
+     *
+     * @ret     E_SUCCESS               Task Pool successfully created.
+     *          E_INVALID_NUM_WORKERS   More than MAX_WORKERS workers.
+     *          E_FAILED_TO_INIT_LOCK   Failed to initialize lock.
+     *          E_FAILED_TO_INIT_COND   Failed to initialize condition
+     *                                  variable.
+     *          [other]                 Error returned by ThreadManager.
+     */
+    static Error_t createNew (const Config_t& kConfig,
+                              std::unique_ptr<TaskPool>& kPPoolRet);
+
+    /**
+     * Destructor. Stops and waits for the worker threads.
+     */
+    ~TaskPool ();
+
+    /**
+     * Run a batch of tasks in parallel and block until every task has run.
+     * Each task's return value is stored in its ret field.
+     *
+     * @param   kTasks                    Tasks to run.
+     *
+     * @ret     E_SUCCESS                 All tasks run. Check each task's ret
+     *                                    for task errors.
+     *          E_FAILED_TO_LOCK          Failed to lock pool lock.
+     *          E_FAILED_TO_UNLOCK        Failed to unlock pool lock.
+     *          E_FAILED_TO_SIGNAL_COND   Failed to wake workers.
+     *          E_FAILED_TO_WAIT_ON_COND  Failed to wait for workers.
+     */
+    Error_t run (std::vector<Task_t>& kTasks);
+
+private:
+
+    /**
+     * Args passed to each worker thread.
+     */
+    typedef struct WorkerArgs
+    {
+        TaskPool* pPool;
+        uint8_t   participant;
+    } WorkerArgs_t;
+
+    /**
+     * Worker threads.
+     */
+    std::vector<pthread_t> mWorkers;
+
+    /**
+     * Range of task indices not yet taken by each participant, packed as
+     * (first << 32) | end. Participant 0 is the caller of run and participant
+     * i + 1 is worker i.
+     */
+    std::unique_ptr<std::atomic<uint64_t>[]> mRanges;
+
+    /**
+     * Number of participants.
+     */
+    uint8_t mNumParticipants;
+
+    /**
+     * Tasks in the current batch.
+     */
+    Task_t* mPTasks;
+
+    /**
+     * Number of tasks in the current batch that have not finished.
+     */
+    std::atomic<uint32_t> mNumRemaining;
+
+    /**
+     * Incremented each time a batch starts. Protected by mLock.
+     */
+    uint32_t mBatchId;
+
+    /**
+     * True when the workers should exit. Protected by mLock.
+     */
+    bool mShutdown;
+
+    /**
+     * Lock and condition variables used to wake the workers when a batch
+     * starts and the caller when a batch finishes.
+     */
+    pthread_mutex_t mLock;
+    pthread_cond_t  mBatchCond;
+    pthread_cond_t  mDoneCond;
+
+    /**
+     * Constructor. Initializes the lock and condition variables.
+     *
+     * @param   kNumWorkers  Number of worker threads.
+     * @param   kRet         E_SUCCESS or E_FAILED_TO_INIT_LOCK or
+     *                       E_FAILED_TO_INIT_COND.
+     */
+    TaskPool (uint8_t kNumWorkers, Error_t& kRet);
+
+    /**
+     * Take the task at the end of a participant's range.
+     *
+     * @param   kParticipant  Participant whose range to take from.
+     * @param   kTaskRet      Index of task taken.
+     *
+     * @ret     true          Task taken.
+     *          false         Range empty.
+     */
+    bool takeTask (uint8_t kParticipant, uint32_t& kTaskRet);
+
+    /**
+     * Steal the task at the front of a participant's range.
+     *
+     * @param   kParticipant  Participant whose range to steal from.
+     * @param   kTaskRet      Index of task stolen.
+     *
+     * @ret     true          Task stolen.
+     *          false         Range empty.
+     */
+    bool stealTask (uint8_t kParticipant, uint32_t& kTaskRet);
+
+    /**
+     * Run tasks from a participant's own range, then steal from the other
+     * participants until every range is empty.
+     *
+     * @param   kParticipant              Participant running tasks.
+     *
+     * @ret     E_SUCCESS                 No tasks left to take.
+     *          E_FAILED_TO_LOCK          Failed to lock pool lock.
+     *          E_FAILED_TO_UNLOCK        Failed to unlock pool lock.
+     *          E_FAILED_TO_SIGNAL_COND   Failed to signal batch done.
+     */
+    Error_t runTasks (uint8_t kParticipant);
+
+    /**
+     * Worker thread function. Waits for a batch, runs tasks, and repeats
+     * until the pool is destroyed.
+     *
+     * @param   kRawArgs                  Pointer to WorkerArgs_t.
+     *
+     * @ret     E_SUCCESS                 Pool destroyed.
+     *          E_FAILED_TO_LOCK          Failed to lock pool lock.
+     *          E_FAILED_TO_UNLOCK        Failed to unlock pool lock.
+     *          E_FAILED_TO_WAIT_ON_COND  Failed to wait for a batch.
+     *          E_FAILED_TO_SIGNAL_COND   Failed to signal batch done.
+     */
+    static void* workerFunc (void* kRawArgs);
+};
+
+#endif
@@ -31,6 +31,16 @@
  * For all fsw and time-critical kernel threads the SCHED_FIFO scheduling policy 
  * will be used. This policy schedules the highest priority thread until it has 
  * blocked or exited. 
+ *
+ * Periodic threads may instead use SCHED_DEADLINE by passing DeadlineParams_t 
+ * on creation. The kernel reserves the thread's runtime every period, admits 
+ * the thread only if the reservation fits the available bandwidth, and runs
+ * SCHED_DEADLINE threads before any SCHED_FIFO thread. A SCHED_DEADLINE thread
+ * that exceeds its runtime is throttled until its next period, so a 
+ * misbehaving thread cannot steal bandwidth reserved for the control loop, 
+ * and lower priority SCHED_FIFO threads such as a logger keep the bandwidth 
+ * left over. Note that SCHED_DEADLINE threads also preempt the IRQ threads 
+ * below, so their total runtime should leave room for interrupt servicing.
  * 
  * 
  * SCHEDULING PRIORITIES:
@@ -59,6 +69,9 @@
  *    real-time priority range to give to FSW threads (which should run at 
  *    priorities lower than these threads).
  *
+ *    The threads are found by name in /proc on initialization, so any 
+ *    number of CPUs is supported.
+ *
  *    Note: The hardware serviced by the ksoftird/n threads is listed in 
  *          kernel/softirq.c in the kernel source.
  * 
@@ -89,17 +102,35 @@
  *      Max new thread priority      = MAX_NEW_THREAD_PRIORITY   = 12
  *      Min new thread priority      = MIN_NEW_THREAD_PRIORITY   = 2 
  *      RCU Threads                  = RCU_PRIORITY              = 1 (default) 
+ *
+ *
+ *                    ---------- CPU AFFINITY ------------
+ *
+ * Threads are pinned to a CpuSet_t, a bitmask of up to MAX_CPUS CPUs, so the
+ * same binary can be tuned on hosts with more cores than the sbRIO. The
+ * Affinity_t values used on the sbRIO convert implicitly to a CpuSet_t.
+ *
+ * By default the kernel may service a device's hardware interrupts on any 
+ * CPU. Use steerIrqs to pin the NIC's interrupts to the CPU running the 
+ * node's comms so that network interrupts do not preempt other fsw threads.
  */
 
 #ifndef THREAD_MANAGER_HPP
 #define THREAD_MANAGER_HPP
 
+#include <errno.h>
 #include <stdint.h>
 #include <pthread.h>
+#include <time.h>
+#include <sys/types.h>
+#include <atomic>
+#include <memory>
 #include <vector>
 #include <string>
 
+#include "DataVector.hpp"
 #include "Errors.hpp"
+#include "Time.hpp"
 
 class ThreadManager final 
 {
@@ -145,7 +176,9 @@ public:
     typedef uint8_t Priority_t;
 
     /**
-     * CPU affinity possibilities for new threads.
+     * CPU affinity possibilities for new threads on the sbRIO's 2 cores. ALL 
+     * is every online CPU (see getOnlineCpus). For other CPU sets, use 
+     * CpuSet_t.
      */
     enum Affinity_t : uint8_t
     {
@@ -155,6 +188,153 @@ public:
         LAST
     };
 
+    /**
+     * What a periodic thread does after it overruns its period. In both cases
+     * the error handler is first called with E_MISSED_SCHEDULER_DEADLINE.
+     *
+     *   OVERRUN_POLICY_SKIP      Skip the releases that passed during the 
+     *                            overrun. The thread next runs at the first 
+     *                            release time after the overrun ends, so the
+     *                            frame after an overrun is dropped.
+     *   OVERRUN_POLICY_CATCH_UP  Run the releases that passed during the 
+     *                            overrun back-to-back, so that the thread runs
+     *                            once for every period. If more than 
+     *                            MAX_CATCH_UP_PERIODS releases passed, only 
+     *                            the last MAX_CATCH_UP_PERIODS are run and the
+     *                            earlier ones are skipped, so that sustained 
+     *                            overload does not build an unbounded backlog.
+     *                            The back-to-back runs do not report further 
+     *                            deadline misses.
+     */
+    enum OverrunPolicy_t : uint8_t
+    {
+        OVERRUN_POLICY_SKIP,
+        OVERRUN_POLICY_CATCH_UP,
+
+        OVERRUN_POLICY_LAST
+    };
+
+    /**
+     * Max number of missed releases a thread with OVERRUN_POLICY_CATCH_UP 
+     * runs back-to-back after an overrun.
+     */
+    static const uint8_t MAX_CATCH_UP_PERIODS = 4;
+
+    /**
+     * SCHED_DEADLINE params for a periodic thread. The thread's period is the
+     * SCHED_DEADLINE period.
+     *
+     *   runtimeNs    CPU time reserved for the thread each period. Must be 
+     *                >= MIN_DEADLINE_RUNTIME_NS. 0 to use SCHED_FIFO instead.
+     *   deadlineNs   Time after each period starts by which the runtime must
+     *                be provided. Must be >= runtimeNs and <= the period. 0 
+     *                for a deadline equal to the period.
+     */
+    typedef struct DeadlineParams
+    {
+        Time::TimeNs_t runtimeNs;
+        Time::TimeNs_t deadlineNs;
+    } DeadlineParams_t;
+
+    /**
+     * DeadlineParams_t to use SCHED_FIFO.
+     */
+    static const DeadlineParams_t NO_DEADLINE;
+
+    /**
+     * Min SCHED_DEADLINE runtime supported by the kernel.
+     */
+    static const Time::TimeNs_t MIN_DEADLINE_RUNTIME_NS = 1024;
+
+    /**
+     * Max time createPeriodicThread waits for a new thread to switch itself 
+     * to SCHED_DEADLINE.
+     */
+    static const Time::TimeNs_t DEADLINE_SWITCH_TIMEOUT_NS = 
+        100 * Time::NS_IN_MS;
+
+    /**
+     * Max number of CPUs a CpuSet_t can contain.
+     */
+    static const uint8_t MAX_CPUS = 64;
+
+    /**
+     * Set of CPUs a thread may run on. Bit i of mask is set if the thread may
+     * run on CPU i. Implicitly constructed from an Affinity_t so that either 
+     * can be passed to the thread creation methods. An Affinity_t of LAST
+     * results in an empty, and therefore invalid, set.
+     */
+    typedef struct CpuSet
+    {
+        uint64_t mask;
+
+        explicit CpuSet (uint64_t kMask = 0) : mask (kMask) {}
+        CpuSet (Affinity_t kAffinity);
+    } CpuSet_t;
+
+    /**
+     * A per-CPU kernel thread, e.g. ksoftirqd/1.
+     */
+    typedef struct KernelThread
+    {
+        pid_t   pid;
+        uint8_t cpu;
+    } KernelThread_t;
+
+    /**
+     * Number of buckets in a periodic thread stats histogram.
+     */
+    static const uint8_t NUM_HISTOGRAM_BUCKETS = 16;
+
+    /**
+     * Exclusive upper bound in ns of each histogram bucket, in ascending 
+     * order. The last bucket holds all samples >= the last bound.
+     */
+    static const uint32_t HISTOGRAM_BUCKET_BOUNDS_NS[NUM_HISTOGRAM_BUCKETS - 1];
+
+    /**
+     * Histogram of a periodic thread timing metric.
+     */
+    typedef struct Histogram
+    {
+        uint32_t counts[NUM_HISTOGRAM_BUCKETS];
+        uint32_t maxNs;
+        uint32_t numSamples;
+    } Histogram_t;
+
+    /**
+     * Timing stats of a periodic thread. For each period, where release is the
+     * time the thread should have woken up, wake is the time it did, and end 
+     * is the time the thread function returned:
+     *
+     *      releaseJitter  = wake - release
+     *      execution      = end - wake
+     *      response       = end - release
+     *
+     * Response time approaching the period is an early warning of a deadline
+     * miss.
+     */
+    typedef struct PeriodicThreadStats
+    {
+        Histogram_t releaseJitter;
+        Histogram_t execution;
+        Histogram_t response;
+    } PeriodicThreadStats_t;
+
+    /**
+     * Data Vector elements to mirror a periodic thread's stats to. All must be
+     * DV_T_UINT32.
+     */
+    typedef struct PeriodicThreadStatsDvConfig
+    {
+        DataVectorElement_t releaseJitterMaxNs;
+        DataVectorElement_t releaseJitterP99Ns;
+        DataVectorElement_t executionMaxNs;
+        DataVectorElement_t executionP99Ns;
+        DataVectorElement_t responseMaxNs;
+        DataVectorElement_t responseP99Ns;
+    } PeriodicThreadStatsDvConfig_t;
+
     /**
      * Max priority for new threads.
      */
@@ -198,7 +378,9 @@ public:
      * @param   kPriority                   Priority to set new thread. Must be
      *                                      >= MIN_NEW_THREAD_PRIORITY and <= 
      *                                      MAX_NEW_THREAD_PRIORITY.
-     * @param   kCpuAffinity                CPU affinity for new thread.
+     * @param   kCpuAffinity                CPUs new thread may run on. Must
+     *                                      be non-empty and only contain
+     *                                      online CPUs.
      * 
      * @ret     E_SUCCESS                   Successfully created new thread.
      *          E_INVALID_POINTER           Invalid pFunc param.
@@ -217,7 +399,7 @@ public:
      */
     Error_t createThread (pthread_t& kThread, ThreadFunc_t kFunc, 
                           void* kPArgs, uint32_t kNumArgBytes, 
-                          Priority_t kPriority, Affinity_t kCpuAffinity);
+                          Priority_t kPriority, CpuSet_t kCpuAffinity);
 
     /**
      * Create a periodic thread with SCHED_FIFO scheduling policy. All created 
@@ -226,6 +408,17 @@ public:
      * Note: Affinity is set after thread is created due to pthread API 
      *       limitations.
      *
+     * Note: Release jitter, execution time, and response time are recorded
+     *       each period. See getPeriodicThreadStats.
+     *
+     * Note: The thread function is first called immediately after the thread
+     *       starts. Each following call is released at an absolute time equal
+     *       to the previous release time plus the period, so that the time
+     *       taken to wake up does not accumulate as drift. If a call overruns
+     *       its period, the error handler is called with 
+     *       E_MISSED_SCHEDULER_DEADLINE and the releases that were missed are
+     *       skipped rather than run back-to-back.
+     *
      * Warning: If there is a timer error in the periodic implementation, the 
      *          thread will exit. This is explicitly not tolerated, as a timer
      *          failure is a critical system error.
@@ -243,14 +436,26 @@ public:
      * @param   kPriority                   Priority to set new thread. Must be
      *                                      >= MIN_NEW_THREAD_PRIORITY and <= 
      *                                      MAX_NEW_THREAD_PRIORITY.
-     * @param   kCpuAffinity                CPU affinity for new thread.
+     * @param   kCpuAffinity                CPUs new thread may run on. Must
+     *                                      be non-empty and only contain
+     *                                      online CPUs.
      * @param   kPeriodMs                   Period of thread in ms.
      * @param   kErrorHandlerFunc           Callback function in case of error
      *                                      during execution of periodic thread
      *                                      or deadline miss.
+     * @param   kDeadlineParams             If runtimeNs is non-zero, the 
+     *                                      thread switches to SCHED_DEADLINE
+     *                                      with these params before its first
+     *                                      period, and kPriority only applies
+     *                                      until then. kCpuAffinity must then
+     *                                      contain every online CPU, as 
+     *                                      required by the kernel's admission
+     *                                      control.
      * 
      * @ret     E_SUCCESS                   Successfully created new thread.
      *          E_INVALID_POINTER           Invalid function pointer.
+     *          E_INVALID_PERIOD            Period is 0.
+     *          E_INVALID_DEADLINE          Deadline params invalid.
      *          E_INVALID_ARGS_LENGTH       Args length invalid.
      *          E_INVALID_PRIORITY          Priority invalid.
      *          E_INVALID_AFFINITY          CPU affinity invalid.
@@ -263,12 +468,171 @@ public:
      *                                      inheritance.
      *          E_FAILED_TO_CREATE_THREAD   Failed to create thread.
      *          E_FAILED_TO_SET_AFFINITY    Failed to set thread affinity.
+     *          E_DEADLINE_ADMISSION_FAILED Kernel rejected the SCHED_DEADLINE
+     *                                      reservation because it does not fit
+     *                                      the available bandwidth.
+     *          E_FAILED_TO_SET_DEADLINE    Failed to set SCHED_DEADLINE.
+     *          E_DEADLINE_SWITCH_TIMED_OUT Thread did not report switching to
+     *                                      SCHED_DEADLINE within 
+     *                                      DEADLINE_SWITCH_TIMEOUT_NS, e.g. 
+     *                                      because it was not scheduled. The
+     *                                      thread exits without running once
+     *                                      scheduled, and must still be 
+     *                                      waited on with waitForThread.
      */
     Error_t createPeriodicThread (pthread_t& kThread, ThreadFunc_t kFunc, 
                                   void* kPArgs, uint32_t kNumArgBytes, 
-                                  Priority_t kPriority, Affinity_t kCpuAffinity, 
+                                  Priority_t kPriority, CpuSet_t kCpuAffinity, 
                                   uint32_t kPeriodMs, 
-                                  ErrorHandler_t kErrorHandlerFunc);
+                                  ErrorHandler_t kErrorHandlerFunc,
+                                  DeadlineParams_t kDeadlineParams = 
+                                      NO_DEADLINE);
+
+    /**
+     * Create a periodic thread with a period specified in ns. Use this instead
+     * of createPeriodicThread for periods that are not a whole number of ms.
+     * See createPeriodicThread for details.
+     *
+     * @param   kThread                     pthread_t for new thread.
+     * @param   kFunc                       Function new thread will execute
+     *                                      periodically.
+     * @param   kPArgs                      Pointer to arguments passed to new 
+     *                                      thread's function.
+     * @param   kNumArgBytes                Number of bytes pArgs points to.
+     * @param   kPriority                   Priority to set new thread.
+     * @param   kCpuAffinity                CPUs new thread may run on. Must
+     *                                      be non-empty and only contain
+     *                                      online CPUs.
+     * @param   kPeriodNs                   Period of thread in ns.
+     * @param   kErrorHandlerFunc           Callback function in case of error
+     *                                      during execution of periodic thread
+     *                                      or deadline miss.
+     * @param   kDeadlineParams             SCHED_DEADLINE params. See 
+     *                                      createPeriodicThread.
+     * 
+     * @ret     E_SUCCESS                   Successfully created new thread.
+     *          E_INVALID_PERIOD            Period is 0.
+     *          [other]                     See createPeriodicThread.
+     */
+    Error_t createPeriodicThreadNs (pthread_t& kThread, ThreadFunc_t kFunc, 
+                                    void* kPArgs, uint32_t kNumArgBytes, 
+                                    Priority_t kPriority, 
+                                    CpuSet_t kCpuAffinity, 
+                                    Time::TimeNs_t kPeriodNs, 
+                                    ErrorHandler_t kErrorHandlerFunc,
+                                    DeadlineParams_t kDeadlineParams = 
+                                        NO_DEADLINE);
+
+    /**
+     * Create a periodic thread that runs a task each period. Use this instead
+     * of createPeriodicThread to run an object or lambda without passing its
+     * state through a void* args buffer. The task's type is known at compile
+     * time, so the task's body can be inlined into the periodic loop. See 
+     * createPeriodicThread for scheduling details. Defined in the header so 
+     * that each task type does not need to be instantiated explicitly.
+     *
+     * Task_T must either have a method Error_t run () or be callable as 
+     * Error_t (), e.g. a lambda. If it has both, run is called.
+     *
+     * The task is copied into state owned by the thread, so it need not 
+     * outlive this call. To run an object that cannot be copied, e.g. a 
+     * Controller or Device, pass a lambda that captures a pointer to it. The
+     * object must then outlive the thread.
+     *
+     * @param   kThread                     pthread_t for new thread.
+     * @param   kTask                       Task new thread will run 
+     *                                      periodically.
+     * @param   kPriority                   Priority to set new thread.
+     * @param   kCpuAffinity                CPUs new thread may run on. Must
+     *                                      be non-empty and only contain
+     *                                      online CPUs.
+     * @param   kPeriodNs                   Period of thread in ns.
+     * @param   kErrorHandlerFunc           Callback function in case of error
+     *                                      returned by task or deadline miss.
+     * @param   kOverrunPolicy              What the thread does after it 
+     *                                      overruns its period.
+     * @param   kDeadlineParams             SCHED_DEADLINE params. See 
+     *                                      createPeriodicThread.
+     * 
+     * @ret     E_SUCCESS                   Successfully created new thread.
+     *          E_INVALID_POINTER           Error handler null.
+     *          E_INVALID_PERIOD            Period is 0.
+     *          E_INVALID_ENUM              Invalid overrun policy.
+     *          [other]                     See createPeriodicThread.
+     */
+    template <class Task_T>
+    Error_t createPeriodicTask (pthread_t& kThread, const Task_T& kTask,
+                                Priority_t kPriority, CpuSet_t kCpuAffinity,
+                                Time::TimeNs_t kPeriodNs,
+                                ErrorHandler_t kErrorHandlerFunc,
+                                OverrunPolicy_t kOverrunPolicy = 
+                                    OVERRUN_POLICY_SKIP,
+                                DeadlineParams_t kDeadlineParams = 
+                                    NO_DEADLINE)
+    {
+        PeriodicMetadata_t metadata = {kPeriodNs, nullptr, nullptr,
+                                       kErrorHandlerFunc, kOverrunPolicy,
+                                       kDeadlineParams};
+        std::unique_ptr<PeriodicThread> pPeriodic (
+                            new PeriodicTaskThread<Task_T> (metadata, kTask));
+        return this->createPeriodicThreadImpl (
+                                        kThread, 
+                                        &periodicTaskWrapperFunc<Task_T>,
+                                        std::move (pPeriodic), kPriority, 
+                                        kCpuAffinity);
+    }
+
+    /**
+     * Get a snapshot of a periodic thread's timing stats. Stats are recorded 
+     * by the periodic thread into lock-free histograms, so this may be called
+     * while the thread runs, including from the periodic thread itself. The 
+     * snapshot is not taken atomically, so a histogram's counts may include 
+     * up to one sample more or less than its numSamples.
+     *
+     * Note: Counts wrap after 2^32 samples.
+     *
+     * @param   kThread                     Periodic thread.
+     * @param   kStatsRet                   Snapshot of stats.
+     *
+     * @ret     E_SUCCESS                   Successfully read stats.
+     *          E_THREAD_NOT_FOUND          Thread not found.
+     *          E_NOT_PERIODIC_THREAD       Thread not created with 
+     *                                      createPeriodicThread, 
+     *                                      createPeriodicThreadNs, or
+     *                                      createPeriodicTask.
+     */
+    Error_t getPeriodicThreadStats (const pthread_t& kThread, 
+                                    PeriodicThreadStats_t& kStatsRet);
+
+    /**
+     * Mirror a periodic thread's max and 99th percentile stats to the Data 
+     * Vector for telemetry.
+     *
+     * @param   kThread                     Periodic thread.
+     * @param   kPDv                        Data Vector to write to.
+     * @param   kConfig                     Elements to write to.
+     *
+     * @ret     E_SUCCESS                   Successfully wrote stats.
+     *          E_DATA_VECTOR_NULL          Data Vector ptr null.
+     *          E_THREAD_NOT_FOUND          Thread not found.
+     *          E_NOT_PERIODIC_THREAD       Thread not periodic.
+     *          E_DATA_VECTOR_WRITE         Failed to write stats.
+     */
+    Error_t writePeriodicThreadStats (
+                                const pthread_t& kThread,
+                                std::shared_ptr<DataVector> kPDv,
+                                const PeriodicThreadStatsDvConfig_t& kConfig);
+
+    /**
+     * Estimate the 99th percentile of a histogram. Returns the upper bound of
+     * the bucket containing the 99th percentile sample, or the histogram's max
+     * if that is lower or the sample is in the last bucket.
+     *
+     * @param   kHistogram  Histogram.
+     *
+     * @ret     99th percentile estimate in ns. 0 if histogram is empty.
+     */
+    static uint32_t calcHistogramP99Ns (const Histogram_t& kHistogram);
 
     /**
      * Block until specified thread returns. Waiting on an invalid thread has
@@ -285,18 +649,75 @@ public:
      */
     Error_t waitForThread (pthread_t& kThread, Error_t& kThreadRet); 
 
+    /**
+     * Get the number of online CPUs, capped at MAX_CPUS.
+     *
+     * @ret     Number of online CPUs.
+     */
+    static uint8_t getNumCpus ();
+
+    /**
+     * Get the set of online CPUs, read from /sys/devices/system/cpu/online.
+     * Online CPUs need not be numbered contiguously. CPUs numbered MAX_CPUS 
+     * or above are omitted. If the file cannot be read, the first 
+     * getNumCpus () CPUs are assumed to be online.
+     *
+     * @ret     Online CPUs.
+     */
+    static CpuSet_t getOnlineCpus ();
+
+    /**
+     * Steer the hardware interrupts of a device (e.g. the NIC, "eth0") to a 
+     * set of CPUs, typically the CPU running the node's comms thread. The 
+     * device's IRQs are found in /proc/interrupts, and for each IRQ the 
+     * IRQ's affinity and its kernel IRQ thread's (irq/<n>-<name>) affinity 
+     * are set to kCpus.
+     *
+     * @param   kDevName                Device name as listed in 
+     *                                  /proc/interrupts.
+     * @param   kCpus                   CPUs to steer the IRQs to.
+     *
+     * @ret     E_SUCCESS               IRQs steered.
+     *          E_INVALID_AFFINITY      CPU set invalid.
+     *          E_IRQ_NOT_FOUND         No IRQs found for device.
+     *          E_FAILED_TO_OPEN_FILE   Failed to open /proc file.
+     *          E_FAILED_TO_WRITE_FILE  Failed to write IRQ affinity.
+     *          E_FAILED_TO_SET_AFFINITY  Failed to set IRQ thread affinity.
+     */
+    static Error_t steerIrqs (const std::string& kDevName, CpuSet_t kCpus);
+
     /**
      * PUBLIC FOR TESTING PURPOSES ONLY -- DO NOT USE OUTSIDE OF THREADMANAGER
      * 
-     * PID's of the software IRQ kernel threads. There is one per core, and
-     * the sbRIO-96<2|3>7 has 2 cores. Hardcode the PID's since these do not
-     * appear to change per system boot and getting the PID's dynamically is
-     * tricky. These are verified on initialization using verifyProcess. 
+     * Find the per-CPU kernel threads with a given name by reading each 
+     * process's /proc/<pid>/comm file. Per-CPU kernel threads are named
+     * <name>/<cpu>, e.g. ksoftirqd/0. Used on initialization to find the
+     * software IRQ threads on any number of CPUs.
+     *
+     * @param   kName                   Thread name without the /<cpu> suffix.
+     * @param   kThreadsRet             Threads found, in PID order.
+     *
+     * @ret     E_SUCCESS               Search completed. kThreadsRet may be
+     *                                  empty.
+     *          E_FAILED_TO_OPEN_FILE   Failed to open /proc.
      */
-    static const uint8_t KSOFTIRQD_0_PID;
-    static const uint8_t KSOFTIRQD_1_PID;
-    static const uint8_t KTIMERSOFTD_0_PID;
-    static const uint8_t KTIMERSOFTD_1_PID;
+    static Error_t findKernelThreads (const std::string& kName,
+                                      std::vector<KernelThread_t>& kThreadsRet);
+
+    /**
+     * PUBLIC FOR TESTING PURPOSES ONLY -- DO NOT USE OUTSIDE OF THREADMANAGER
+     * 
+     * Find a device's IRQ numbers by reading /proc/interrupts.
+     *
+     * @param   kDevName                Device name.
+     * @param   kIrqsRet                IRQ numbers found.
+     *
+     * @ret     E_SUCCESS               Search completed. kIrqsRet may be 
+     *                                  empty.
+     *          E_FAILED_TO_OPEN_FILE   Failed to open /proc/interrupts.
+     */
+    static Error_t findIrqs (const std::string& kDevName,
+                             std::vector<uint32_t>& kIrqsRet);
 
     /**
      * PUBLIC FOR TESTING PURPOSES ONLY -- DO NOT USE OUTSIDE OF THREADMANAGER
@@ -330,7 +751,7 @@ public:
      *          E_FAILED_TO_READ_FILE   Unable to read /proc file.  
      *          E_FAILED_TO_CLOSE_FILE  Unable to close /proc file.
      */
-    static Error_t verifyProcess (const uint8_t kPid,
+    static Error_t verifyProcess (const pid_t kPid,
                                   const std::string kExpectedName, 
                                   bool& kVerifiedRet);
 
@@ -351,17 +772,151 @@ public:
      *          E_INVALID_PRIORITY          Priority out of bounds.
      *          E_FAILED_TO_SET_PRIORITY    Failed to set priority.
      */
-    static Error_t setKernelProcessPriority (const uint8_t kPid, 
+    static Error_t setKernelProcessPriority (const pid_t kPid, 
                                              const uint8_t kPriority);
 
 private:
 
     /**
-     * Struct to contain relevant info per thread.
+     * Histogram updated by a periodic thread and read by other threads. Each 
+     * field has a single writer, so relaxed atomics are sufficient. Starts
+     * zeroed.
+     */
+    typedef struct AtomicHistogram
+    {
+        std::atomic<uint32_t> counts[NUM_HISTOGRAM_BUCKETS] {};
+        std::atomic<uint32_t> maxNs {0};
+        std::atomic<uint32_t> numSamples {0};
+    } AtomicHistogram_t;
+
+    /**
+     * Stats updated by a periodic thread.
+     */
+    typedef struct AtomicPeriodicThreadStats
+    {
+        AtomicHistogram_t releaseJitter;
+        AtomicHistogram_t execution;
+        AtomicHistogram_t response;
+    } AtomicPeriodicThreadStats_t;
+
+    /**
+     * Periodic thread metadata. For threads created with createPeriodicTask, 
+     * pTask points to the thread's copy of the task and pFunc is null. 
+     * Otherwise pFunc is the thread function and pTask is null.
+     */
+    typedef struct PeriodicMetadata
+    {
+        Time::TimeNs_t periodNs;
+        ThreadFunc_t   pFunc;
+        void*          pTask;
+        ErrorHandler_t pErrorHandlerFunc;
+        OverrunPolicy_t overrunPolicy;
+        DeadlineParams_t deadlineParams;
+    } PeriodicMetadata_t;
+
+    /**
+     * State of a periodic thread's switch to SCHED_DEADLINE. Starts pending. 
+     * The thread moves it to reported once it has stored the result, unless 
+     * the creating thread has timed out waiting and moved it to abandoned 
+     * first. Exactly one of the two moves succeeds.
+     */
+    enum SchedSwitch_t : uint8_t
+    {
+        SCHED_SWITCH_PENDING,
+        SCHED_SWITCH_REPORTED,
+        SCHED_SWITCH_ABANDONED
+    };
+
+    /**
+     * Result of a periodic thread switching to SCHED_DEADLINE. The thread 
+     * stores ret and then moves state from pending to reported.
+     */
+    typedef struct AtomicSchedStatus
+    {
+        std::atomic<uint8_t>  state {SCHED_SWITCH_PENDING};
+        std::atomic<uint32_t> ret {0};
+    } AtomicSchedStatus_t;
+
+    /**
+     * State of a periodic thread. Constructed on the heap by the creating 
+     * thread, so that its atomics are constructed in place, and recorded in
+     * the thread's Thread struct before the thread is created, so that 
+     * pthread_create publishes it to the new thread. The new thread is passed
+     * a pointer to it as its args. Deleted by waitForThread once the thread 
+     * is joined.
+     */
+    struct PeriodicThread
+    {
+        PeriodicMetadata_t          metadata;
+        AtomicPeriodicThreadStats_t stats;
+        AtomicSchedStatus_t         schedStatus;
+        std::vector<uint8_t>        args;       // Copy of thread func's args.
+
+        /**
+         * Constructor.
+         *
+         * @param   kMetadata       Thread's metadata.
+         * @param   kPArgs          Thread function's args to copy.
+         * @param   kNumArgBytes    Number of bytes kPArgs points to.
+         */
+        PeriodicThread (const PeriodicMetadata_t& kMetadata, void* kPArgs, 
+                        uint32_t kNumArgBytes);
+
+        /**
+         * Destructor. Virtual, since waitForThread deletes task threads' 
+         * state through this type.
+         */
+        virtual ~PeriodicThread () {}
+    };
+
+    /**
+     * State of a periodic thread created with createPeriodicTask. Holds the
+     * thread's copy of the task, which metadata.pTask points to.
+     */
+    template <class Task_T>
+    struct PeriodicTaskThread : PeriodicThread
+    {
+        Task_T task;
+
+        /**
+         * Constructor.
+         *
+         * @param   kMetadata       Thread's metadata. pTask is ignored.
+         * @param   kTask           Task to copy.
+         */
+        PeriodicTaskThread (const PeriodicMetadata_t& kMetadata, 
+                            const Task_T& kTask) :
+            PeriodicThread (kMetadata, nullptr, 0),
+            task           (kTask)
+        {
+            metadata.pTask = &task;
+        }
+    };
+
+    /**
+     * Task that calls a ThreadFunc_t with its args. Used to run periodic 
+     * threads created with createPeriodicThread in the same loop as tasks.
+     */
+    typedef struct FuncTask
+    {
+        ThreadFunc_t pFunc;
+        void*        pArgs;
+
+        Error_t run ()
+        {
+            return static_cast<Error_t> (
+                        reinterpret_cast<uintptr_t> (pFunc (pArgs)));
+        }
+    } FuncTask_t;
+
+    /**
+     * Struct to contain relevant info per thread. pPeriodic is nullptr for
+     * non-periodic threads.
      */
     struct Thread {
         pthread_t thread;   
         void *pArgs;
+        struct PeriodicThread *pPeriodic;
         struct Thread *next;
     };
 
@@ -394,7 +949,11 @@ private:
      *    priority. Sets current thread to have affinity to CPU 0 to provide 
      *    determinism in the FSW app startup and for testing purposes.
      * 
-     * 2. Sets the software irq threads to have a priority below the hardware
+     * 2. Finds the software irq threads (ksoftirqd/N and, on kernels that
+     *    have them, ktimersoftd/N) and verifies there is one of each per 
+     *    online CPU.
+     *
+     * 3. Sets the software irq threads to have a priority below the hardware
      *    irq threads and above the max allowable fsw thread priorities.
      * 
      * @ret     E_SUCCESS                   Successfully initialized kernel 
@@ -404,37 +963,340 @@ private:
      *                                      threads.
      *          E_FAILED_TO_SET_AFFINITY    Failed to set current thread's CPU
      *                                      affinity. 
-     *          E_FAILED_TO_VERIFY_PROCESS  Could not verify PID(s) were 
-     *                                      kernel threads intended to have 
-     *                                      their priorities updated.
+     *          E_FAILED_TO_VERIFY_PROCESS  Could not find a software irq 
+     *                                      thread for each online CPU.
      */
     static Error_t initKernelSchedulingEnvironment ();
 
     /**
-     * Wrapper function for periodic thread implementation. Manages timer and
-     * calls thread function each period. Does not return except on error.
-     *
-     * @param   kRawArgs                        Buffer with first 4 bytes 
-     *                                          representing the thread's 
-     *                                          period in ms, and second
-     *                                          4 bytes representing the 
-     *                                          function to call every period.
-     *
-     * @ret     E_FAILED_TO_CREATE_TIMERFD      Failed to create timer.
-     *          E_FAILED_TO_ARM_TIMERFD         Failed to set and arm timer.
-     *          E_FAILED_TO_GET_TIMER_FLAGS     Failed to get timer flags.
-     *          E_FAILED_TO_SET_TIMER_FLAGS     Failed to set timer flags.
-     *          E_FAILED_TO_READ_TIMERFD        Failed to read timer.
-     *          E_DATA_VECTOR_WRITE             Failed to log deadline miss.
-     *          E_MISSED_SCHEDULER_DEADLINE     Thread completed after period
-     *                                          elapsed.
-     *          E_TIMER_EXPIRED_MORE_THAN_ONCE  While blocked waiting for timer,
-     *                                          timer unexpectedly expired more 
-     *                                          than once.
+     * Record a sample in a histogram. Must only be called by the thread that
+     * owns the histogram.
+     *
+     * @param   kHistogram  Histogram.
+     * @param   kNs         Sample in ns.
+     */
+    static void recordSample (AtomicHistogram_t& kHistogram, uint32_t kNs);
+
+    /**
+     * Read a histogram.
+     *
+     * @param   kHistogram     Histogram to read.
+     * @param   kHistogramRet  Snapshot of histogram.
+     */
+    static void readHistogram (const AtomicHistogram_t& kHistogram, 
+                               Histogram_t& kHistogramRet);
+
+    /**
+     * Find a thread's stats.
+     *
+     * @param   kThread                 Thread.
+     * @param   kPStatsRet              Thread's stats.
+     *
+     * @ret     E_SUCCESS               Stats found.
+     *          E_THREAD_NOT_FOUND      Thread not found.
+     *          E_NOT_PERIODIC_THREAD   Thread not periodic.
+     */
+    Error_t findPeriodicThreadStats (
+                                const pthread_t& kThread,
+                                AtomicPeriodicThreadStats_t*& kPStatsRet);
+
+    /**
+     * Create a thread. See createThread. If kPPeriodic is not null, the 
+     * thread is periodic: kPPeriodic is recorded in the thread's Thread 
+     * struct before the thread is created, kFunc is passed kPPeriodic instead
+     * of a copy of kPArgs, and if the thread is created, kPPeriodic is owned
+     * by the Thread Manager from then on.
+     *
+     * @param   kThread                     pthread_t for new thread.
+     * @param   kFunc                       Function new thread will execute.
+     * @param   kPArgs                      Pointer to args to copy to the 
+     *                                      heap and pass to kFunc. Must be 
+     *                                      null if kPPeriodic is not null.
+     * @param   kNumArgBytes                Number of bytes kPArgs points to.
+     * @param   kPriority                   Priority to set new thread.
+     * @param   kCpuAffinity                CPUs new thread may run on.
+     * @param   kPPeriodic                  Periodic thread state, or null.
+     *
+     * @ret     See createThread.
+     */
+    Error_t createThreadImpl (pthread_t& kThread, ThreadFunc_t kFunc, 
+                              void* kPArgs, uint32_t kNumArgBytes, 
+                              Priority_t kPriority, CpuSet_t kCpuAffinity,
+                              std::unique_ptr<PeriodicThread> kPPeriodic);
+
+    /**
+     * Validate a periodic thread's params and create the thread.
+     *
+     * @param   kThread                     pthread_t for new thread.
+     * @param   kWrapperFunc                Thread function that is passed a
+     *                                      pointer to the PeriodicThread 
+     *                                      state and runs the periodic loop.
+     * @param   kPPeriodic                  Periodic thread state, holding 
+     *                                      the thread's metadata and its copy
+     *                                      of the args or task.
+     * @param   kPriority                   Priority to set new thread.
+     * @param   kCpuAffinity                CPUs new thread may run on.
+     *
+     * @ret     E_SUCCESS                   Successfully created new thread.
+     *          E_INVALID_POINTER           Thread function or task and error
+     *                                      handler not both set.
+     *          E_INVALID_PERIOD            Period is 0.
+     *          E_INVALID_ENUM              Invalid overrun policy.
+     *          E_INVALID_DEADLINE          Deadline params invalid.
+     *          E_INVALID_AFFINITY          SCHED_DEADLINE requested and CPU
+     *                                      affinity does not contain every
+     *                                      online CPU.
+     *          E_DEADLINE_ADMISSION_FAILED See createPeriodicThread.
+     *          E_FAILED_TO_SET_DEADLINE    See createPeriodicThread.
+     *          [other]                     See createThread.
+     */
+    Error_t createPeriodicThreadImpl (
+                                   pthread_t& kThread, 
+                                   ThreadFunc_t kWrapperFunc,
+                                   std::unique_ptr<PeriodicThread> kPPeriodic,
+                                   Priority_t kPriority, 
+                                   CpuSet_t kCpuAffinity);
+
+    /**
+     * Called by a periodic thread before its first period. If requested, 
+     * switches the thread to SCHED_DEADLINE and reports the result to the
+     * creating thread.
+     *
+     * @param   kPeriodic                   Thread's state.
+     *
+     * @ret     E_SUCCESS                   Thread ready to run periodically.
+     *          E_DEADLINE_ADMISSION_FAILED Kernel rejected the reservation.
+     *          E_FAILED_TO_SET_DEADLINE    Failed to set SCHED_DEADLINE.
+     *          E_DEADLINE_SWITCH_TIMED_OUT Creating thread stopped waiting
+     *                                      for the result.
+     */
+    static Error_t initPeriodicThread (PeriodicThread& kPeriodic);
+
+    /**
+     * Add a period to a time.
+     *
+     * @param   kTime       Time to add period to.
+     * @param   kPeriodS    Whole seconds of period.
+     * @param   kPeriodNs   Remaining ns of period. Must be < 1s.
+     */
+    static void addPeriod (struct timespec& kTime, time_t kPeriodS, 
+                           long kPeriodNs);
+
+    /**
+     * Calculate the time elapsed between two times.
+     *
+     * @param   kEnd     End time.
+     * @param   kStart   Start time.
+     *
+     * @ret     Elapsed time in ns. 0 if kEnd is before kStart, and saturates 
+     *          at max uint32_t (~4.3s).
+     */
+    static uint32_t elapsedNs (const struct timespec& kEnd, 
+                               const struct timespec& kStart);
+
+    /**
+     * Check if a time has been reached.
+     *
+     * @param   kNow     Current time.
+     * @param   kTime    Time to check.
+     *
+     * @ret     true     kNow is at or after kTime.
+     *          false    kNow is before kTime.
+     */
+    static bool isReached (const struct timespec& kNow, 
+                           const struct timespec& kTime);
+
+    /**
+     * Run a task. Calls the task's run method if it has one.
+     *
+     * @param   kTask   Task to run.
+     *
+     * @ret     Task's return value.
+     */
+    template <class Task_T>
+    static inline auto runTask (Task_T& kTask, int) -> decltype (kTask.run ())
+    {
+        return kTask.run ();
+    }
+
+    /**
+     * Run a task. Calls the task if it does not have a run method.
+     *
+     * @param   kTask   Task to run.
+     *
+     * @ret     Task's return value.
+     */
+    template <class Task_T>
+    static inline auto runTask (Task_T& kTask, long) -> decltype (kTask ())
+    {
+        return kTask ();
+    }
+
+    /**
+     * Periodic loop. Runs the task and then sleeps until the next absolute 
+     * release time using clock_nanosleep (TIMER_ABSTIME). Deadline misses are
+     * detected by comparing the current time to the next release time, so no
+     * timer state needs to be read or modified each period. Does not return 
+     * except on error.
+     *
+     * @param   kTask                           Task to run each period.
+     * @param   kMetadata                       Thread's metadata.
+     * @param   kStats                          Thread's stats.
+     *
+     * @ret     E_FAILED_TO_GET_TIME            Failed to read current time.
+     *          E_FAILED_TO_SLEEP               Failed to sleep until next
+     *                                          release time.
      *          [other]                         Error returned from caller's 
      *                                          error handler.
      */
+    template <class Task_T>
+    static Error_t periodicLoop (Task_T& kTask, 
+                                 const PeriodicMetadata_t& kMetadata,
+                                 AtomicPeriodicThreadStats_t& kStats)
+    {
+        // 1) Split period into s and ns so that release times can be computed
+        //    without 64-bit division in the loop.
+        const time_t periodS = kMetadata.periodNs / Time::NS_IN_S;
+        const long periodRemNs = kMetadata.periodNs % Time::NS_IN_S;
+
+        // 2) Set the first release time to now.
+        struct timespec release;
+        if (clock_gettime (CLOCK_MONOTONIC, &release) != 0)
+        {
+            return E_FAILED_TO_GET_TIME;
+        }
+
+        // 3) Enter periodic loop. Track the number of missed releases still
+        //    to be run back-to-back when catching up after an overrun.
+        uint32_t catchUpLeft = 0;
+        while (1)
+        {
+            // 3a) Record wake time.
+            struct timespec wake;
+            if (clock_gettime (CLOCK_MONOTONIC, &wake) != 0)
+            {
+                return E_FAILED_TO_GET_TIME;
+            }
+
+            // 3b) Run task.
+            Error_t ret = runTask (kTask, 0);
+
+            // 3c) Record end time and stats.
+            struct timespec end;
+            if (clock_gettime (CLOCK_MONOTONIC, &end) != 0)
+            {
+                return E_FAILED_TO_GET_TIME;
+            }
+            recordSample (kStats.releaseJitter, elapsedNs (wake, release));
+            recordSample (kStats.execution, elapsedNs (end, wake));
+            recordSample (kStats.response, elapsedNs (end, release));
+
+            // 3d) Handle error returned by task.
+            if (ret != E_SUCCESS)
+            {
+                ret = kMetadata.pErrorHandlerFunc (ret);
+                if (ret != E_SUCCESS)
+                {
+                    return ret;
+                }
+            }
+
+            // 3e) Compute next release time. If this run was one of the runs
+            //     catching up on the releases missed in an overrun, count it.
+            addPeriod (release, periodS, periodRemNs);
+            if (catchUpLeft > 0)
+            {
+                catchUpLeft--;
+            }
+
+            // 3f) Check for deadline miss by comparing the end time to the 
+            //     next release time. While catching up, the next release has
+            //     already passed by design, so only report the miss once per
+            //     overrun.
+            if (isReached (end, release) == true && catchUpLeft == 0)
+            {
+                ret = kMetadata.pErrorHandlerFunc (E_MISSED_SCHEDULER_DEADLINE);
+                if (ret != E_SUCCESS)
+                {
+                    return ret;
+                }
+
+                // Count the releases that have passed.
+                struct timespec nextRelease = release;
+                uint32_t numMissed = 0;
+                while (isReached (end, nextRelease) == true)
+                {
+                    addPeriod (nextRelease, periodS, periodRemNs);
+                    numMissed++;
+                }
+
+                // Skip to the first release time that has not passed, or if 
+                // catching up, skip all but the last MAX_CATCH_UP_PERIODS 
+                // missed releases. The sleep below then returns immediately 
+                // for each remaining missed release and the thread runs 
+                // back-to-back.
+                if (kMetadata.overrunPolicy != OVERRUN_POLICY_CATCH_UP)
+                {
+                    release = nextRelease;
+                }
+                else
+                {
+                    while (numMissed > MAX_CATCH_UP_PERIODS)
+                    {
+                        addPeriod (release, periodS, periodRemNs);
+                        numMissed--;
+                    }
+                    catchUpLeft = numMissed;
+                }
+            }
+
+            // 3g) Block until the next release time. Retry if interrupted by 
+            //     a signal, since the release time is absolute.
+            int32_t sleepRet = 0;
+            do
+            {
+                sleepRet = clock_nanosleep (CLOCK_MONOTONIC, TIMER_ABSTIME, 
+                                            &release, nullptr);
+            } while (sleepRet == EINTR);
+            if (sleepRet != 0)
+            {
+                return E_FAILED_TO_SLEEP;
+            }
+        }
+    }
+
+    /**
+     * Thread function for periodic threads created with createPeriodicThread.
+     * Runs the thread function in the periodic loop.
+     *
+     * @param   kRawArgs    Pointer to the thread's PeriodicThread state.
+     *
+     * @ret     See initPeriodicThread and periodicLoop.
+     */
     static void* periodicWrapperFunc (void* kRawArgs);
+
+    /**
+     * Thread function for periodic threads created with createPeriodicTask.
+     * Runs the task in the periodic loop.
+     *
+     * @param   kRawArgs    Pointer to the thread's PeriodicThread state.
+     *
+     * @ret     See initPeriodicThread and periodicLoop.
+     */
+    template <class Task_T>
+    static void* periodicTaskWrapperFunc (void* kRawArgs)
+    {
+        PeriodicThread& periodic = *static_cast<PeriodicThread*> (kRawArgs);
+        Error_t ret = initPeriodicThread (periodic);
+        if (ret != E_SUCCESS)
+        {
+            return (void*) (uintptr_t) ret;
+        }
+
+        Task_T* pTask = static_cast<Task_T*> (periodic.metadata.pTask);
+        return (void*) (uintptr_t) periodicLoop (*pTask, periodic.metadata, 
+                                                 periodic.stats);
+    }
 };
 
 #endif
@@ -0,0 +1,9 @@
+# ifndef PROFILE_COMMS_SCALING_HPP
+# define PROFILE_COMMS_SCALING_HPP
+
+namespace ProfileCommsScaling
+{
+    void main (int, char**);
+}
+
+# endif
@@ -0,0 +1,15 @@
+/**
+ * See ProfilePlatform_Config.hpp for instructions on running test.
+ */
+
+#ifndef PROFILE_PLATFORM_JITTER_PERIODIC_THREAD_HPP
+#define PROFILE_PLATFORM_JITTER_PERIODIC_THREAD_HPP
+
+#include "ProfilePlatform_Config.hpp"
+
+namespace ProfilePlatformJitter_PeriodicThread
+{
+    void main (int, char**);
+}
+
+#endif
@@ -30,6 +30,12 @@
  *        the Device Nodes. In a perfect world, run over run would be exactly
  *        10ms apart. Jitter measures the actual variation.
  *
+ *        ProfilePlatformJitter_PeriodicThread isolates the Thread Manager's
+ *        periodic executor from the rest of the Platform. It measures 
+ *        tick-to-tick jitter and deadline misses of a periodic thread for 
+ *        periods from 10ms down to 100us on a single sbRIO and does not 
+ *        use NUM_RUNS.
+ *
  *        Maximum NUM_RUNS: An int64_t is stored per run, so the max recommended
  *                          NUM_RUNS is 10k.
  *
@@ -38,7 +44,9 @@
  *            actuators on Device Nodes, and
  *         b) a Controller running on a Device Node with dependent sensors &
  *            actuators running on that same Device Node.
- *        Results printed by each Device Node.
+ *        Results printed by each Device Node. Set SAME_FRAME_ACTUATION to
+ *        true to measure a) with Control Node Controller outputs sent to the
+ *        Device Nodes in the same loop.
  *
  *        Maximum NUM_RUNS: An uint64_t is stored per run, so the max 
  *                          recommended NUM_RUNS is 10k.
@@ -80,6 +88,7 @@
 #define DEVICE_NODE2_IP         "10.0.0.3"
 #define CONTROL_NODE_IP         "10.0.0.4"
 #define GROUND_NODE_IP          "10.0.0.99"
+#define SAME_FRAME_ACTUATION    false
 
 /**
  * Preprocessor directives cannot be compared to enums, so redefine Device Node 
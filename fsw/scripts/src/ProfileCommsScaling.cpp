@@ -0,0 +1,215 @@
+/**
+ * Measure the Control Node's communications step overhead as a function of the
+ * number of Device Nodes. All nodes run in this process and communicate over 
+ * loopback, so the results capture the software cost of sending to and 
+ * multiplexing receives from N nodes rather than wire time.
+ *
+ * For each number of Device Nodes N (1 to MAX_DEVICE_NODES), each run:
+ *
+ *     1) Each Device Node sends its reply to the Control Node ahead of time.
+ *     2) The Control Node sends a message to each Device Node (once with a 
+ *        send per node and once with sendMult) and calls recvMult, returning
+ *        as soon as every Device Node has reported. This step is timed.
+ *     3) Each Device Node drains the Control Node's message. Not timed.
+ *
+ * The purpose of this profiling script is to verify that the communications 
+ * step scales linearly with the number of Device Nodes.
+ */
+
+#include <stdint.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "NetworkManager.hpp"
+#include "DataVector.hpp"
+#include "Errors.hpp"
+#include "ProfileCommsScaling.hpp"
+#include "ProfileHelpers.hpp"
+
+/**
+ * # of times to run per number of Device Nodes.
+ */
+static const uint32_t NUM_TIMES_TO_RUN = 10000;
+
+/**
+ * Max number of Device Nodes to profile.
+ */
+static const uint8_t MAX_DEVICE_NODES = 8;
+
+/**
+ * Size of each message in bytes.
+ */
+static const uint32_t MSG_SIZE_BYTES = 64;
+
+/**
+ * Timeout for recvMult. Only reached on a dropped message.
+ */
+static const Time::TimeNs_t RECV_TIMEOUT_NS = 10 * Time::NS_IN_MS;
+
+/**
+ * Device Node message counter elements, indexed by Device Node.
+ */
+static const std::vector<DataVectorElement_t> DN_TX_ELEMS =
+{
+    DV_ELEM_DN0_MSG_TX_COUNT,
+    DV_ELEM_DN1_MSG_TX_COUNT,
+    DV_ELEM_DN2_MSG_TX_COUNT,
+    DV_ELEM_DN3_MSG_TX_COUNT,
+    DV_ELEM_DN4_MSG_TX_COUNT,
+    DV_ELEM_DN5_MSG_TX_COUNT,
+    DV_ELEM_DN6_MSG_TX_COUNT,
+    DV_ELEM_DN7_MSG_TX_COUNT,
+};
+static const std::vector<DataVectorElement_t> DN_RX_ELEMS =
+{
+    DV_ELEM_DN0_MSG_RX_COUNT,
+    DV_ELEM_DN1_MSG_RX_COUNT,
+    DV_ELEM_DN2_MSG_RX_COUNT,
+    DV_ELEM_DN3_MSG_RX_COUNT,
+    DV_ELEM_DN4_MSG_RX_COUNT,
+    DV_ELEM_DN5_MSG_RX_COUNT,
+    DV_ELEM_DN6_MSG_RX_COUNT,
+    DV_ELEM_DN7_MSG_RX_COUNT,
+};
+
+/**
+ * Create a Data Vector holding the message counters for all nodes.
+ */
+static std::shared_ptr<DataVector> createDataVector ()
+{
+    DataVector::RegionConfig_t regionConfig = {DV_REG_CN, {}};
+    regionConfig.elems.push_back (DV_ADD_UINT32 (DV_ELEM_CN_MSG_TX_COUNT, 0));
+    regionConfig.elems.push_back (DV_ADD_UINT32 (DV_ELEM_CN_MSG_RX_COUNT, 0));
+    for (uint8_t i = 0; i < MAX_DEVICE_NODES; i++)
+    {
+        regionConfig.elems.push_back (DV_ADD_UINT32 (DN_TX_ELEMS[i], 0));
+        regionConfig.elems.push_back (DV_ADD_UINT32 (DN_RX_ELEMS[i], 0));
+    }
+    DataVector::Config_t dvConfig = {regionConfig};
+
+    std::shared_ptr<DataVector> pDv = nullptr;
+    Errors::exitOnError (DataVector::createNew (dvConfig, pDv), 
+                         "Failed to create Data Vector.");
+    return pDv;
+}
+
+/**
+ * Profile the communications step with kNumDns Device Nodes.
+ *
+ * @param  kPDv           Data Vector.
+ * @param  kNumDns        Number of Device Nodes.
+ * @param  kUseSendMult   If true, send with sendMult. Otherwise, send to each 
+ *                        node with send.
+ * @param  kResults       Vector to store elapsed times in.
+ */
+static void profileCommsStep (std::shared_ptr<DataVector>& kPDv, 
+                              uint8_t kNumDns, bool kUseSendMult,
+                              std::vector<Time::TimeNs_t>& kResults)
+{
+    // 1) Build the loopback network config. Node i is at 127.0.0.(i + 2).
+    std::vector<Node_t> dnNodes;
+    std::unordered_map<Node_t, NetworkManager::IP_t, EnumClassHash> nodeToIp =
+    {
+        {NODE_CONTROL, "127.0.0.1"},
+    };
+    std::vector<NetworkManager::ChannelConfig_t> channels;
+    for (uint8_t i = 0; i < kNumDns; i++)
+    {
+        Node_t node = static_cast<Node_t> (NODE_DEVICE0 + i);
+        dnNodes.push_back (node);
+        nodeToIp[node] = "127.0.0." + std::to_string (i + 2);
+        channels.push_back ({NODE_CONTROL, node, 
+             static_cast<uint16_t> (NetworkManager::MIN_PORT + i)});
+    }
+
+    // 2) Create a Network Manager for each node.
+    NetworkManager::Config_t cnConfig = {nodeToIp, channels, NODE_CONTROL, 
+                                         DV_ELEM_CN_MSG_TX_COUNT, 
+                                         DV_ELEM_CN_MSG_RX_COUNT};
+    std::shared_ptr<NetworkManager> pCnNm = nullptr;
+    Errors::exitOnError (NetworkManager::createNew (cnConfig, kPDv, pCnNm), 
+                         "Failed to create Control Node Network Manager.");
+    std::vector<std::shared_ptr<NetworkManager>> dnNms (kNumDns);
+    for (uint8_t i = 0; i < kNumDns; i++)
+    {
+        NetworkManager::Config_t dnConfig = {nodeToIp, channels, dnNodes[i],
+                                             DN_TX_ELEMS[i], DN_RX_ELEMS[i]};
+        Errors::exitOnError (NetworkManager::createNew (dnConfig, kPDv, 
+                                                        dnNms[i]), 
+                             "Failed to create Device Node Network Manager.");
+    }
+
+    // 3) Initialize buffers.
+    std::vector<uint8_t> dnSendBuf (MSG_SIZE_BYTES, 0xff);
+    std::vector<uint8_t> dnRecvBuf (MSG_SIZE_BYTES, 0);
+    std::vector<std::vector<uint8_t>> cnSendBufs (
+                                kNumDns, std::vector<uint8_t> (MSG_SIZE_BYTES));
+    std::vector<std::vector<uint8_t>> cnRecvBufs (
+                                kNumDns, std::vector<uint8_t> (MSG_SIZE_BYTES));
+    std::vector<uint32_t> numMsgsReceived (kNumDns, 0);
+
+    // 4) Profile.
+    for (uint32_t run = 0; run < NUM_TIMES_TO_RUN; run++)
+    {
+        // 4a) Device Nodes send replies ahead of time.
+        for (uint8_t i = 0; i < kNumDns; i++)
+        {
+            Errors::exitOnError (dnNms[i]->send (NODE_CONTROL, dnSendBuf),
+                                 "Device Node send failed.");
+        }
+
+        // 4b) Time Control Node send and receive.
+        Time::TimeNs_t startNs = ProfileHelpers::getTimeNs ();
+        if (kUseSendMult == true)
+        {
+            Errors::exitOnError (pCnNm->sendMult (dnNodes, cnSendBufs),
+                                 "Control Node sendMult failed.");
+        }
+        else
+        {
+            for (uint8_t i = 0; i < kNumDns; i++)
+            {
+                Errors::exitOnError (pCnNm->send (dnNodes[i], cnSendBufs[i]),
+                                     "Control Node send failed.");
+            }
+        }
+        Errors::exitOnError (pCnNm->recvMult (RECV_TIMEOUT_NS, dnNodes, 
+                                              cnRecvBufs, numMsgsReceived, 
+                                              true),
+                             "Control Node recvMult failed.");
+        kResults[run] = ProfileHelpers::getTimeNs () - startNs;
+
+        // 4c) Device Nodes drain the Control Node's messages.
+        for (uint8_t i = 0; i < kNumDns; i++)
+        {
+            Errors::exitOnError (dnNms[i]->recvBlock (NODE_CONTROL, dnRecvBuf),
+                                 "Device Node recv failed.");
+        }
+    }
+}
+
+void ProfileCommsScaling::main (int ac, char** av)
+{
+    // Set thread to be SCHED_FIFO.
+    ProfileHelpers::setThreadPriAndAffinity ();
+
+    std::shared_ptr<DataVector> pDv = createDataVector ();
+    std::vector<Time::TimeNs_t> results_Send     (NUM_TIMES_TO_RUN);
+    std::vector<Time::TimeNs_t> results_SendMult (NUM_TIMES_TO_RUN);
+
+    std::cout << "------ Results ------" << std::endl;
+    std::cout << "# of runs: " << NUM_TIMES_TO_RUN << std::endl;
+
+    for (uint8_t numDns = 1; numDns <= MAX_DEVICE_NODES; numDns++)
+    {
+        profileCommsStep (pDv, numDns, false, results_Send);
+        profileCommsStep (pDv, numDns, true, results_SendMult);
+
+        std::string numDnsStr = std::to_string (numDns);
+        ProfileHelpers::printVectorStats (results_Send,
+                                          "\nSEND, " + numDnsStr + " DNs");
+        ProfileHelpers::printVectorStats (results_SendMult,
+                                          "\nSEND_MULT, " + numDnsStr + " DNs");
+    }
+}
@@ -31,7 +31,8 @@ class ProfileJitterController final : public Controller
          */
         Error_t runEnabled ()
         {
-            static const int64_t CN_LOOP_PERIOD_NS = 10 * Time::NS_IN_MS;
+            static const int64_t CN_LOOP_PERIOD_NS = 
+                                                NetworkManager::LOOP_PERIOD_NS;
             static std::vector<int64_t> jitterBuf (NUM_RUNS);
             static uint32_t jitterIdx = 0;
             static Time* pTime = nullptr;
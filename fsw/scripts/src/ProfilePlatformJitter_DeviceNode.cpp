@@ -29,7 +29,8 @@ class ProfileJitterDevice final : public Device
          */
         virtual Error_t run ()
         {
-            static const int64_t CN_LOOP_PERIOD_NS = 10 * Time::NS_IN_MS;
+            static const int64_t CN_LOOP_PERIOD_NS = 
+                                                NetworkManager::LOOP_PERIOD_NS;
             static std::vector<int64_t> jitterBuf (NUM_RUNS);
             static uint32_t jitterIdx = 0;
             static Time* pTime = nullptr;
@@ -0,0 +1,154 @@
+/**
+ * See ProfilePlatform_Config.hpp for instructions on running test.
+ */
+
+#include <stdint.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ThreadManager.hpp"
+#include "ProfilePlatformJitter_PeriodicThread.hpp"
+
+/******************************** CONSTANTS ***********************************/
+
+/**
+ * # of ticks to measure per period.
+ */
+static const uint32_t NUM_TICKS = 10000;
+
+/**
+ * Periods to measure.
+ */
+static const std::vector<Time::TimeNs_t> PERIODS_NS =
+{
+    10  * Time::NS_IN_MS,
+    1   * Time::NS_IN_MS,
+    500 * Time::NS_IN_US,
+    250 * Time::NS_IN_US,
+    100 * Time::NS_IN_US,
+};
+
+/********************************* GLOBALS ************************************/
+
+/**
+ * Period currently being measured.
+ */
+static Time::TimeNs_t gPeriodNs = 0;
+
+/**
+ * Jitter per tick for the period currently being measured.
+ */
+static std::vector<int64_t> gJitterBuf (NUM_TICKS);
+
+/**
+ * Index of next jitter sample.
+ */
+static uint32_t gJitterIdx = 0;
+
+/**
+ * Time of previous tick. 0 before first tick.
+ */
+static Time::TimeNs_t gPrevTimeNs = 0;
+
+/**
+ * # of deadline misses for the period currently being measured.
+ */
+static uint32_t gNumMisses = 0;
+
+/***************************** THREAD FUNCTIONS *******************************/
+
+/**
+ * Periodic function. Stores tick-to-tick jitter and exits once NUM_TICKS 
+ * samples are stored.
+ *
+ * @param  _kRawArgs  Unused.
+ *
+ * @ret    E_SUCCESS  Successfully stored jitter.
+ */
+static void* measureJitter (void* _kRawArgs)
+{
+    Time::TimeNs_t currTimeNs = ProfileHelpers::getTimeNs ();
+
+    // 1) If this isn't the first run, store jitter.
+    if (gPrevTimeNs != 0)
+    {
+        gJitterBuf[gJitterIdx] = (int64_t) gPeriodNs - 
+                                 (int64_t) (currTimeNs - gPrevTimeNs);
+        gJitterIdx++;
+    }
+
+    // 2) Save curr as prev to use next tick.
+    gPrevTimeNs = currTimeNs;
+
+    // 3) If NUM_TICKS samples stored, exit.
+    if (gJitterIdx == NUM_TICKS)
+    {
+        pthread_exit ((void*) E_SUCCESS);
+    }
+
+    return (void*) E_SUCCESS;
+}
+
+/**
+ * Count deadline misses and continue. Any other error is critical.
+ *
+ * @param  kError                       Error to handle.
+ *
+ * @ret    E_SUCCESS                    Deadline miss counted.
+ *         [other]                      Error returned from periodic function.
+ */
+static Error_t handleError (Error_t kError)
+{
+    if (kError == E_MISSED_SCHEDULER_DEADLINE)
+    {
+        gNumMisses++;
+        return E_SUCCESS;
+    }
+
+    return kError;
+}
+
+/*********************************** MAIN *************************************/
+
+void ProfilePlatformJitter_PeriodicThread::main (int, char**)
+{
+    ProfileHelpers::setThreadPriAndAffinity ();
+
+    ThreadManager* pTm = nullptr;
+    if (ThreadManager::getInstance (pTm) != E_SUCCESS)
+    {
+        std::cout << "Failed to initialize Thread Manager" << std::endl;
+        return;
+    }
+
+    for (Time::TimeNs_t periodNs : PERIODS_NS)
+    {
+        // 1) Reset state for this period.
+        gPeriodNs = periodNs;
+        gJitterIdx = 0;
+        gPrevTimeNs = 0;
+        gNumMisses = 0;
+
+        // 2) Run periodic thread on core 0 until NUM_TICKS samples stored.
+        pthread_t thread;
+        Error_t threadRet = E_SUCCESS;
+        if (pTm->createPeriodicThreadNs (
+                    thread, (ThreadManager::ThreadFunc_t) measureJitter, 
+                    nullptr, 0, ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                    ThreadManager::Affinity_t::CORE_0, periodNs,
+                    (ThreadManager::ErrorHandler_t) handleError) != E_SUCCESS ||
+            pTm->waitForThread (thread, threadRet) != E_SUCCESS ||
+            threadRet != E_SUCCESS)
+        {
+            std::cout << "Failed to run periodic thread" << std::endl;
+            return;
+        }
+
+        // 3) Print results.
+        ProfileHelpers::printVectorStats (
+                gJitterBuf, 
+                "--- Period (ns): " + std::to_string (periodNs) + " ---");
+        std::cout << "# Deadline Misses: " << gNumMisses << std::endl;
+    }
+}
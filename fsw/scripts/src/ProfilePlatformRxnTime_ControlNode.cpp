@@ -145,10 +145,13 @@ static StateMachine::Config_t gSmConfig =
 
 void ProfilePlatformRxnTime_ControlNode::main (int, char**)
 {
+    ControlNode::Options_t options;
+    options.sameFrameActuation = SAME_FRAME_ACTUATION;
     ControlNode::entry (
             ProfilePlatform_Config::mCnNmConfig, 
             ProfilePlatform_Config::mCnDvConfig, 
             ProfilePlatform_Config::mChConfig, 
             gSmConfig, 
-            (ControlNode::fInitializeControllers_t) initializeControllers);
+            (ControlNode::fInitializeControllers_t) initializeControllers,
+            options);
 }
@@ -369,9 +369,12 @@ static Error_t initializeCtrlsAndDevs (
 
 void ProfilePlatformRxnTime_DeviceNode::main (int, char**)
 {
+    DeviceNode::Options_t options;
+    options.sameFrameActuation = SAME_FRAME_ACTUATION;
     DeviceNode::entry (
             ProfilePlatform_Config::mDnNmConfig, 
             ProfilePlatform_Config::mDnDvConfig,  
             (DeviceNode::fInitializeCtrlsAndDevs_t) initializeCtrlsAndDevs,
-            false);
+            false,
+            options);
 }
@@ -16,6 +16,7 @@
 
 // #include "ProfileCopyBuffer.hpp"
 // #include "ProfileLock.hpp"
+// #include "ProfileCommsScaling.hpp"
 // #include "RecoveryIgniterTest.hpp"
 // #include "ClockSyncTest_Client.hpp"
 // #include "ClockSyncTest_Server.hpp"
@@ -26,6 +27,7 @@
 // #include "ProfilePlatformComms_DeviceNode.hpp"
 // #include "ProfilePlatformJitter_ControlNode.hpp"
 // #include "ProfilePlatformJitter_DeviceNode.hpp"
+// #include "ProfilePlatformJitter_PeriodicThread.hpp"
 // #include "ProfilePlatformRxnTime_ControlNode.hpp"
 // #include "ProfilePlatformRxnTime_DeviceNode.hpp"
 // #include "ProfilePlatformOverhead_ControlNode.hpp"
@@ -40,6 +42,7 @@ int main (int ac, char** av)
     // RecoveryIgniterTest::main (ac, (const char**) av);
     // ProfileCopyBuffer::main (ac, av);
     // ProfileLock::main (ac, av);
+    // ProfileCommsScaling::main (ac, av);
     // ClockSyncTest_Client::main (ac, av);
     // ClockSyncTest_Server::main (ac, av);
     // ProfileFpgaApi::main (ac, av);
@@ -49,6 +52,7 @@ int main (int ac, char** av)
     // ProfilePlatformComms_DeviceNode::main (ac, av);
     // ProfilePlatformJitter_ControlNode::main (ac, av);
     // ProfilePlatformJitter_DeviceNode::main (ac, av);
+    // ProfilePlatformJitter_PeriodicThread::main (ac, av);
     // ProfilePlatformRxnTime_ControlNode::main (ac, av);
     // ProfilePlatformRxnTime_DeviceNode::main (ac, av);
     // ProfilePlatformOsverhead_ControlNode::main (ac, av);
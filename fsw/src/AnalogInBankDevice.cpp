@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <set>
+
+#include "AnalogInBankDevice.hpp"
+
+/****************************** PUBLIC MEMBERS ********************************/
+
+AnalogInBankDevice::AnalogInBankDevice (
+                                    NiFpga_Session& kSession,
+                                    std::shared_ptr<DataVector> kPDataVector,
+                                    Config_t& kConfig,
+                                    Error_t& kRet) :
+    Device         (kSession, kPDataVector),
+    mPolyNumCoeffs (0)
+{
+    // Verify config.
+    kRet = this->verifyConfig (kConfig);
+    if (kRet != E_SUCCESS)
+    {
+        return;
+    }
+
+    // Create each channel. This validates the channel's config and configures
+    // its pin.
+    for (AnalogInDevice::Config_t& channelConfig : kConfig)
+    {
+        std::unique_ptr<AnalogInDevice> pChannel;
+        kRet = Device::createNew (kSession, kPDataVector, channelConfig,
+                                  pChannel);
+        if (kRet != E_SUCCESS)
+        {
+            return;
+        }
+        mPChannels.push_back (std::move (pChannel));
+    }
+
+    // Size buffers before binding to them so that they are not reallocated.
+    uint32_t numChannels = kConfig.size ();
+    mFxpVals.resize (numChannels);
+    mFxpShifts.resize (numChannels);
+    mFxpDeltas.resize (numChannels);
+    mOutputs.resize (2 * numChannels);
+    mOutputBindings.resize (2 * numChannels);
+
+    // Bind each channel's output elems.
+    for (uint32_t i = 0; i < numChannels; i++)
+    {
+        if (mPDataVector->bind (kConfig[i].dvElemOutputVolts, mOutputs[i],
+                                mOutputBindings[i]) != E_SUCCESS ||
+            mPDataVector->bind (kConfig[i].dvElemOutputEngr,
+                                mOutputs[numChannels + i],
+                                mOutputBindings[numChannels + i]) 
+                != E_SUCCESS)
+        {
+            kRet = E_INVALID_ELEM;
+            return;
+        }
+    }
+
+    // Precompute each channel's fxp conversion. See note (3) in 
+    // AnalogInBankDevice.hpp.
+    for (uint32_t i = 0; i < numChannels; i++)
+    {
+        const NiFpga_FxpTypeInfo& typeInfo = mPChannels[i]->mFxpTypeInfoId;
+        if (typeInfo.isSigned == false || typeInfo.wordLength == 0 ||
+            typeInfo.wordLength > 32)
+        {
+            kRet = E_INVALID_CONFIG;
+            return;
+        }
+        mFxpShifts[i] = 32 - typeInfo.wordLength;
+        mFxpDeltas[i] = NiFpga_CalculateFxpDeltaFloat (typeInfo);
+    }
+
+    // Group the channels by how they convert to engineering unit.
+    for (uint32_t i = 0; i < numChannels; i++)
+    {
+        const Calibration::Config_t& calibration = 
+            mPChannels[i]->mCalibration;
+        switch (calibration.type)
+        {
+            case Calibration::CAL_POLYNOMIAL:
+                mPolyChannels.push_back (i);
+                mPolyNumCoeffs = std::max (mPolyNumCoeffs, 
+                                           (uint32_t) 
+                                           calibration.coeffs.size ());
+                break;
+
+            case Calibration::CAL_PIECEWISE_LINEAR:
+                mTableChannels.push_back (i);
+                break;
+
+            default:
+                mFuncChannels.push_back (i);
+                break;
+        }
+    }
+
+    // Store the polynomial coefficients term by term, zero padding the 
+    // polynomials of lower degree.
+    uint32_t numPoly = mPolyChannels.size ();
+    mPolyCoeffs.assign (mPolyNumCoeffs * numPoly, 0);
+    for (uint32_t j = 0; j < numPoly; j++)
+    {
+        const std::vector<float>& coeffs = 
+            mPChannels[mPolyChannels[j]]->mCalibration.coeffs;
+        for (uint32_t k = 0; k < coeffs.size (); k++)
+        {
+            mPolyCoeffs[k * numPoly + j] = coeffs[k];
+        }
+    }
+    mPolyVolts.resize (numPoly);
+    mPolyEngr.resize (numPoly);
+}
+
+Error_t AnalogInBankDevice::verifyConfig (Config_t& kConfig)
+{
+    // Check that there is at least one channel.
+    if (kConfig.empty () == true)
+    {
+        return E_EMPTY_CONFIG;
+    }
+
+    std::set<uint8_t> pins;
+    for (AnalogInDevice::Config_t& channelConfig : kConfig)
+    {
+        // Check that each pin is used by one channel.
+        if (pins.insert (channelConfig.pinNumber).second == false)
+        {
+            return E_DUPLICATE_PIN;
+        }
+
+        // Check that the channel does not oversample.
+        if (channelConfig.oversampleRingSize != 0)
+        {
+            return E_INVALID_CONFIG;
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t AnalogInBankDevice::run ()
+{
+    // 1) Read every pin.
+    Error_t ret = this->readPins ();
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 2) Convert every fxp value to voltage. Shifting left then arithmetic
+    //    shifting right discards the bits above the word length and sign 
+    //    extends the value.
+    uint32_t numChannels = mPChannels.size ();
+    const uint32_t* pFxpVals = mFxpVals.data ();
+    const uint32_t* pShifts = mFxpShifts.data ();
+    const float* pDeltas = mFxpDeltas.data ();
+    float* pVolts = mOutputs.data ();
+    float* pEngr = mOutputs.data () + numChannels;
+    for (uint32_t i = 0; i < numChannels; i++)
+    {
+        int32_t count = (int32_t) (pFxpVals[i] << pShifts[i]) >> pShifts[i];
+        pVolts[i] = pDeltas[i] * count;
+    }
+
+    // 3) Convert voltages to engineering units, polynomials first since they
+    //    are evaluated together.
+    this->evaluatePolynomials ();
+    for (uint32_t i : mTableChannels)
+    {
+        pEngr[i] = Calibration::evaluate (mPChannels[i]->mCalibration, 
+                                          pVolts[i]);
+    }
+    for (uint32_t i : mFuncChannels)
+    {
+        Error_t convertErr = (*mPChannels[i]->mPTransferFunc) (pVolts[i],
+                                                               pEngr[i]);
+        if (convertErr != E_SUCCESS)
+        {
+            return convertErr;
+        }
+    }
+
+    // 4) Write every output to the Data Vector.
+    if (mPDataVector->writeBindings (mOutputBindings) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    return E_SUCCESS;
+}
+
+/****************************** PRIVATE MEMBERS *******************************/
+
+Error_t AnalogInBankDevice::readPins ()
+{
+    // Issue the reads back-to-back and check the merged status once.
+    NiFpga_Status status = NiFpga_Status_Success;
+    for (uint32_t i = 0; i < mPChannels.size (); i++)
+    {
+        NiFpga_MergeStatus (&status,
+                            NiFpga_ReadU32 (mSession,
+                                            mPChannels[i]->mFxpResourceId,
+                                            &mFxpVals[i]));
+    }
+    if (status != NiFpga_Status_Success)
+    {
+        return E_FPGA_READ;
+    }
+
+    return E_SUCCESS;
+}
+
+void AnalogInBankDevice::evaluatePolynomials ()
+{
+    uint32_t numPoly = mPolyChannels.size ();
+    float* pVolts = mPolyVolts.data ();
+    float* pEngr = mPolyEngr.data ();
+
+    // 1) Gather the voltages.
+    for (uint32_t j = 0; j < numPoly; j++)
+    {
+        pVolts[j] = mOutputs[mPolyChannels[j]];
+        pEngr[j] = 0;
+    }
+
+    // 2) Horner's method, one term across every channel at a time, highest
+    //    order term first. Zero padded terms leave the result unchanged.
+    for (uint32_t k = mPolyNumCoeffs; k > 0; k--)
+    {
+        const float* pCoeffs = mPolyCoeffs.data () + (k - 1) * numPoly;
+        for (uint32_t j = 0; j < numPoly; j++)
+        {
+            pEngr[j] = pEngr[j] * pVolts[j] + pCoeffs[j];
+        }
+    }
+
+    // 3) Scatter the engineering units.
+    uint32_t numChannels = mPChannels.size ();
+    for (uint32_t j = 0; j < numPoly; j++)
+    {
+        mOutputs[numChannels + mPolyChannels[j]] = pEngr[j];
+    }
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "AnalogInDevice.hpp"
 
 /**
@@ -101,7 +103,9 @@ AnalogInDevice::AnalogInDevice (NiFpga_Session& kSession,
                                 std::shared_ptr<DataVector> kPDataVector,
                                 Config_t& kConfig,
                                 Error_t& kRet) :
-    Device (kSession, kPDataVector)
+    Device    (kSession, kPDataVector),
+    mRingHead (0),
+    mRingTail (0)
 {
     // Verify config.
     kRet = this->verifyConfig (kConfig);
@@ -113,6 +117,7 @@ AnalogInDevice::AnalogInDevice (NiFpga_Session& kSession,
     mDvElemOutputVolts = kConfig.dvElemOutputVolts;
     mDvElemOutputEngr = kConfig.dvElemOutputEngr;
     mPTransferFunc = kConfig.pTransferFunc;
+    mCalibration = kConfig.calibration;
 
     // Set the voltage range.
     NiFpga_Status status = NiFpga_Status_Success;
@@ -139,6 +144,13 @@ AnalogInDevice::AnalogInDevice (NiFpga_Session& kSession,
     // from U32s to floating point voltages.
     mFxpResourceId = AIN_FXP_RESOURCE_ARR[kConfig.pinNumber];
     mFxpTypeInfoId = AIN_FXP_INFO_ARR[kConfig.pinNumber];
+
+    // Allocate the oversampling ring up front so that sampling does not 
+    // allocate.
+    mDvElemOutputMin = kConfig.dvElemOutputMin;
+    mDvElemOutputMax = kConfig.dvElemOutputMax;
+    mDvElemNumSamples = kConfig.dvElemNumSamples;
+    mRing.resize (kConfig.oversampleRingSize);
 }
 
 Error_t AnalogInDevice::verifyConfig (Config_t& kConfig)
@@ -158,8 +170,17 @@ Error_t AnalogInDevice::verifyConfig (Config_t& kConfig)
         return E_OUT_OF_BOUNDS;
     }
 
-    // Check that transfer function pointer is non-null.
-    if (kConfig.pTransferFunc == nullptr)
+    // Check that the calibration is valid or, if there is none, that the 
+    // transfer function pointer is non-null.
+    if (kConfig.calibration.type != Calibration::CAL_NONE)
+    {
+        Error_t ret = Calibration::verifyConfig (kConfig.calibration);
+        if (ret != E_SUCCESS)
+        {
+            return ret;
+        }
+    }
+    else if (kConfig.pTransferFunc == nullptr)
     {
         return E_INVALID_POINTER;
     }
@@ -182,33 +203,133 @@ Error_t AnalogInDevice::verifyConfig (Config_t& kConfig)
         return E_PIN_NOT_CONFIGURED;
     }
 
+    // If oversampling, check that the ring size is a power of 2 and that the
+    // stats elems exist and are the correct type.
+    if (kConfig.oversampleRingSize > 0)
+    {
+        if ((kConfig.oversampleRingSize & 
+             (kConfig.oversampleRingSize - 1)) != 0)
+        {
+            return E_INCORRECT_SIZE;
+        }
+
+        uint32_t numSamples = 0;
+        if (mPDataVector->read (kConfig.dvElemOutputMin, value) 
+                != E_SUCCESS ||
+            mPDataVector->read (kConfig.dvElemOutputMax, value) 
+                != E_SUCCESS ||
+            mPDataVector->read (kConfig.dvElemNumSamples, numSamples) 
+                != E_SUCCESS)
+        {
+            return E_INVALID_ELEM;
+        }
+    }
+
     return E_SUCCESS;
 }
 
 Error_t AnalogInDevice::run ()
 {
+    if (mRing.empty () == false)
+    {
+        return this->runOversampled ();
+    }
+
     // Read fxp value.
-    NiFpga_Status status = NiFpga_Status_Success;
     uint32_t fxpVal = 0;
+    Error_t ret = this->readFxp (fxpVal);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // Convert fxp to floating point voltage and write outputs.
+    return this->writeOutput (NiFpga_ConvertFromFxpToFloat (mFxpTypeInfoId, 
+                                                            fxpVal));
+}
+
+Error_t AnalogInDevice::sample ()
+{
+    if (mRing.empty () == true)
+    {
+        return E_SUCCESS;
+    }
+
+    // Check for space. Only this thread writes the head.
+    uint32_t head = mRingHead.load (std::memory_order_relaxed);
+    if (head - mRingTail.load (std::memory_order_acquire) >= mRing.size ())
+    {
+        return E_SAMPLE_RING_FULL;
+    }
+
+    // Read fxp value into the ring, then publish it to run.
+    Error_t ret = this->readFxp (mRing[head & (mRing.size () - 1)]);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+    mRingHead.store (head + 1, std::memory_order_release);
+
+    return E_SUCCESS;
+}
+
+void AnalogInDevice::reserveSamples (uint32_t kNumSamples)
+{
+    if (mRing.empty () == true)
+    {
+        return;
+    }
+
+    // Keep the ring size a power of 2. See mRing.
+    uint32_t size = mRing.size ();
+    while (size < kNumSamples)
+    {
+        size <<= 1;
+    }
+    mRing.resize (size);
+
+    // Drop samples not yet aggregated, since their slots moved.
+    mRingTail.store (mRingHead.load (std::memory_order_relaxed), 
+                     std::memory_order_release);
+}
+
+/****************************** PRIVATE MEMBERS *******************************/
+
+Error_t AnalogInDevice::readFxp (uint32_t& kFxpValRet)
+{
+    NiFpga_Status status = NiFpga_Status_Success;
     NiFpga_MergeStatus (&status, NiFpga_ReadU32 (mSession, mFxpResourceId,
-                                                 &fxpVal));
+                                                 &kFxpValRet));
     if (status != NiFpga_Status_Success)
     {
         return E_FPGA_READ;
     }
 
-    // Convert fxp to floating point voltage.
-    float voltage = NiFpga_ConvertFromFxpToFloat (mFxpTypeInfoId, fxpVal);
+    return E_SUCCESS;
+}
+
+Error_t AnalogInDevice::convert (float kVoltage, float& kEngrRet)
+{
+    if (mCalibration.type != Calibration::CAL_NONE)
+    {
+        kEngrRet = Calibration::evaluate (mCalibration, kVoltage);
+        return E_SUCCESS;
+    }
 
+    return (*mPTransferFunc) (kVoltage, kEngrRet);
+}
+
+Error_t AnalogInDevice::writeOutput (float kVoltage)
+{
     // Write voltage to Data Vector.
-    if (mPDataVector->write (mDvElemOutputVolts, voltage) != E_SUCCESS)
+    if (mPDataVector->write (mDvElemOutputVolts, kVoltage) != E_SUCCESS)
     {
         return E_DATA_VECTOR_WRITE;
     }
 
     // Convert voltage to engineering unit.
     float engrUnit = 0;
-    Error_t convertErr = (*mPTransferFunc) (voltage, engrUnit);
+    Error_t convertErr = this->convert (kVoltage, engrUnit);
     if (convertErr != E_SUCCESS)
     {
         return convertErr;
@@ -221,4 +342,60 @@ Error_t AnalogInDevice::run ()
     }
 
     return E_SUCCESS;
+}
+
+Error_t AnalogInDevice::runOversampled ()
+{
+    // 1) Get the samples taken since the last run. Only this thread writes 
+    //    the tail.
+    uint32_t tail = mRingTail.load (std::memory_order_relaxed);
+    uint32_t head = mRingHead.load (std::memory_order_acquire);
+    uint32_t numSamples = head - tail;
+    uint32_t mask = mRing.size () - 1;
+
+    // 2) Aggregate them. If none were taken, take one now so that the outputs
+    //    are still updated.
+    float minVolts = 0;
+    float maxVolts = 0;
+    double sumVolts = 0;
+    if (numSamples == 0)
+    {
+        uint32_t fxpVal = 0;
+        Error_t ret = this->readFxp (fxpVal);
+        if (ret != E_SUCCESS)
+        {
+            return ret;
+        }
+        minVolts = NiFpga_ConvertFromFxpToFloat (mFxpTypeInfoId, fxpVal);
+        maxVolts = minVolts;
+        sumVolts = minVolts;
+        numSamples = 1;
+    }
+    else
+    {
+        minVolts = NiFpga_ConvertFromFxpToFloat (mFxpTypeInfoId, 
+                                                 mRing[tail & mask]);
+        maxVolts = minVolts;
+        for (uint32_t i = tail; i != head; i++)
+        {
+            float volts = NiFpga_ConvertFromFxpToFloat (mFxpTypeInfoId, 
+                                                        mRing[i & mask]);
+            minVolts = std::min (minVolts, volts);
+            maxVolts = std::max (maxVolts, volts);
+            sumVolts += volts;
+        }
+
+        // Free the ring slots for sample.
+        mRingTail.store (head, std::memory_order_release);
+    }
+
+    // 3) Write stats. The engineering unit is that of the mean voltage.
+    if (mPDataVector->write (mDvElemOutputMin, minVolts) != E_SUCCESS ||
+        mPDataVector->write (mDvElemOutputMax, maxVolts) != E_SUCCESS ||
+        mPDataVector->write (mDvElemNumSamples, numSamples) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    return this->writeOutput ((float) (sumVolts / numSamples));
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <algorithm>
+
+#include "Calibration.hpp"
+
+Error_t Calibration::verifyConfig (const Config_t& kConfig)
+{
+    switch (kConfig.type)
+    {
+        case CAL_NONE:
+            return E_SUCCESS;
+
+        case CAL_POLYNOMIAL:
+            if (kConfig.coeffs.empty () == true)
+            {
+                return E_EMPTY_CONFIG;
+            }
+            return E_SUCCESS;
+
+        case CAL_PIECEWISE_LINEAR:
+            if (kConfig.pointsV.size () < 2)
+            {
+                return E_EMPTY_CONFIG;
+            }
+            if (kConfig.pointsV.size () != kConfig.pointsEngr.size ())
+            {
+                return E_INCORRECT_SIZE;
+            }
+            for (uint32_t i = 1; i < kConfig.pointsV.size (); i++)
+            {
+                if (kConfig.pointsV[i] <= kConfig.pointsV[i - 1])
+                {
+                    return E_INVALID_CONFIG;
+                }
+            }
+            return E_SUCCESS;
+
+        default:
+            return E_INVALID_ENUM;
+    }
+}
+
+float Calibration::evaluate (const Config_t& kConfig, float kV)
+{
+    switch (kConfig.type)
+    {
+        case CAL_POLYNOMIAL:
+        {
+            // Horner's method, highest order term first.
+            float engr = kConfig.coeffs.back ();
+            for (uint32_t i = kConfig.coeffs.size () - 1; i > 0; i--)
+            {
+                engr = engr * kV + kConfig.coeffs[i - 1];
+            }
+            return engr;
+        }
+
+        case CAL_PIECEWISE_LINEAR:
+        {
+            // Find the segment containing kV, clamped to the first and last
+            // segments so that values outside the table are extrapolated.
+            const std::vector<float>& x = kConfig.pointsV;
+            const std::vector<float>& y = kConfig.pointsEngr;
+            uint32_t hi = std::upper_bound (x.begin (), x.end (), kV) -
+                          x.begin ();
+            hi = std::max (1u, std::min (hi, (uint32_t) x.size () - 1));
+            uint32_t lo = hi - 1;
+            return y[lo] + (kV - x[lo]) * (y[hi] - y[lo]) / (x[hi] - x[lo]);
+        }
+
+        default:
+            return kV;
+    }
+}
@@ -4,21 +4,6 @@
 
 /******************************** CONSTANTS ***********************************/
 
-/**
- * Period of loop function.
- */
-static const uint32_t LOOP_PERIOD_MS = 10;
-
-/**
- * Device Nodes.
- */
-static const std::vector<Node_t> DEVICE_NODES =
-{
-    NODE_DEVICE0,
-    NODE_DEVICE1,
-    NODE_DEVICE2,
-};
-
 /**
  * Time per loop available to the communications step.
  */
@@ -39,8 +24,170 @@ static const Time::TimeNs_t COMMUNICATIONS_TIME_BUFFER_NS =
  */
 static const Time::TimeNs_t MIN_RECV_TIMEOUT_NS = 100 * Time::NS_IN_US;
 
+/**
+ * With OVERRUN_POLICY_DEGRADE, number of consecutive loops that must finish 
+ * within DEGRADE_RECOVERY_LOOP_TIME_NS before the loop stops shedding. 
+ */
+static const uint32_t DEGRADE_RECOVERY_FRAMES = 10;
+
+/**
+ * With OVERRUN_POLICY_DEGRADE, max loop time of a degraded loop that counts 
+ * towards recovery. Leaves margin below the period so that the loop does not 
+ * recover into an immediate overrun.
+ */
+static const Time::TimeNs_t DEGRADE_RECOVERY_LOOP_TIME_NS = 
+                                    NetworkManager::LOOP_PERIOD_NS * 8 / 10;
+
+/**
+ * Profiled loop phases. Each phase's index into LOOP_PHASE_CONFIG is its phase
+ * number. Controller i is profiled as phase PHASE_CTRL0 + i.
+ */
+enum LoopPhase_t : uint8_t
+{
+    PHASE_COMMS,
+    PHASE_CMD_HANDLER,
+    PHASE_STATE_MACHINE,
+    PHASE_CTRLS,
+    PHASE_ACTUATION,
+    PHASE_LOOP,
+    PHASE_CTRL0,
+};
+
+/**
+ * Data Vector elements to write loop phase timing stats to. Profiling is 
+ * enabled if the Data Vector contains these elements.
+ */
+static const PhaseProfiler::Config_t LOOP_PHASE_CONFIG =
+{
+    PHASE_PROFILER_PHASE_CONFIG (DV_ELEM_CN_COMMS),
+    PHASE_PROFILER_PHASE_CONFIG (DV_ELEM_CN_CMD_HANDLER),
+    PHASE_PROFILER_PHASE_CONFIG (DV_ELEM_CN_STATE_MACHINE),
+    PHASE_PROFILER_PHASE_CONFIG (DV_ELEM_CN_CTRLS),
+    PHASE_PROFILER_PHASE_CONFIG (DV_ELEM_CN_ACTUATION),
+    PHASE_PROFILER_PHASE_CONFIG (DV_ELEM_CN_LOOP),
+};
+
+/**
+ * Data Vector elements to write per-Controller timing stats to, in Controller
+ * order. Generated from DV_CN_CTRL_PHASE_PREFIXES so that adding Controller 
+ * elements there extends this table.
+ */
+#define CTRL_PHASE_CONFIG_ENTRY(kPrefix) PHASE_PROFILER_PHASE_CONFIG (kPrefix),
+static const PhaseProfiler::Config_t CTRL_PHASE_CONFIG =
+{
+    DV_CN_CTRL_PHASE_PREFIXES (CTRL_PHASE_CONFIG_ENTRY)
+};
+
+/**
+ * Data Vector elements to mirror the loop thread's timing stats to. Mirroring
+ * is enabled if the Data Vector contains these elements.
+ */
+static const ThreadManager::PeriodicThreadStatsDvConfig_t 
+    LOOP_THREAD_STATS_CONFIG =
+{
+    DV_ELEM_CN_LOOP_JITTER_MAX_NS,
+    DV_ELEM_CN_LOOP_JITTER_P99_NS,
+    DV_ELEM_CN_LOOP_EXEC_MAX_NS,
+    DV_ELEM_CN_LOOP_EXEC_P99_NS,
+    DV_ELEM_CN_LOOP_RESPONSE_MAX_NS,
+    DV_ELEM_CN_LOOP_RESPONSE_P99_NS,
+};
+
+/**
+ * Number of loops between writes of the loop thread's timing stats.
+ */
+static const uint32_t LOOP_THREAD_STATS_WRITE_PERIOD = 100;
+
+/**
+ * Struct containing the elements of DV_REG_CN_TO_DNx that the Control Node 
+ * stamps each message with.
+ */
+typedef struct MsgElems
+{
+    DataVectorElement_t frameElem;
+    DataVectorElement_t actuationMsgElem;
+} MsgElems_t;
+
+/**
+ * Map entry from Device Node x to the elements of DV_REG_CN_TO_DNx that stamp
+ * each message.
+ *
+ * @param  kIdx  Device Node index.
+ */
+#define MSG_ELEMS_ENTRY(kIdx)                                                  \
+    {NODE_DEVICE##kIdx, {DV_ELEM_CN_TO_DN##kIdx##_FRAME,                       \
+                         DV_ELEM_CN_TO_DN##kIdx##_ACTUATION_MSG}},
+
+/**
+ * Map from Device Node x to the elements of DV_REG_CN_TO_DNx that stamp each 
+ * message. A Device Node uses the frame counter to discard stale messages and
+ * the message type to tell the same-frame actuation message from the next 
+ * frame's message. Generated from NODE_DEVICE_INDICES so that every Device 
+ * Node has an entry.
+ */
+static const std::unordered_map<Node_t, MsgElems_t, EnumClassHash>
+    NODE_TO_MSG_ELEMS =
+{
+    NODE_DEVICE_INDICES (MSG_ELEMS_ENTRY)
+};
+
+const std::vector<ControlNode::DeviceNodeConfig_t> 
+    ControlNode::PLATFORM_V1_DEVICE_NODES =
+{
+    {NODE_DEVICE0, 
+     DV_REG_CN_TO_DN0, 
+     DV_REG_DN0_TO_CN, 
+     DV_ELEM_DN0_RX_MISS_COUNT},
+    {NODE_DEVICE1, 
+     DV_REG_CN_TO_DN1, 
+     DV_REG_DN1_TO_CN, 
+     DV_ELEM_DN1_RX_MISS_COUNT},
+    {NODE_DEVICE2, 
+     DV_REG_CN_TO_DN2, 
+     DV_REG_DN2_TO_CN, 
+     DV_ELEM_DN2_RX_MISS_COUNT},
+};
+
+const TaskPool::Config_t ControlNode::PLATFORM_V1_CTRL_POOL =
+{
+    {ThreadManager::Affinity_t::CORE_0},
+    ThreadManager::MIN_NEW_THREAD_PRIORITY
+};
+
 /********************************* GLOBALS ************************************/
 
+/**
+ * Communications step timing mode.
+ */
+static ControlNode::CommsMode_t gCommsMode = ControlNode::COMMS_MODE_EARLY_EXIT;
+
+/**
+ * If true, send the Control Node to Device Node regions again after the 
+ * Controllers run each loop.
+ */
+static bool gSameFrameActuation = false;
+
+/**
+ * Device Node configs and the corresponding Device Nodes, in the same order. 
+ * Set in entry.
+ */
+static std::vector<ControlNode::DeviceNodeConfig_t> gDeviceNodeConfigs;
+static std::vector<Node_t> gDeviceNodes;
+
+/**
+ * Frame counter and message type elements in the Data Vector, one per 
+ * configured Device Node whose element exists. Filled after Data Vector 
+ * initialization.
+ */
+static std::vector<DataVectorElement_t> gFrameElems;
+static std::vector<DataVectorElement_t> gActuationMsgElems;
+
+/**
+ * Frame counter written to gFrameElems each time the Control Node to Device
+ * Node regions are copied for the communications step.
+ */
+static uint32_t gFrame = 0;
+
 /**
  * Pointer to Time Module.
  */
@@ -72,23 +219,148 @@ std::unique_ptr<StateMachine> gPSm = nullptr;
 static std::vector<std::unique_ptr<Controller>> gPCtrls;
 
 /**
- * Statically allocated buffer for receiving data from Ground over the network.
+ * Pointer to Phase Profiler. Null if loop phase profiling is disabled.
+ */
+static std::unique_ptr<PhaseProfiler> gPPp = nullptr;
+
+/**
+ * Rate Group Executive. Schedules the Controllers. Controller i is task i.
+ */
+static std::unique_ptr<RateGroupExecutive> gPRge = nullptr;
+
+/**
+ * A Controller run in parallel by the Task Pool. The Controller's execution 
+ * time, and its wall and CPU time if profiling is enabled, are measured on the
+ * thread that runs it.
+ */
+typedef struct CtrlTask
+{
+    uint8_t        ctrl;
+    Time::TimeNs_t timeNs;
+    Error_t        timeRet;
+    Time::TimeNs_t wallNs;
+    Time::TimeNs_t cpuNs;
+    Error_t        profileRet;
+} CtrlTask_t;
+
+/**
+ * Controller Graph. Orders the Controllers into levels that can run in 
+ * parallel. Null if parallel Controllers are disabled.
+ */
+static std::unique_ptr<ControllerGraph> gPGraph = nullptr;
+
+/**
+ * Task Pool used to run the Controllers in a level in parallel. Null if 
+ * parallel Controllers are disabled.
+ */
+static std::unique_ptr<TaskPool> gPPool = nullptr;
+
+/**
+ * Statically allocated Controller tasks, one per Controller, and the batch of
+ * tasks to run in parallel.
+ */
+static std::vector<CtrlTask_t> gCtrlTasks;
+static std::vector<TaskPool::Task_t> gBatch;
+
+/**
+ * True if the rate group responsible for a loop deadline miss is written to 
+ * the Data Vector.
+ */
+static bool gWriteOverrunRateGroup = false;
+
+/**
+ * Thread Manager. Used by the loop to read its own timing stats.
+ */
+static ThreadManager* gPTm = nullptr;
+
+/**
+ * True if the loop thread's timing stats are mirrored to the Data Vector.
  */
-static std::vector<uint8_t> gGndToCnBuf;
+static bool gWriteLoopThreadStats = false;
 
 /**
- * Statically allocated buffers for receiving data from Device Nodes over the 
- * network.
+ * Number of loops since the loop thread's timing stats were last written.
  */
-static std::vector<std::vector<uint8_t>> gDnRecvBufs (DEVICE_NODES.size ());
+static uint32_t gLoopsSinceStatsWrite = 0;
 
 /**
- * Statically allocated buffers for sending data over the network.
+ * True if page faults taken after the first loop are counted in the Data 
+ * Vector.
  */
-static std::vector<uint8_t> gCnToDn0Buf;
-static std::vector<uint8_t> gCnToDn1Buf;
-static std::vector<uint8_t> gCnToDn2Buf;
-static std::vector<uint8_t> gCnToGndBuf;
+static bool gCountPageFaults = false;
+
+/**
+ * Process page fault counts at the end of the first loop, and when faults 
+ * were last counted. Set by the loop.
+ */
+static bool gPageFaultsBaselined = false;
+static MemoryManager::PageFaults_t gBaselinePageFaults = {0, 0};
+static MemoryManager::PageFaults_t gLastPageFaults = {0, 0};
+
+/**
+ * Loop overrun policy.
+ */
+static ControlNode::OverrunPolicy_t gOverrunPolicy = 
+                                        ControlNode::OVERRUN_POLICY_SKIP;
+
+/**
+ * With OVERRUN_POLICY_DEGRADE, number of loops within 
+ * DEGRADE_RECOVERY_LOOP_TIME_NS still required before the loop stops shedding.
+ * The loop is degraded while non-zero. Reset on each deadline miss.
+ */
+static uint32_t gDegradeFramesLeft = 0;
+
+/**
+ * True if degraded loops are counted in the Data Vector.
+ */
+static bool gCountDegradedLoops = false;
+
+/**
+ * Buffers for one frame of network data exchange.
+ */
+typedef struct CommsBuffers
+{
+    std::vector<std::vector<uint8_t>> cnToDnBufs;
+    std::vector<uint8_t>              cnToGndBuf;
+    bool                              shedGround;
+    std::vector<uint8_t>              gndToCnBuf;
+    bool                              gndMsgReceived;
+    std::vector<std::vector<uint8_t>> dnRecvBufs;
+    std::vector<uint32_t>             dnNumMsgsReceived;
+    bool                              exchanged;
+} CommsBuffers_t;
+
+/**
+ * Statically allocated buffers for sending and receiving data over the 
+ * network. In COMMS_MODE_DEDICATED_THREAD, the comms thread fills one set 
+ * while the loop thread consumes the other, and the sets are swapped at the 
+ * frame boundary. Other modes only use set 0.
+ */
+static CommsBuffers_t gCommsBufs[2];
+
+/**
+ * Index into gCommsBufs of the set owned by the comms thread. The loop thread
+ * owns the other set. Protected by gCommsLock.
+ */
+static uint8_t gCommsThreadBufIdx = 0;
+
+/**
+ * True from when the loop thread hands a frame to the comms thread until the
+ * comms thread finishes exchanging that frame's data. Protected by gCommsLock.
+ */
+static bool gCommsFramePending = false;
+
+/**
+ * Statically allocated buffers for the same-frame actuation send. Separate from
+ * gCommsBufs so that the send does not race with the comms thread.
+ */
+static std::vector<std::vector<uint8_t>> gCnToDnActuationBufs;
+
+/**
+ * Lock and condition variable used to hand frames to the comms thread.
+ */
+static pthread_mutex_t gCommsLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gCommsCond = PTHREAD_COND_INITIALIZER;
 
 /***************************** PRIVATE FUNCIONS *******************************/
 
@@ -102,12 +374,26 @@ static std::vector<uint8_t> gCnToGndBuf;
  */
 static Error_t periodicErrorHandler (Error_t kError)
 {
-    // Log deadline miss.
+    // Log deadline miss and the rate group that took the most time in the 
+    // loop that missed its deadline. If degrading, start or restart shedding.
     if (kError == E_MISSED_SCHEDULER_DEADLINE)
     {
+        if (gOverrunPolicy == ControlNode::OVERRUN_POLICY_DEGRADE)
+        {
+            gDegradeFramesLeft = DEGRADE_RECOVERY_FRAMES;
+        }
         Errors::incrementOnError (gPDv->increment (
                                            DV_ELEM_CN_LOOP_DEADLINE_MISS_COUNT),
                                  gPDv, DV_ELEM_CN_ERROR_COUNT);
+        if (gWriteOverrunRateGroup == true)
+        {
+            uint8_t divisor = 0;
+            gPRge->getHeaviestRateGroup (divisor);
+            Errors::incrementOnError (gPDv->write (
+                                           DV_ELEM_CN_OVERRUN_RATE_DIVISOR,
+                                           divisor),
+                                      gPDv, DV_ELEM_CN_ERROR_COUNT);
+        }
         return E_SUCCESS;
     }
 
@@ -115,36 +401,233 @@ static Error_t periodicErrorHandler (Error_t kError)
 }
 
 /**
- * Helper to verify Network Manager config matches required Platform v1 
- * topology.
+ * Helper to start timing a loop phase if profiling is enabled. Errors are 
+ * logged.
  *
- * @param  kNmConfig        NM config to verify.
+ * @param  kPhase  Phase to start.
+ */
+static void startPhase (uint8_t kPhase)
+{
+    if (gPPp != nullptr)
+    {
+        Errors::incrementOnError (gPPp->startPhase (kPhase), gPDv, 
+                                  DV_ELEM_CN_ERROR_COUNT);
+    }
+}
+
+/**
+ * Helper to end timing a loop phase if profiling is enabled. Errors are 
+ * logged.
+ *
+ * @param  kPhase  Phase to end.
+ */
+static void endPhase (uint8_t kPhase)
+{
+    if (gPPp != nullptr)
+    {
+        Errors::incrementOnError (gPPp->endPhase (kPhase), gPDv, 
+                                  DV_ELEM_CN_ERROR_COUNT);
+    }
+}
+
+/**
+ * Helper to initialize the Phase Profiler if the Data Vector contains the loop
+ * phase timing elements. Must be called after the Controllers are initialized.
+ *
+ * @ret    E_SUCCESS         Phase Profiler initialized or profiling disabled.
+ *         E_INVALID_CONFIG  More Controllers than per-Controller phases.
+ *         [other]           Phase Profiler failed to initialize.
+ */
+static Error_t initializePhaseProfiler ()
+{
+    // 1) Profiling is disabled if the first phase's elements are not in the 
+    //    Data Vector.
+    if (gPDv->elementExists (LOOP_PHASE_CONFIG[0].wallMinNs) != E_SUCCESS)
+    {
+        return E_SUCCESS;
+    }
+
+    // 2) Verify every Controller has its own phase elements so that none is 
+    //    left out of the per-Controller stats.
+    if (gPCtrls.size () > CTRL_PHASE_CONFIG.size ())
+    {
+        return E_INVALID_CONFIG;
+    }
+
+    // 3) Build config with the loop phases followed by one phase per 
+    //    Controller. The Data Vector must contain the elements of each.
+    PhaseProfiler::Config_t config = LOOP_PHASE_CONFIG;
+    config.insert (config.end (), CTRL_PHASE_CONFIG.begin (), 
+                   CTRL_PHASE_CONFIG.begin () + gPCtrls.size ());
+
+    return PhaseProfiler::createNew (config, gPDv, gPPp);
+}
+
+/**
+ * Helper to write the number of page faults the process has taken since the 
+ * first loop to the Data Vector. The first call records the baseline. The 
+ * Data Vector is only written when the counts change.
+ *
+ * @ret    E_SUCCESS              Page faults counted.
+ *         E_FAILED_TO_GET_USAGE  Failed to read page fault counts.
+ *         E_DATA_VECTOR_WRITE    Failed to write counts to Data Vector.
+ */
+static Error_t countPageFaults ()
+{
+    // 1) Read the process's page fault counts.
+    MemoryManager::PageFaults_t faults = {0, 0};
+    Error_t ret = MemoryManager::getPageFaults (faults);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 2) On the first call, record the baseline.
+    if (gPageFaultsBaselined == false)
+    {
+        gBaselinePageFaults = faults;
+        gLastPageFaults = faults;
+        gPageFaultsBaselined = true;
+        return E_SUCCESS;
+    }
+
+    // 3) If any faults were taken since the last call, write the counts since
+    //    the baseline.
+    if (faults.minor == gLastPageFaults.minor && 
+        faults.major == gLastPageFaults.major)
+    {
+        return E_SUCCESS;
+    }
+    gLastPageFaults = faults;
+    if (gPDv->write (DV_ELEM_CN_MINOR_PAGE_FAULT_COUNT, 
+                     (uint32_t) (faults.minor - gBaselinePageFaults.minor)) 
+            != E_SUCCESS ||
+        gPDv->write (DV_ELEM_CN_MAJOR_PAGE_FAULT_COUNT, 
+                     (uint32_t) (faults.major - gBaselinePageFaults.major)) 
+            != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to initialize the Rate Group Executive with each Controller's rate.
+ * Must be called after the Controllers are initialized.
+ *
+ * @ret    E_SUCCESS  Rate Group Executive initialized.
+ *         [other]    Rate Group Executive failed to initialize.
+ */
+static Error_t initializeRateGroupExecutive ()
+{
+    RateGroupExecutive::Config_t config;
+    for (std::unique_ptr<Controller>& pCtrl : gPCtrls)
+    {
+        config.push_back (pCtrl->getRate ());
+    }
+
+    return RateGroupExecutive::createNew (config, gPRge);
+}
+
+/**
+ * Helper to initialize the Controller Graph, the Task Pool, and the task 
+ * buffers used by the loop to run Controllers in parallel. Must be called 
+ * after the Controllers are initialized.
+ *
+ * @param  kPoolConfig  Task Pool config.
+ *
+ * @ret    E_SUCCESS    Parallel Controllers initialized.
+ *         [other]      Controller Graph or Task Pool failed to initialize.
+ */
+static Error_t initializeParallelCtrls (const TaskPool::Config_t& kPoolConfig)
+{
+    Error_t ret = ControllerGraph::createNew (gPCtrls, gPGraph);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    gCtrlTasks.resize (gPCtrls.size ());
+    gBatch.reserve (gPCtrls.size ());
+
+    return TaskPool::createNew (kPoolConfig, gPPool);
+}
+
+/**
+ * Helper to verify the Device Node configs are valid.
+ *
+ * @param  kDeviceNodes     Device Node configs to verify.
  *
  * @ret    E_SUCCESS        Config valid.
  *         E_INVALD_CONFIG  Config invalid.
  */
-static Error_t verifyNmConfig (NetworkManager::Config_t& kNmConfig)
+static Error_t verifyDeviceNodeConfig (
+                    std::vector<ControlNode::DeviceNodeConfig_t>& kDeviceNodes)
 {
-    // Verify nodes.
-    std::unordered_map<Node_t, NetworkManager::IP_t, EnumClassHash> nodes = 
-        kNmConfig.nodeToIp;
-    if (nodes.find (NODE_CONTROL) == nodes.end () ||
-        nodes.find (NODE_DEVICE0) == nodes.end () ||
-        nodes.find (NODE_DEVICE1) == nodes.end () ||
-        nodes.find (NODE_DEVICE2) == nodes.end () ||
-        nodes.find (NODE_GROUND)  == nodes.end ())
+    // Verify at least one Device Node.
+    if (kDeviceNodes.empty () == true)
     {
         return E_INVALID_CONFIG;
     }
 
-    // Verify channels
-    std::set<std::set<Node_t>> expectedChannelsSet =
+    // Verify each config is for a Device Node with an entry in 
+    // NODE_TO_MSG_ELEMS and no node, region, or element is used more than 
+    // once.
+    std::set<Node_t> nodes;
+    std::set<DataVectorRegion_t> regions;
+    std::set<DataVectorElement_t> elems;
+    for (ControlNode::DeviceNodeConfig_t& dnConfig : kDeviceNodes)
+    {
+        if (dnConfig.node < NODE_DEVICE0 || dnConfig.node > NODE_DEVICE_LAST ||
+            NODE_TO_MSG_ELEMS.find (dnConfig.node) == 
+                NODE_TO_MSG_ELEMS.end () ||
+            nodes.insert (dnConfig.node).second == false ||
+            regions.insert (dnConfig.cnToDnRegion).second == false ||
+            regions.insert (dnConfig.dnToCnRegion).second == false ||
+            elems.insert (dnConfig.rxMissCountElem).second == false)
+        {
+            return E_INVALID_CONFIG;
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to verify Network Manager config matches required Platform v1 
+ * topology.
+ *
+ * @param  kNmConfig        NM config to verify.
+ * @param  kDeviceNodes     Device Node configs.
+ *
+ * @ret    E_SUCCESS        Config valid.
+ *         E_INVALD_CONFIG  Config invalid.
+ */
+static Error_t verifyNmConfig (
+                    NetworkManager::Config_t& kNmConfig,
+                    std::vector<ControlNode::DeviceNodeConfig_t>& kDeviceNodes)
+{
+    // Initialize sets of required nodes and channels.
+    std::set<Node_t> requiredNodeSet = {NODE_CONTROL, NODE_GROUND};
+    std::set<std::set<Node_t>> expectedChannelsSet = 
     {
-        {NODE_CONTROL, NODE_DEVICE0},
-        {NODE_CONTROL, NODE_DEVICE1},
-        {NODE_CONTROL, NODE_DEVICE2},
         {NODE_CONTROL, NODE_GROUND}
     };
+    for (ControlNode::DeviceNodeConfig_t& dnConfig : kDeviceNodes)
+    {
+        requiredNodeSet.insert (dnConfig.node);
+        expectedChannelsSet.insert ({NODE_CONTROL, dnConfig.node});
+    }
+
+    // Verify nodes.
+    for (Node_t node : requiredNodeSet)
+    {
+        if (kNmConfig.nodeToIp.find (node) == kNmConfig.nodeToIp.end ())
+        {
+            return E_INVALID_CONFIG;
+        }
+    }
 
     // Remove channels that exist in config from expectedChannelsSet.
     for (NetworkManager::ChannelConfig_t channel : kNmConfig.channels)
@@ -165,22 +648,19 @@ static Error_t verifyNmConfig (NetworkManager::Config_t& kNmConfig)
  * Helper to verify Data Vector config contains required regions and elements.
  *
  * @param  kDvConfig        DV config to verify.
+ * @param  kDeviceNodes     Device Node configs.
  *
  * @ret    E_SUCCESS        Config valid.
  *         E_INVALD_CONFIG  Config invalid.
  */
-static Error_t verifyDvConfig (DataVector::Config_t& kDvConfig)
+static Error_t verifyDvConfig (
+                    DataVector::Config_t& kDvConfig,
+                    std::vector<ControlNode::DeviceNodeConfig_t>& kDeviceNodes)
 {
     // Initialize sets of required regions and elements.
     std::set<DataVectorRegion_t> requiredRegionSet =
     {
         DV_REG_CN,
-        DV_REG_CN_TO_DN0,
-        DV_REG_CN_TO_DN1,
-        DV_REG_CN_TO_DN2,
-        DV_REG_DN0_TO_CN,
-        DV_REG_DN1_TO_CN,
-        DV_REG_DN2_TO_CN,
         DV_REG_GROUND_TO_CN,
     };
     std::set<DataVectorElement_t> requiredElementSet =
@@ -188,13 +668,16 @@ static Error_t verifyDvConfig (DataVector::Config_t& kDvConfig)
         DV_ELEM_STATE,
         DV_ELEM_CN_LOOP_COUNT,
         DV_ELEM_CN_ERROR_COUNT,
-        DV_ELEM_DN0_RX_MISS_COUNT,
-        DV_ELEM_DN1_RX_MISS_COUNT,
-        DV_ELEM_DN2_RX_MISS_COUNT,
         DV_ELEM_CN_TIME_NS,
         DV_ELEM_CN_LOOP_DEADLINE_MISS_COUNT,
         DV_ELEM_CN_COMMS_DEADLINE_MISS_COUNT,
     };
+    for (ControlNode::DeviceNodeConfig_t& dnConfig : kDeviceNodes)
+    {
+        requiredRegionSet.insert (dnConfig.cnToDnRegion);
+        requiredRegionSet.insert (dnConfig.dnToCnRegion);
+        requiredElementSet.insert (dnConfig.rxMissCountElem);
+    }
 
     // Loop over regions and elements, removing them from the required sets.
     for (DataVector::RegionConfig_t regionConfig : kDvConfig)
@@ -218,65 +701,63 @@ static Error_t verifyDvConfig (DataVector::Config_t& kDvConfig)
 
 /**
  * Helper to initialize static buffers for rx'ing/tx'ing data over the network.
+ * Buffers are sized for the configured Device Nodes.
  *
  * @ret  E_SUCCESS           Successfully initialized buffers.
  *       E_DATA_VECTOR_READ  Failed to read size data from Data Vector.
- *       E_INVALID_CONFIG    Unexpected buffer.
  */
 static Error_t initializeBuffers ()
 {
-    // Get size of buffers.
-    uint32_t cnToDn0BufSize = 0;
-    uint32_t cnToDn1BufSize = 0;
-    uint32_t cnToDn2BufSize = 0;
+    // 1) Get size of Ground buffers.
     uint32_t cnToGndBufSize = 0;
-    uint32_t dn0ToCnBufSize = 0;
-    uint32_t dn1ToCnBufSize = 0;
-    uint32_t dn2ToCnBufSize = 0;
     uint32_t gndToCnBufSize = 0;
-    if (gPDv->getRegionSizeBytes (DV_REG_CN_TO_DN0, cnToDn0BufSize) 
-            != E_SUCCESS ||
-        gPDv->getRegionSizeBytes (DV_REG_CN_TO_DN1, cnToDn1BufSize) 
-            != E_SUCCESS ||
-        gPDv->getRegionSizeBytes (DV_REG_CN_TO_DN2, cnToDn2BufSize) 
-            != E_SUCCESS ||
-        gPDv->getRegionSizeBytes (DV_REG_DN0_TO_CN, dn0ToCnBufSize) 
-            != E_SUCCESS ||
-        gPDv->getRegionSizeBytes (DV_REG_DN1_TO_CN, dn1ToCnBufSize) 
-            != E_SUCCESS ||
-        gPDv->getRegionSizeBytes (DV_REG_DN2_TO_CN, dn2ToCnBufSize) 
-            != E_SUCCESS ||
-        gPDv->getRegionSizeBytes (DV_REG_GROUND_TO_CN, gndToCnBufSize) 
+    if (gPDv->getRegionSizeBytes (DV_REG_GROUND_TO_CN, gndToCnBufSize) 
             != E_SUCCESS ||
         gPDv->getDataVectorSizeBytes (cnToGndBufSize) != E_SUCCESS)
     {
         return E_DATA_VECTOR_READ;
     }
 
-    // Resize send buffers.
-    gCnToDn0Buf.resize (cnToDn0BufSize);
-    gCnToDn1Buf.resize (cnToDn1BufSize);
-    gCnToDn2Buf.resize (cnToDn2BufSize);
-    gCnToGndBuf.resize (cnToGndBufSize);
+    // 2) Get size of Device Node buffers.
+    uint8_t numDeviceNodes = gDeviceNodeConfigs.size ();
+    std::vector<uint32_t> cnToDnBufSizes (numDeviceNodes, 0);
+    std::vector<uint32_t> dnToCnBufSizes (numDeviceNodes, 0);
+    for (uint8_t i = 0; i < numDeviceNodes; i++)
+    {
+        if (gPDv->getRegionSizeBytes (gDeviceNodeConfigs[i].cnToDnRegion, 
+                                      cnToDnBufSizes[i]) != E_SUCCESS ||
+            gPDv->getRegionSizeBytes (gDeviceNodeConfigs[i].dnToCnRegion, 
+                                      dnToCnBufSizes[i]) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+    }
+
+    // 3) Resize same-frame actuation buffers.
+    gCnToDnActuationBufs.resize (numDeviceNodes);
+    for (uint8_t i = 0; i < numDeviceNodes; i++)
+    {
+        gCnToDnActuationBufs[i].resize (cnToDnBufSizes[i]);
+    }
 
-    // Resize receive buffers.
-    gGndToCnBuf.resize (gndToCnBufSize);
-    for (uint8_t i = 0; i < DEVICE_NODES.size (); i++)
+    // 4) Resize both sets of buffers.
+    for (CommsBuffers_t& bufs : gCommsBufs)
     {
-        switch (DEVICE_NODES[i])
+        // Resize send buffers.
+        bufs.cnToDnBufs.resize (numDeviceNodes);
+        bufs.cnToGndBuf.resize (cnToGndBufSize);
+        bufs.shedGround = false;
+
+        // Resize receive buffers.
+        bufs.gndToCnBuf.resize (gndToCnBufSize);
+        bufs.gndMsgReceived = false;
+        bufs.dnRecvBufs.resize (numDeviceNodes);
+        bufs.dnNumMsgsReceived.assign (numDeviceNodes, 0);
+        bufs.exchanged = false;
+        for (uint8_t i = 0; i < numDeviceNodes; i++)
         {
-            case NODE_DEVICE0:
-                gDnRecvBufs[i].resize (dn0ToCnBufSize);
-                break;
-            case NODE_DEVICE1:
-                gDnRecvBufs[i].resize (dn1ToCnBufSize);
-                break;
-            case NODE_DEVICE2:
-                gDnRecvBufs[i].resize (dn2ToCnBufSize);
-                break;
-            default:
-                // This should never happen.
-                return E_INVALID_CONFIG;
+            bufs.cnToDnBufs[i].resize (cnToDnBufSizes[i]);
+            bufs.dnRecvBufs[i].resize (dnToCnBufSizes[i]);
         }
     }
 
@@ -284,62 +765,104 @@ static Error_t initializeBuffers ()
 }
 
 /**
- * Helper to send/recv Data Vector data to/from Device Nodes and Ground.
+ * Helper to copy the Data Vector data to send this frame into a set of comms
+ * buffers.
  *
- * @ret  E_SUCCESS                  Successfully received data.
- *       E_FAILED_TO_GET_TIME       Could not read time.
- *       E_DATA_VECTOR_READ         Failed to copy data from Data Vector.
- *       E_DATA_VECTOR_WRITE        Failed to write data to Data Vector.
- *       E_NETWORK_MANAGER_RX_FAIL  Failed to recv data from nodes.
- *       E_NETWORK_MANAGER_TX_FAIL  Failed to send data to nodes.
+ * @param  kBufs               Buffers to copy data into.
+ * @param  kShedGround         If true, skip the Ground link this frame. The 
+ *                             Data Vector is not copied for Ground.
+ *
+ * @ret    E_SUCCESS            Successfully copied data.
+ *         E_DATA_VECTOR_READ   Failed to copy data from Data Vector.
+ *         E_DATA_VECTOR_WRITE  Failed to write frame counter.
  */
-static Error_t sendAndRecvDataVectorData ()
+static Error_t readTxData (CommsBuffers_t& kBufs, bool kShedGround)
 {
-    // 1) Get start time, deadline time, and deadline time - buffer. These are 
-    //    used for managing the communications so that they are completed within 
-    //    the time slice.
-    Time::TimeNs_t startTimeNs = 0;
-    if (gPTime->getTimeNs (startTimeNs) != E_SUCCESS)
+    // 1) Stamp the Device Node messages with the next frame counter and mark
+    //    them as not the actuation message.
+    gFrame++;
+    for (DataVectorElement_t elem : gFrameElems)
     {
-        return E_FAILED_TO_GET_TIME;
+        if (gPDv->write (elem, gFrame) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_WRITE;
+        }
+    }
+    for (DataVectorElement_t elem : gActuationMsgElems)
+    {
+        if (gPDv->write (elem, false) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_WRITE;
+        }
     }
 
     // 2) Copy Data Vector data to buffers.
-    if (gPDv->readRegion (DV_REG_CN_TO_DN0, gCnToDn0Buf) != E_SUCCESS ||
-        gPDv->readRegion (DV_REG_CN_TO_DN1, gCnToDn1Buf) != E_SUCCESS ||
-        gPDv->readRegion (DV_REG_CN_TO_DN2, gCnToDn2Buf) != E_SUCCESS ||
-        gPDv->readDataVector (gCnToGndBuf)               != E_SUCCESS)
+    for (uint8_t i = 0; i < gDeviceNodeConfigs.size (); i++)
+    {
+        if (gPDv->readRegion (gDeviceNodeConfigs[i].cnToDnRegion, 
+                              kBufs.cnToDnBufs[i]) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+    }
+
+    // 3) Copy the Data Vector for Ground unless shed this frame.
+    kBufs.shedGround = kShedGround;
+    if (kShedGround == false && 
+        gPDv->readDataVector (kBufs.cnToGndBuf) != E_SUCCESS)
     {
         return E_DATA_VECTOR_READ;
     }
 
-    // 3) Send data to respective nodes. Send to Ground last so that there is
-    //    additional time for Device Nodes to respond before end of comms 
-    //    deadline.
-    if (gPNm->send (NODE_DEVICE0, gCnToDn0Buf) != E_SUCCESS ||
-        gPNm->send (NODE_DEVICE1, gCnToDn1Buf) != E_SUCCESS ||
-        gPNm->send (NODE_DEVICE2, gCnToDn2Buf) != E_SUCCESS ||
-        gPNm->send (NODE_GROUND,  gCnToGndBuf) != E_SUCCESS)
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to send a set of comms buffers to the Device Nodes and Ground and to 
+ * receive their responses into the same set. Does not access the Data Vector
+ * other than through the Network Manager's message counters.
+ *
+ * @param  kBufs                      Buffers to send from and receive into.
+ * @param  kStartTimeNs               Start time of the communications step.
+ * @param  kSliceNs                   Time available to the communications 
+ *                                    step.
+ * @param  kReturnOnAllReceived       If true, stop receiving once every Device
+ *                                    Node has reported.
+ *
+ * @ret    E_SUCCESS                  Successfully exchanged data.
+ *         E_FAILED_TO_GET_TIME       Could not read time.
+ *         E_NETWORK_MANAGER_RX_FAIL  Failed to recv data from nodes.
+ *         E_NETWORK_MANAGER_TX_FAIL  Failed to send data to nodes.
+ */
+static Error_t exchangeData (CommsBuffers_t& kBufs, 
+                             Time::TimeNs_t kStartTimeNs,
+                             Time::TimeNs_t kSliceNs, 
+                             bool kReturnOnAllReceived)
+{
+    // 1) Send data to respective nodes. Device Node messages are all sent 
+    //    before any no-op messages so that the last Device Node is not delayed
+    //    by the others. Send to Ground last so that there is additional time 
+    //    for Device Nodes to respond before end of comms deadline. Skip Ground
+    //    if shed this frame.
+    if (gPNm->sendMult (gDeviceNodes, kBufs.cnToDnBufs) != E_SUCCESS ||
+        (kBufs.shedGround == false &&
+         gPNm->send (NODE_GROUND, kBufs.cnToGndBuf) != E_SUCCESS))
     {
         return E_NETWORK_MANAGER_TX_FAIL;
     }
 
-    // 4) Attempt to receive data from Ground. Only done once per loop so that 
-    //    sequential commands do not overwrite each other.
-    bool msgRecvd = false;
-    if (gPNm->recvNoBlock (NODE_GROUND, gGndToCnBuf, msgRecvd) != E_SUCCESS)
+    // 2) Attempt to receive data from Ground. Only done once per loop so that 
+    //    sequential commands do not overwrite each other. If Ground is shed, 
+    //    any command stays queued until the Ground link resumes.
+    kBufs.gndMsgReceived = false;
+    if (kBufs.shedGround == false &&
+        gPNm->recvNoBlock (NODE_GROUND, kBufs.gndToCnBuf, 
+                           kBufs.gndMsgReceived) != E_SUCCESS)
     {
         return E_NETWORK_MANAGER_RX_FAIL;
     }
-    if (msgRecvd == true)
-    {
-        if (gPDv->writeRegion (DV_REG_GROUND_TO_CN, gGndToCnBuf))
-        {
-            return E_DATA_VECTOR_WRITE;
-        }
-    }
 
-    // 5) Calculate remaining time in communications time slice to use as 
+    // 3) Calculate remaining time in communications time slice to use as 
     //    timeout for recvMult call. Minimum timeout is MIN_RECV_TIMEOUT_NS,
     //    even if this will cause a communications deadline miss.
     Time::TimeNs_t currTimeNs = 0;
@@ -348,11 +871,10 @@ static Error_t sendAndRecvDataVectorData ()
         return E_FAILED_TO_GET_TIME;
     }
 
-    // 5a) If we've already gone into the buffer or we are less than 
+    // 3a) If we've already gone into the buffer or we are less than 
     //     MIN_RECV_TIMEOUT_NS away from the buffer, set the timeout to be 
     //     MIN_RECV_TIMEOUT_NS.
-    Time::TimeNs_t deadlineTimeNs = startTimeNs + COMMUNICATIONS_TIME_SLICE_NS;
-    Time::TimeNs_t deadlineBufferTimeNs = deadlineTimeNs - 
+    Time::TimeNs_t deadlineBufferTimeNs = kStartTimeNs + kSliceNs - 
                                           COMMUNICATIONS_TIME_BUFFER_NS;
     Time::TimeNs_t recvMultTimeoutNs = 0;
     if (currTimeNs > deadlineBufferTimeNs ||
@@ -361,46 +883,54 @@ static Error_t sendAndRecvDataVectorData ()
         recvMultTimeoutNs = MIN_RECV_TIMEOUT_NS;
     }
 
-    // 5b) Otherwise, set the timeout to be the remaining time before we hit the
+    // 3b) Otherwise, set the timeout to be the remaining time before we hit the
     //     buffer time.
     else
     {
         recvMultTimeoutNs = deadlineBufferTimeNs - currTimeNs;
     }
 
-    // 6) Receive data from Device Nodes.
-    std::vector<uint32_t> numMsgsReceived (DEVICE_NODES.size (), 0);
-    if (gPNm->recvMult (recvMultTimeoutNs, DEVICE_NODES, gDnRecvBufs, 
-                        numMsgsReceived) != E_SUCCESS)
+    // 4) Receive data from Device Nodes.
+    if (gPNm->recvMult (recvMultTimeoutNs, gDeviceNodes, kBufs.dnRecvBufs, 
+                        kBufs.dnNumMsgsReceived, 
+                        kReturnOnAllReceived) != E_SUCCESS)
     {
         return E_NETWORK_MANAGER_RX_FAIL;
     }
 
-    // 7) Copy data from buffers to Data Vector or log a missed message.
-    for (uint8_t i = 0; i < DEVICE_NODES.size (); i++)
+    kBufs.exchanged = true;
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to copy data received into a set of comms buffers to the Data Vector
+ * or log missed messages.
+ *
+ * @param  kBufs                Buffers to copy data from.
+ *
+ * @ret    E_SUCCESS            Successfully copied data.
+ *         E_DATA_VECTOR_WRITE  Failed to write data to Data Vector.
+ */
+static Error_t writeRxData (CommsBuffers_t& kBufs)
+{
+    // 1) Copy Ground data to Data Vector if a message was received.
+    if (kBufs.gndMsgReceived == true)
     {
-        Error_t ret = E_SUCCESS;
-        switch (DEVICE_NODES[i])
+        if (gPDv->writeRegion (DV_REG_GROUND_TO_CN, kBufs.gndToCnBuf))
         {
-            case NODE_DEVICE0:
-                ret = numMsgsReceived[i] > 0
-                    ? gPDv->writeRegion (DV_REG_DN0_TO_CN, gDnRecvBufs[i])
-                    : gPDv->increment (DV_ELEM_DN0_RX_MISS_COUNT);
-                break;
-            case NODE_DEVICE1:
-                ret = numMsgsReceived[i] > 0
-                    ? gPDv->writeRegion (DV_REG_DN1_TO_CN, gDnRecvBufs[i])
-                    : gPDv->increment (DV_ELEM_DN1_RX_MISS_COUNT);
-                break;
-            case NODE_DEVICE2:
-                ret = numMsgsReceived[i] > 0
-                    ? gPDv->writeRegion (DV_REG_DN2_TO_CN, gDnRecvBufs[i])
-                    : gPDv->increment (DV_ELEM_DN2_RX_MISS_COUNT);
-                break;
-            default:
-                // This should never happen.
-                return E_DATA_VECTOR_WRITE;
+            return E_DATA_VECTOR_WRITE;
         }
+    }
+
+    // 2) Copy data from Device Node buffers to Data Vector or log a missed 
+    //    message.
+    std::vector<uint32_t>& numMsgsReceived = kBufs.dnNumMsgsReceived;
+    for (uint8_t i = 0; i < gDeviceNodeConfigs.size (); i++)
+    {
+        ControlNode::DeviceNodeConfig_t& dnConfig = gDeviceNodeConfigs[i];
+        Error_t ret = numMsgsReceived[i] > 0
+            ? gPDv->writeRegion (dnConfig.dnToCnRegion, kBufs.dnRecvBufs[i])
+            : gPDv->increment (dnConfig.rxMissCountElem);
 
         // Handle write error.
         if (ret != E_SUCCESS)
@@ -409,9 +939,61 @@ static Error_t sendAndRecvDataVectorData ()
         }
     }
 
-    // 8) If the communications did not complete before deadline, log an error. 
-    //    Otherwise, spin until deadline is reached to reduce jitter in when
-    //    State Machine and Controllers run.
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to send/recv Data Vector data to/from Device Nodes and Ground on the
+ * loop thread. Used in COMMS_MODE_EARLY_EXIT and COMMS_MODE_FIXED_SLICE.
+ *
+ * @param  kShedGround              If true, skip the Ground link this frame.
+ *
+ * @ret  E_SUCCESS                  Successfully received data.
+ *       E_FAILED_TO_GET_TIME       Could not read time.
+ *       E_DATA_VECTOR_READ         Failed to copy data from Data Vector.
+ *       E_DATA_VECTOR_WRITE        Failed to write data to Data Vector.
+ *       E_NETWORK_MANAGER_RX_FAIL  Failed to recv data from nodes.
+ *       E_NETWORK_MANAGER_TX_FAIL  Failed to send data to nodes.
+ */
+static Error_t sendAndRecvDataVectorData (bool kShedGround)
+{
+    // 1) Get start time. This is used for managing the communications so that 
+    //    they are completed within the time slice.
+    Time::TimeNs_t startTimeNs = 0;
+    if (gPTime->getTimeNs (startTimeNs) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+
+    // 2) Copy Data Vector data to buffers.
+    CommsBuffers_t& bufs = gCommsBufs[0];
+    Error_t ret = readTxData (bufs, kShedGround);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 3) Send and receive data. In early exit mode, stop receiving as soon as
+    //    every Device Node has reported.
+    ret = exchangeData (bufs, startTimeNs, COMMUNICATIONS_TIME_SLICE_NS, 
+                        gCommsMode == ControlNode::COMMS_MODE_EARLY_EXIT);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 4) Copy received data to the Data Vector or log missed messages.
+    ret = writeRxData (bufs);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 5) If the communications did not complete before deadline, log an error. 
+    //    Otherwise, in fixed slice mode, spin until deadline is reached to 
+    //    reduce jitter in when State Machine and Controllers run.
+    Time::TimeNs_t deadlineTimeNs = startTimeNs + COMMUNICATIONS_TIME_SLICE_NS;
+    Time::TimeNs_t currTimeNs = 0;
     if (gPTime->getTimeNs (currTimeNs) != E_SUCCESS)
     {
         return E_FAILED_TO_GET_TIME;
@@ -425,7 +1007,7 @@ static Error_t sendAndRecvDataVectorData ()
             return E_DATA_VECTOR_WRITE;
         }
     }
-    else
+    else if (gCommsMode == ControlNode::COMMS_MODE_FIXED_SLICE)
     {
         // Spin.
         while (currTimeNs < deadlineTimeNs)
@@ -440,6 +1022,361 @@ static Error_t sendAndRecvDataVectorData ()
     return E_SUCCESS;
 }
 
+/**
+ * Helper to send the Control Node to Device Node regions right after the 
+ * Controllers run, so that Device Nodes can apply the Controllers' outputs in 
+ * the same frame instead of waiting for the next loop's communications step.
+ *
+ * @ret  E_SUCCESS                  Successfully sent data.
+ *       E_DATA_VECTOR_READ         Failed to copy data from Data Vector.
+ *       E_DATA_VECTOR_WRITE        Failed to write message type.
+ *       E_NETWORK_MANAGER_TX_FAIL  Failed to send data to nodes.
+ */
+static Error_t sendActuationData ()
+{
+    // 1) Mark the messages as the actuation message. The frame counter is 
+    //    left at this frame's.
+    for (DataVectorElement_t elem : gActuationMsgElems)
+    {
+        if (gPDv->write (elem, true) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_WRITE;
+        }
+    }
+
+    // 2) Copy Data Vector data to buffers.
+    for (uint8_t i = 0; i < gDeviceNodeConfigs.size (); i++)
+    {
+        if (gPDv->readRegion (gDeviceNodeConfigs[i].cnToDnRegion, 
+                              gCnToDnActuationBufs[i]) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+    }
+
+    // 3) Send data to Device Nodes.
+    if (gPNm->sendMult (gDeviceNodes, gCnToDnActuationBufs) != E_SUCCESS)
+    {
+        return E_NETWORK_MANAGER_TX_FAIL;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper run by the loop thread at each frame boundary in 
+ * COMMS_MODE_DEDICATED_THREAD. If the comms thread finished the previous 
+ * frame, swaps the buffer sets, copies the data received last frame to the 
+ * Data Vector, and hands this frame's data to the comms thread. Otherwise, 
+ * logs a comms deadline miss and leaves the comms thread to finish.
+ *
+ * @param  kShedGround            If true, skip the Ground link this frame.
+ *
+ * @ret  E_SUCCESS                Frame handed off or deadline miss logged.
+ *       E_DATA_VECTOR_READ       Failed to copy data from Data Vector.
+ *       E_DATA_VECTOR_WRITE      Failed to write data to Data Vector.
+ *       E_FAILED_TO_LOCK         Failed to lock comms lock.
+ *       E_FAILED_TO_UNLOCK       Failed to unlock comms lock.
+ *       E_FAILED_TO_SIGNAL_COND  Failed to signal comms thread.
+ */
+static Error_t swapCommsBuffers (bool kShedGround)
+{
+    // 1) Check whether the comms thread is still exchanging last frame's data.
+    if (pthread_mutex_lock (&gCommsLock) != 0)
+    {
+        return E_FAILED_TO_LOCK;
+    }
+    bool framePending = gCommsFramePending;
+    uint8_t loopBufIdx = gCommsThreadBufIdx ^ 1;
+    if (pthread_mutex_unlock (&gCommsLock) != 0)
+    {
+        return E_FAILED_TO_UNLOCK;
+    }
+
+    // 2) If so, log a comms deadline miss. The Controllers run on the data 
+    //    already in the Data Vector.
+    if (framePending == true)
+    {
+        if (gPDv->increment (DV_ELEM_CN_COMMS_DEADLINE_MISS_COUNT) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_WRITE;
+        }
+        return E_SUCCESS;
+    }
+
+    // 3) Copy this frame's data to send into the loop thread's buffers. The 
+    //    comms thread is idle, so no other thread accesses the buffers.
+    Error_t ret = readTxData (gCommsBufs[loopBufIdx], kShedGround);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 4) Swap buffer sets and hand the frame to the comms thread.
+    if (pthread_mutex_lock (&gCommsLock) != 0)
+    {
+        return E_FAILED_TO_LOCK;
+    }
+    gCommsThreadBufIdx = loopBufIdx;
+    loopBufIdx ^= 1;
+    gCommsFramePending = true;
+    if (pthread_cond_signal (&gCommsCond) != 0)
+    {
+        pthread_mutex_unlock (&gCommsLock);
+        return E_FAILED_TO_SIGNAL_COND;
+    }
+    if (pthread_mutex_unlock (&gCommsLock) != 0)
+    {
+        return E_FAILED_TO_UNLOCK;
+    }
+
+    // 5) Copy data received by the comms thread last frame to the Data Vector.
+    //    Skip the first frame, before any data has been exchanged.
+    if (gCommsBufs[loopBufIdx].exchanged == true)
+    {
+        return writeRxData (gCommsBufs[loopBufIdx]);
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Comms thread function used in COMMS_MODE_DEDICATED_THREAD. Waits for the 
+ * loop thread to hand off a frame, then sends and receives that frame's data
+ * using the comms thread's set of buffers. The exchange has the full loop 
+ * period to complete.
+ *
+ * On success, function never returns.
+ *
+ * @param   _kArgs              Unused.
+ *
+ * @ret     E_FAILED_TO_LOCK          Failed to lock comms lock.
+ *          E_FAILED_TO_UNLOCK        Failed to unlock comms lock.
+ *          E_FAILED_TO_WAIT_ON_COND  Failed to wait on comms condition 
+ *                                    variable.
+ */
+static void* commsThreadFunc (void* _kArgs)
+{
+    while (true)
+    {
+        // 1) Wait for the loop thread to hand off a frame.
+        if (pthread_mutex_lock (&gCommsLock) != 0)
+        {
+            return (void*) E_FAILED_TO_LOCK;
+        }
+        while (gCommsFramePending == false)
+        {
+            if (pthread_cond_wait (&gCommsCond, &gCommsLock) != 0)
+            {
+                pthread_mutex_unlock (&gCommsLock);
+                return (void*) E_FAILED_TO_WAIT_ON_COND;
+            }
+        }
+        CommsBuffers_t& bufs = gCommsBufs[gCommsThreadBufIdx];
+        if (pthread_mutex_unlock (&gCommsLock) != 0)
+        {
+            return (void*) E_FAILED_TO_UNLOCK;
+        }
+
+        // 2) Send and receive data, returning as soon as all Device Nodes have
+        //    reported.
+        Time::TimeNs_t startTimeNs = 0;
+        Error_t ret = gPTime->getTimeNs (startTimeNs);
+        if (ret == E_SUCCESS)
+        {
+            ret = exchangeData (bufs, startTimeNs, 
+                                NetworkManager::LOOP_PERIOD_NS, true);
+        }
+        Errors::incrementOnError (ret, gPDv, DV_ELEM_CN_ERROR_COUNT);
+
+        // 3) Mark frame complete.
+        if (pthread_mutex_lock (&gCommsLock) != 0)
+        {
+            return (void*) E_FAILED_TO_LOCK;
+        }
+        gCommsFramePending = false;
+        if (pthread_mutex_unlock (&gCommsLock) != 0)
+        {
+            return (void*) E_FAILED_TO_UNLOCK;
+        }
+    }
+
+    return (void*) E_SUCCESS;
+}
+
+/**
+ * Helper to update the degraded state at the end of a degraded loop. The loop
+ * recovers after DEGRADE_RECOVERY_FRAMES consecutive loops finish within 
+ * DEGRADE_RECOVERY_LOOP_TIME_NS. A loop that does not restarts the count.
+ *
+ * @param  kLoopStartNs          Start time of the loop.
+ *
+ * @ret    E_SUCCESS             Degraded state updated.
+ *         E_FAILED_TO_GET_TIME  Could not read time.
+ *         E_DATA_VECTOR_WRITE   Failed to count degraded loop.
+ */
+static Error_t updateDegradedState (Time::TimeNs_t kLoopStartNs)
+{
+    // 1) Measure loop time.
+    Time::TimeNs_t currTimeNs = 0;
+    if (gPTime->getTimeNs (currTimeNs) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+
+    // 2) Count towards recovery or restart the count.
+    if (currTimeNs - kLoopStartNs <= DEGRADE_RECOVERY_LOOP_TIME_NS)
+    {
+        gDegradeFramesLeft--;
+    }
+    else
+    {
+        gDegradeFramesLeft = DEGRADE_RECOVERY_FRAMES;
+    }
+
+    // 3) Count degraded loop.
+    if (gCountDegradedLoops == true && 
+        gPDv->increment (DV_ELEM_CN_DEGRADED_LOOP_COUNT) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to check whether a Controller runs in this minor frame. If degraded,
+ * low priority Controllers are shed.
+ *
+ * @param   kCtrl      Controller index.
+ * @param   kDegraded  True if the loop is degraded.
+ *
+ * @ret     True if the Controller runs.
+ */
+static bool isCtrlScheduled (uint8_t kCtrl, bool kDegraded)
+{
+    return gPRge->isScheduled (kCtrl) == true &&
+           (kDegraded == false || gPCtrls[kCtrl]->isLowPriority () == false);
+}
+
+/**
+ * Helper to run a Controller on the loop thread, timing it with the Rate Group
+ * Executive and, if profiling is enabled, the Phase Profiler. Errors are
+ * logged.
+ *
+ * @param   kCtrl  Controller index.
+ */
+static void runCtrl (uint8_t kCtrl)
+{
+    startPhase (PHASE_CTRL0 + kCtrl);
+    Errors::incrementOnError (gPRge->startTask (kCtrl), gPDv, 
+                              DV_ELEM_CN_ERROR_COUNT);
+    Errors::incrementOnError (gPCtrls[kCtrl]->run (), gPDv, 
+                              DV_ELEM_CN_ERROR_COUNT);
+    Errors::incrementOnError (gPRge->endTask (kCtrl), gPDv, 
+                              DV_ELEM_CN_ERROR_COUNT);
+    endPhase (PHASE_CTRL0 + kCtrl);
+}
+
+/**
+ * Task Pool task function that runs a Controller and measures its execution
+ * time and, if profiling is enabled, its wall and CPU time.
+ *
+ * @param   kPArg  Pointer to CtrlTask_t.
+ *
+ * @ret     Return value of Controller's run.
+ */
+static Error_t runCtrlTask (void* kPArg)
+{
+    CtrlTask_t* pTask = static_cast<CtrlTask_t*> (kPArg);
+    Time::TimeNs_t startNs = 0;
+    Time::TimeNs_t endNs = 0;
+    Time::TimeNs_t wallStartNs = 0;
+    Time::TimeNs_t cpuStartNs = 0;
+    bool profile = gPPp != nullptr;
+
+    if (profile == true)
+    {
+        pTask->profileRet = PhaseProfiler::getTimes (wallStartNs, cpuStartNs);
+    }
+    pTask->timeRet = gPTime->getTimeNs (startNs);
+    Error_t ret = gPCtrls[pTask->ctrl]->run ();
+    if (pTask->timeRet == E_SUCCESS)
+    {
+        pTask->timeRet = gPTime->getTimeNs (endNs);
+    }
+    pTask->timeNs = pTask->timeRet == E_SUCCESS ? endNs - startNs : 0;
+    if (profile == true && pTask->profileRet == E_SUCCESS)
+    {
+        pTask->profileRet = PhaseProfiler::getTimes (pTask->wallNs, 
+                                                     pTask->cpuNs);
+        pTask->wallNs -= wallStartNs;
+        pTask->cpuNs  -= cpuStartNs;
+    }
+
+    return ret;
+}
+
+/**
+ * Helper to run the Controllers scheduled in this minor frame level by level.
+ * The scheduled Controllers in a level run in parallel, and their errors and 
+ * times are then recorded in Controller order. See ControlNode.hpp note #11.
+ *
+ * @param   kDegraded  True if the loop is degraded.
+ */
+static void runCtrlLevels (bool kDegraded)
+{
+    for (const std::vector<uint32_t>& level : gPGraph->getLevels ())
+    {
+        // 1) Collect the level's scheduled Controllers.
+        gBatch.clear ();
+        for (uint32_t ctrl : level)
+        {
+            if (isCtrlScheduled (ctrl, kDegraded) == true)
+            {
+                gCtrlTasks[ctrl] = {static_cast<uint8_t> (ctrl), 0, 
+                                    E_SUCCESS, 0, 0, E_SUCCESS};
+                gBatch.push_back ({runCtrlTask, &gCtrlTasks[ctrl], 
+                                   E_SUCCESS});
+            }
+        }
+
+        // 2) Run a lone Controller on the loop thread.
+        if (gBatch.size () <= 1)
+        {
+            if (gBatch.empty () == false)
+            {
+                runCtrl (static_cast<CtrlTask_t*> (gBatch[0].pArg)->ctrl);
+            }
+            continue;
+        }
+
+        // 3) Run the level in parallel, then record results in order.
+        Errors::incrementOnError (gPPool->run (gBatch), gPDv, 
+                                  DV_ELEM_CN_ERROR_COUNT);
+        for (TaskPool::Task_t& task : gBatch)
+        {
+            CtrlTask_t& ctrlTask = *static_cast<CtrlTask_t*> (task.pArg);
+            Errors::incrementOnError (task.ret, gPDv, DV_ELEM_CN_ERROR_COUNT);
+            Errors::incrementOnError (ctrlTask.timeRet, gPDv, 
+                                      DV_ELEM_CN_ERROR_COUNT);
+            Errors::incrementOnError (gPRge->addTaskTime (ctrlTask.ctrl, 
+                                                          ctrlTask.timeNs), 
+                                      gPDv, DV_ELEM_CN_ERROR_COUNT);
+            if (gPPp != nullptr)
+            {
+                Errors::incrementOnError (ctrlTask.profileRet, gPDv, 
+                                          DV_ELEM_CN_ERROR_COUNT);
+                Errors::incrementOnError (
+                                gPPp->addSample (PHASE_CTRL0 + ctrlTask.ctrl,
+                                                 (uint32_t) ctrlTask.wallNs,
+                                                 (uint32_t) ctrlTask.cpuNs),
+                                gPDv, DV_ELEM_CN_ERROR_COUNT);
+            }
+        }
+    }
+}
+
 /**
  * Control Node logic that runs in a periodic loop. Runs logic in the
  * following order:
@@ -448,22 +1385,47 @@ static Error_t sendAndRecvDataVectorData ()
  *   2) Receive Data Vector regions from all other nodes on the network.
  *   3) Run Command Handler to process commands from ground computer.
  *   4) Step State Machine.
- *   5) Run each Controller.
- *
- * On success, function never returns.
+ *   5) Run each Controller, or each level of Controllers in parallel.
+ *   6) If same-frame actuation is enabled, send Data Vector regions to the 
+ *      Device Nodes again.
+ *   7) If enabled, count page faults taken since the first loop.
  *
- * @param   _kArgs     Unused.
+ * If the loop is degraded, the Ground link and low priority Controllers are 
+ * skipped. See ControlNode.hpp note #10.
  *
  * @ret     E_SUCCESS  Loop executed successfully. Errors may have been logged.
  *                     If Errors::incrementOnError fails, fails silently.
  */
-static void* loop (void* _kArgs)
+static Error_t loop ()
 {
+    startPhase (PHASE_LOOP);
+
+    // 0) Check whether this loop is degraded and if so record its start time.
+    bool degraded = gDegradeFramesLeft > 0;
+    Time::TimeNs_t loopStartNs = 0;
+    if (degraded == true)
+    {
+        Errors::incrementOnError (gPTime->getTimeNs (loopStartNs), gPDv,
+                                  DV_ELEM_CN_ERROR_COUNT);
+    }
+
     // 1) Send and receive Data Vector Regions with Device Nodes and Ground.
     //    This step doubles as a loop synchronizer, as all Device Nodes begin 
-    //    their loop on receiving a message from the Control Node.
-    Errors::incrementOnError (sendAndRecvDataVectorData (), gPDv,
-                              DV_ELEM_CN_ERROR_COUNT);
+    //    their loop on receiving a message from the Control Node. In dedicated
+    //    thread mode, the exchange is handed to the comms thread and the data
+    //    it received last frame is copied to the Data Vector.
+    startPhase (PHASE_COMMS);
+    if (gCommsMode == ControlNode::COMMS_MODE_DEDICATED_THREAD)
+    {
+        Errors::incrementOnError (swapCommsBuffers (degraded), gPDv, 
+                                  DV_ELEM_CN_ERROR_COUNT);
+    }
+    else
+    {
+        Errors::incrementOnError (sendAndRecvDataVectorData (degraded), gPDv,
+                                  DV_ELEM_CN_ERROR_COUNT);
+    }
+    endPhase (PHASE_COMMS);
 
     // 3) Get the current time and store it in the Data Vector.
     Time::TimeNs_t currTimeNs;
@@ -476,23 +1438,79 @@ static void* loop (void* _kArgs)
     // 4) Run Command Handler. This will process a command from ground if one
     //    was received. This must run before the State Machine, as some state
     //    transitions are dependent on a ground command.
+    startPhase (PHASE_CMD_HANDLER);
     Errors::incrementOnError (gPCh->run (), gPDv, DV_ELEM_CN_ERROR_COUNT);
+    endPhase (PHASE_CMD_HANDLER);
     
     // 5) Step the State Machine.
+    startPhase (PHASE_STATE_MACHINE);
     Errors::incrementOnError (gPSm->step (currTimeNs), gPDv, 
                               DV_ELEM_CN_ERROR_COUNT);
+    endPhase (PHASE_STATE_MACHINE);
     
-    // 6) Run the Controllers.
-    for (std::unique_ptr<Controller>& pCtrl : gPCtrls)
+    // 6) Run the Controllers scheduled in this minor frame. If degraded, shed
+    //    low priority Controllers. If parallel Controllers are enabled, run
+    //    them level by level.
+    startPhase (PHASE_CTRLS);
+    gPRge->startFrame ();
+    if (gPGraph != nullptr)
     {
-        Errors::incrementOnError (pCtrl->run (), gPDv, DV_ELEM_CN_ERROR_COUNT);
+        runCtrlLevels (degraded);
     }
+    else
+    {
+        for (uint8_t i = 0; i < gPCtrls.size (); i++)
+        {
+            if (isCtrlScheduled (i, degraded) == true)
+            {
+                runCtrl (i);
+            }
+        }
+    }
+    endPhase (PHASE_CTRLS);
 
-    // 7) Increment loop counter.
+    // 7) If same-frame actuation is enabled, send the Controllers' outputs to 
+    //    the Device Nodes now rather than in the next loop.
+    if (gSameFrameActuation == true)
+    {
+        startPhase (PHASE_ACTUATION);
+        Errors::incrementOnError (sendActuationData (), gPDv, 
+                                  DV_ELEM_CN_ERROR_COUNT);
+        endPhase (PHASE_ACTUATION);
+    }
+
+    // 8) Increment loop counter.
     Errors::incrementOnError (gPDv->increment (DV_ELEM_CN_LOOP_COUNT), gPDv,
                               DV_ELEM_CN_ERROR_COUNT);
 
-    return (void *) E_SUCCESS;
+    // 9) Periodically mirror the loop thread's timing stats to the Data 
+    //    Vector.
+    if (gWriteLoopThreadStats == true && 
+        ++gLoopsSinceStatsWrite == LOOP_THREAD_STATS_WRITE_PERIOD)
+    {
+        gLoopsSinceStatsWrite = 0;
+        Errors::incrementOnError (gPTm->writePeriodicThreadStats (
+                                                pthread_self (), gPDv, 
+                                                LOOP_THREAD_STATS_CONFIG), 
+                                  gPDv, DV_ELEM_CN_ERROR_COUNT);
+    }
+
+    // 10) Count page faults taken since the first loop.
+    if (gCountPageFaults == true)
+    {
+        Errors::incrementOnError (countPageFaults (), gPDv, 
+                                  DV_ELEM_CN_ERROR_COUNT);
+    }
+
+    // 11) If degraded, check whether the loop time has recovered.
+    if (degraded == true)
+    {
+        Errors::incrementOnError (updateDegradedState (loopStartNs), gPDv,
+                                  DV_ELEM_CN_ERROR_COUNT);
+    }
+
+    endPhase (PHASE_LOOP);
+    return E_SUCCESS;
 }
 
 /***************************** PUBLIC FUNCIONS ********************************/
@@ -501,62 +1519,118 @@ void ControlNode::entry (NetworkManager::Config_t kNmConfig,
                          DataVector::Config_t     kDvConfig,
                          CommandHandler::Config_t kChConfig,
                          StateMachine::Config_t   kSmConfig,
-                         fInitializeControllers_t kFInitControllers)
+                         fInitializeControllers_t kFInitControllers,
+                         Options_t                kOptions)
 {
-    // 0) Verify Network Manager config matches required topology.
+    // 0) Verify and store Device Node configs.
+    Errors::exitOnError (verifyDeviceNodeConfig (kOptions.deviceNodes), 
+                         "Invalid Device Node config.");
+    gDeviceNodeConfigs = kOptions.deviceNodes;
+    gDeviceNodes.clear ();
+    for (DeviceNodeConfig_t& dnConfig : gDeviceNodeConfigs)
+    {
+        gDeviceNodes.push_back (dnConfig.node);
+    }
+
+    // 1) Verify Network Manager config matches required topology.
     Errors::exitOnError (
-                verifyNmConfig (kNmConfig), 
+                verifyNmConfig (kNmConfig, gDeviceNodeConfigs), 
                 "Network Manager config does not match required topology.");
 
-    // 1) Verify Data Vector config contains required elements.
+    // 2) Verify Data Vector config contains required elements.
     Errors::exitOnError (
-        verifyDvConfig (kDvConfig),
+        verifyDvConfig (kDvConfig, gDeviceNodeConfigs),
         "Data Vector config does not contain required regions or elements.");
 
-    // 2) Init Thread Manager. Do this first so that the kernel scheduling 
+    // 3) Verify and store communications options and the overrun policy.
+    if (kOptions.commsMode >= COMMS_MODE_LAST)
+    {
+        Errors::exitOnError (E_INVALID_ENUM, "Invalid communications mode.");
+    }
+    if (kOptions.overrunPolicy >= OVERRUN_POLICY_LAST)
+    {
+        Errors::exitOnError (E_INVALID_ENUM, "Invalid overrun policy.");
+    }
+    gCommsMode = kOptions.commsMode;
+    gSameFrameActuation = kOptions.sameFrameActuation;
+    gOverrunPolicy = kOptions.overrunPolicy;
+
+    // 4) Init Thread Manager. Do this first so that the kernel scheduling 
     //    environment is set up immediately.
     ThreadManager* pTm = nullptr;
     Errors::exitOnError (ThreadManager::getInstance (pTm),
                          "Thread Manager failed to initialize.");
+    gPTm = pTm;
 
-    // 3) Init Data Vector. This is required for Network Manager, Command 
+    // 5) Init Data Vector. This is required for Network Manager, Command 
     //    Handler, Controller, and State Machine initialization.
     Errors::exitOnError (DataVector::createNew (kDvConfig, gPDv),
                          "Data Vector failed to initialize.");
 
-    // 4) Init buffers that will be used in loop to send and receive data over
-    //    the network.
+    // 6) Init buffers that will be used in loop to send and receive data over
+    //    the network. Stamp Device Node messages with a frame counter and 
+    //    message type if the Data Vector contains the Device Node's elements.
     Errors::exitOnError (initializeBuffers (), "Failed to initialize buffers.");
+    gFrameElems.clear ();
+    gActuationMsgElems.clear ();
+    for (DeviceNodeConfig_t& dnConfig : gDeviceNodeConfigs)
+    {
+        const MsgElems_t& msgElems = NODE_TO_MSG_ELEMS.at (dnConfig.node);
+        if (gPDv->elementExists (msgElems.frameElem) == E_SUCCESS)
+        {
+            gFrameElems.push_back (msgElems.frameElem);
+        }
+        if (gPDv->elementExists (msgElems.actuationMsgElem) == E_SUCCESS)
+        {
+            gActuationMsgElems.push_back (msgElems.actuationMsgElem);
+        }
+    }
 
-    // 5) Init Network Manager. This is required for clock synchronization.
+    // 7) Init Network Manager. This is required for clock synchronization.
     Errors::exitOnError (NetworkManager::createNew (kNmConfig, gPDv, gPNm), 
                          "Network Manager failed to initialize.");
 
-    // 6) Synchronize the flight computer clocks. Clients are all device nodes 
+    // 8) Synchronize the flight computer clocks. Clients are all device nodes 
     //    in the network. This must be done before the Time Module is 
     //    initialized.
-    std::vector<Node_t> clockSyncClients =
-    {
-        NODE_DEVICE0,
-        NODE_DEVICE1,
-        NODE_DEVICE2,
-    };
-    Errors::exitOnError (ClockSync::syncServer (gPNm, clockSyncClients),
+    Errors::exitOnError (ClockSync::syncServer (gPNm, gDeviceNodes),
                          "Clock synchronization failed.");
 
-    // 7) Init Command Handler.
+    // 9) Init Command Handler.
     Errors::exitOnError (CommandHandler::createNew (kChConfig, gPDv, gPCh),
                          "Command Handler failed to initialize.");
 
-    // 8) Init Controllers.
+    // 10) Init Controllers and the Rate Group Executive that schedules them. 
+    //     If parallel Controllers are enabled, build the Controller Graph and
+    //     start the Task Pool.
     Errors::exitOnError (kFInitControllers (gPDv, gPCtrls),
                          "Controllers failed to initialize.");
-
-    // 9) Init Time Module. This is required for State Machine initialization.
+    Errors::exitOnError (initializeRateGroupExecutive (),
+                         "Rate Group Executive failed to initialize.");
+    if (kOptions.parallelCtrls == true)
+    {
+        Errors::exitOnError (initializeParallelCtrls (kOptions.ctrlPoolConfig),
+                             "Parallel Controllers failed to initialize.");
+    }
+    gWriteOverrunRateGroup = gPDv->elementExists (
+                                DV_ELEM_CN_OVERRUN_RATE_DIVISOR) == E_SUCCESS;
+    gCountDegradedLoops = gPDv->elementExists (
+                                DV_ELEM_CN_DEGRADED_LOOP_COUNT) == E_SUCCESS;
+
+    // 11) Init Phase Profiler if the Data Vector contains the loop phase 
+    //     timing elements. This must be done after the Controllers are 
+    //     initialized. Similarly, enable mirroring of the loop thread's timing
+    //     stats if the Data Vector contains the loop thread stats elements.
+    Errors::exitOnError (initializePhaseProfiler (), 
+                         "Phase Profiler failed to initialize.");
+    gWriteLoopThreadStats = gPDv->elementExists (
+              LOOP_THREAD_STATS_CONFIG.releaseJitterMaxNs) == E_SUCCESS;
+
+    // 12) Init Time Module. This is required for State Machine initialization.
     Errors::exitOnError (Time::getInstance (gPTime), 
                          "Time Module failed to initialize.");
 
-    // 10) Get current time and write it to the Data Vector.
+    // 13) Get current time and write it to the Data Vector.
     Time::TimeNs_t currTimeNs = 0;
     Errors::exitOnError (gPTime->getTimeNs (currTimeNs), 
                          "Failed to read current time.");
@@ -564,33 +1638,69 @@ void ControlNode::entry (NetworkManager::Config_t kNmConfig,
                                       (uint64_t) currTimeNs),
                          "Failed to write current time to Data Vector");
 
-    // 11) Initialize the State Machine. Do this last so that the periodic loop 
+    // 14) Initialize the State Machine. Do this last so that the periodic loop 
     //     begins right after the State Machine is initialized, which starts 
     //     counting time in state.
     Errors::exitOnError (StateMachine::createNew (kSmConfig, gPDv, currTimeNs, 
                                                   DV_ELEM_STATE, gPSm),
                          "State Machine failed to initialize.");
+
+    // 15) Lock all memory in RAM and prefault it so that the loop does not 
+    //     take page faults. Done after all buffers are allocated. The Data 
+    //     Vector is prefaulted first so that huge page advice, if enabled, is
+    //     given before its pages are locked. Count page faults in the loop if
+    //     the Data Vector contains the page fault elements.
+    Errors::exitOnError (gPDv->prefault (kOptions.hugePageDv), 
+                         "Failed to prefault Data Vector.");
+    Errors::exitOnError (MemoryManager::lockAll (
+                                        MemoryManager::STACK_PREFAULT_BYTES,
+                                        MemoryManager::HEAP_RESERVE_BYTES),
+                         "Failed to lock memory.");
+    gCountPageFaults = gPDv->elementExists (
+                            DV_ELEM_CN_MINOR_PAGE_FAULT_COUNT) == E_SUCCESS;
             
-    // 12) Create periodic thread to run loop function.
+    // 16) In dedicated thread mode, create the comms thread. It runs on CPU 0
+    //     alongside the kernel's Ethernet thread, leaving CPU 1 to the loop.
+    if (gCommsMode == COMMS_MODE_DEDICATED_THREAD)
+    {
+        pthread_t commsThread;
+        ThreadManager::ThreadFunc_t fComms = 
+            (ThreadManager::ThreadFunc_t) commsThreadFunc;
+        Errors::exitOnError (pTm->createThread (
+                                      commsThread, fComms, nullptr, 0,
+                                      ThreadManager::MIN_NEW_THREAD_PRIORITY,
+                                      ThreadManager::Affinity_t::CORE_0),
+                             "Failed to start comms thread.");
+    }
+
+    // 17) Create periodic thread to run loop function. The loop is passed as
+    //     a task so that it is called directly by the periodic loop. Only the
+    //     catch up policy changes the Thread Manager's overrun behavior. The 
+    //     degrade policy is handled by the loop.
     pthread_t loopThread;
-    ThreadManager::ThreadFunc_t fLoop = (ThreadManager::ThreadFunc_t) loop;
+    auto fLoop = [] () { return loop (); };
     ThreadManager::ErrorHandler_t fError = 
         (ThreadManager::ErrorHandler_t) &periodicErrorHandler;
-    Errors::exitOnError (pTm->createPeriodicThread (
-                                      loopThread, fLoop, nullptr, 0,
+    ThreadManager::OverrunPolicy_t tmOverrunPolicy = 
+        gOverrunPolicy == OVERRUN_POLICY_CATCH_UP 
+            ? ThreadManager::OVERRUN_POLICY_CATCH_UP
+            : ThreadManager::OVERRUN_POLICY_SKIP;
+    Errors::exitOnError (pTm->createPeriodicTask (
+                                      loopThread, fLoop,
                                       ThreadManager::MIN_NEW_THREAD_PRIORITY,
                                       ThreadManager::Affinity_t::CORE_1,
-                                      LOOP_PERIOD_MS, fError),
+                                      NetworkManager::LOOP_PERIOD_NS, 
+                                      fError, tmOverrunPolicy),
                          "Failed to start periodic thread.");
 
-    // 13) Wait for thread and check return status. On success, this will cause
+    // 18) Wait for thread and check return status. On success, this will cause
     //     the main thread to block and should never return.
     Error_t loopThreadRet = E_SUCCESS;
     Errors::exitOnError (pTm->waitForThread (loopThread, loopThreadRet),
                          "Failed to wait on loop thread.");
     Errors::exitOnError (loopThreadRet, "Loop thread returned error.");
 
-    // 14) If the function gets this far, the loop thread return an unexpected
+    // 19) If the function gets this far, the loop thread return an unexpected
     //     success status. Exit the process.
     exit (EXIT_FAILURE);
 }
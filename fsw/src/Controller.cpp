@@ -6,22 +6,40 @@ Controller::~Controller () {}
 
 Error_t Controller::run ()
 {
-    Mode_t mode = MODE_SAFED;
-    Error_t ret = this->getMode (mode);
+    // 1) If no element is bound, read the mode and run.
+    if (mInputBindings.empty () == true)
+    {
+        Mode_t mode = MODE_SAFED;
+        Error_t ret = this->getMode (mode);
+        if (ret != E_SUCCESS)
+        {
+            return ret;
+        }
+
+        return runMode (mode);
+    }
+
+    // 2) Otherwise, read the mode and inputs in one locked pass.
+    if (mPDataVector->readBindings (mInputBindings) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_READ;
+    }
+
+    // 3) Run.
+    Error_t ret = runMode (static_cast<Mode_t> (mMode));
     if (ret != E_SUCCESS)
     {
         return ret;
     }
 
-    switch (mode)
+    // 4) Write the outputs in one locked pass.
+    if (mOutputBindings.empty () == false &&
+        mPDataVector->writeBindings (mOutputBindings) != E_SUCCESS)
     {
-        case MODE_SAFED:
-            return runSafed();
-        case MODE_ENABLED:
-            return runEnabled();
-        default:
-            return E_INVALID_ENUM;
+        return E_DATA_VECTOR_WRITE;
     }
+
+    return E_SUCCESS;
 }
 
 Error_t Controller::getMode (Mode_t& kModeRet)
@@ -37,9 +55,127 @@ Error_t Controller::getMode (Mode_t& kModeRet)
     return E_SUCCESS;
 }
 
+void Controller::setRate (RateGroupExecutive::Rate_t kRate)
+{
+    mRate = kRate;
+}
+
+RateGroupExecutive::Rate_t Controller::getRate ()
+{
+    return mRate;
+}
+
+void Controller::setIndependent (bool kIndependent)
+{
+    mIndependent = kIndependent;
+}
+
+bool Controller::isIndependent ()
+{
+    return mIndependent;
+}
+
+void Controller::setLowPriority (bool kLowPriority)
+{
+    mLowPriority = kLowPriority;
+}
+
+bool Controller::isLowPriority ()
+{
+    return mLowPriority;
+}
+
+void Controller::setFastLoop (bool kFastLoop)
+{
+    mFastLoop = kFastLoop;
+}
+
+bool Controller::isFastLoop ()
+{
+    return mFastLoop;
+}
+
+bool Controller::isIoDeclared ()
+{
+    return mIoDeclared;
+}
+
+const std::vector<DataVectorElement_t>& Controller::getInputs ()
+{
+    return mInputs;
+}
+
+const std::vector<DataVectorElement_t>& Controller::getOutputs ()
+{
+    return mOutputs;
+}
+
 /*************************** PROTECTED FUNCTIONS ******************************/
 
 Controller::Controller (std::shared_ptr<DataVector> kPDataVector, 
                         DataVectorElement_t kDvModeElem) :
     mPDataVector (kPDataVector),
-    mDvModeElem  (kDvModeElem) {}
+    mDvModeElem  (kDvModeElem),
+    mRate        (RateGroupExecutive::RATE_EVERY_FRAME),
+    mIndependent (false),
+    mLowPriority (false),
+    mFastLoop    (false),
+    mIoDeclared  (false),
+    mMode        (MODE_SAFED) {}
+
+/**************************** PRIVATE FUNCTIONS *******************************/
+
+Error_t Controller::bindIo ()
+{
+    return E_SUCCESS;
+}
+
+Error_t Controller::initBindings ()
+{
+    // 1) Bind the controller's elements.
+    Error_t ret = bindIo ();
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+    if (mInputBindings.empty () == true && mOutputBindings.empty () == true)
+    {
+        return E_SUCCESS;
+    }
+
+    // 2) Bind the mode element so that it is read with the inputs.
+    ret = bindInput (mDvModeElem, mMode);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 3) Declare the bound elements if not declared in createNew.
+    if (mIoDeclared == false)
+    {
+        mIoDeclared = true;
+        for (DataVector::ElementBinding_t& binding : mInputBindings)
+        {
+            mInputs.push_back (binding.elem);
+        }
+        for (DataVector::ElementBinding_t& binding : mOutputBindings)
+        {
+            mOutputs.push_back (binding.elem);
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t Controller::runMode (Mode_t kMode)
+{
+    switch (kMode)
+    {
+        case MODE_SAFED:
+            return runSafed();
+        case MODE_ENABLED:
+            return runEnabled();
+        default:
+            return E_INVALID_ENUM;
+    }
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+
+#include "ControllerGraph.hpp"
+
+/*************************** PUBLIC FUNCTIONS *********************************/
+
+Error_t ControllerGraph::createNew (
+                        const std::vector<std::unique_ptr<Controller>>& kPCtrls,
+                        std::unique_ptr<ControllerGraph>& kPGraphRet)
+{
+    // 1) Verify Controllers.
+    for (const std::unique_ptr<Controller>& pCtrl : kPCtrls)
+    {
+        if (pCtrl == nullptr)
+        {
+            return E_CONTROLLER_NULL;
+        }
+    }
+
+    // 2) Assign each Controller the level after the last level of the 
+    //    Controllers it depends on. Dependencies only point to lower indices,
+    //    so a single pass in index order suffices.
+    std::vector<uint32_t> ctrlLevels (kPCtrls.size (), 0);
+    for (uint32_t i = 0; i < kPCtrls.size (); i++)
+    {
+        Controller& ctrl = *kPCtrls[i];
+        for (uint32_t j = 0; j < i; j++)
+        {
+            Controller& prev = *kPCtrls[j];
+            bool dependent = ctrl.isIoDeclared () == false ||
+                             prev.isIoDeclared () == false;
+            if (dependent == false)
+            {
+                if (intersect (ctrl.getOutputs (), prev.getOutputs ()) == true)
+                {
+                    return E_WRITE_CONFLICT;
+                }
+                dependent = 
+                    intersect (ctrl.getInputs (), prev.getOutputs ()) == true ||
+                    intersect (ctrl.getOutputs (), prev.getInputs ()) == true;
+            }
+            if (dependent == true)
+            {
+                ctrlLevels[i] = std::max (ctrlLevels[i], ctrlLevels[j] + 1);
+            }
+        }
+    }
+
+    // 3) Group Controllers by level in index order.
+    Levels_t levels;
+    for (uint32_t i = 0; i < kPCtrls.size (); i++)
+    {
+        if (ctrlLevels[i] >= levels.size ())
+        {
+            levels.resize (ctrlLevels[i] + 1);
+        }
+        levels[ctrlLevels[i]].push_back (i);
+    }
+
+    // 4) Create Controller Graph.
+    kPGraphRet.reset (new ControllerGraph (levels));
+
+    return E_SUCCESS;
+}
+
+const ControllerGraph::Levels_t& ControllerGraph::getLevels () const
+{
+    return mLevels;
+}
+
+/**************************** PRIVATE FUNCTIONS *******************************/
+
+ControllerGraph::ControllerGraph (const Levels_t& kLevels) :
+    mLevels (kLevels) {}
+
+bool ControllerGraph::intersect (
+                            const std::vector<DataVectorElement_t>& kElemsA,
+                            const std::vector<DataVectorElement_t>& kElemsB)
+{
+    for (DataVectorElement_t elem : kElemsA)
+    {
+        if (std::find (kElemsB.begin (), kElemsB.end (), elem) != kElemsB.end ())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -4,6 +4,7 @@
 #include <limits>
 
 #include "NetworkManager.hpp"
+#include "MemoryManager.hpp"
 #include "DataVector.hpp"
 
 /*************************** PUBLIC FUNCTIONS *********************************/
@@ -308,8 +309,7 @@ Error_t DataVector::readRegion (DataVectorRegion_t kRegion,
     }
 
     // Copy buffer.
-    std::vector<uint8_t>::iterator startIter = mBuffer.begin () + 
-                                                   pRegionInfo->startIdx;
+    Buffer_t::iterator startIter = mBuffer.begin () + pRegionInfo->startIdx;
     std::copy_n (startIter, pRegionInfo->sizeBytes, kRegionBufRet.begin ());
 
     // Release lock. 
@@ -342,14 +342,55 @@ Error_t DataVector::writeRegion (DataVectorRegion_t kRegion,
     }
 
     // Copy buffer.
-    std::vector<uint8_t>::iterator startIter = mBuffer.begin () + 
-                                                   pRegionInfo->startIdx;
+    Buffer_t::iterator startIter = mBuffer.begin () + pRegionInfo->startIdx;
     std::copy_n (kRegionBuf.begin (), pRegionInfo->sizeBytes, startIter);
 
     // Release lock. 
     return this->releaseLock ();
 }
 
+Error_t DataVector::readBindings (
+                                const std::vector<ElementBinding_t>& kBindings)
+{
+    // Acquire lock.
+    Error_t ret = this->acquireLock (); 
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // Copy each element to its variable.
+    for (const ElementBinding_t& binding : kBindings)
+    {
+        std::memcpy (binding.pValue, &mBuffer[binding.startIdx], 
+                     binding.sizeBytes);
+    }
+
+    // Release lock. 
+    return this->releaseLock ();
+}
+
+Error_t DataVector::writeBindings (
+                                const std::vector<ElementBinding_t>& kBindings)
+{
+    // Acquire lock.
+    Error_t ret = this->acquireLock (); 
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // Copy each variable to its element.
+    for (const ElementBinding_t& binding : kBindings)
+    {
+        std::memcpy (&mBuffer[binding.startIdx], binding.pValue, 
+                     binding.sizeBytes);
+    }
+
+    // Release lock. 
+    return this->releaseLock ();
+}
+
 Error_t DataVector::readDataVector (std::vector<uint8_t>& kDataVectorBufRet)
 {
     Error_t ret = E_SUCCESS;
@@ -368,7 +409,7 @@ Error_t DataVector::readDataVector (std::vector<uint8_t>& kDataVectorBufRet)
     }
 
     // Copy buffer.
-    kDataVectorBufRet = mBuffer;
+    kDataVectorBufRet.assign (mBuffer.begin (), mBuffer.end ());
 
     // Release lock. 
     return this->releaseLock ();
@@ -393,13 +434,60 @@ Error_t DataVector::writeDataVector (std::vector<uint8_t>& kDvBuf)
     }
 
     // Copy buffer.
-    std::vector<uint8_t>::iterator startIter = mBuffer.begin ();
+    Buffer_t::iterator startIter = mBuffer.begin ();
     std::copy_n (kDvBuf.begin (), mBuffer.size (), startIter);
 
     // Release lock. 
     return this->releaseLock ();
 }
 
+Error_t DataVector::prefault (bool kUseHugePages)
+{
+    // Acquire lock.
+    Error_t ret = this->acquireLock (); 
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // If huge pages are requested, move the buffer to a new, huge page 
+    // aligned buffer. mBuffer was written when it was built, so advice on it 
+    // would have no effect. Prefault the new buffer with advice before 
+    // copying the data into it, and cover every huge page it spans so that 
+    // each is faulted in as a huge page. On failure, release lock and return
+    // the prefault error.
+    if (kUseHugePages == true && mBuffer.empty () == false &&
+        mBuffer.get_allocator ().isHugePageAligned () == false)
+    {
+        Buffer_t hugePageBuffer (MemoryManager::HugePageAllocator<uint8_t> (
+                                                                      true));
+        hugePageBuffer.reserve (mBuffer.size ());
+        ret = MemoryManager::prefault (
+                    hugePageBuffer.data (), 
+                    MemoryManager::toHugePageBytes (hugePageBuffer.capacity ()),
+                    true);
+        if (ret != E_SUCCESS)
+        {
+            this->releaseLock ();
+            return ret;
+        }
+        hugePageBuffer.assign (mBuffer.begin (), mBuffer.end ());
+        mBuffer = std::move (hugePageBuffer);
+    }
+
+    // Prefault buffer. On failure, release lock and return the prefault 
+    // error.
+    ret = MemoryManager::prefault (mBuffer.data (), mBuffer.size (), false);
+    if (ret != E_SUCCESS)
+    {
+        this->releaseLock ();
+        return ret;
+    }
+
+    // Release lock. 
+    return this->releaseLock ();
+}
+
 Error_t DataVector::acquireLock ()
 {
     if (pthread_mutex_lock (&mLock) != 0)
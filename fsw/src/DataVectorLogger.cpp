@@ -6,6 +6,19 @@
 
 const uint32_t DataVectorLogger::WATCH_ELEM_VALUE_START_POS = 33;
 
+/**
+ * Map the 6 Phase Profiler elements of a prefix to their names.
+ *
+ * @param  kPrefix  Element prefix, e.g. DV_ELEM_CN_COMMS.
+ */
+#define DV_PHASE_PROFILER_ELEM_STRS(kPrefix)                                   \
+    {kPrefix##_WALL_MIN_NS, #kPrefix "_WALL_MIN_NS"},                          \
+    {kPrefix##_WALL_MAX_NS, #kPrefix "_WALL_MAX_NS"},                          \
+    {kPrefix##_WALL_P99_NS, #kPrefix "_WALL_P99_NS"},                          \
+    {kPrefix##_CPU_MIN_NS,  #kPrefix "_CPU_MIN_NS" },                          \
+    {kPrefix##_CPU_MAX_NS,  #kPrefix "_CPU_MAX_NS" },                          \
+    {kPrefix##_CPU_P99_NS,  #kPrefix "_CPU_P99_NS" },
+
 const std::unordered_map<DataVectorRegion_t, 
                          std::string, 
                          EnumClassHash> DataVectorLogger::mRegionToStr =
@@ -16,10 +29,20 @@ const std::unordered_map<DataVectorRegion_t,
     {DV_REG_DN0_TO_CN,    "DV_REG_DN0_TO_CN"   },
     {DV_REG_DN1_TO_CN,    "DV_REG_DN1_TO_CN"   },
     {DV_REG_DN2_TO_CN,    "DV_REG_DN2_TO_CN"   },
+    {DV_REG_DN3_TO_CN,    "DV_REG_DN3_TO_CN"   },
+    {DV_REG_DN4_TO_CN,    "DV_REG_DN4_TO_CN"   },
+    {DV_REG_DN5_TO_CN,    "DV_REG_DN5_TO_CN"   },
+    {DV_REG_DN6_TO_CN,    "DV_REG_DN6_TO_CN"   },
+    {DV_REG_DN7_TO_CN,    "DV_REG_DN7_TO_CN"   },
     {DV_REG_GROUND_TO_CN, "DV_REG_GROUND_TO_CN"},
     {DV_REG_CN_TO_DN0,    "DV_REG_CN_TO_DN0"   },
     {DV_REG_CN_TO_DN1,    "DV_REG_CN_TO_DN1"   },
     {DV_REG_CN_TO_DN2,    "DV_REG_CN_TO_DN2"   },
+    {DV_REG_CN_TO_DN3,    "DV_REG_CN_TO_DN3"   },
+    {DV_REG_CN_TO_DN4,    "DV_REG_CN_TO_DN4"   },
+    {DV_REG_CN_TO_DN5,    "DV_REG_CN_TO_DN5"   },
+    {DV_REG_CN_TO_DN6,    "DV_REG_CN_TO_DN6"   },
+    {DV_REG_CN_TO_DN7,    "DV_REG_CN_TO_DN7"   },
     {DV_REG_GROUND,       "DV_REG_GROUND"      },
 };
 
@@ -96,12 +119,120 @@ const std::unordered_map<DataVectorElement_t,
     {DV_ELEM_DN2_ERROR_COUNT,              "DV_ELEM_DN2_ERROR_COUNT"             },
     {DV_ELEM_DN2_MSG_TX_COUNT,             "DV_ELEM_DN2_MSG_TX_COUNT"            },
     {DV_ELEM_DN2_MSG_RX_COUNT,             "DV_ELEM_DN2_MSG_RX_COUNT"            },
+    {DV_ELEM_DN3_LOOP_COUNT,               "DV_ELEM_DN3_LOOP_COUNT"              },
+    {DV_ELEM_DN3_ERROR_COUNT,              "DV_ELEM_DN3_ERROR_COUNT"             },
+    {DV_ELEM_DN3_MSG_TX_COUNT,             "DV_ELEM_DN3_MSG_TX_COUNT"            },
+    {DV_ELEM_DN3_MSG_RX_COUNT,             "DV_ELEM_DN3_MSG_RX_COUNT"            },
+    {DV_ELEM_DN4_LOOP_COUNT,               "DV_ELEM_DN4_LOOP_COUNT"              },
+    {DV_ELEM_DN4_ERROR_COUNT,              "DV_ELEM_DN4_ERROR_COUNT"             },
+    {DV_ELEM_DN4_MSG_TX_COUNT,             "DV_ELEM_DN4_MSG_TX_COUNT"            },
+    {DV_ELEM_DN4_MSG_RX_COUNT,             "DV_ELEM_DN4_MSG_RX_COUNT"            },
+    {DV_ELEM_DN5_LOOP_COUNT,               "DV_ELEM_DN5_LOOP_COUNT"              },
+    {DV_ELEM_DN5_ERROR_COUNT,              "DV_ELEM_DN5_ERROR_COUNT"             },
+    {DV_ELEM_DN5_MSG_TX_COUNT,             "DV_ELEM_DN5_MSG_TX_COUNT"            },
+    {DV_ELEM_DN5_MSG_RX_COUNT,             "DV_ELEM_DN5_MSG_RX_COUNT"            },
+    {DV_ELEM_DN6_LOOP_COUNT,               "DV_ELEM_DN6_LOOP_COUNT"              },
+    {DV_ELEM_DN6_ERROR_COUNT,              "DV_ELEM_DN6_ERROR_COUNT"             },
+    {DV_ELEM_DN6_MSG_TX_COUNT,             "DV_ELEM_DN6_MSG_TX_COUNT"            },
+    {DV_ELEM_DN6_MSG_RX_COUNT,             "DV_ELEM_DN6_MSG_RX_COUNT"            },
+    {DV_ELEM_DN7_LOOP_COUNT,               "DV_ELEM_DN7_LOOP_COUNT"              },
+    {DV_ELEM_DN7_ERROR_COUNT,              "DV_ELEM_DN7_ERROR_COUNT"             },
+    {DV_ELEM_DN7_MSG_TX_COUNT,             "DV_ELEM_DN7_MSG_TX_COUNT"            },
+    {DV_ELEM_DN7_MSG_RX_COUNT,             "DV_ELEM_DN7_MSG_RX_COUNT"            },
     {DV_ELEM_GROUND_MSG_TX_COUNT,          "DV_ELEM_GROUND_MSG_TX_COUNT"         },
     {DV_ELEM_GROUND_MSG_RX_COUNT,          "DV_ELEM_GROUND_MSG_RX_COUNT"         },
     {DV_ELEM_DN0_RX_MISS_COUNT,            "DV_ELEM_DN0_RX_MISS_COUNT"           },
     {DV_ELEM_DN1_RX_MISS_COUNT,            "DV_ELEM_DN1_RX_MISS_COUNT"           },
     {DV_ELEM_DN2_RX_MISS_COUNT,            "DV_ELEM_DN2_RX_MISS_COUNT"           },
+    {DV_ELEM_DN3_RX_MISS_COUNT,            "DV_ELEM_DN3_RX_MISS_COUNT"           },
+    {DV_ELEM_DN4_RX_MISS_COUNT,            "DV_ELEM_DN4_RX_MISS_COUNT"           },
+    {DV_ELEM_DN5_RX_MISS_COUNT,            "DV_ELEM_DN5_RX_MISS_COUNT"           },
+    {DV_ELEM_DN6_RX_MISS_COUNT,            "DV_ELEM_DN6_RX_MISS_COUNT"           },
+    {DV_ELEM_DN7_RX_MISS_COUNT,            "DV_ELEM_DN7_RX_MISS_COUNT"           },
     {DV_ELEM_CN_TIME_NS,                   "DV_ELEM_CN_TIME_NS"                  },
+    DV_PHASE_PROFILER_PREFIXES (DV_PHASE_PROFILER_ELEM_STRS)
+    {DV_ELEM_CN_LOOP_JITTER_MAX_NS,        "DV_ELEM_CN_LOOP_JITTER_MAX_NS"       },
+    {DV_ELEM_CN_LOOP_JITTER_P99_NS,        "DV_ELEM_CN_LOOP_JITTER_P99_NS"       },
+    {DV_ELEM_CN_LOOP_EXEC_MAX_NS,          "DV_ELEM_CN_LOOP_EXEC_MAX_NS"         },
+    {DV_ELEM_CN_LOOP_EXEC_P99_NS,          "DV_ELEM_CN_LOOP_EXEC_P99_NS"         },
+    {DV_ELEM_CN_LOOP_RESPONSE_MAX_NS,      "DV_ELEM_CN_LOOP_RESPONSE_MAX_NS"     },
+    {DV_ELEM_CN_LOOP_RESPONSE_P99_NS,      "DV_ELEM_CN_LOOP_RESPONSE_P99_NS"     },
+    {DV_ELEM_CN_OVERRUN_RATE_DIVISOR,      "DV_ELEM_CN_OVERRUN_RATE_DIVISOR"     },
+    {DV_ELEM_CN_MINOR_PAGE_FAULT_COUNT,    "DV_ELEM_CN_MINOR_PAGE_FAULT_COUNT"   },
+    {DV_ELEM_CN_MAJOR_PAGE_FAULT_COUNT,    "DV_ELEM_CN_MAJOR_PAGE_FAULT_COUNT"   },
+    {DV_ELEM_DN0_MINOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN0_MINOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN0_MAJOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN0_MAJOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN1_MINOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN1_MINOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN1_MAJOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN1_MAJOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN2_MINOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN2_MINOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN2_MAJOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN2_MAJOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN3_MINOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN3_MINOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN3_MAJOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN3_MAJOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN4_MINOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN4_MINOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN4_MAJOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN4_MAJOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN5_MINOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN5_MINOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN5_MAJOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN5_MAJOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN6_MINOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN6_MINOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN6_MAJOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN6_MAJOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN7_MINOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN7_MINOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_DN7_MAJOR_PAGE_FAULT_COUNT,   "DV_ELEM_DN7_MAJOR_PAGE_FAULT_COUNT"  },
+    {DV_ELEM_CN_DEGRADED_LOOP_COUNT,       "DV_ELEM_CN_DEGRADED_LOOP_COUNT"      },
+    {DV_ELEM_DN0_CN_RX_MISS_COUNT,         "DV_ELEM_DN0_CN_RX_MISS_COUNT"        },
+    {DV_ELEM_DN1_CN_RX_MISS_COUNT,         "DV_ELEM_DN1_CN_RX_MISS_COUNT"        },
+    {DV_ELEM_DN2_CN_RX_MISS_COUNT,         "DV_ELEM_DN2_CN_RX_MISS_COUNT"        },
+    {DV_ELEM_DN3_CN_RX_MISS_COUNT,         "DV_ELEM_DN3_CN_RX_MISS_COUNT"        },
+    {DV_ELEM_DN4_CN_RX_MISS_COUNT,         "DV_ELEM_DN4_CN_RX_MISS_COUNT"        },
+    {DV_ELEM_DN5_CN_RX_MISS_COUNT,         "DV_ELEM_DN5_CN_RX_MISS_COUNT"        },
+    {DV_ELEM_DN6_CN_RX_MISS_COUNT,         "DV_ELEM_DN6_CN_RX_MISS_COUNT"        },
+    {DV_ELEM_DN7_CN_RX_MISS_COUNT,         "DV_ELEM_DN7_CN_RX_MISS_COUNT"        },
+    {DV_ELEM_CN_TO_DN0_FRAME,              "DV_ELEM_CN_TO_DN0_FRAME"             },
+    {DV_ELEM_CN_TO_DN1_FRAME,              "DV_ELEM_CN_TO_DN1_FRAME"             },
+    {DV_ELEM_CN_TO_DN2_FRAME,              "DV_ELEM_CN_TO_DN2_FRAME"             },
+    {DV_ELEM_CN_TO_DN3_FRAME,              "DV_ELEM_CN_TO_DN3_FRAME"             },
+    {DV_ELEM_CN_TO_DN4_FRAME,              "DV_ELEM_CN_TO_DN4_FRAME"             },
+    {DV_ELEM_CN_TO_DN5_FRAME,              "DV_ELEM_CN_TO_DN5_FRAME"             },
+    {DV_ELEM_CN_TO_DN6_FRAME,              "DV_ELEM_CN_TO_DN6_FRAME"             },
+    {DV_ELEM_CN_TO_DN7_FRAME,              "DV_ELEM_CN_TO_DN7_FRAME"             },
+    {DV_ELEM_CN_TO_DN0_ACTUATION_MSG,      "DV_ELEM_CN_TO_DN0_ACTUATION_MSG"     },
+    {DV_ELEM_CN_TO_DN1_ACTUATION_MSG,      "DV_ELEM_CN_TO_DN1_ACTUATION_MSG"     },
+    {DV_ELEM_CN_TO_DN2_ACTUATION_MSG,      "DV_ELEM_CN_TO_DN2_ACTUATION_MSG"     },
+    {DV_ELEM_CN_TO_DN3_ACTUATION_MSG,      "DV_ELEM_CN_TO_DN3_ACTUATION_MSG"     },
+    {DV_ELEM_CN_TO_DN4_ACTUATION_MSG,      "DV_ELEM_CN_TO_DN4_ACTUATION_MSG"     },
+    {DV_ELEM_CN_TO_DN5_ACTUATION_MSG,      "DV_ELEM_CN_TO_DN5_ACTUATION_MSG"     },
+    {DV_ELEM_CN_TO_DN6_ACTUATION_MSG,      "DV_ELEM_CN_TO_DN6_ACTUATION_MSG"     },
+    {DV_ELEM_CN_TO_DN7_ACTUATION_MSG,      "DV_ELEM_CN_TO_DN7_ACTUATION_MSG"     },
+    {DV_ELEM_DN0_FAST_LOOP_COUNT,          "DV_ELEM_DN0_FAST_LOOP_COUNT"         },
+    {DV_ELEM_DN0_FAST_LOOP_MISS_COUNT,     "DV_ELEM_DN0_FAST_LOOP_MISS_COUNT"    },
+    {DV_ELEM_DN1_FAST_LOOP_COUNT,          "DV_ELEM_DN1_FAST_LOOP_COUNT"         },
+    {DV_ELEM_DN1_FAST_LOOP_MISS_COUNT,     "DV_ELEM_DN1_FAST_LOOP_MISS_COUNT"    },
+    {DV_ELEM_DN2_FAST_LOOP_COUNT,          "DV_ELEM_DN2_FAST_LOOP_COUNT"         },
+    {DV_ELEM_DN2_FAST_LOOP_MISS_COUNT,     "DV_ELEM_DN2_FAST_LOOP_MISS_COUNT"    },
+    {DV_ELEM_DN3_FAST_LOOP_COUNT,          "DV_ELEM_DN3_FAST_LOOP_COUNT"         },
+    {DV_ELEM_DN3_FAST_LOOP_MISS_COUNT,     "DV_ELEM_DN3_FAST_LOOP_MISS_COUNT"    },
+    {DV_ELEM_DN4_FAST_LOOP_COUNT,          "DV_ELEM_DN4_FAST_LOOP_COUNT"         },
+    {DV_ELEM_DN4_FAST_LOOP_MISS_COUNT,     "DV_ELEM_DN4_FAST_LOOP_MISS_COUNT"    },
+    {DV_ELEM_DN5_FAST_LOOP_COUNT,          "DV_ELEM_DN5_FAST_LOOP_COUNT"         },
+    {DV_ELEM_DN5_FAST_LOOP_MISS_COUNT,     "DV_ELEM_DN5_FAST_LOOP_MISS_COUNT"    },
+    {DV_ELEM_DN6_FAST_LOOP_COUNT,          "DV_ELEM_DN6_FAST_LOOP_COUNT"         },
+    {DV_ELEM_DN6_FAST_LOOP_MISS_COUNT,     "DV_ELEM_DN6_FAST_LOOP_MISS_COUNT"    },
+    {DV_ELEM_DN7_FAST_LOOP_COUNT,          "DV_ELEM_DN7_FAST_LOOP_COUNT"         },
+    {DV_ELEM_DN7_FAST_LOOP_MISS_COUNT,     "DV_ELEM_DN7_FAST_LOOP_MISS_COUNT"    },
+    {DV_ELEM_DN0_SAMPLE_TIME_NS,           "DV_ELEM_DN0_SAMPLE_TIME_NS"          },
+    {DV_ELEM_DN0_SAMPLE_MISS_COUNT,        "DV_ELEM_DN0_SAMPLE_MISS_COUNT"       },
+    {DV_ELEM_DN1_SAMPLE_TIME_NS,           "DV_ELEM_DN1_SAMPLE_TIME_NS"          },
+    {DV_ELEM_DN1_SAMPLE_MISS_COUNT,        "DV_ELEM_DN1_SAMPLE_MISS_COUNT"       },
+    {DV_ELEM_DN2_SAMPLE_TIME_NS,           "DV_ELEM_DN2_SAMPLE_TIME_NS"          },
+    {DV_ELEM_DN2_SAMPLE_MISS_COUNT,        "DV_ELEM_DN2_SAMPLE_MISS_COUNT"       },
+    {DV_ELEM_DN3_SAMPLE_TIME_NS,           "DV_ELEM_DN3_SAMPLE_TIME_NS"          },
+    {DV_ELEM_DN3_SAMPLE_MISS_COUNT,        "DV_ELEM_DN3_SAMPLE_MISS_COUNT"       },
+    {DV_ELEM_DN4_SAMPLE_TIME_NS,           "DV_ELEM_DN4_SAMPLE_TIME_NS"          },
+    {DV_ELEM_DN4_SAMPLE_MISS_COUNT,        "DV_ELEM_DN4_SAMPLE_MISS_COUNT"       },
+    {DV_ELEM_DN5_SAMPLE_TIME_NS,           "DV_ELEM_DN5_SAMPLE_TIME_NS"          },
+    {DV_ELEM_DN5_SAMPLE_MISS_COUNT,        "DV_ELEM_DN5_SAMPLE_MISS_COUNT"       },
+    {DV_ELEM_DN6_SAMPLE_TIME_NS,           "DV_ELEM_DN6_SAMPLE_TIME_NS"          },
+    {DV_ELEM_DN6_SAMPLE_MISS_COUNT,        "DV_ELEM_DN6_SAMPLE_MISS_COUNT"       },
+    {DV_ELEM_DN7_SAMPLE_TIME_NS,           "DV_ELEM_DN7_SAMPLE_TIME_NS"          },
+    {DV_ELEM_DN7_SAMPLE_MISS_COUNT,        "DV_ELEM_DN7_SAMPLE_MISS_COUNT"       },
     {DV_ELEM_STATE,                        "DV_ELEM_STATE"                       },
     {DV_ELEM_CMD_REQ,                      "DV_ELEM_CMD_REQ"                     },
     {DV_ELEM_CMD,                          "DV_ELEM_CMD"                         },
@@ -1,8 +1,50 @@
 #include "Device.hpp"
 
+/*************************** PUBLIC FUNCTIONS *********************************/
+
+void Device::setRate (RateGroupExecutive::Rate_t kRate)
+{
+    mRate = kRate;
+}
+
+RateGroupExecutive::Rate_t Device::getRate ()
+{
+    return mRate;
+}
+
+void Device::setIndependent (bool kIndependent)
+{
+    mIndependent = kIndependent;
+}
+
+bool Device::isIndependent ()
+{
+    return mIndependent;
+}
+
+void Device::setFastLoop (bool kFastLoop)
+{
+    mFastLoop = kFastLoop;
+}
+
+bool Device::isFastLoop ()
+{
+    return mFastLoop;
+}
+
+Error_t Device::sample ()
+{
+    return E_SUCCESS;
+}
+
+void Device::reserveSamples (uint32_t kNumSamples) {}
+
 /*************************** PROTECTED FUNCTIONS ******************************/
 
 Device::Device (NiFpga_Session& kSession, 
                 std::shared_ptr<DataVector> kPDataVector) :
     mSession     (kSession),
-    mPDataVector (kPDataVector) {}
+    mPDataVector (kPDataVector),
+    mRate        (RateGroupExecutive::RATE_EVERY_FRAME),
+    mIndependent (false),
+    mFastLoop    (false) {}
@@ -1,3 +1,6 @@
+#include <errno.h>
+#include <time.h>
+#include <algorithm>
 #include <set>
 
 #include "DeviceNode.hpp"
@@ -13,35 +16,131 @@ typedef struct DvInfo
     DataVectorRegion_t sendRegion;
     DataVectorElement_t loopElem;
     DataVectorElement_t errorElem;
+    PhaseProfiler::Config_t phases;
+    DataVectorElement_t minorFaultElem;
+    DataVectorElement_t majorFaultElem;
+    DataVectorElement_t cnRxMissElem;
+    DataVectorElement_t fastLoopElem;
+    DataVectorElement_t fastLoopMissElem;
+    DataVectorElement_t sampleTimeElem;
+    DataVectorElement_t sampleMissElem;
+    DataVectorElement_t cnFrameElem;
+    DataVectorElement_t cnActuationMsgElem;
 } DvInfo_t;
 
 /**
- * Map from Device Node x to Data Vector info.
+ * Phase config entry of a Device Node loop phase. 
+ *
+ * @param  kPrefix  Element prefix, e.g. DV_ELEM_DN0_COMMS.
+ */
+#define DN_PHASE_CONFIG_ENTRY(kPrefix) PHASE_PROFILER_PHASE_CONFIG (kPrefix),
+
+/**
+ * Map entry from Device Node x to its Data Vector info.
+ *
+ * @param  kIdx  Device Node index.
+ */
+#define DV_INFO_ENTRY(kIdx)                                                    \
+    {NODE_DEVICE##kIdx,                                                        \
+    {                                                                          \
+        DV_REG_CN_TO_DN##kIdx,                                                 \
+        DV_REG_DN##kIdx##_TO_CN,                                               \
+        DV_ELEM_DN##kIdx##_LOOP_COUNT,                                         \
+        DV_ELEM_DN##kIdx##_ERROR_COUNT,                                        \
+        {                                                                      \
+            DV_DN_PHASE_PREFIXES (DN_PHASE_CONFIG_ENTRY, DN##kIdx)             \
+        },                                                                     \
+        DV_ELEM_DN##kIdx##_MINOR_PAGE_FAULT_COUNT,                             \
+        DV_ELEM_DN##kIdx##_MAJOR_PAGE_FAULT_COUNT,                             \
+        DV_ELEM_DN##kIdx##_CN_RX_MISS_COUNT,                                   \
+        DV_ELEM_DN##kIdx##_FAST_LOOP_COUNT,                                    \
+        DV_ELEM_DN##kIdx##_FAST_LOOP_MISS_COUNT,                               \
+        DV_ELEM_DN##kIdx##_SAMPLE_TIME_NS,                                     \
+        DV_ELEM_DN##kIdx##_SAMPLE_MISS_COUNT,                                  \
+        DV_ELEM_CN_TO_DN##kIdx##_FRAME,                                        \
+        DV_ELEM_CN_TO_DN##kIdx##_ACTUATION_MSG,                                \
+    }},
+
+/**
+ * Map from Device Node x to Data Vector info. Generated from 
+ * NODE_DEVICE_INDICES so that every Device Node has an entry.
  */
 static const std::unordered_map<Node_t, DvInfo_t, EnumClassHash> 
     NODE_TO_DV_INFO =
 {
-    {NODE_DEVICE0, 
-    {
-        DV_REG_CN_TO_DN0, 
-        DV_REG_DN0_TO_CN, 
-        DV_ELEM_DN0_LOOP_COUNT, 
-        DV_ELEM_DN0_ERROR_COUNT
-    }},
-    {NODE_DEVICE1,
-    {
-        DV_REG_CN_TO_DN1, 
-        DV_REG_DN1_TO_CN, 
-        DV_ELEM_DN1_LOOP_COUNT, 
-        DV_ELEM_DN1_ERROR_COUNT
-    }},
-    {NODE_DEVICE2,
-    {
-        DV_REG_CN_TO_DN2, 
-        DV_REG_DN2_TO_CN, 
-        DV_ELEM_DN2_LOOP_COUNT, 
-        DV_ELEM_DN2_ERROR_COUNT
-    }},
+    NODE_DEVICE_INDICES (DV_INFO_ENTRY)
+};
+
+/**
+ * Profiled loop phases. Each phase's index into DvInfo_t.phases is its phase
+ * number.
+ */
+enum LoopPhase_t : uint8_t
+{
+    PHASE_COMMS,
+    PHASE_SENSORS,
+    PHASE_CTRLS,
+    PHASE_ACTUATORS,
+    PHASE_LOOP,
+};
+
+/**
+ * Nodes to receive from with recvMult, i.e. the Control Node.
+ */
+static const std::vector<Node_t> CN_NODES = {NODE_CONTROL};
+
+/**
+ * Time after the start of the loop (receipt of the Control Node's first 
+ * message) to stop waiting for the same-frame actuation message. Must be less
+ * than the Control Node loop period so that the next loop's first message is 
+ * never mistaken for the actuation message.
+ */
+static const Time::TimeNs_t ACTUATION_RECV_CUTOFF_NS = 
+                                    NetworkManager::LOOP_PERIOD_NS * 8 / 10;
+
+/**
+ * Max fast loop rate as a multiple of the loop rate, i.e. a 1 kHz fast loop.
+ */
+static const uint8_t MAX_FAST_LOOP_MULTIPLE = 10;
+
+/**
+ * Time before the expected start of the Control Node's frame that the 
+ * time-triggered loop runs the sensor Devices and sends DV_REG_DNx_TO_CN. 
+ * Must leave enough time for the sensor Devices to run and the message to 
+ * arrive before the Control Node's communications step.
+ */
+static const Time::TimeNs_t SENSOR_LEAD_NS = 1 * Time::NS_IN_MS;
+
+/**
+ * Time after the expected start of the Control Node's frame that the 
+ * time-triggered loop stops waiting for DV_REG_CN_TO_DNx and counts the frame
+ * as missed. Set to the Control Node's communications time slice.
+ */
+static const Time::TimeNs_t CN_RECV_WINDOW_NS = 2 * Time::NS_IN_MS;
+
+/**
+ * Max time the sensor phase waits for the FPGA's sample tick before running
+ * the sensor Devices anyway. Must exceed the tick period. See note #11.
+ */
+static const uint32_t SAMPLE_TICK_TIMEOUT_MS = 2;
+
+/**
+ * Fraction of the measured phase error that the time-triggered loop corrects 
+ * each frame, as a divisor. Smaller divisors track the Control Node faster but
+ * pass more network jitter through to the loop.
+ */
+static const int64_t PHASE_CORRECTION_DIVISOR = 4;
+
+/**
+ * Max phase correction applied in one frame. Bounds the effect of a single 
+ * delayed message.
+ */
+static const int64_t MAX_PHASE_CORRECTION_NS = 250 * Time::NS_IN_US;
+
+const TaskPool::Config_t DeviceNode::PLATFORM_V1_TASK_POOL =
+{
+    {ThreadManager::Affinity_t::CORE_0},
+    ThreadManager::MIN_NEW_THREAD_PRIORITY
 };
 
 /********************************* GLOBALS ************************************/
@@ -66,6 +165,11 @@ static std::shared_ptr<DataVector> gPDv = nullptr;
  */
 static std::shared_ptr<NetworkManager> gPNm = nullptr;
 
+/**
+ * Pointer to Phase Profiler. Null if loop phase profiling is disabled.
+ */
+static std::unique_ptr<PhaseProfiler> gPPp = nullptr;
+
 /**
  * Vector of pointers to Controllers.
  */
@@ -81,6 +185,65 @@ static std::vector<std::unique_ptr<Device>> gPSensorDevs;
  */
 static std::vector<std::unique_ptr<Device>> gPActuatorDevs;
 
+/**
+ * Sensor Devices, Controllers, and actuator Devices run by the fast loop 
+ * instead of the loop. Owned by gPSensorDevs, gPCtrls, and gPActuatorDevs.
+ */
+static std::vector<Device*> gPFastSensorDevs;
+static std::vector<Controller*> gPFastCtrls;
+static std::vector<Device*> gPFastActuatorDevs;
+
+/**
+ * Sensor Devices run by the loop, which the fast loop samples each period so
+ * that oversampling Devices can aggregate the samples. See Device::sample.
+ */
+static std::vector<Device*> gPSampledSensorDevs;
+
+/**
+ * True if fast loops and fast loop deadline misses are counted in the Data 
+ * Vector.
+ */
+static bool gCountFastLoops = false;
+static bool gCountFastLoopMisses = false;
+
+/**
+ * Rate Group Executive. Schedules the Sensor Devices, Controllers, and
+ * Actuator Devices, in that order. E.g. Controller i is task 
+ * gPSensorDevs.size () + i.
+ */
+static std::unique_ptr<RateGroupExecutive> gPRge = nullptr;
+
+/**
+ * Task Pool used to run independent Devices and Controllers in parallel. Null
+ * if parallel tasks are disabled.
+ */
+static std::unique_ptr<TaskPool> gPPool = nullptr;
+
+/**
+ * Sample Trigger that aligns the sensor phase to the FPGA's sample tick. Null
+ * if sample alignment is disabled.
+ */
+static std::unique_ptr<SampleTrigger> gPSampleTrigger = nullptr;
+
+/**
+ * Statically allocated batch of independent tasks to run in parallel.
+ */
+static std::vector<TaskPool::Task_t> gBatch;
+
+/**
+ * True if page faults taken after the first loop are counted in the Data 
+ * Vector.
+ */
+static bool gCountPageFaults = false;
+
+/**
+ * Process page fault counts at the end of the first loop, and when faults 
+ * were last counted. Set by the loop.
+ */
+static bool gPageFaultsBaselined = false;
+static MemoryManager::PageFaults_t gBaselinePageFaults = {0, 0};
+static MemoryManager::PageFaults_t gLastPageFaults = {0, 0};
+
 /**
  * FPGA session.
  */
@@ -96,8 +259,112 @@ static std::vector<uint8_t> gRecvBuf;
  */
 static std::vector<uint8_t> gSendBuf;
 
+/**
+ * If true, wait for the Control Node's same-frame actuation message each loop
+ * and run the actuator Devices again on receipt.
+ */
+static bool gSameFrameActuation = false;
+
+/**
+ * Time the Control Node's first message was received this loop. Only set if 
+ * gSameFrameActuation is true.
+ */
+static Time::TimeNs_t gLoopStartNs = 0;
+
+/**
+ * Expected start time of the Control Node's current frame, i.e. the expected
+ * receipt time of DV_REG_CN_TO_DNx. Only used by the time-triggered loop.
+ */
+static Time::TimeNs_t gFrameStartNs = 0;
+
+/**
+ * True if frames in which the time-triggered loop does not receive 
+ * DV_REG_CN_TO_DNx are counted in the Data Vector.
+ */
+static bool gCountCnRxMisses = false;
+
+/**
+ * Statically allocated buffer for receiving messages from the Control Node 
+ * with recvMult and its received count. Used for the same-frame actuation 
+ * message and by the time-triggered loop.
+ */
+static std::vector<std::vector<uint8_t>> gCnRecvBufs (CN_NODES.size ());
+static std::vector<uint32_t> gCnNumMsgsReceived (CN_NODES.size ());
+
+/**
+ * True if the time-triggered loop reads the Control Node's frame counter from
+ * DV_ELEM_CN_TO_DNx_FRAME to discard stale messages.
+ */
+static bool gCheckCnFrame = false;
+
+/**
+ * Frame counter of the last Control Node message accepted by the 
+ * time-triggered loop. Only valid if gCnFrameKnown is true.
+ */
+static bool gCnFrameKnown = false;
+static uint32_t gLastCnFrame = 0;
+
+/**
+ * True if the Control Node's message type is read from 
+ * DV_ELEM_CN_TO_DNx_ACTUATION_MSG so that the same-frame actuation message is
+ * told apart from the next frame's message.
+ */
+static bool gCheckCnMsgType = false;
+
+/**
+ * True if the next frame's message was received while waiting for the 
+ * same-frame actuation message. It is held in gRecvBuf and used by the next
+ * loop instead of receiving again.
+ */
+static bool gCnMsgPending = false;
+
+/**
+ * True if the same-frame actuation message was received while receiving the
+ * frame's message. It is held in gCnRecvBufs[0] and used by 
+ * recvActuationData instead of receiving again.
+ */
+static bool gActuationMsgPending = false;
+
 /***************************** PRIVATE FUNCIONS *******************************/
 
+/**
+ * Helper to verify NODE_TO_DV_INFO has exactly one entry for each Device Node
+ * and that no two Device Nodes share a region. Done at init so that a missing
+ * or duplicated entry is not first found by a lookup in the loop.
+ *
+ * @ret    E_SUCCESS        Table valid.
+ *         E_INVALID_CONFIG Table invalid.
+ */
+static Error_t verifyDvInfo ()
+{
+    // 1) Verify every Device Node has an entry and no other node does.
+    uint32_t numDeviceNodes = NODE_DEVICE_LAST - NODE_DEVICE0 + 1;
+    if (NODE_TO_DV_INFO.size () != numDeviceNodes)
+    {
+        return E_INVALID_CONFIG;
+    }
+    for (uint32_t node = NODE_DEVICE0; node <= NODE_DEVICE_LAST; node++)
+    {
+        if (NODE_TO_DV_INFO.find ((Node_t) node) == NODE_TO_DV_INFO.end ())
+        {
+            return E_INVALID_CONFIG;
+        }
+    }
+
+    // 2) Verify each region belongs to exactly one Device Node.
+    std::set<DataVectorRegion_t> regions;
+    for (const auto& nodeToDvInfo : NODE_TO_DV_INFO)
+    {
+        if (regions.insert (nodeToDvInfo.second.recvRegion).second == false ||
+            regions.insert (nodeToDvInfo.second.sendRegion).second == false)
+        {
+            return E_INVALID_CONFIG;
+        }
+    }
+
+    return E_SUCCESS;
+}
+
 /**
  * Helper to verify Network Manager config matches required Platform v1 
  * topology.
@@ -204,59 +471,101 @@ static Error_t initializeBuffers ()
     // Resize buffers.
     gRecvBuf.resize (recvBufSize);
     gSendBuf.resize (sendBufSize);
+    gCnRecvBufs[0].resize (recvBufSize);
 
     return E_SUCCESS;
 }
 
 /**
- * Helper to recv Data Vector data from Control Node and send the relevant data
- * back. Optimized for faster response time to Control Node.
+ * Helper to start timing a loop phase if profiling is enabled. Errors are 
+ * logged.
  *
- * NOTE: Blocks until message received.
+ * @param  kPhase  Phase to start.
+ */
+static void startPhase (uint8_t kPhase)
+{
+    if (gPPp != nullptr)
+    {
+        Errors::incrementOnError (gPPp->startPhase (kPhase), gPDv, 
+                                  NODE_TO_DV_INFO.at (gMe).errorElem);
+    }
+}
+
+/**
+ * Helper to end timing a loop phase if profiling is enabled. Errors are 
+ * logged.
  *
- * @ret  E_SUCCESS                  Successfully received data.
- *       E_DATA_VECTOR_READ         Failed to copy data from Data Vector.
- *       E_NETWORK_MANAGER_RX_FAIL  Failed to recv data.
- *       E_DATA_VECTOR_WRITE        Failed to write data to Data Vector.
- *       E_NETWORK_MANAGER_TX_FAIL  Failed to send data to nodes.
+ * @param  kPhase  Phase to end.
  */
-static Error_t recvAndSendDataVectorData ()
+static void endPhase (uint8_t kPhase)
 {
-    // 1) Copy tx Data Vector data to buffer. Do this first so can respond as
-    //    soon as data is received.
-    if (gPDv->readRegion (NODE_TO_DV_INFO.at (gMe).sendRegion, gSendBuf) 
-            != E_SUCCESS)
+    if (gPPp != nullptr)
     {
-        return E_DATA_VECTOR_READ;
+        Errors::incrementOnError (gPPp->endPhase (kPhase), gPDv, 
+                                  NODE_TO_DV_INFO.at (gMe).errorElem);
     }
+}
 
-    // 2) Receive data from Control Node.
-    if (gPNm->recvBlock (NODE_CONTROL, gRecvBuf) != E_SUCCESS)
+/**
+ * Helper to initialize the Phase Profiler if the Data Vector contains this 
+ * node's loop phase timing elements.
+ *
+ * @ret    E_SUCCESS  Phase Profiler initialized or profiling disabled.
+ *         [other]    Phase Profiler failed to initialize.
+ */
+static Error_t initializePhaseProfiler ()
+{
+    PhaseProfiler::Config_t config = NODE_TO_DV_INFO.at (gMe).phases;
+    if (gPDv->elementExists (config[0].wallMinNs) != E_SUCCESS)
     {
-        return E_NETWORK_MANAGER_RX_FAIL;
+        return E_SUCCESS;
     }
 
-    // 3) Send data to Control Node.
-    if (gPNm->send (NODE_CONTROL, gSendBuf) != E_SUCCESS)
+    return PhaseProfiler::createNew (config, gPDv, gPPp);
+}
+
+/**
+ * Helper to write the number of page faults the process has taken since the 
+ * first loop to this node's page fault elements. The first call records the 
+ * baseline. The Data Vector is only written when the counts change.
+ *
+ * @ret    E_SUCCESS              Page faults counted.
+ *         E_FAILED_TO_GET_USAGE  Failed to read page fault counts.
+ *         E_DATA_VECTOR_WRITE    Failed to write counts to Data Vector.
+ */
+static Error_t countPageFaults ()
+{
+    // 1) Read the process's page fault counts.
+    MemoryManager::PageFaults_t faults = {0, 0};
+    Error_t ret = MemoryManager::getPageFaults (faults);
+    if (ret != E_SUCCESS)
     {
-        return E_NETWORK_MANAGER_TX_FAIL;
+        return ret;
     }
 
-    // 4) There is a known issue with the sbRIO Ethernet hardware that can
-    //    result in a message getting "stuck" in the RX FIFO queue. The message
-    //    gets unstuck when the next Ethernet frame comes in. This should not
-    //    happen due to the noop message sent by the Network Manager after each
-    //    send, but in case it does, call recv one more time without blocking to 
-    //    make sure the Device Node is not operating on the previous loop's 
-    //    data.
-    bool _msgRxd = false;
-    if (gPNm->recvNoBlock (NODE_CONTROL, gRecvBuf, _msgRxd) != E_SUCCESS)
+    // 2) On the first call, record the baseline.
+    if (gPageFaultsBaselined == false)
     {
-        return E_NETWORK_MANAGER_RX_FAIL;
+        gBaselinePageFaults = faults;
+        gLastPageFaults = faults;
+        gPageFaultsBaselined = true;
+        return E_SUCCESS;
     }
 
-    // 5) Copy data from buffer to Data Vector.
-    if (gPDv->writeRegion (NODE_TO_DV_INFO.at (gMe).recvRegion, gRecvBuf) 
+    // 3) If any faults were taken since the last call, write the counts since
+    //    the baseline.
+    if (faults.minor == gLastPageFaults.minor && 
+        faults.major == gLastPageFaults.major)
+    {
+        return E_SUCCESS;
+    }
+    gLastPageFaults = faults;
+    const DvInfo_t& dvInfo = NODE_TO_DV_INFO.at (gMe);
+    if (gPDv->write (dvInfo.minorFaultElem, 
+                     (uint32_t) (faults.minor - gBaselinePageFaults.minor)) 
+            != E_SUCCESS ||
+        gPDv->write (dvInfo.majorFaultElem, 
+                     (uint32_t) (faults.major - gBaselinePageFaults.major)) 
             != E_SUCCESS)
     {
         return E_DATA_VECTOR_WRITE;
@@ -266,80 +575,1100 @@ static Error_t recvAndSendDataVectorData ()
 }
 
 /**
- * Device Node logic that runs in a loop synchronized with Control Node's
- * periodic loop. Runs logic in the following order:
+ * Helper to initialize the Rate Group Executive with each Sensor Device, 
+ * Controller, and Actuator Device's rate. Must be called after the Controllers
+ * and Devices are initialized.
  *
- *   1) Receive Data Vector region from Control Node. Block until receive.
- *   2) Send Data Vector region to Control Node.
- *   3) Run Sensor Devices.
- *   4) Run Controllers.
- *   5) Run Actuator Devices.
+ * @ret    E_SUCCESS  Rate Group Executive initialized.
+ *         [other]    Rate Group Executive failed to initialize.
+ */
+static Error_t initializeRateGroupExecutive ()
+{
+    RateGroupExecutive::Config_t config;
+    for (std::unique_ptr<Device>& pSensorDev : gPSensorDevs)
+    {
+        config.push_back (pSensorDev->getRate ());
+    }
+    for (std::unique_ptr<Controller>& pCtrl : gPCtrls)
+    {
+        config.push_back (pCtrl->getRate ());
+    }
+    for (std::unique_ptr<Device>& pActuatorDev : gPActuatorDevs)
+    {
+        config.push_back (pActuatorDev->getRate ());
+    }
+
+    return RateGroupExecutive::createNew (config, gPRge);
+}
+
+/**
+ * Helper to initialize the Task Pool and the batch buffer used by the loop.
  *
- * This function never returns. If Errors::incrementOnError fails, fails 
- * silently.
+ * @param  kPoolConfig  Task Pool config.
  *
- * @param   _kArgs                          Unused.
+ * @ret    E_SUCCESS    Task Pool initialized.
+ *         [other]      Task Pool failed to initialize.
+ */
+static Error_t initializeTaskPool (const TaskPool::Config_t& kPoolConfig)
+{
+    gBatch.reserve (std::max ({gPSensorDevs.size (), gPCtrls.size (), 
+                               gPActuatorDevs.size ()}));
+
+    return TaskPool::createNew (kPoolConfig, gPPool);
+}
+
+/**
+ * Helper to collect the Devices and Controllers run by the fast loop and 
+ * verify the fast loop multiple.
+ *
+ * @param  kFastLoopMultiple  Fast loop rate as a multiple of the loop rate. 0
+ *                            if the fast loop is disabled.
  *
+ * @ret    E_SUCCESS          Fast loop initialized.
+ *         E_INVALID_CONFIG   Multiple greater than MAX_FAST_LOOP_MULTIPLE, or
+ *                            fast loop tasks set and fast loop disabled.
  */
-static void* loop (void* _kArgs)
+static Error_t initializeFastLoop (uint8_t kFastLoopMultiple)
 {
-    DataVectorElement_t errorElem = NODE_TO_DV_INFO.at (gMe).errorElem;
-    DataVectorElement_t loopElem  = NODE_TO_DV_INFO.at (gMe).loopElem;
-    while (1)
+    // 1) Collect fast loop tasks.
+    for (std::unique_ptr<Device>& pSensorDev : gPSensorDevs)
     {
-        // 1) Receive rx Region from Control Node send tx Region. 
-        Errors::incrementOnError (recvAndSendDataVectorData (), gPDv, 
-                                  errorElem);
-
-        // 2) Run the Sensor Devices. Run this before the Controllers so that
-        //    they have the most up-to-date data.
-        for (std::unique_ptr<Device>& pSensorDev : gPSensorDevs)
+        if (pSensorDev->isFastLoop () == true)
         {
-            Errors::incrementOnError (pSensorDev->run (), gPDv, errorElem);
+            gPFastSensorDevs.push_back (pSensorDev.get ());
         }
-        
-        // 3) Run the Controllers.
-        for (std::unique_ptr<Controller>& pCtrl : gPCtrls)
+        else
         {
-            Errors::incrementOnError (pCtrl->run (), gPDv, errorElem);
+            // The fast loop samples the Device every period and the loop
+            // drains it every divisor frames. Reserve one extra sample since
+            // the two are not phase locked.
+            pSensorDev->reserveSamples (
+                        kFastLoopMultiple * pSensorDev->getRate ().divisor + 1);
+            gPSampledSensorDevs.push_back (pSensorDev.get ());
         }
-
-        // 4) Run the Actuator Devices. Run this after the Controllers so that
-        //    the system can react quickly.
-        for (std::unique_ptr<Device>& pActuatorDev : gPActuatorDevs)
+    }
+    for (std::unique_ptr<Controller>& pCtrl : gPCtrls)
+    {
+        if (pCtrl->isFastLoop () == true)
+        {
+            gPFastCtrls.push_back (pCtrl.get ());
+        }
+    }
+    for (std::unique_ptr<Device>& pActuatorDev : gPActuatorDevs)
+    {
+        if (pActuatorDev->isFastLoop () == true)
         {
-            Errors::incrementOnError (pActuatorDev->run (), gPDv, errorElem);
+            gPFastActuatorDevs.push_back (pActuatorDev.get ());
         }
+    }
 
-        // 5) Increment loop counter.
-        Errors::incrementOnError (gPDv->increment (loopElem), gPDv, errorElem);
+    // 2) Verify multiple. Fast loop tasks are skipped by the loop, so they 
+    //    would never run if the fast loop were disabled.
+    bool hasFastTasks = gPFastSensorDevs.empty () == false || 
+                        gPFastCtrls.empty () == false ||
+                        gPFastActuatorDevs.empty () == false;
+    if (kFastLoopMultiple > MAX_FAST_LOOP_MULTIPLE ||
+        (kFastLoopMultiple == 0 && hasFastTasks == true))
+    {
+        return E_INVALID_CONFIG;
     }
+
+    // 3) Count fast loops and deadline misses if the Data Vector contains this
+    //    node's fast loop elements.
+    gCountFastLoops = gPDv->elementExists (
+                    NODE_TO_DV_INFO.at (gMe).fastLoopElem) == E_SUCCESS;
+    gCountFastLoopMisses = gPDv->elementExists (
+                    NODE_TO_DV_INFO.at (gMe).fastLoopMissElem) == E_SUCCESS;
+
+    return E_SUCCESS;
 }
 
-/***************************** PUBLIC FUNCIONS ********************************/
+/**
+ * Task Pool task function that runs a Device or Controller.
+ *
+ * @param   kPArg     Pointer to Device or Controller.
+ *
+ * @ret     Return value of Device or Controller's run.
+ */
+template <class T>
+static Error_t runTask (void* kPArg)
+{
+    return static_cast<T*> (kPArg)->run ();
+}
 
-void DeviceNode::entry (NetworkManager::Config_t  kNmConfig, 
-                        DataVector::Config_t      kDvConfig,
-                        fInitializeCtrlsAndDevs_t kFInitCtrlsAndDevs,
-                        bool                      kSkipClockSync)
+/**
+ * Helper to run the Devices or Controllers of one loop phase that are 
+ * scheduled in this minor frame, skipping fast loop tasks. Tasks that are not
+ * independent run in order on the loop thread. If the Task Pool is enabled, 
+ * independent tasks are then run in parallel.
+ *
+ * @param   kPTasks     Devices or Controllers to run.
+ * @param   kFirstTask  Rate Group Executive task index of kPTasks[0].
+ * @param   kErrorElem  Element to increment on error.
+ */
+template <class T>
+static void runPhaseTasks (std::vector<std::unique_ptr<T>>& kPTasks, 
+                           uint32_t kFirstTask, DataVectorElement_t kErrorElem)
 {
-    // 0) Set "me" global
-    gMe = kNmConfig.me;
-    if (gMe != NODE_DEVICE0 && gMe != NODE_DEVICE1 && gMe != NODE_DEVICE2)
+    // 1) Run dependent tasks and collect independent tasks.
+    gBatch.clear ();
+    for (uint32_t i = 0; i < kPTasks.size (); i++)
     {
-        Errors::exitOnError (E_INVALID_NODE, "Me node must be a Device Node.");
+        if (gPRge->isScheduled (kFirstTask + i) == false ||
+            kPTasks[i]->isFastLoop () == true)
+        {
+            continue;
+        }
+        if (gPPool != nullptr && kPTasks[i]->isIndependent () == true)
+        {
+            gBatch.push_back ({runTask<T>, kPTasks[i].get (), E_SUCCESS});
+        }
+        else
+        {
+            Errors::incrementOnError (kPTasks[i]->run (), gPDv, kErrorElem);
+        }
     }
 
-    // 1) Verify Network Manager config matches required topology.
-    Errors::exitOnError (
-                verifyNmConfig (kNmConfig), 
-                "Network Manager config does not match required topology.");
+    // 2) Run independent tasks in parallel.
+    if (gBatch.empty () == true)
+    {
+        return;
+    }
+    Errors::incrementOnError (gPPool->run (gBatch), gPDv, kErrorElem);
+    for (TaskPool::Task_t& task : gBatch)
+    {
+        Errors::incrementOnError (task.ret, gPDv, kErrorElem);
+    }
+}
 
-    // 2) Verify Data Vector config contains required regions and elements.
-    Errors::exitOnError (
-        verifyDvConfig (kDvConfig),
-        "Data Vector config does not contain required regions or elements.");
-    
+/**
+ * Initialize the Sample Trigger. Its Data Vector elements are required when
+ * sample alignment is enabled.
+ *
+ * @param  kSampleIrqs  IRQs the FPGA asserts each sample tick. 0 to disable.
+ *
+ * @ret    E_SUCCESS    Sample Trigger initialized or disabled.
+ *         [other]      Sample Trigger failed to initialize.
+ */
+static Error_t initializeSampleTrigger (uint32_t kSampleIrqs)
+{
+    if (kSampleIrqs == 0)
+    {
+        return E_SUCCESS;
+    }
+
+    SampleTrigger::Config_t config =
+    {
+        kSampleIrqs,
+        SAMPLE_TICK_TIMEOUT_MS,
+        NODE_TO_DV_INFO.at (gMe).sampleTimeElem,
+        NODE_TO_DV_INFO.at (gMe).sampleMissElem,
+    };
+    return SampleTrigger::createNew (config, gFpgaSession, gPDv,
+                                     gPSampleTrigger);
+}
+
+/**
+ * If sample alignment is enabled, wait for the FPGA's next sample tick so
+ * that the sensor Devices read the sample set latched at that tick. Misses
+ * are counted by the Sample Trigger, and the sensor Devices run regardless.
+ *
+ * @param  kErrorElem  Element to count errors in.
+ */
+static void waitForSampleTick (DataVectorElement_t kErrorElem)
+{
+    if (gPSampleTrigger == nullptr)
+    {
+        return;
+    }
+
+    bool ticked = false;
+    Errors::incrementOnError (gPSampleTrigger->waitForTick (ticked), gPDv,
+                              kErrorElem);
+}
+
+/**
+ * Helper to check whether a message received from the Control Node is the 
+ * same-frame actuation message or a frame's message. If the message type is 
+ * not checked, the message is assumed to be of the expected type.
+ *
+ * @param  kBuf                Message received from the Control Node.
+ * @param  kActuationMsg       True if the same-frame actuation message is 
+ *                             expected, false if a frame's message is.
+ * @param  kMatchRet           True if the message is of the expected type.
+ *
+ * @ret    E_SUCCESS           Message checked.
+ *         E_DATA_VECTOR_READ  Failed to read message type from message.
+ */
+static Error_t checkCnMsgType (const std::vector<uint8_t>& kBuf, 
+                               bool kActuationMsg, bool& kMatchRet)
+{
+    kMatchRet = true;
+    if (gCheckCnMsgType == false)
+    {
+        return E_SUCCESS;
+    }
+
+    bool isActuationMsg = false;
+    if (gPDv->readFromRegionBuf (NODE_TO_DV_INFO.at (gMe).recvRegion, kBuf,
+                                 NODE_TO_DV_INFO.at (gMe).cnActuationMsgElem,
+                                 isActuationMsg) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_READ;
+    }
+    kMatchRet = isActuationMsg == kActuationMsg;
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to enable checking the Control Node's message type and, if 
+ * time-triggered, frame counter if the Data Vector contains this node's 
+ * elements. Must be called after the buffers are initialized.
+ *
+ * @param  kTimeTriggered     True if the time-triggered loop is used.
+ *
+ * @ret    E_SUCCESS          Checks initialized.
+ *         E_INVALID_CONFIG   DV_ELEM_CN_TO_DNx_ACTUATION_MSG is not a bool or
+ *                            DV_ELEM_CN_TO_DNx_FRAME is not a uint32 in 
+ *                            DV_REG_CN_TO_DNx.
+ */
+static Error_t initializeCnMsgChecks (bool kTimeTriggered)
+{
+    const DvInfo_t& dvInfo = NODE_TO_DV_INFO.at (gMe);
+
+    // 1) Check the message type if the Data Vector contains its element.
+    gCheckCnMsgType = gPDv->elementExists (
+                                dvInfo.cnActuationMsgElem) == E_SUCCESS;
+    bool _isActuationMsg = false;
+    if (gCheckCnMsgType == true &&
+        gPDv->readFromRegionBuf (dvInfo.recvRegion, gRecvBuf, 
+                                 dvInfo.cnActuationMsgElem, 
+                                 _isActuationMsg) != E_SUCCESS)
+    {
+        return E_INVALID_CONFIG;
+    }
+
+    // 2) If time-triggered, check the frame counter if the Data Vector 
+    //    contains its element.
+    gCheckCnFrame = kTimeTriggered == true &&
+                    gPDv->elementExists (dvInfo.cnFrameElem) == E_SUCCESS;
+    uint32_t _frame = 0;
+    if (gCheckCnFrame == true &&
+        gPDv->readFromRegionBuf (dvInfo.recvRegion, gRecvBuf, 
+                                 dvInfo.cnFrameElem, _frame) != E_SUCCESS)
+    {
+        return E_INVALID_CONFIG;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to recv Data Vector data from Control Node and send the relevant data
+ * back. Optimized for faster response time to Control Node.
+ *
+ * NOTE: Blocks until message received.
+ *
+ * @ret  E_SUCCESS                  Successfully received data.
+ *       E_DATA_VECTOR_READ         Failed to copy data from Data Vector.
+ *       E_NETWORK_MANAGER_RX_FAIL  Failed to recv data.
+ *       E_DATA_VECTOR_WRITE        Failed to write data to Data Vector.
+ *       E_NETWORK_MANAGER_TX_FAIL  Failed to send data to nodes.
+ *       E_FAILED_TO_GET_TIME       Failed to get loop start time.
+ */
+static Error_t recvAndSendDataVectorData ()
+{
+    // 1) Copy tx Data Vector data to buffer. Do this first so can respond as
+    //    soon as data is received.
+    if (gPDv->readRegion (NODE_TO_DV_INFO.at (gMe).sendRegion, gSendBuf) 
+            != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_READ;
+    }
+
+    // 2) Receive data from Control Node, unless recvActuationData already 
+    //    received it. Discard late same-frame actuation messages. If 
+    //    same-frame actuation is enabled, record the receive time to bound 
+    //    the wait for the actuation message.
+    bool isFrameMsg = gCnMsgPending;
+    gCnMsgPending = false;
+    gActuationMsgPending = false;
+    while (isFrameMsg == false)
+    {
+        if (gPNm->recvBlock (NODE_CONTROL, gRecvBuf) != E_SUCCESS)
+        {
+            return E_NETWORK_MANAGER_RX_FAIL;
+        }
+        if (checkCnMsgType (gRecvBuf, false, isFrameMsg) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+    }
+    if (gSameFrameActuation == true && 
+        gPTime->getTimeNs (gLoopStartNs) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+
+    // 3) Send data to Control Node.
+    if (gPNm->send (NODE_CONTROL, gSendBuf) != E_SUCCESS)
+    {
+        return E_NETWORK_MANAGER_TX_FAIL;
+    }
+
+    // 4) There is a known issue with the sbRIO Ethernet hardware that can
+    //    result in a message getting "stuck" in the RX FIFO queue. The message
+    //    gets unstuck when the next Ethernet frame comes in. This should not
+    //    happen due to the noop message sent by the Network Manager after each
+    //    send, but in case it does, call recv one more time without blocking to 
+    //    make sure the Device Node is not operating on the previous loop's 
+    //    data. If the message is the same-frame actuation message instead, 
+    //    hold it for recvActuationData.
+    bool msgRxd = false;
+    if (gPNm->recvNoBlock (NODE_CONTROL, gCnRecvBufs[0], msgRxd) != E_SUCCESS)
+    {
+        return E_NETWORK_MANAGER_RX_FAIL;
+    }
+    if (msgRxd == true)
+    {
+        if (checkCnMsgType (gCnRecvBufs[0], false, isFrameMsg) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+        if (isFrameMsg == true)
+        {
+            gRecvBuf.swap (gCnRecvBufs[0]);
+        }
+        else
+        {
+            gActuationMsgPending = gSameFrameActuation;
+        }
+    }
+
+    // 5) Copy data from buffer to Data Vector.
+    if (gPDv->writeRegion (NODE_TO_DV_INFO.at (gMe).recvRegion, gRecvBuf) 
+            != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to wait for the Control Node's same-frame actuation message, sent 
+ * right after the Control Node's Controllers run, and copy it to the Data 
+ * Vector. Stops waiting ACTUATION_RECV_CUTOFF_NS after the loop started. If 
+ * the next frame's message is received first, the actuation message was lost
+ * or is late, so stops waiting and holds the next frame's message for the
+ * next loop.
+ *
+ * @param  kMsgReceivedRet            True if the message was received.
+ *
+ * @ret    E_SUCCESS                  Message received or cutoff reached.
+ *         E_FAILED_TO_GET_TIME       Failed to get current time.
+ *         E_NETWORK_MANAGER_RX_FAIL  Failed to recv data.
+ *         E_DATA_VECTOR_READ         Failed to read message type.
+ *         E_DATA_VECTOR_WRITE        Failed to write data to Data Vector.
+ */
+static Error_t recvActuationData (bool& kMsgReceivedRet)
+{
+    kMsgReceivedRet = false;
+
+    // 1) Use the message if it was already received with the frame's 
+    //    message.
+    bool isActuationMsg = gActuationMsgPending;
+    gActuationMsgPending = false;
+
+    // 2) Otherwise, wait for the message until the cutoff, returning as soon 
+    //    as it is received.
+    Time::TimeNs_t cutoffTimeNs = gLoopStartNs + ACTUATION_RECV_CUTOFF_NS;
+    Time::TimeNs_t currTimeNs = 0;
+    while (isActuationMsg == false)
+    {
+        if (gPTime->getTimeNs (currTimeNs) != E_SUCCESS)
+        {
+            return E_FAILED_TO_GET_TIME;
+        }
+        if (currTimeNs >= cutoffTimeNs)
+        {
+            return E_SUCCESS;
+        }
+        if (gPNm->recvMult (cutoffTimeNs - currTimeNs, CN_NODES, 
+                            gCnRecvBufs, gCnNumMsgsReceived, 
+                            true) != E_SUCCESS)
+        {
+            return E_NETWORK_MANAGER_RX_FAIL;
+        }
+        if (gCnNumMsgsReceived[0] == 0)
+        {
+            continue;
+        }
+        if (checkCnMsgType (gCnRecvBufs[0], true, isActuationMsg) 
+                != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+
+        // 2a) The next frame's message was received first. Hold it for the 
+        //     next loop.
+        if (isActuationMsg == false)
+        {
+            gRecvBuf.swap (gCnRecvBufs[0]);
+            gCnMsgPending = true;
+            return E_SUCCESS;
+        }
+    }
+
+    // 3) Copy data from buffer to Data Vector.
+    if (gPDv->writeRegion (NODE_TO_DV_INFO.at (gMe).recvRegion, 
+                           gCnRecvBufs[0]) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    kMsgReceivedRet = true;
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to sleep until an absolute time on the clock synchronized with the 
+ * Control Node. Retries if interrupted by a signal.
+ *
+ * @param  kWakeNs            Time to wake.
+ *
+ * @ret    E_SUCCESS          Slept until kWakeNs.
+ *         E_FAILED_TO_SLEEP  Failed to sleep.
+ */
+static Error_t sleepUntil (Time::TimeNs_t kWakeNs)
+{
+    struct timespec wake;
+    wake.tv_sec  = kWakeNs / Time::NS_IN_S;
+    wake.tv_nsec = kWakeNs % Time::NS_IN_S;
+
+    int ret = EINTR;
+    while (ret == EINTR)
+    {
+        ret = clock_nanosleep (CLOCK_REALTIME, TIMER_ABSTIME, &wake, nullptr);
+    }
+
+    return ret == 0 ? E_SUCCESS : E_FAILED_TO_SLEEP;
+}
+
+/**
+ * Helper to check whether a message received from the Control Node by the 
+ * time-triggered loop is a frame's message newer than the last one accepted. 
+ * If so, accepts it by recording its frame counter. Same-frame actuation 
+ * messages are never accepted. If the frame counter is not checked, every 
+ * frame's message is new.
+ *
+ * @param  kBuf                Message received from the Control Node.
+ * @param  kIsNewRet           True if the message was accepted.
+ *
+ * @ret    E_SUCCESS           Message checked.
+ *         E_DATA_VECTOR_READ  Failed to read frame counter or message type 
+ *                             from message.
+ */
+static Error_t acceptCnMsg (const std::vector<uint8_t>& kBuf, bool& kIsNewRet)
+{
+    // 1) Discard the same-frame actuation message.
+    if (checkCnMsgType (kBuf, false, kIsNewRet) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_READ;
+    }
+    if (kIsNewRet == false || gCheckCnFrame == false)
+    {
+        return E_SUCCESS;
+    }
+
+    // 2) Read the frame counter from the message.
+    uint32_t frame = 0;
+    if (gPDv->readFromRegionBuf (NODE_TO_DV_INFO.at (gMe).recvRegion, kBuf,
+                                 NODE_TO_DV_INFO.at (gMe).cnFrameElem, 
+                                 frame) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_READ;
+    }
+
+    // 3) Accept the message if its frame is after the last accepted one. The
+    //    difference is compared as signed so that the counter can wrap.
+    kIsNewRet = gCnFrameKnown == false || 
+                (int32_t) (frame - gLastCnFrame) > 0;
+    if (kIsNewRet == true)
+    {
+        gLastCnFrame  = frame;
+        gCnFrameKnown = true;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to receive, without blocking, every message from the Control Node 
+ * already queued. The newest message accepted by acceptCnMsg is kept in 
+ * gCnRecvBufs[0] and the rest are discarded.
+ *
+ * @param  kMsgReceivedRet            Set to true if a message was accepted. 
+ *                                    Otherwise, left unchanged.
+ *
+ * @ret    E_SUCCESS                  Queue drained.
+ *         E_NETWORK_MANAGER_RX_FAIL  Failed to receive data.
+ *         E_DATA_VECTOR_READ         Failed to read frame counter.
+ */
+static Error_t drainCnMsgs (bool& kMsgReceivedRet)
+{
+    bool msgRecvd = true;
+    while (msgRecvd == true)
+    {
+        // 1) Receive the next queued message, if any.
+        if (gPNm->recvNoBlock (NODE_CONTROL, gRecvBuf, msgRecvd) != E_SUCCESS)
+        {
+            return E_NETWORK_MANAGER_RX_FAIL;
+        }
+        if (msgRecvd == false)
+        {
+            break;
+        }
+
+        // 2) Keep the message if it is new. Swap instead of copy so that the
+        //    loop does not allocate.
+        bool isNew = false;
+        if (acceptCnMsg (gRecvBuf, isNew) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+        if (isNew == true)
+        {
+            gRecvBuf.swap (gCnRecvBufs[0]);
+            kMsgReceivedRet = true;
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to lock the time-triggered loop's phase to the Control Node's frame.
+ * Discards messages queued before the loop started, e.g. while the Device 
+ * Node was initializing, since their receipt time does not reflect the 
+ * Control Node's phase. Then blocks until the Control Node's next new message
+ * is received and sets the expected start of its next frame.
+ *
+ * @ret    E_SUCCESS                  Phase locked.
+ *         E_NETWORK_MANAGER_RX_FAIL  Failed to receive data.
+ *         E_DATA_VECTOR_READ         Failed to read frame counter.
+ *         E_FAILED_TO_GET_TIME       Failed to get time.
+ *         E_DATA_VECTOR_WRITE        Failed to write data to DV.
+ */
+static Error_t lockFramePhase ()
+{
+    // 1) Discard queued messages. If the frame counter is checked, the newest
+    //    one's frame is kept so that a stale message still in flight is not
+    //    locked onto below.
+    bool _msgRecvd = false;
+    Error_t ret = drainCnMsgs (_msgRecvd);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 2) Block until the Control Node's next new message and record its 
+    //    receipt time.
+    bool isNew = false;
+    while (isNew == false)
+    {
+        if (gPNm->recvBlock (NODE_CONTROL, gCnRecvBufs[0]) != E_SUCCESS)
+        {
+            return E_NETWORK_MANAGER_RX_FAIL;
+        }
+        if (gPTime->getTimeNs (gFrameStartNs) != E_SUCCESS)
+        {
+            return E_FAILED_TO_GET_TIME;
+        }
+        if (acceptCnMsg (gCnRecvBufs[0], isNew) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+    }
+
+    // 3) Copy data from buffer to Data Vector.
+    if (gPDv->writeRegion (NODE_TO_DV_INFO.at (gMe).recvRegion, 
+                           gCnRecvBufs[0]) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    // 4) The first frame to run is the Control Node's next one.
+    gFrameStartNs += NetworkManager::LOOP_PERIOD_NS;
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to send tx Region to Control Node without waiting for rx Region.
+ *
+ * @ret    E_SUCCESS                  Data sent.
+ *         E_DATA_VECTOR_READ         Failed to read data from DV.
+ *         E_NETWORK_MANAGER_TX_FAIL  Failed to send data.
+ */
+static Error_t sendDataVectorData ()
+{
+    // 1) Copy tx Data Vector data to buffer.
+    if (gPDv->readRegion (NODE_TO_DV_INFO.at (gMe).sendRegion, gSendBuf) 
+            != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_READ;
+    }
+
+    // 2) Send data to Control Node.
+    if (gPNm->send (NODE_CONTROL, gSendBuf) != E_SUCCESS)
+    {
+        return E_NETWORK_MANAGER_TX_FAIL;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to receive rx Region from Control Node for the current frame. First
+ * drains messages already queued, keeping the newest (e.g. after a skipped 
+ * frame). If none is new, waits until a new message is received or 
+ * CN_RECV_WINDOW_NS after the expected start of the frame, whichever is first.
+ * If the frame counter is checked, messages from frames already accepted are 
+ * discarded. Once a new message is received, messages queued behind it are 
+ * drained so that the latest data is used.
+ *
+ * @param  kMsgReceivedRet            True if a new message was received.
+ * @param  kRecvTimeNsRet             Receipt time. Only set if a new message
+ *                                    was received. A message that was already
+ *                                    queued is timed when it is drained.
+ *
+ * @ret    E_SUCCESS                  Received message or window closed.
+ *         E_FAILED_TO_GET_TIME       Failed to get time.
+ *         E_NETWORK_MANAGER_RX_FAIL  Failed to receive data.
+ *         E_DATA_VECTOR_READ         Failed to read frame counter.
+ *         E_DATA_VECTOR_WRITE        Failed to write data to DV.
+ */
+static Error_t recvFrameData (bool& kMsgReceivedRet, 
+                              Time::TimeNs_t& kRecvTimeNsRet)
+{
+    kMsgReceivedRet = false;
+
+    // 1) Use the message held by recvActuationData if it is new, then drain
+    //    messages already queued without blocking.
+    bool msgRecvd = false;
+    if (gCnMsgPending == true)
+    {
+        gCnMsgPending = false;
+        if (acceptCnMsg (gRecvBuf, msgRecvd) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+        if (msgRecvd == true)
+        {
+            gRecvBuf.swap (gCnRecvBufs[0]);
+        }
+    }
+    Error_t ret = drainCnMsgs (msgRecvd);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 2) If no new message was queued, wait for one until the receive window
+    //    closes, discarding stale messages.
+    Time::TimeNs_t windowEndNs = gFrameStartNs + CN_RECV_WINDOW_NS;
+    Time::TimeNs_t currTimeNs = 0;
+    while (msgRecvd == false)
+    {
+        if (gPTime->getTimeNs (currTimeNs) != E_SUCCESS)
+        {
+            return E_FAILED_TO_GET_TIME;
+        }
+        if (currTimeNs >= windowEndNs)
+        {
+            return E_SUCCESS;
+        }
+        if (gPNm->recvMult (windowEndNs - currTimeNs, CN_NODES, gCnRecvBufs, 
+                            gCnNumMsgsReceived, true) != E_SUCCESS)
+        {
+            return E_NETWORK_MANAGER_RX_FAIL;
+        }
+        if (gCnNumMsgsReceived[0] > 0 &&
+            acceptCnMsg (gCnRecvBufs[0], msgRecvd) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_READ;
+        }
+    }
+
+    // 3) Record the receipt time, then drain any newer messages that arrived
+    //    behind the new one.
+    if (gPTime->getTimeNs (kRecvTimeNsRet) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+    ret = drainCnMsgs (msgRecvd);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 4) Copy data from buffer to Data Vector.
+    if (gPDv->writeRegion (NODE_TO_DV_INFO.at (gMe).recvRegion, 
+                           gCnRecvBufs[0]) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    kMsgReceivedRet = true;
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to advance the expected frame start time to the Control Node's next 
+ * frame. If a new message was accepted this frame, corrects a bounded 
+ * fraction of the error between its receipt time and the expected frame start
+ * so that the loop tracks the Control Node as the clocks drift apart. Stale 
+ * messages are discarded by recvFrameData and never used for correction. If 
+ * the loop has fallen behind, skips frames so that the next sensor time is in
+ * the future.
+ *
+ * @param  kMsgReceived          True if a new message was accepted this 
+ *                               frame.
+ * @param  kRecvTimeNs           Receipt time of this frame's message.
+ *
+ * @ret    E_SUCCESS             Advanced frame.
+ *         E_FAILED_TO_GET_TIME  Failed to get time.
+ */
+static Error_t advanceFrame (bool kMsgReceived, Time::TimeNs_t kRecvTimeNs)
+{
+    // 1) Correct a fraction of the phase error.
+    int64_t correctionNs = 0;
+    if (kMsgReceived == true)
+    {
+        int64_t errorNs = (int64_t) (kRecvTimeNs - gFrameStartNs);
+        correctionNs = std::max (-MAX_PHASE_CORRECTION_NS, 
+                                 std::min (MAX_PHASE_CORRECTION_NS, 
+                                           errorNs / PHASE_CORRECTION_DIVISOR));
+    }
+    gFrameStartNs += NetworkManager::LOOP_PERIOD_NS + correctionNs;
+
+    // 2) Skip frames whose sensor time has already passed.
+    Time::TimeNs_t currTimeNs = 0;
+    if (gPTime->getTimeNs (currTimeNs) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+    while (gFrameStartNs - SENSOR_LEAD_NS < currTimeNs)
+    {
+        gFrameStartNs += NetworkManager::LOOP_PERIOD_NS;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Helper to run the part of the loop that follows communications and the 
+ * sensor Devices. Shared by the event-triggered and time-triggered loops.
+ *
+ *   1) Run Controllers scheduled in this minor frame.
+ *   2) Run Actuator Devices scheduled in this minor frame.
+ *   3) If same-frame actuation is enabled, wait for the Control Node's 
+ *      actuation message and run Actuator Devices again on receipt.
+ *   4) Increment the loop counter.
+ *   5) If enabled, count page faults taken since the first loop.
+ *
+ * Errors are logged.
+ *
+ * @param  kFirstCtrlTask      Task number of the first Controller.
+ * @param  kFirstActuatorTask  Task number of the first actuator Device.
+ */
+static void runLoopTail (uint32_t kFirstCtrlTask, uint32_t kFirstActuatorTask)
+{
+    DataVectorElement_t errorElem = NODE_TO_DV_INFO.at (gMe).errorElem;
+    DataVectorElement_t loopElem  = NODE_TO_DV_INFO.at (gMe).loopElem;
+
+    // 1) Run the Controllers scheduled in this minor frame.
+    startPhase (PHASE_CTRLS);
+    runPhaseTasks (gPCtrls, kFirstCtrlTask, errorElem);
+    endPhase (PHASE_CTRLS);
+
+    // 2) Run the Actuator Devices scheduled in this minor frame. Run this 
+    //    after the Controllers so that the system can react quickly.
+    startPhase (PHASE_ACTUATORS);
+    runPhaseTasks (gPActuatorDevs, kFirstActuatorTask, errorElem);
+    endPhase (PHASE_ACTUATORS);
+
+    // 3) If same-frame actuation is enabled, apply the Control Node's 
+    //    Controller outputs from this frame as soon as they arrive.
+    if (gSameFrameActuation == true)
+    {
+        bool msgRecvd = false;
+        Errors::incrementOnError (recvActuationData (msgRecvd), gPDv, 
+                                  errorElem);
+        if (msgRecvd == true)
+        {
+            runPhaseTasks (gPActuatorDevs, kFirstActuatorTask, errorElem);
+        }
+    }
+
+    // 4) Increment loop counter.
+    Errors::incrementOnError (gPDv->increment (loopElem), gPDv, errorElem);
+
+    // 5) Count page faults taken since the first loop.
+    if (gCountPageFaults == true)
+    {
+        Errors::incrementOnError (countPageFaults (), gPDv, errorElem);
+    }
+}
+
+/**
+ * Device Node logic that runs in a loop synchronized with Control Node's
+ * periodic loop. Runs logic in the following order:
+ *
+ *   1) Receive Data Vector region from Control Node. Block until receive.
+ *   2) Send Data Vector region to Control Node.
+ *   3) Run Sensor Devices scheduled in this minor frame. If enabled, first
+ *      wait for the FPGA's sample tick.
+ *   4) Run Controllers scheduled in this minor frame.
+ *   5) Run Actuator Devices scheduled in this minor frame.
+ *   6) If same-frame actuation is enabled, wait for the Control Node's 
+ *      actuation message and run Actuator Devices again on receipt.
+ *   7) If enabled, count page faults taken since the first loop.
+ *
+ * If parallel tasks are enabled, independent tasks within each of steps 3-5 
+ * run in parallel on the Task Pool.
+ *
+ * This function never returns. If Errors::incrementOnError fails, fails 
+ * silently.
+ *
+ * @param   _kArgs                          Unused.
+ *
+ */
+static void* loop (void* _kArgs)
+{
+    DataVectorElement_t errorElem = NODE_TO_DV_INFO.at (gMe).errorElem;
+    uint32_t firstSensorTask   = 0;
+    uint32_t firstCtrlTask     = firstSensorTask + gPSensorDevs.size ();
+    uint32_t firstActuatorTask = firstCtrlTask + gPCtrls.size ();
+    while (1)
+    {
+        startPhase (PHASE_LOOP);
+
+        // 1) Receive rx Region from Control Node send tx Region. Wall time of
+        //    this phase includes time blocked waiting for the Control Node.
+        startPhase (PHASE_COMMS);
+        Errors::incrementOnError (recvAndSendDataVectorData (), gPDv, 
+                                  errorElem);
+        endPhase (PHASE_COMMS);
+
+        // 2) Run the Sensor Devices scheduled in this minor frame. Run this 
+        //    before the Controllers so that they have the most up-to-date 
+        //    data. If enabled, first wait for the FPGA's sample tick.
+        startPhase (PHASE_SENSORS);
+        waitForSampleTick (errorElem);
+        gPRge->startFrame ();
+        runPhaseTasks (gPSensorDevs, firstSensorTask, errorElem);
+        endPhase (PHASE_SENSORS);
+        
+        // 3) Run the Controllers and Actuator Devices, then update loop 
+        //    statistics.
+        runLoopTail (firstCtrlTask, firstActuatorTask);
+
+        endPhase (PHASE_LOOP);
+    }
+}
+
+/**
+ * Device Node logic that runs in a periodic loop phase-locked to the Control 
+ * Node's frame instead of being triggered by its messages. Runs logic in the 
+ * following order:
+ *
+ *   1) Sleep until SENSOR_LEAD_NS before the expected start of the Control 
+ *      Node's frame.
+ *   2) Run Sensor Devices scheduled in this minor frame, after the FPGA's
+ *      sample tick if enabled.
+ *   3) Send Data Vector region to Control Node so that it is waiting when the
+ *      Control Node's frame starts.
+ *   4) Receive Data Vector region from Control Node. Wait at most until 
+ *      CN_RECV_WINDOW_NS after the expected frame start. Only the newest 
+ *      message is used and stale ones are discarded. If not received, count
+ *      the miss and continue with the last received data.
+ *   5) Run Controllers, Actuator Devices and same-frame actuation as in loop.
+ *   6) Advance to the next frame, correcting the phase towards this frame's 
+ *      receipt time.
+ *
+ * This function never returns. If Errors::incrementOnError fails, fails 
+ * silently.
+ *
+ * @param   _kArgs                          Unused.
+ *
+ */
+static void* timeTriggeredLoop (void* _kArgs)
+{
+    DataVectorElement_t errorElem  = NODE_TO_DV_INFO.at (gMe).errorElem;
+    DataVectorElement_t rxMissElem = NODE_TO_DV_INFO.at (gMe).cnRxMissElem;
+    uint32_t firstSensorTask   = 0;
+    uint32_t firstCtrlTask     = firstSensorTask + gPSensorDevs.size ();
+    uint32_t firstActuatorTask = firstCtrlTask + gPCtrls.size ();
+
+    // Lock the loop's phase to the Control Node's first message. Retry until 
+    // successful since the loop cannot run without a phase.
+    Error_t lockRet = lockFramePhase ();
+    while (lockRet != E_SUCCESS)
+    {
+        Errors::incrementOnError (lockRet, gPDv, errorElem);
+        lockRet = lockFramePhase ();
+    }
+
+    while (1)
+    {
+        // 1) Sleep until the sensor time of the Control Node's next frame.
+        Errors::incrementOnError (sleepUntil (gFrameStartNs - SENSOR_LEAD_NS),
+                                  gPDv, errorElem);
+        startPhase (PHASE_LOOP);
+
+        // 2) Run the Sensor Devices scheduled in this minor frame. If enabled,
+        //    first wait for the FPGA's sample tick.
+        startPhase (PHASE_SENSORS);
+        waitForSampleTick (errorElem);
+        gPRge->startFrame ();
+        runPhaseTasks (gPSensorDevs, firstSensorTask, errorElem);
+        endPhase (PHASE_SENSORS);
+
+        // 3) Send tx Region, then receive rx Region from Control Node. Wall 
+        //    time of this phase includes time waiting for the Control Node.
+        startPhase (PHASE_COMMS);
+        bool msgRecvd = false;
+        Time::TimeNs_t recvTimeNs = 0;
+        Errors::incrementOnError (sendDataVectorData (), gPDv, errorElem);
+        Errors::incrementOnError (recvFrameData (msgRecvd, recvTimeNs), gPDv,
+                                  errorElem);
+        endPhase (PHASE_COMMS);
+
+        // 4) If the message was missed, count it and keep running. Same-frame
+        //    actuation is bounded relative to the expected frame start.
+        gLoopStartNs = msgRecvd == true ? recvTimeNs : gFrameStartNs;
+        if (msgRecvd == false && gCountCnRxMisses == true)
+        {
+            Errors::incrementOnError (gPDv->increment (rxMissElem), gPDv, 
+                                      errorElem);
+        }
+
+        // 5) Run the Controllers and Actuator Devices, then update loop 
+        //    statistics.
+        runLoopTail (firstCtrlTask, firstActuatorTask);
+
+        // 6) Advance to the Control Node's next frame.
+        Errors::incrementOnError (advanceFrame (msgRecvd, recvTimeNs), gPDv, 
+                                  errorElem);
+
+        endPhase (PHASE_LOOP);
+    }
+}
+
+/**
+ * Device Node logic that runs in the fast loop. Samples the loop's sensor 
+ * Devices, then runs the fast loop sensor Devices, Controllers, and actuator 
+ * Devices in that order every period. Their rates are ignored.
+ *
+ * @ret    E_SUCCESS  Errors are logged and not returned.
+ */
+static Error_t fastLoop ()
+{
+    DataVectorElement_t errorElem = NODE_TO_DV_INFO.at (gMe).errorElem;
+
+    // 0) Sample the loop's sensor Devices for them to aggregate in their next
+    //    run. This is a no-op for Devices that do not oversample.
+    for (Device* pSensorDev : gPSampledSensorDevs)
+    {
+        Errors::incrementOnError (pSensorDev->sample (), gPDv, errorElem);
+    }
+
+    // 1) Run the sensor Devices first so that the Controllers have the most 
+    //    up-to-date data.
+    for (Device* pSensorDev : gPFastSensorDevs)
+    {
+        Errors::incrementOnError (pSensorDev->run (), gPDv, errorElem);
+    }
+
+    // 2) Run the Controllers.
+    for (Controller* pCtrl : gPFastCtrls)
+    {
+        Errors::incrementOnError (pCtrl->run (), gPDv, errorElem);
+    }
+
+    // 3) Run the actuator Devices.
+    for (Device* pActuatorDev : gPFastActuatorDevs)
+    {
+        Errors::incrementOnError (pActuatorDev->run (), gPDv, errorElem);
+    }
+
+    // 4) Increment fast loop counter.
+    if (gCountFastLoops == true)
+    {
+        Errors::incrementOnError (
+                    gPDv->increment (NODE_TO_DV_INFO.at (gMe).fastLoopElem),
+                    gPDv, errorElem);
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Handle a missed fast loop deadline. No other errors are expected since 
+ * fastLoop always succeeds.
+ *
+ * @param  kError     Error to handle.
+ *
+ * @ret    E_SUCCESS  Deadline miss handled.
+ *         [other]    Unexpected error.
+ */
+static Error_t fastLoopErrorHandler (Error_t kError)
+{
+    if (kError == E_MISSED_SCHEDULER_DEADLINE)
+    {
+        if (gCountFastLoopMisses == true)
+        {
+            Errors::incrementOnError (
+                gPDv->increment (NODE_TO_DV_INFO.at (gMe).fastLoopMissElem),
+                gPDv, NODE_TO_DV_INFO.at (gMe).errorElem);
+        }
+        return E_SUCCESS;
+    }
+
+    return kError;
+}
+
+/***************************** PUBLIC FUNCIONS ********************************/
+
+void DeviceNode::entry (NetworkManager::Config_t  kNmConfig, 
+                        DataVector::Config_t      kDvConfig,
+                        fInitializeCtrlsAndDevs_t kFInitCtrlsAndDevs,
+                        bool                      kSkipClockSync,
+                        Options_t                 kOptions)
+{
+    // 0) Verify the Device Node table and set "me" and same-frame actuation 
+    //    globals.
+    Errors::exitOnError (verifyDvInfo (), "Invalid Device Node table.");
+    gMe = kNmConfig.me;
+    gSameFrameActuation = kOptions.sameFrameActuation;
+    if (NODE_TO_DV_INFO.find (gMe) == NODE_TO_DV_INFO.end ())
+    {
+        Errors::exitOnError (E_INVALID_NODE, "Me node must be a Device Node.");
+    }
+
+    // 1) Verify Network Manager config matches required topology.
+    Errors::exitOnError (
+                verifyNmConfig (kNmConfig), 
+                "Network Manager config does not match required topology.");
+
+    // 2) Verify Data Vector config contains required regions and elements.
+    Errors::exitOnError (
+        verifyDvConfig (kDvConfig),
+        "Data Vector config does not contain required regions or elements.");
+    
 
     // 3) Init Thread Manager. Do this early on so that the kernel scheduling 
     //    environment is set up immediately.
@@ -372,13 +1701,29 @@ void DeviceNode::entry (NetworkManager::Config_t  kNmConfig,
         Errors::exitOnError (E_FPGA_INIT, "FPGA status error.");
     }
 
-    // 8) Init Controllers and Devices.
+    // 8) Init Controllers and Devices, the Rate Group Executive that 
+    //    schedules them, if enabled, the Task Pool that runs independent ones
+    //    in parallel, and the set of fast loop ones.
     Errors::exitOnError (kFInitCtrlsAndDevs (gPDv, gFpgaSession, gPCtrls, 
                                              gPSensorDevs, gPActuatorDevs),
                          "Controllers or Devices failed to initialize.");
+    Errors::exitOnError (initializeRateGroupExecutive (),
+                         "Rate Group Executive failed to initialize.");
+    if (kOptions.parallelTasks == true)
+    {
+        Errors::exitOnError (initializeTaskPool (kOptions.taskPoolConfig),
+                             "Task Pool failed to initialize.");
+    }
+    Errors::exitOnError (initializeFastLoop (kOptions.fastLoopMultiple),
+                         "Fast loop failed to initialize.");
+
+    // 9) Init Phase Profiler if the Data Vector contains this node's loop 
+    //    phase timing elements.
+    Errors::exitOnError (initializePhaseProfiler (), 
+                         "Phase Profiler failed to initialize.");
 
-    // 9) Synchronize to the Control Node's clock. This must be done before the 
-    //    Time Module is initialized.
+    // 10) Synchronize to the Control Node's clock. This must be done before 
+    //     the Time Module is initialized.
     if (kSkipClockSync == false)
     {
         NetworkManager::IP_t serverIp = kNmConfig.nodeToIp[NODE_CONTROL];
@@ -387,27 +1732,75 @@ void DeviceNode::entry (NetworkManager::Config_t  kNmConfig,
                              "Clock synchronization failed.");
     }
 
-    // 10) Init Time Module.
+    // 11) Init Time Module, then the Sample Trigger if enabled, which
+    //     timestamps sample ticks with it.
     Errors::exitOnError (Time::getInstance (gPTime), 
                          "Time Module failed to initialize.");
+    Errors::exitOnError (initializeSampleTrigger (kOptions.sampleIrqs),
+                         "Sample Trigger failed to initialize.");
 
-    // 11) Create thread to run loop function.
+    // 12) Lock all memory in RAM and prefault it so that the loop does not 
+    //     take page faults. Done after all buffers are allocated. The Data 
+    //     Vector is prefaulted first so that huge page advice, if enabled, is
+    //     given before its pages are locked. Count page faults in the loop if
+    //     the Data Vector contains this node's page fault elements.
+    Errors::exitOnError (gPDv->prefault (kOptions.hugePageDv), 
+                         "Failed to prefault Data Vector.");
+    Errors::exitOnError (MemoryManager::lockAll (
+                                        MemoryManager::STACK_PREFAULT_BYTES,
+                                        MemoryManager::HEAP_RESERVE_BYTES),
+                         "Failed to lock memory.");
+    gCountPageFaults = gPDv->elementExists (
+                    NODE_TO_DV_INFO.at (gMe).minorFaultElem) == E_SUCCESS;
+
+    // 13) Create thread to run loop function. If time-triggered, count frames
+    //     in which the Control Node's message is missed if the Data Vector 
+    //     contains this node's miss count element. Check the Control Node's
+    //     message type and, if time-triggered, frame counter if the Data 
+    //     Vector contains this node's elements.
     pthread_t loopThread;
     ThreadManager::ThreadFunc_t fLoop = (ThreadManager::ThreadFunc_t) loop;
+    if (kOptions.timeTriggered == true)
+    {
+        fLoop = (ThreadManager::ThreadFunc_t) timeTriggeredLoop;
+        gCountCnRxMisses = gPDv->elementExists (
+                        NODE_TO_DV_INFO.at (gMe).cnRxMissElem) == E_SUCCESS;
+    }
+    Errors::exitOnError (initializeCnMsgChecks (kOptions.timeTriggered),
+                         "Invalid Control Node message elements.");
     Errors::exitOnError (pTm->createThread (
                                       loopThread, fLoop, nullptr, 0,
                                       ThreadManager::MIN_NEW_THREAD_PRIORITY,
                                       ThreadManager::Affinity_t::CORE_1),
                          "Failed to start thread.");
 
-    // 12) Wait for thread and check return status. On success, this will cause
+    // 14) If enabled, create periodic thread to run fast loop function. It 
+    //     runs at a higher priority than the loop thread on the same CPU so
+    //     that it preempts the loop.
+    if (kOptions.fastLoopMultiple > 0)
+    {
+        auto fFastLoop = [] () { return fastLoop (); };
+        pthread_t fastLoopThread;
+        ThreadManager::ErrorHandler_t fError = 
+            (ThreadManager::ErrorHandler_t) &fastLoopErrorHandler;
+        Errors::exitOnError (pTm->createPeriodicTask (
+                                  fastLoopThread, fFastLoop,
+                                  ThreadManager::MIN_NEW_THREAD_PRIORITY + 1,
+                                  ThreadManager::Affinity_t::CORE_1,
+                                  NetworkManager::LOOP_PERIOD_NS / 
+                                      kOptions.fastLoopMultiple, 
+                                  fError),
+                             "Failed to start fast loop thread.");
+    }
+
+    // 15) Wait for thread and check return status. On success, this will cause
     //     the main thread to block and should never return.
     Error_t loopThreadRet = E_SUCCESS;
     Errors::exitOnError (pTm->waitForThread (loopThread, loopThreadRet),
                          "Failed to wait on loop thread.");
     Errors::exitOnError (loopThreadRet, "Loop thread returned error.");
 
-    // 13) If the function gets this far, the loop thread return an unexpected
+    // 16) If the function gets this far, the loop thread return an unexpected
     //     success status. Exit the process.
     exit (EXIT_FAILURE);
 }
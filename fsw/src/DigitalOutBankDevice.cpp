@@ -0,0 +1,163 @@
+#include <set>
+
+#include "DigitalOutBankDevice.hpp"
+
+/*************************** PUBLIC FUNCTIONS *********************************/
+
+Error_t DigitalOutBankDevice::run ()
+{
+    // Read every control value from DV.
+    if (mPDataVector->readBindings (mControlBindings) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_READ;
+    }
+
+    // Build the control bitmask and find the pins that changed.
+    uint32_t controlMask = 0;
+    for (uint32_t i = 0; i < mPChannels.size (); i++)
+    {
+        if (mControlVals[i] == true)
+        {
+            controlMask |= mPinMasks[i];
+        }
+    }
+    uint32_t changedMask = controlMask ^ mLastControlMask;
+
+    // Write every changed control value to FPGA, checking the merged status
+    // once. See note #1 in DigitalOutBankDevice.hpp.
+    NiFpga_Status status = NiFpga_Status_Success;
+    if (changedMask != 0)
+    {
+        for (uint32_t i = 0; i < mPChannels.size (); i++)
+        {
+            if ((changedMask & mPinMasks[i]) == 0)
+            {
+                continue;
+            }
+            NiFpga_MergeStatus (&status,
+                                NiFpga_WriteBool (
+                                    mSession,
+                                    mPChannels[i]->mFpgaControl,
+                                    static_cast<NiFpga_Bool> (
+                                        mControlVals[i])));
+        }
+        if (status != NiFpga_Status_Success)
+        {
+            return E_FPGA_WRITE;
+        }
+        mLastControlMask = controlMask;
+    }
+
+    // Read every due FPGA pin value, checking the merged status once.
+    bool feedbackRead = false;
+    for (uint32_t i = 0; i < mPChannels.size (); i++)
+    {
+        if (mPChannels[i]->isFeedbackDue () == false)
+        {
+            continue;
+        }
+        NiFpga_MergeStatus (&status,
+                            NiFpga_ReadBool (
+                                mSession,
+                                mPChannels[i]->mFpgaIndicator,
+                                (NiFpga_Bool*) &mFeedbackVals[i]));
+        feedbackRead = true;
+    }
+    if (status != NiFpga_Status_Success)
+    {
+        return E_FPGA_READ;
+    }
+    if (feedbackRead == false)
+    {
+        return E_SUCCESS;
+    }
+
+    // Write every current pin value to DV.
+    if (mPDataVector->writeBindings (mFeedbackBindings) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t DigitalOutBankDevice::verifyConfig (Config_t& kConfig)
+{
+    // Verify there is at least one channel.
+    if (kConfig.empty () == true)
+    {
+        return E_EMPTY_CONFIG;
+    }
+
+    // Verify each pin is used by one channel.
+    std::set<uint8_t> pins;
+    for (DigitalOutDevice::Config_t& channelConfig : kConfig)
+    {
+        if (pins.insert (channelConfig.pinNumber).second == false)
+        {
+            return E_DUPLICATE_PIN;
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+DigitalOutBankDevice::DigitalOutBankDevice (
+                                    NiFpga_Session& kSession,
+                                    std::shared_ptr<DataVector> kPDataVector,
+                                    Config_t& kConfig,
+                                    Error_t& kRet) :
+    Device           (kSession, kPDataVector),
+    mLastControlMask (0)
+{
+    // Verify config.
+    kRet = this->verifyConfig (kConfig);
+    if (kRet != E_SUCCESS)
+    {
+        return;
+    }
+
+    // Create each channel. This verifies the channel's config, writes its
+    // initial control value, and configures its pin as an output.
+    for (DigitalOutDevice::Config_t& channelConfig : kConfig)
+    {
+        std::unique_ptr<DigitalOutDevice> pChannel;
+        kRet = Device::createNew (kSession, kPDataVector, channelConfig,
+                                  pChannel);
+        if (kRet != E_SUCCESS)
+        {
+            return;
+        }
+
+        // Start from the control bitmask written by the channel.
+        uint32_t pinMask = 1u << channelConfig.pinNumber;
+        mPinMasks.push_back (pinMask);
+        if (pChannel->mLastControlVal == true)
+        {
+            mLastControlMask |= pinMask;
+        }
+        mPChannels.push_back (std::move (pChannel));
+    }
+
+    // Allocate values before binding to them.
+    mControlVals.reset (new bool[kConfig.size ()] ());
+    mFeedbackVals.reset (new bool[kConfig.size ()] ());
+    mControlBindings.resize (kConfig.size ());
+    mFeedbackBindings.resize (kConfig.size ());
+
+    // Bind each channel's elems.
+    for (uint32_t i = 0; i < kConfig.size (); i++)
+    {
+        if (mPDataVector->bind (kConfig[i].dvElemControlVal, mControlVals[i],
+                                mControlBindings[i]) != E_SUCCESS ||
+            mPDataVector->bind (kConfig[i].dvElemFeedbackVal,
+                                mFeedbackVals[i],
+                                mFeedbackBindings[i]) != E_SUCCESS)
+        {
+            kRet = E_INVALID_ELEM;
+            return;
+        }
+    }
+
+    kRet = E_SUCCESS;
+}
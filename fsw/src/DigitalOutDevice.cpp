@@ -14,6 +14,12 @@ Error_t DigitalOutDevice::run ()
         return ret;
     }
 
+    // Skip feedback if not due this run. See note #2 in DigitalOutDevice.hpp.
+    if (this->isFeedbackDue () == false)
+    {
+        return E_SUCCESS;
+    }
+
     // Read current FPGA pin value. Note, there is some delay between writing
     // a new value to digital out and the value being reflected in the indicator
     // value. So immediately after a new write this value will often not match
@@ -64,7 +70,11 @@ DigitalOutDevice::DigitalOutDevice (NiFpga_Session& kSession,
                                     std::shared_ptr<DataVector> kPDataVector,
                                     Config_t& kConfig,
                                     Error_t& kRet) :
-    Device (kSession, kPDataVector)
+    Device             (kSession, kPDataVector),
+    mLastControlVal    (false),
+    mControlWritten    (false),
+    mFeedbackDivisor   (1),
+    mRunsUntilFeedback (0)
 {
     // Verify config.
     kRet = this->verifyConfig (kConfig);
@@ -76,6 +86,10 @@ DigitalOutDevice::DigitalOutDevice (NiFpga_Session& kSession,
     // Store config data in class globals.
     mDvElemControlVal = kConfig.dvElemControlVal;
     mDvElemFeedbackVal = kConfig.dvElemFeedbackVal;
+    if (kConfig.feedbackDivisor > 1)
+    {
+        mFeedbackDivisor = kConfig.feedbackDivisor;
+    }
     // Get pin config data.
     uint32_t fpgaOutputEnable = 0;
     switch (kConfig.pinNumber)
@@ -233,16 +247,41 @@ Error_t DigitalOutDevice::updateFpgaControlValue ()
         return E_DATA_VECTOR_READ;
     }
 
+    return this->writeControlValue (outputVal);
+}
+
+Error_t DigitalOutDevice::writeControlValue (bool kVal)
+{
+    // Skip the write if the pin already outputs this value.
+    if (mControlWritten == true && kVal == mLastControlVal)
+    {
+        return E_SUCCESS;
+    }
+
     // Write output value to FPGA.
     NiFpga_Status status = NiFpga_Status_Success;
     NiFpga_MergeStatus (&status, 
                         NiFpga_WriteBool (mSession, 
                                           mFpgaControl, 
-                                          static_cast<NiFpga_Bool> (outputVal)));
+                                          static_cast<NiFpga_Bool> (kVal)));
     if (status != NiFpga_Status_Success)
     {
         return E_FPGA_WRITE;
     }
 
+    mLastControlVal = kVal;
+    mControlWritten = true;
     return E_SUCCESS;
 }
+
+bool DigitalOutDevice::isFeedbackDue ()
+{
+    if (mRunsUntilFeedback > 0)
+    {
+        mRunsUntilFeedback--;
+        return false;
+    }
+
+    mRunsUntilFeedback = mFeedbackDivisor - 1;
+    return true;
+}
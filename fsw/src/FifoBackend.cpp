@@ -0,0 +1,61 @@
+#include "FifoBackend.hpp"
+
+/****************************** PUBLIC MEMBERS ********************************/
+
+NiFpgaFifoBackend::NiFpgaFifoBackend (NiFpga_Session& kSession,
+                                      uint32_t kFifo) :
+    mSession (kSession),
+    mFifo    (kFifo) {}
+
+Error_t NiFpgaFifoBackend::start (size_t kDepth)
+{
+    NiFpga_Status status = NiFpga_Status_Success;
+    size_t actualDepth = 0;
+    NiFpga_MergeStatus (&status, NiFpga_ConfigureFifo2 (mSession, mFifo,
+                                                        kDepth, &actualDepth));
+    NiFpga_MergeStatus (&status, NiFpga_StartFifo (mSession, mFifo));
+    if (status != NiFpga_Status_Success)
+    {
+        return E_FPGA_FIFO;
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t NiFpgaFifoBackend::acquire (size_t kNumElems,
+                                    const uint32_t*& kPElemsRet,
+                                    bool& kAcquiredRet,
+                                    size_t& kNumRemainingRet)
+{
+    // Acquire with a timeout of 0 so that the caller never blocks on the
+    // FPGA. A timeout means fewer than kNumElems elements are available.
+    uint32_t* pElems = nullptr;
+    size_t numAcquired = 0;
+    NiFpga_Status status = NiFpga_AcquireFifoReadElementsU32 (
+                                    mSession, mFifo, &pElems, kNumElems, 0,
+                                    &numAcquired, &kNumRemainingRet);
+    if (status == NiFpga_Status_FifoTimeout)
+    {
+        kAcquiredRet = false;
+        return E_SUCCESS;
+    }
+    if (NiFpga_IsError (status) || numAcquired != kNumElems)
+    {
+        return E_FPGA_FIFO;
+    }
+
+    kPElemsRet = pElems;
+    kAcquiredRet = true;
+    return E_SUCCESS;
+}
+
+Error_t NiFpgaFifoBackend::release (size_t kNumElems)
+{
+    if (NiFpga_IsError (NiFpga_ReleaseFifoElements (mSession, mFifo,
+                                                    kNumElems)))
+    {
+        return E_FPGA_FIFO;
+    }
+
+    return E_SUCCESS;
+}
@@ -3,7 +3,8 @@
 LEDController::LEDController (const LEDController::Config_t& kConf,
                               std::shared_ptr<DataVector> kPDataVector,
                               DataVectorElement_t kDvModeElem) :
-    Controller (kPDataVector, kDvModeElem)
+    Controller (kPDataVector, kDvModeElem),
+    mControlVal (false)
 {
     this->mDvElemControlVal = kConf.dvElemControlVal;
 }
@@ -22,24 +23,19 @@ Error_t LEDController::verifyConfig ()
 
 Error_t LEDController::runEnabled ()
 {
-    return this->setLED (true);
+    mControlVal = true;
+    return E_SUCCESS;
 }
 
 Error_t LEDController::runSafed ()
 {
-    return this->setLED (false);
+    mControlVal = false;
+    return E_SUCCESS;
 }
 
-Error_t LEDController::setLED (bool kControlVal)
+Error_t LEDController::bindIo ()
 {
-    Error_t err = E_SUCCESS;
-
-    // Write control value to DV, which will inform the DIO device whether to
-    // turn LED on or off.
-    if (mPDataVector->write (this->mDvElemControlVal, kControlVal) != E_SUCCESS)
-    {
-        return E_DATA_VECTOR_WRITE;
-    }
-
-    return err;
+    // Bind control value, which will inform the DIO device whether to turn 
+    // LED on or off.
+    return this->bindOutput (this->mDvElemControlVal, this->mControlVal);
 }
@@ -0,0 +1,113 @@
+#include <alloca.h>
+#include <malloc.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+#include "MemoryManager.hpp"
+
+/*************************** PUBLIC FUNCTIONS *********************************/
+
+Error_t MemoryManager::lockAll (uint32_t kStackBytes, uint32_t kHeapBytes)
+{
+    // 1) Never trim the heap or serve allocations with mmap, so that memory
+    //    freed after this call stays locked and is reused. Use one arena so
+    //    that every thread allocates from the reserve prefaulted below.
+    if (mallopt (M_TRIM_THRESHOLD, -1) == 0 ||
+        mallopt (M_MMAP_MAX, 0) == 0 ||
+        mallopt (M_ARENA_MAX, 1) == 0)
+    {
+        return E_FAILED_TO_SET_MALLOC_OPT;
+    }
+
+    // 2) Lock current and future mappings. This faults in all memory mapped
+    //    so far.
+    if (mlockall (MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        return E_FAILED_TO_LOCK_MEMORY;
+    }
+
+    // 3) Prefault the calling thread's stack.
+    prefaultStack (kStackBytes);
+
+    // 4) Prefault the heap reserve. Since the heap is never trimmed, the
+    //    reserve remains mapped and locked after it is freed.
+    if (kHeapBytes > 0)
+    {
+        uint8_t* pReserve = (uint8_t*) malloc (kHeapBytes);
+        if (pReserve == nullptr)
+        {
+            return E_FAILED_TO_ALLOC_RESERVE;
+        }
+        prefault (pReserve, kHeapBytes, false);
+        free (pReserve);
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t MemoryManager::prefault (void* kPBuf, size_t kNumBytes,
+                                 bool kUseHugePages)
+{
+    if (kPBuf == nullptr)
+    {
+        return E_INVALID_POINTER;
+    }
+    if (kNumBytes == 0)
+    {
+        return E_SUCCESS;
+    }
+
+    // 1) Get the page-aligned range covering the buffer.
+    uintptr_t pageSize = sysconf (_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t) kPBuf & ~(pageSize - 1);
+    uintptr_t end = ((uintptr_t) kPBuf + kNumBytes + pageSize - 1) &
+                    ~(pageSize - 1);
+
+    // 2) Advise huge pages before faulting in the range.
+    if (kUseHugePages == true &&
+        madvise ((void*) start, end - start, MADV_HUGEPAGE) != 0)
+    {
+        return E_FAILED_TO_ADVISE_MEMORY;
+    }
+
+    // 3) Write to each page so that it is mapped writable. A read would map
+    //    the shared zero page and the first write would still fault.
+    volatile uint8_t* pBuf = (volatile uint8_t*) kPBuf;
+    for (size_t i = 0; i < kNumBytes;
+         i += pageSize - (((uintptr_t) &pBuf[i]) & (pageSize - 1)))
+    {
+        pBuf[i] = pBuf[i];
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t MemoryManager::getPageFaults (PageFaults_t& kFaultsRet)
+{
+    struct rusage usage;
+    if (getrusage (RUSAGE_SELF, &usage) != 0)
+    {
+        return E_FAILED_TO_GET_USAGE;
+    }
+
+    kFaultsRet.minor = usage.ru_minflt;
+    kFaultsRet.major = usage.ru_majflt;
+
+    return E_SUCCESS;
+}
+
+/**************************** PRIVATE FUNCTIONS *******************************/
+
+void MemoryManager::prefaultStack (uint32_t kNumBytes)
+{
+    // Write through a volatile pointer so that the writes are not optimized
+    // out even though the memory is never read.
+    volatile uint8_t* pStack = (volatile uint8_t*) alloca (kNumBytes);
+    uint32_t pageSize = sysconf (_SC_PAGESIZE);
+    for (uint32_t i = 0; i < kNumBytes; i += pageSize)
+    {
+        pStack[i] = 0;
+    }
+}
@@ -109,6 +109,91 @@ Error_t NetworkManager::send (Node_t kNode, std::vector<uint8_t>& kBuf)
     return E_SUCCESS;
 }
 
+Error_t NetworkManager::sendMult (std::vector<Node_t>& kNodes, 
+                                  std::vector<std::vector<uint8_t>>& kBufs)
+{
+    // 1) Verify vector inputs are the same size.
+    uint8_t numNodes = kNodes.size ();
+    if (numNodes != kBufs.size ())
+    {
+        return E_VECTORS_DIFF_SIZES;
+    }
+
+    // 2) Verify buffers and nodes and fill destination address info for each
+    //    node.
+    std::vector<NetworkManager::Channel_t> channels (numNodes);
+    std::vector<struct sockaddr_in> destAddrs (numNodes);
+    for (uint8_t i = 0; i < numNodes; i++)
+    {
+        // 2a) Verify buffer is not empty.
+        if (kBufs[i].size () == 0)
+        {
+            return E_EMPTY_BUFFER;
+        }
+
+        // 2b) Verify valid node and get channel information.
+        if (mNodeToChannel.find (kNodes[i]) == mNodeToChannel.end ())
+        {
+            return E_INVALID_NODE;
+        }
+        channels[i] = mNodeToChannel[kNodes[i]];
+
+        // 2c) Fill destination address info.
+        memset ((void*) (&destAddrs[i]), 0, sizeof (destAddrs[i]));
+        destAddrs[i].sin_family = AF_INET;
+        destAddrs[i].sin_port = htons (channels[i].toPort);
+        destAddrs[i].sin_addr.s_addr = htonl (channels[i].toIP);
+    }
+
+    // 3) Send messages with no flags (0) and verify full messages sent.
+    for (uint8_t i = 0; i < numNodes; i++)
+    {
+        int32_t numBytesSent = sendto (channels[i].socketFd, kBufs[i].data (), 
+                                       kBufs[i].size (), 0, 
+                                       (const struct sockaddr*) &destAddrs[i], 
+                                       sizeof (destAddrs[i]));
+        if (numBytesSent == -1)
+        {
+            return E_FAILED_TO_SEND_MSG;
+        }
+        else if (numBytesSent != (int32_t) kBufs[i].size ())
+        {
+            return E_UNEXPECTED_SEND_SIZE;
+        }
+    }
+
+    // 4) Send no-op msgs to destination nodes to ensure messages do not get 
+    //    stuck in rx queue. See send.
+    uint8_t noopMsg = 0xff;
+    for (uint8_t i = 0; i < numNodes; i++)
+    {
+        destAddrs[i].sin_port = NOOP_PORT;
+        int32_t numBytesSent = sendto (channels[i].socketFd, &noopMsg, 
+                                       sizeof (noopMsg), 0, 
+                                       (const struct sockaddr*) &destAddrs[i], 
+                                       sizeof (destAddrs[i]));
+        if (numBytesSent == -1)
+        {
+            return E_FAILED_TO_SEND_MSG;
+        }
+        else if (numBytesSent != (int32_t) sizeof (noopMsg))
+        {
+            return E_UNEXPECTED_SEND_SIZE;
+        }
+    }
+
+    // 5) Increment message sent counter once per message.
+    for (uint8_t i = 0; i < numNodes; i++)
+    {
+        if (mPDataVector->increment (mDvElemMsgTxCount) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_WRITE;
+        }
+    }
+
+    return E_SUCCESS;
+}
+
 Error_t NetworkManager::recvBlock (Node_t kNode, std::vector<uint8_t>& kBufRet)
 {
     // 1) Verify params.
@@ -222,7 +307,8 @@ Error_t NetworkManager::recvNoBlock (Node_t kNode,
 Error_t NetworkManager::recvMult (Time::TimeNs_t kTimeoutNs,
                                   std::vector<Node_t> kNodes,
                                   std::vector<std::vector<uint8_t>>& kBufsRet, 
-                                  std::vector<uint32_t>& kNumMsgsReceivedRet)
+                                  std::vector<uint32_t>& kNumMsgsReceivedRet,
+                                  bool kReturnOnAllReceived)
 {
     // 1) Verify vector inputs are the same size.
     uint8_t numNodes = kNodes.size ();
@@ -276,7 +362,9 @@ Error_t NetworkManager::recvMult (Time::TimeNs_t kTimeoutNs,
     timeout.tv_sec = kTimeoutNs / Time::NS_IN_S;
     timeout.tv_usec = (kTimeoutNs % Time::NS_IN_S) / Time::NS_IN_US;
 
-    // 6) Attempt to receive message from nodes until timeout expires.
+    // 6) Attempt to receive message from nodes until timeout expires or, if
+    //    kReturnOnAllReceived is set, until every node has reported.
+    uint8_t numNodesReceived = 0;
     while (timeout.tv_sec > 0 || timeout.tv_usec > 0)
     {
         // 6a) Call select on fd set. Select returns 0 if timeout expired, -1 if 
@@ -328,10 +416,21 @@ Error_t NetworkManager::recvMult (Time::TimeNs_t kTimeoutNs,
                     return E_DATA_VECTOR_WRITE;
                 }
 
-                // 6b iv) Increment msgs received count.
+                // 6b iv) Increment msgs received count. Track the number of 
+                //        nodes that have reported at least once.
+                if (kNumMsgsReceivedRet[i] == 0)
+                {
+                    numNodesReceived++;
+                }
                 kNumMsgsReceivedRet[i]++;
             }
         }
+
+        // 6c) Return early if every node has reported.
+        if (kReturnOnAllReceived == true && numNodesReceived == numNodes)
+        {
+            break;
+        }
     }
 
     return E_SUCCESS;
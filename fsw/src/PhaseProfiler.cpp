@@ -0,0 +1,234 @@
+#include <time.h>
+#include <algorithm>
+#include <limits>
+
+#include "PhaseProfiler.hpp"
+
+/******************************** CONSTANTS ***********************************/
+
+/**
+ * Index of the 99th percentile sample in a sorted window, i.e. the smallest
+ * sample greater than or equal to 99% of the window.
+ */
+static const uint32_t P99_IDX = 
+                              (PhaseProfiler::WINDOW_SIZE * 99 + 99) / 100 - 1;
+
+/*************************** PUBLIC FUNCTIONS *********************************/
+
+Error_t PhaseProfiler::createNew (Config_t& kConfig,
+                                  std::shared_ptr<DataVector> kPDv,
+                                  std::unique_ptr<PhaseProfiler>& kPPpRet)
+{
+    // 1) Verify DV not null.
+    if (kPDv == nullptr)
+    {
+        return E_DATA_VECTOR_NULL;
+    }
+
+    // 2) Verify number of phases.
+    if (kConfig.empty () == true)
+    {
+        return E_EMPTY_CONFIG;
+    }
+    if (kConfig.size () > std::numeric_limits<uint8_t>::max ())
+    {
+        return E_INVALID_PHASE;
+    }
+
+    // 3) Verify elements exist and are DV_T_UINT32.
+    for (PhaseConfig_t& phaseConfig : kConfig)
+    {
+        std::vector<DataVectorElement_t> elems =
+        {
+            phaseConfig.wallMinNs,
+            phaseConfig.wallMaxNs,
+            phaseConfig.wallP99Ns,
+            phaseConfig.cpuMinNs,
+            phaseConfig.cpuMaxNs,
+            phaseConfig.cpuP99Ns,
+        };
+        for (DataVectorElement_t elem : elems)
+        {
+            if (kPDv->elementExists (elem) != E_SUCCESS)
+            {
+                return E_INVALID_ELEM;
+            }
+
+            DataVectorElementType_t type = DV_T_LAST;
+            if (kPDv->getElementType (elem, type) != E_SUCCESS)
+            {
+                return E_DATA_VECTOR_READ;
+            }
+            if (type != DV_T_UINT32)
+            {
+                return E_INVALID_TYPE;
+            }
+        }
+    }
+
+    // 4) Create Phase Profiler.
+    kPPpRet.reset (new PhaseProfiler (kConfig, kPDv));
+
+    return E_SUCCESS;
+}
+
+Error_t PhaseProfiler::startPhase (uint8_t kPhase)
+{
+    // 1) Verify phase.
+    if (kPhase >= mStats.size ())
+    {
+        return E_INVALID_PHASE;
+    }
+
+    // 2) Record start times.
+    PhaseStats_t& stats = mStats[kPhase];
+    if (getTimes (stats.wallStartNs, stats.cpuStartNs) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+    stats.started = true;
+
+    return E_SUCCESS;
+}
+
+Error_t PhaseProfiler::endPhase (uint8_t kPhase)
+{
+    // 1) Read end times first so that the checks below are not measured.
+    Time::TimeNs_t wallEndNs = 0;
+    Time::TimeNs_t cpuEndNs = 0;
+    if (getTimes (wallEndNs, cpuEndNs) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+
+    // 2) Verify phase is valid and started.
+    if (kPhase >= mStats.size ())
+    {
+        return E_INVALID_PHASE;
+    }
+    PhaseStats_t& stats = mStats[kPhase];
+    if (stats.started == false)
+    {
+        return E_PHASE_NOT_STARTED;
+    }
+    stats.started = false;
+
+    // 3) Record sample.
+    return recordSample (kPhase, (uint32_t) (wallEndNs - stats.wallStartNs),
+                         (uint32_t) (cpuEndNs - stats.cpuStartNs));
+}
+
+Error_t PhaseProfiler::addSample (uint8_t kPhase, uint32_t kWallNs, 
+                                  uint32_t kCpuNs)
+{
+    // 1) Verify phase.
+    if (kPhase >= mStats.size ())
+    {
+        return E_INVALID_PHASE;
+    }
+
+    // 2) Record sample.
+    return recordSample (kPhase, kWallNs, kCpuNs);
+}
+
+Error_t PhaseProfiler::getTimes (Time::TimeNs_t& kWallNsRet,
+                                 Time::TimeNs_t& kCpuNsRet)
+{
+    struct timespec wall;
+    struct timespec cpu;
+    if (clock_gettime (CLOCK_MONOTONIC, &wall) != 0 ||
+        clock_gettime (CLOCK_THREAD_CPUTIME_ID, &cpu) != 0)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+
+    kWallNsRet = wall.tv_sec * Time::NS_IN_S + wall.tv_nsec;
+    kCpuNsRet  = cpu.tv_sec * Time::NS_IN_S + cpu.tv_nsec;
+
+    return E_SUCCESS;
+}
+
+/**************************** PRIVATE FUNCTIONS *******************************/
+
+PhaseProfiler::PhaseProfiler (Config_t& kConfig,
+                              std::shared_ptr<DataVector> kPDv) :
+    mPDv (kPDv),
+    mConfig (kConfig),
+    mStats (kConfig.size ()),
+    mScratchNs (WINDOW_SIZE, 0)
+{
+    // Allocate all windows up front so that no allocation occurs in the loop.
+    for (PhaseStats_t& stats : mStats)
+    {
+        stats.started             = false;
+        stats.wallStartNs         = 0;
+        stats.cpuStartNs          = 0;
+        stats.wallMinNs           = std::numeric_limits<uint32_t>::max ();
+        stats.wallMaxNs           = 0;
+        stats.cpuMinNs            = std::numeric_limits<uint32_t>::max ();
+        stats.cpuMaxNs            = 0;
+        stats.windowIdx           = 0;
+        stats.numWindowSamples    = 0;
+        stats.numUnwrittenSamples = 0;
+        stats.wallWindowNs.resize (WINDOW_SIZE, 0);
+        stats.cpuWindowNs.resize (WINDOW_SIZE, 0);
+    }
+}
+
+Error_t PhaseProfiler::recordSample (uint8_t kPhase, uint32_t kWallNs, 
+                                     uint32_t kCpuNs)
+{
+    PhaseStats_t& stats = mStats[kPhase];
+
+    // 1) Update min and max and record sample in window, overwriting the 
+    //    oldest sample once the window is full.
+    stats.wallMinNs = std::min (stats.wallMinNs, kWallNs);
+    stats.wallMaxNs = std::max (stats.wallMaxNs, kWallNs);
+    stats.cpuMinNs  = std::min (stats.cpuMinNs, kCpuNs);
+    stats.cpuMaxNs  = std::max (stats.cpuMaxNs, kCpuNs);
+    stats.wallWindowNs[stats.windowIdx] = kWallNs;
+    stats.cpuWindowNs[stats.windowIdx]  = kCpuNs;
+    stats.windowIdx = (stats.windowIdx + 1) % WINDOW_SIZE;
+    if (stats.numWindowSamples < WINDOW_SIZE)
+    {
+        stats.numWindowSamples++;
+    }
+    stats.numUnwrittenSamples++;
+
+    // 2) Once the window is full, write stats every WRITE_PERIOD samples.
+    if (stats.numWindowSamples == WINDOW_SIZE && 
+        stats.numUnwrittenSamples >= WRITE_PERIOD)
+    {
+        stats.numUnwrittenSamples = 0;
+        return writeStats (kPhase);
+    }
+
+    return E_SUCCESS;
+}
+
+uint32_t PhaseProfiler::calcP99 (std::vector<uint32_t>& kWindowNs)
+{
+    std::copy (kWindowNs.begin (), kWindowNs.end (), mScratchNs.begin ());
+    std::nth_element (mScratchNs.begin (), mScratchNs.begin () + P99_IDX,
+                      mScratchNs.end ());
+    return mScratchNs[P99_IDX];
+}
+
+Error_t PhaseProfiler::writeStats (uint8_t kPhase)
+{
+    PhaseConfig_t& config = mConfig[kPhase];
+    PhaseStats_t& stats = mStats[kPhase];
+    if (mPDv->write (config.wallMinNs, stats.wallMinNs) != E_SUCCESS ||
+        mPDv->write (config.wallMaxNs, stats.wallMaxNs) != E_SUCCESS ||
+        mPDv->write (config.wallP99Ns,
+                     calcP99 (stats.wallWindowNs))      != E_SUCCESS ||
+        mPDv->write (config.cpuMinNs, stats.cpuMinNs)   != E_SUCCESS ||
+        mPDv->write (config.cpuMaxNs, stats.cpuMaxNs)   != E_SUCCESS ||
+        mPDv->write (config.cpuP99Ns,
+                     calcP99 (stats.cpuWindowNs))       != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    return E_SUCCESS;
+}
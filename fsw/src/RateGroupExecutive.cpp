@@ -0,0 +1,218 @@
+#include <time.h>
+#include <algorithm>
+#include <limits>
+
+#include "RateGroupExecutive.hpp"
+
+/******************************** CONSTANTS ***********************************/
+
+const RateGroupExecutive::Rate_t RateGroupExecutive::RATE_EVERY_FRAME = {1, 0};
+
+/*************************** PUBLIC FUNCTIONS *********************************/
+
+Error_t RateGroupExecutive::createNew (
+                                const Config_t& kConfig,
+                                std::unique_ptr<RateGroupExecutive>& kPRgeRet)
+{
+    // 1) Verify rates.
+    for (const Rate_t& rate : kConfig)
+    {
+        if (rate.divisor == 0 ||
+            MINOR_FRAMES_PER_MAJOR_FRAME % rate.divisor != 0)
+        {
+            return E_INVALID_RATE;
+        }
+        if (rate.offset != OFFSET_AUTO && rate.offset >= rate.divisor)
+        {
+            return E_INVALID_OFFSET;
+        }
+    }
+
+    // 2) Assign offsets to OFFSET_AUTO tasks.
+    Config_t rates = kConfig;
+    assignOffsets (rates);
+
+    // 3) Create Rate Group Executive.
+    kPRgeRet.reset (new RateGroupExecutive (rates));
+
+    return E_SUCCESS;
+}
+
+void RateGroupExecutive::startFrame ()
+{
+    mFrame = (mFrame + 1) % MINOR_FRAMES_PER_MAJOR_FRAME;
+    std::fill (mGroupTimesNs.begin (), mGroupTimesNs.end (), 0);
+}
+
+bool RateGroupExecutive::isScheduled (uint32_t kTask) const
+{
+    if (kTask >= mRates.size ())
+    {
+        return false;
+    }
+
+    return mFrame % mRates[kTask].divisor == mRates[kTask].offset;
+}
+
+Error_t RateGroupExecutive::getRate (uint32_t kTask, Rate_t& kRateRet) const
+{
+    if (kTask >= mRates.size ())
+    {
+        return E_INVALID_TASK;
+    }
+
+    kRateRet = mRates[kTask];
+
+    return E_SUCCESS;
+}
+
+Error_t RateGroupExecutive::startTask (uint32_t kTask)
+{
+    if (kTask >= mRates.size ())
+    {
+        return E_INVALID_TASK;
+    }
+
+    return getTimeNs (mTaskStartNs);
+}
+
+Error_t RateGroupExecutive::endTask (uint32_t kTask)
+{
+    // 1) Read end time first so that the checks below are not measured.
+    Time::TimeNs_t endNs = 0;
+    if (getTimeNs (endNs) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+
+    // 2) Verify task.
+    if (kTask >= mRates.size ())
+    {
+        return E_INVALID_TASK;
+    }
+
+    // 3) Add task's time to its rate group.
+    mGroupTimesNs[mTaskGroups[kTask]] += endNs - mTaskStartNs;
+
+    return E_SUCCESS;
+}
+
+Error_t RateGroupExecutive::addTaskTime (uint32_t kTask, 
+                                         Time::TimeNs_t kTimeNs)
+{
+    if (kTask >= mRates.size ())
+    {
+        return E_INVALID_TASK;
+    }
+
+    mGroupTimesNs[mTaskGroups[kTask]] += kTimeNs;
+
+    return E_SUCCESS;
+}
+
+void RateGroupExecutive::getHeaviestRateGroup (uint8_t& kDivisorRet) const
+{
+    kDivisorRet = 0;
+    Time::TimeNs_t maxNs = 0;
+    for (uint8_t i = 0; i < mGroupTimesNs.size (); i++)
+    {
+        if (mGroupTimesNs[i] > maxNs)
+        {
+            maxNs = mGroupTimesNs[i];
+            kDivisorRet = mGroupDivisors[i];
+        }
+    }
+}
+
+/**************************** PRIVATE FUNCTIONS *******************************/
+
+RateGroupExecutive::RateGroupExecutive (const Config_t& kRates) :
+    mRates       (kRates),
+    mTaskGroups  (kRates.size (), 0),
+    mTaskStartNs (0),
+    mFrame       (MINOR_FRAMES_PER_MAJOR_FRAME - 1)
+{
+    // Create a rate group per unique divisor.
+    for (uint32_t i = 0; i < mRates.size (); i++)
+    {
+        std::vector<uint8_t>::iterator it = std::find (mGroupDivisors.begin (),
+                                                       mGroupDivisors.end (),
+                                                       mRates[i].divisor);
+        mTaskGroups[i] = it - mGroupDivisors.begin ();
+        if (it == mGroupDivisors.end ())
+        {
+            mGroupDivisors.push_back (mRates[i].divisor);
+        }
+    }
+    mGroupTimesNs.resize (mGroupDivisors.size (), 0);
+}
+
+void RateGroupExecutive::assignOffsets (Config_t& kRates)
+{
+    // 1) Count tasks with fixed offsets in each minor frame.
+    std::vector<uint32_t> frameLoads (MINOR_FRAMES_PER_MAJOR_FRAME, 0);
+    std::vector<uint32_t> autoTasks;
+    for (uint32_t i = 0; i < kRates.size (); i++)
+    {
+        if (kRates[i].offset == OFFSET_AUTO)
+        {
+            autoTasks.push_back (i);
+            continue;
+        }
+        for (uint8_t f = kRates[i].offset; f < MINOR_FRAMES_PER_MAJOR_FRAME;
+             f += kRates[i].divisor)
+        {
+            frameLoads[f]++;
+        }
+    }
+
+    // 2) Place OFFSET_AUTO tasks in ascending divisor order.
+    std::stable_sort (autoTasks.begin (), autoTasks.end (),
+                      [&kRates] (uint32_t kA, uint32_t kB)
+                      {
+                          return kRates[kA].divisor < kRates[kB].divisor;
+                      });
+    for (uint32_t task : autoTasks)
+    {
+        uint8_t divisor = kRates[task].divisor;
+
+        // 2a) Find the offset whose busiest minor frame is least busy.
+        uint8_t bestOffset = 0;
+        uint32_t bestMaxLoad = std::numeric_limits<uint32_t>::max ();
+        for (uint8_t offset = 0; offset < divisor; offset++)
+        {
+            uint32_t maxLoad = 0;
+            for (uint8_t f = offset; f < MINOR_FRAMES_PER_MAJOR_FRAME;
+                 f += divisor)
+            {
+                maxLoad = std::max (maxLoad, frameLoads[f]);
+            }
+            if (maxLoad < bestMaxLoad)
+            {
+                bestMaxLoad = maxLoad;
+                bestOffset = offset;
+            }
+        }
+
+        // 2b) Assign offset and add task to minor frame loads.
+        kRates[task].offset = bestOffset;
+        for (uint8_t f = bestOffset; f < MINOR_FRAMES_PER_MAJOR_FRAME;
+             f += divisor)
+        {
+            frameLoads[f]++;
+        }
+    }
+}
+
+Error_t RateGroupExecutive::getTimeNs (Time::TimeNs_t& kTimeNsRet)
+{
+    struct timespec ts;
+    if (clock_gettime (CLOCK_MONOTONIC, &ts) != 0)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+
+    kTimeNsRet = ts.tv_sec * Time::NS_IN_S + ts.tv_nsec;
+
+    return E_SUCCESS;
+}
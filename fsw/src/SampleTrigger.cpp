@@ -0,0 +1,129 @@
+#include "SampleTrigger.hpp"
+
+/*************************** PUBLIC FUNCTIONS *********************************/
+
+Error_t SampleTrigger::createNew (Config_t& kConfig,
+                                  NiFpga_Session& kSession,
+                                  std::shared_ptr<DataVector> kPDv,
+                                  std::unique_ptr<SampleTrigger>& kPStRet)
+{
+    // 1) Verify DV not null.
+    if (kPDv == nullptr)
+    {
+        return E_DATA_VECTOR_NULL;
+    }
+
+    // 2) Verify IRQs and timeout.
+    if (kConfig.irqs == 0 || kConfig.timeoutMs == 0)
+    {
+        return E_INVALID_CONFIG;
+    }
+
+    // 3) Verify elements exist and are the correct type.
+    uint64_t sampleTimeNs = 0;
+    uint32_t missCount = 0;
+    if (kPDv->read (kConfig.dvElemSampleTimeNs, sampleTimeNs) != E_SUCCESS ||
+        kPDv->read (kConfig.dvElemMissCount, missCount) != E_SUCCESS)
+    {
+        return E_INVALID_ELEM;
+    }
+
+    // 4) Get Time Module.
+    Time* pTime = nullptr;
+    Error_t ret = Time::getInstance (pTime);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 5) Reserve IRQ context.
+    NiFpga_IrqContext irqContext = nullptr;
+    NiFpga_Status status = NiFpga_Status_Success;
+    NiFpga_MergeStatus (&status, NiFpga_ReserveIrqContext (kSession,
+                                                           &irqContext));
+    if (status != NiFpga_Status_Success)
+    {
+        return E_FPGA_IRQ;
+    }
+
+    // 6) Create Sample Trigger.
+    kPStRet.reset (new SampleTrigger (kConfig, kSession, irqContext, kPDv,
+                                      pTime));
+
+    return E_SUCCESS;
+}
+
+SampleTrigger::~SampleTrigger ()
+{
+    NiFpga_UnreserveIrqContext (mSession, mIrqContext);
+}
+
+Error_t SampleTrigger::waitForTick (bool& kTickedRet)
+{
+    kTickedRet = false;
+
+    // 1) Acknowledge stale ticks. See note #1 in SampleTrigger.hpp.
+    NiFpga_Status status = NiFpga_Status_Success;
+    NiFpga_MergeStatus (&status, NiFpga_AcknowledgeIrqs (mSession, mIrqs));
+    if (status != NiFpga_Status_Success)
+    {
+        return E_FPGA_IRQ;
+    }
+
+    // 2) Wait for the next tick. Treat NiFpga_Status_IrqTimeout as a timeout
+    //    too, since the FPGA API defines it alongside timedOut.
+    uint32_t irqsAsserted = 0;
+    NiFpga_Bool timedOut = NiFpga_False;
+    status = NiFpga_WaitOnIrqs (mSession, mIrqContext, mIrqs, mTimeoutMs,
+                                &irqsAsserted, &timedOut);
+    if (status == NiFpga_Status_IrqTimeout)
+    {
+        timedOut = NiFpga_True;
+    }
+    else if (status != NiFpga_Status_Success)
+    {
+        return E_FPGA_IRQ;
+    }
+
+    // 3) On timeout, count the miss.
+    if (timedOut == NiFpga_True || (irqsAsserted & mIrqs) == 0)
+    {
+        if (mPDv->increment (mDvElemMissCount) != E_SUCCESS)
+        {
+            return E_DATA_VECTOR_WRITE;
+        }
+        return E_SUCCESS;
+    }
+
+    // 4) Otherwise record the tick's time. Its IRQs stay asserted until the
+    //    next call. See note #2 in SampleTrigger.hpp.
+    Time::TimeNs_t tickTimeNs = 0;
+    if (mPTime->getTimeNs (tickTimeNs) != E_SUCCESS)
+    {
+        return E_FAILED_TO_GET_TIME;
+    }
+    if (mPDv->write (mDvElemSampleTimeNs, (uint64_t) tickTimeNs)
+            != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+    kTickedRet = true;
+
+    return E_SUCCESS;
+}
+
+/**************************** PRIVATE FUNCTIONS *******************************/
+
+SampleTrigger::SampleTrigger (Config_t& kConfig,
+                              NiFpga_Session& kSession,
+                              NiFpga_IrqContext kIrqContext,
+                              std::shared_ptr<DataVector> kPDv,
+                              Time* kPTime) :
+    mSession            (kSession),
+    mIrqContext         (kIrqContext),
+    mIrqs               (kConfig.irqs),
+    mTimeoutMs          (kConfig.timeoutMs),
+    mDvElemSampleTimeNs (kConfig.dvElemSampleTimeNs),
+    mDvElemMissCount    (kConfig.dvElemMissCount),
+    mPDv                (kPDv),
+    mPTime              (kPTime) {}
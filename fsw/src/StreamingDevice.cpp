@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <string.h>
+
+#include "StreamingDevice.hpp"
+
+/****************************** PUBLIC MEMBERS ********************************/
+
+StreamingDevice::StreamingDevice (NiFpga_Session& kSession,
+                                  std::shared_ptr<DataVector> kPDataVector,
+                                  Config_t& kConfig,
+                                  Error_t& kRet) :
+    Device        (kSession, kPDataVector),
+    mNumDropped   (0),
+    mRecorderHead (0),
+    mRecorderTail (0)
+{
+    // Verify config.
+    kRet = this->verifyConfig (kConfig);
+    if (kRet != E_SUCCESS)
+    {
+        return;
+    }
+
+    mBlockSize = kConfig.blockSize;
+    mMaxBlocksPerRun = kConfig.fifoDepth / kConfig.blockSize;
+    mFxpTypeInfo = kConfig.fxpTypeInfo;
+    mDvElemOutputMean = kConfig.dvElemOutputMean;
+    mDvElemOutputMin = kConfig.dvElemOutputMin;
+    mDvElemOutputMax = kConfig.dvElemOutputMax;
+    mDvElemNumSamples = kConfig.dvElemNumSamples;
+    mDvElemNumDropped = kConfig.dvElemNumDropped;
+
+    // Preallocate the recorder ring so that run never allocates.
+    mRecorderRing.resize (kConfig.numRecorderBlocks * kConfig.blockSize);
+    mRecorderMask = kConfig.numRecorderBlocks - 1;
+
+    // Start the FIFO, reading the FPGA FIFO if no backend was provided.
+    mPFifo = kConfig.pFifo;
+    if (mPFifo == nullptr)
+    {
+        mPFifo.reset (new NiFpgaFifoBackend (mSession, kConfig.fifo));
+    }
+    kRet = mPFifo->start (kConfig.fifoDepth);
+}
+
+Error_t StreamingDevice::verifyConfig (Config_t& kConfig)
+{
+    // Check that DV output elems exist and are correct type.
+    float value = 0;
+    uint32_t count = 0;
+    if (mPDataVector->read (kConfig.dvElemOutputMean, value) != E_SUCCESS ||
+        mPDataVector->read (kConfig.dvElemOutputMin,  value) != E_SUCCESS ||
+        mPDataVector->read (kConfig.dvElemOutputMax,  value) != E_SUCCESS ||
+        mPDataVector->read (kConfig.dvElemNumSamples, count) != E_SUCCESS ||
+        mPDataVector->read (kConfig.dvElemNumDropped, count) != E_SUCCESS)
+    {
+        return E_INVALID_ELEM;
+    }
+
+    // Check that the FIFO holds a whole number of blocks.
+    if (kConfig.blockSize == 0 || kConfig.fifoDepth < kConfig.blockSize ||
+        kConfig.fifoDepth % kConfig.blockSize != 0)
+    {
+        return E_INCORRECT_SIZE;
+    }
+
+    // Check that the recorder ring size is a power of 2.
+    if (kConfig.numRecorderBlocks == 0 ||
+        (kConfig.numRecorderBlocks & (kConfig.numRecorderBlocks - 1)) != 0)
+    {
+        return E_INCORRECT_SIZE;
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t StreamingDevice::run ()
+{
+    // 1) Drain full blocks, aggregating each in place before releasing it.
+    float minVal = 0;
+    float maxVal = 0;
+    double sumVal = 0;
+    uint32_t numSamples = 0;
+    for (uint32_t i = 0; i < mMaxBlocksPerRun; i++)
+    {
+        const uint32_t* pBlock = nullptr;
+        bool acquired = false;
+        size_t numRemaining = 0;
+        if (mPFifo->acquire (mBlockSize, pBlock, acquired, numRemaining)
+                != E_SUCCESS)
+        {
+            return E_FPGA_FIFO;
+        }
+        if (acquired == false)
+        {
+            break;
+        }
+
+        if (numSamples == 0)
+        {
+            minVal = NiFpga_ConvertFromFxpToFloat (mFxpTypeInfo, pBlock[0]);
+            maxVal = minVal;
+        }
+        for (uint32_t j = 0; j < mBlockSize; j++)
+        {
+            float val = NiFpga_ConvertFromFxpToFloat (mFxpTypeInfo,
+                                                      pBlock[j]);
+            minVal = std::min (minVal, val);
+            maxVal = std::max (maxVal, val);
+            sumVal += val;
+        }
+        numSamples += mBlockSize;
+
+        this->queueBlock (pBlock);
+
+        if (mPFifo->release (mBlockSize) != E_SUCCESS)
+        {
+            return E_FPGA_FIFO;
+        }
+
+        if (numRemaining < mBlockSize)
+        {
+            break;
+        }
+    }
+
+    // 2) Write counts. Stats are only written if a block was drained.
+    if (mPDataVector->write (mDvElemNumSamples, numSamples) != E_SUCCESS ||
+        mPDataVector->write (mDvElemNumDropped, mNumDropped) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+    if (numSamples == 0)
+    {
+        return E_SUCCESS;
+    }
+
+    // 3) Write stats.
+    if (mPDataVector->write (mDvElemOutputMean,
+                             (float) (sumVal / numSamples)) != E_SUCCESS ||
+        mPDataVector->write (mDvElemOutputMin, minVal) != E_SUCCESS ||
+        mPDataVector->write (mDvElemOutputMax, maxVal) != E_SUCCESS)
+    {
+        return E_DATA_VECTOR_WRITE;
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t StreamingDevice::recordBlocks (std::ostream& kOut,
+                                       uint32_t& kNumBlocksRet)
+{
+    // Get the blocks queued since the last call. Only this thread writes the
+    // tail.
+    uint32_t tail = mRecorderTail.load (std::memory_order_relaxed);
+    uint32_t head = mRecorderHead.load (std::memory_order_acquire);
+
+    kNumBlocksRet = 0;
+    for (uint32_t i = tail; i != head; i++)
+    {
+        const uint32_t* pBlock =
+            &mRecorderRing[(i & mRecorderMask) * mBlockSize];
+        kOut.write (reinterpret_cast<const char*> (pBlock),
+                    mBlockSize * sizeof (uint32_t));
+        if (kOut.fail () == true)
+        {
+            return E_FAILED_TO_WRITE_FILE;
+        }
+
+        // Free the slot for run.
+        mRecorderTail.store (i + 1, std::memory_order_release);
+        kNumBlocksRet++;
+    }
+
+    return E_SUCCESS;
+}
+
+/****************************** PRIVATE MEMBERS *******************************/
+
+void StreamingDevice::queueBlock (const uint32_t* kPBlock)
+{
+    // Check for space. Only this thread writes the head.
+    uint32_t head = mRecorderHead.load (std::memory_order_relaxed);
+    if (head - mRecorderTail.load (std::memory_order_acquire) >
+            mRecorderMask)
+    {
+        mNumDropped++;
+        return;
+    }
+
+    // Copy the block into the ring, then publish it to recordBlocks.
+    memcpy (&mRecorderRing[(head & mRecorderMask) * mBlockSize], kPBlock,
+            mBlockSize * sizeof (uint32_t));
+    mRecorderHead.store (head + 1, std::memory_order_release);
+}
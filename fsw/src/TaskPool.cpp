@@ -0,0 +1,313 @@
+#include "TaskPool.hpp"
+
+/******************************** CONSTANTS ***********************************/
+
+/**
+ * Number of bits to shift a range's first index by when packing.
+ */
+static const uint8_t RANGE_FIRST_SHIFT = 32;
+
+/**
+ * Mask to extract a range's end index.
+ */
+static const uint64_t RANGE_END_MASK = 0xFFFFFFFF;
+
+/***************************** HELPER FUNCTIONS *******************************/
+
+/**
+ * Pack a range of task indices into a single word.
+ *
+ * @param   kFirst  First index in range.
+ * @param   kEnd    One past last index in range.
+ *
+ * @ret     Packed range.
+ */
+static inline uint64_t packRange (uint32_t kFirst, uint32_t kEnd)
+{
+    return ((uint64_t) kFirst << RANGE_FIRST_SHIFT) | kEnd;
+}
+
+/*************************** PUBLIC FUNCTIONS *********************************/
+
+Error_t TaskPool::createNew (const Config_t& kConfig,
+                             std::unique_ptr<TaskPool>& kPPoolRet)
+{
+    // 1) Verify number of workers.
+    if (kConfig.workerAffinities.size () > MAX_WORKERS)
+    {
+        return E_INVALID_NUM_WORKERS;
+    }
+
+    // 2) Create Task Pool.
+    Error_t ret = E_SUCCESS;
+    std::unique_ptr<TaskPool> pPool (
+                        new TaskPool (kConfig.workerAffinities.size (), ret));
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 3) Create workers. If a worker fails to start, the pool's destructor
+    //    stops the workers already started.
+    ThreadManager* pTm = nullptr;
+    ret = ThreadManager::getInstance (pTm);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+    for (uint8_t i = 0; i < kConfig.workerAffinities.size (); i++)
+    {
+        WorkerArgs_t args = {pPool.get (), (uint8_t) (i + 1)};
+        pthread_t worker;
+        ret = pTm->createThread (worker,
+                                 (ThreadManager::ThreadFunc_t) workerFunc,
+                                 &args, sizeof (args), kConfig.priority,
+                                 kConfig.workerAffinities[i]);
+        if (ret != E_SUCCESS)
+        {
+            return ret;
+        }
+        pPool->mWorkers.push_back (worker);
+    }
+
+    kPPoolRet = std::move (pPool);
+
+    return E_SUCCESS;
+}
+
+TaskPool::~TaskPool ()
+{
+    // 1) Tell workers to exit and wait for them. If the lock fails, workers 
+    //    cannot be woken, so do not wait on them.
+    if (mWorkers.empty () == false && pthread_mutex_lock (&mLock) == 0)
+    {
+        mShutdown = true;
+        pthread_cond_broadcast (&mBatchCond);
+        pthread_mutex_unlock (&mLock);
+
+        ThreadManager* pTm = nullptr;
+        if (ThreadManager::getInstance (pTm) == E_SUCCESS)
+        {
+            for (pthread_t& worker : mWorkers)
+            {
+                Error_t _threadRet = E_SUCCESS;
+                pTm->waitForThread (worker, _threadRet);
+            }
+        }
+    }
+
+    // 2) Destroy lock and condition variables.
+    pthread_cond_destroy (&mDoneCond);
+    pthread_cond_destroy (&mBatchCond);
+    pthread_mutex_destroy (&mLock);
+}
+
+Error_t TaskPool::run (std::vector<Task_t>& kTasks)
+{
+    if (kTasks.empty () == true)
+    {
+        return E_SUCCESS;
+    }
+
+    // 1) Split the batch into one range per participant and wake the workers.
+    //    Set the tasks before publishing the ranges so that any participant
+    //    that takes a task sees this batch's tasks.
+    uint32_t numTasks = kTasks.size ();
+    if (pthread_mutex_lock (&mLock) != 0)
+    {
+        return E_FAILED_TO_LOCK;
+    }
+    mPTasks = kTasks.data ();
+    mNumRemaining = numTasks;
+    for (uint8_t i = 0; i < mNumParticipants; i++)
+    {
+        mRanges[i] = packRange (numTasks * i / mNumParticipants,
+                                numTasks * (i + 1) / mNumParticipants);
+    }
+    mBatchId++;
+    if (pthread_cond_broadcast (&mBatchCond) != 0)
+    {
+        pthread_mutex_unlock (&mLock);
+        return E_FAILED_TO_SIGNAL_COND;
+    }
+    if (pthread_mutex_unlock (&mLock) != 0)
+    {
+        return E_FAILED_TO_UNLOCK;
+    }
+
+    // 2) Run tasks on this thread as participant 0.
+    Error_t ret = runTasks (0);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 3) Wait for tasks still running on the workers.
+    if (pthread_mutex_lock (&mLock) != 0)
+    {
+        return E_FAILED_TO_LOCK;
+    }
+    while (mNumRemaining > 0)
+    {
+        if (pthread_cond_wait (&mDoneCond, &mLock) != 0)
+        {
+            pthread_mutex_unlock (&mLock);
+            return E_FAILED_TO_WAIT_ON_COND;
+        }
+    }
+    if (pthread_mutex_unlock (&mLock) != 0)
+    {
+        return E_FAILED_TO_UNLOCK;
+    }
+
+    return E_SUCCESS;
+}
+
+/**************************** PRIVATE FUNCTIONS *******************************/
+
+TaskPool::TaskPool (uint8_t kNumWorkers, Error_t& kRet) :
+    mRanges          (new std::atomic<uint64_t>[kNumWorkers + 1]),
+    mNumParticipants (kNumWorkers + 1),
+    mPTasks          (nullptr),
+    mNumRemaining    (0),
+    mBatchId         (0),
+    mShutdown        (false)
+{
+    kRet = E_SUCCESS;
+    for (uint8_t i = 0; i < mNumParticipants; i++)
+    {
+        mRanges[i] = packRange (0, 0);
+    }
+
+    if (pthread_mutex_init (&mLock, nullptr) != 0)
+    {
+        kRet = E_FAILED_TO_INIT_LOCK;
+    }
+    else if (pthread_cond_init (&mBatchCond, nullptr) != 0 ||
+             pthread_cond_init (&mDoneCond, nullptr) != 0)
+    {
+        kRet = E_FAILED_TO_INIT_COND;
+    }
+}
+
+bool TaskPool::takeTask (uint8_t kParticipant, uint32_t& kTaskRet)
+{
+    std::atomic<uint64_t>& range = mRanges[kParticipant];
+    uint64_t curr = range;
+    while (true)
+    {
+        uint32_t first = curr >> RANGE_FIRST_SHIFT;
+        uint32_t end   = curr & RANGE_END_MASK;
+        if (first >= end)
+        {
+            return false;
+        }
+        if (range.compare_exchange_weak (curr, packRange (first, end - 1)))
+        {
+            kTaskRet = end - 1;
+            return true;
+        }
+    }
+}
+
+bool TaskPool::stealTask (uint8_t kParticipant, uint32_t& kTaskRet)
+{
+    std::atomic<uint64_t>& range = mRanges[kParticipant];
+    uint64_t curr = range;
+    while (true)
+    {
+        uint32_t first = curr >> RANGE_FIRST_SHIFT;
+        uint32_t end   = curr & RANGE_END_MASK;
+        if (first >= end)
+        {
+            return false;
+        }
+        if (range.compare_exchange_weak (curr, packRange (first + 1, end)))
+        {
+            kTaskRet = first;
+            return true;
+        }
+    }
+}
+
+Error_t TaskPool::runTasks (uint8_t kParticipant)
+{
+    uint32_t task = 0;
+    while (true)
+    {
+        // 1) Take a task from this participant's range. If empty, try to steal
+        //    one, starting with the next participant.
+        bool found = takeTask (kParticipant, task);
+        for (uint8_t i = 1; i < mNumParticipants && found == false; i++)
+        {
+            found = stealTask ((kParticipant + i) % mNumParticipants, task);
+        }
+        if (found == false)
+        {
+            return E_SUCCESS;
+        }
+
+        // 2) Run the task.
+        Task_t& t = mPTasks[task];
+        t.ret = t.func (t.pArg);
+
+        // 3) If this was the batch's last task, wake the caller.
+        if (mNumRemaining.fetch_sub (1) == 1)
+        {
+            if (pthread_mutex_lock (&mLock) != 0)
+            {
+                return E_FAILED_TO_LOCK;
+            }
+            if (pthread_cond_signal (&mDoneCond) != 0)
+            {
+                pthread_mutex_unlock (&mLock);
+                return E_FAILED_TO_SIGNAL_COND;
+            }
+            if (pthread_mutex_unlock (&mLock) != 0)
+            {
+                return E_FAILED_TO_UNLOCK;
+            }
+        }
+    }
+}
+
+void* TaskPool::workerFunc (void* kRawArgs)
+{
+    WorkerArgs_t* pArgs = (WorkerArgs_t*) kRawArgs;
+    TaskPool* pPool = pArgs->pPool;
+    uint8_t participant = pArgs->participant;
+    uint32_t lastBatchId = 0;
+    while (true)
+    {
+        // 1) Wait for a new batch or shutdown.
+        if (pthread_mutex_lock (&pPool->mLock) != 0)
+        {
+            return (void*) E_FAILED_TO_LOCK;
+        }
+        while (pPool->mBatchId == lastBatchId && pPool->mShutdown == false)
+        {
+            if (pthread_cond_wait (&pPool->mBatchCond, &pPool->mLock) != 0)
+            {
+                pthread_mutex_unlock (&pPool->mLock);
+                return (void*) E_FAILED_TO_WAIT_ON_COND;
+            }
+        }
+        bool shutdown = pPool->mShutdown;
+        lastBatchId = pPool->mBatchId;
+        if (pthread_mutex_unlock (&pPool->mLock) != 0)
+        {
+            return (void*) E_FAILED_TO_UNLOCK;
+        }
+        if (shutdown == true)
+        {
+            return (void*) E_SUCCESS;
+        }
+
+        // 2) Run tasks until the batch has none left to take.
+        Error_t ret = pPool->runTasks (participant);
+        if (ret != E_SUCCESS)
+        {
+            return (void*) ret;
+        }
+    }
+}
@@ -3,19 +3,20 @@
 #include <string>
 #include <fstream>
 #include <sched.h>
+#include <cstddef>
 #include <cstring>
-#include <sys/timerfd.h>
-#include <fcntl.h>
+#include <limits>
+#include <algorithm>
+#include <time.h>
+#include <errno.h>
 #include <unistd.h>
+#include <sstream>
+#include <sys/syscall.h>
 
 #include "ThreadManager.hpp"
 
 /******************************* CONSTANTS ************************************/
 
-const uint8_t ThreadManager::KSOFTIRQD_0_PID = 7;
-const uint8_t ThreadManager::KSOFTIRQD_1_PID = 22;
-const uint8_t ThreadManager::KTIMERSOFTD_0_PID = 8;
-const uint8_t ThreadManager::KTIMERSOFTD_1_PID = 21;
 const uint8_t ThreadManager::RCU_PRIORITY = 1;
 const uint8_t ThreadManager::HW_IRQ_PRIORITY = 15;
 const uint8_t ThreadManager::SW_IRQ_PRIORITY =
@@ -26,9 +27,186 @@ const uint8_t ThreadManager::MAX_NEW_THREAD_PRIORITY =
     ThreadManager::FSW_INIT_THREAD_PRIORITY - 1;
 const uint8_t ThreadManager::MIN_NEW_THREAD_PRIORITY = 
     ThreadManager::RCU_PRIORITY + 1;
+const ThreadManager::DeadlineParams_t ThreadManager::NO_DEADLINE = {0, 0};
+const uint32_t ThreadManager::HISTOGRAM_BUCKET_BOUNDS_NS[
+                                  ThreadManager::NUM_HISTOGRAM_BUCKETS - 1] =
+{
+    1   * Time::NS_IN_US,
+    2   * Time::NS_IN_US,
+    5   * Time::NS_IN_US,
+    10  * Time::NS_IN_US,
+    20  * Time::NS_IN_US,
+    50  * Time::NS_IN_US,
+    100 * Time::NS_IN_US,
+    200 * Time::NS_IN_US,
+    500 * Time::NS_IN_US,
+    1   * Time::NS_IN_MS,
+    2   * Time::NS_IN_MS,
+    5   * Time::NS_IN_MS,
+    10  * Time::NS_IN_MS,
+    20  * Time::NS_IN_MS,
+    50  * Time::NS_IN_MS,
+};
+
+/**
+ * Names of the per-CPU software IRQ kernel threads.
+ */
+static const std::string KSOFTIRQD_NAME   = "ksoftirqd";
+static const std::string KTIMERSOFTD_NAME = "ktimersoftd";
+
+/******************************** HELPERS *************************************/
+
+/**
+ * SCHED_DEADLINE policy and the sched_setattr argument struct. Not all libc
+ * versions provide them.
+ */
+#ifndef SCHED_DEADLINE
+#define SCHED_DEADLINE 6
+#endif
+
+typedef struct SchedAttr
+{
+    uint32_t size;
+    uint32_t schedPolicy;
+    uint64_t schedFlags;
+    int32_t  schedNice;
+    uint32_t schedPriority;
+    uint64_t schedRuntime;
+    uint64_t schedDeadline;
+    uint64_t schedPeriod;
+} SchedAttr_t;
+
+/**
+ * Switch the calling thread to SCHED_DEADLINE.
+ *
+ * @param   kRuntimeNs                  Runtime per period.
+ * @param   kDeadlineNs                 Relative deadline.
+ * @param   kPeriodNs                   Period.
+ *
+ * @ret     E_SUCCESS                   Thread switched to SCHED_DEADLINE.
+ *          E_DEADLINE_ADMISSION_FAILED Kernel rejected the reservation.
+ *          E_FAILED_TO_SET_DEADLINE    Failed to set SCHED_DEADLINE.
+ */
+static Error_t setSchedDeadline (Time::TimeNs_t kRuntimeNs, 
+                                 Time::TimeNs_t kDeadlineNs,
+                                 Time::TimeNs_t kPeriodNs)
+{
+    SchedAttr_t attr;
+    std::memset (&attr, 0, sizeof (attr));
+    attr.size          = sizeof (attr);
+    attr.schedPolicy   = SCHED_DEADLINE;
+    attr.schedRuntime  = kRuntimeNs;
+    attr.schedDeadline = kDeadlineNs;
+    attr.schedPeriod   = kPeriodNs;
+
+    if (syscall (SYS_sched_setattr, 0, &attr, 0) != 0)
+    {
+        return errno == EBUSY ? E_DEADLINE_ADMISSION_FAILED 
+                              : E_FAILED_TO_SET_DEADLINE;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Convert a CpuSet_t to a cpu_set_t.
+ *
+ * @param   kCpus       CPU set.
+ * @param   kCpuSetRet  cpu_set_t to fill.
+ */
+static void toCpuSet (const ThreadManager::CpuSet_t& kCpus, 
+                      cpu_set_t& kCpuSetRet)
+{
+    CPU_ZERO (&kCpuSetRet);
+    for (uint8_t cpu = 0; cpu < ThreadManager::MAX_CPUS; cpu++)
+    {
+        if (((kCpus.mask >> cpu) & 1) == 1)
+        {
+            CPU_SET (cpu, &kCpuSetRet);
+        }
+    }
+}
+
+/**
+ * Check that a CPU set is non-empty and only contains online CPUs.
+ *
+ * @param   kCpus   CPU set.
+ *
+ * @ret     true    CPU set valid.
+ *          false   CPU set invalid.
+ */
+static bool isValidCpuSet (const ThreadManager::CpuSet_t& kCpus)
+{
+    uint64_t onlineMask = ThreadManager::getOnlineCpus ().mask;
+    return kCpus.mask != 0 && (kCpus.mask & ~onlineMask) == 0;
+}
+
+/**
+ * Read the name and PID of every process from /proc/<pid>/comm. Processes 
+ * that exit while being read are skipped.
+ *
+ * @param   kProcsRet               PID and name of each process.
+ *
+ * @ret     E_SUCCESS               Processes read.
+ *          E_FAILED_TO_OPEN_FILE   Failed to open /proc.
+ */
+static Error_t readProcessNames (
+                        std::vector<std::pair<pid_t, std::string>>& kProcsRet)
+{
+    DIR* pProcDir = opendir ("/proc");
+    if (pProcDir == nullptr)
+    {
+        return E_FAILED_TO_OPEN_FILE;
+    }
+
+    kProcsRet.clear ();
+    struct dirent* pEntry = nullptr;
+    while ((pEntry = readdir (pProcDir)) != nullptr)
+    {
+        // Only numeric entries are processes.
+        char* pEnd = nullptr;
+        long pid = strtol (pEntry->d_name, &pEnd, 10);
+        if (pEnd == pEntry->d_name || *pEnd != '\0')
+        {
+            continue;
+        }
+
+        std::ifstream commFile ("/proc/" + std::string (pEntry->d_name) + 
+                                "/comm");
+        std::string name;
+        if (std::getline (commFile, name))
+        {
+            kProcsRet.push_back ({(pid_t) pid, name});
+        }
+    }
+    closedir (pProcDir);
+
+    return E_SUCCESS;
+}
+
 
 /*************************** PUBLIC FUNCTIONS *********************************/
 
+ThreadManager::CpuSet::CpuSet (Affinity_t kAffinity) :
+    mask (0)
+{
+    switch (kAffinity)
+    {
+        case CORE_0:
+            mask = 1;
+            break;
+        case CORE_1:
+            mask = 1 << 1;
+            break;
+        case ALL:
+            mask = getOnlineCpus ().mask;
+            break;
+        default:
+            mask = 0;
+            break;
+    }
+}
+
 Error_t ThreadManager::getInstance (ThreadManager*& kPThreadManagerRet)
 {
     // 1) Initialize the kernel scheduling environment.
@@ -55,179 +233,146 @@ Error_t ThreadManager::createThread (pthread_t& kThread,
                                      ThreadManager::ThreadFunc_t kFunc, 
                                      void* kPArgs, uint32_t kNumArgBytes,
                                      ThreadManager::Priority_t kPriority, 
-                                     ThreadManager::Affinity_t kCpuAffinity)
+                                     ThreadManager::CpuSet_t kCpuAffinity)
 {
-    // 1) Validate params. 
-    if (kFunc == nullptr)
-    {
-        return E_INVALID_POINTER;
-    } 
-    else if (kPriority < ThreadManager::MIN_NEW_THREAD_PRIORITY || 
-             kPriority > ThreadManager::MAX_NEW_THREAD_PRIORITY)
-    {
-        return E_INVALID_PRIORITY;
-    }
-    else if (kCpuAffinity >= ThreadManager::Affinity_t::LAST)
-    {
-        return E_INVALID_AFFINITY;
-    }
-    else if (kPArgs == nullptr && kNumArgBytes != 0)
-    {
-        return E_INVALID_ARGS_LENGTH;
-    }
+    return this->createThreadImpl (kThread, kFunc, kPArgs, kNumArgBytes, 
+                                   kPriority, kCpuAffinity, nullptr);
+}
 
-    // 2) Copy the passed in args to the heap.
-    void *pArgsCopy = nullptr;
-    if (kNumArgBytes > 0)
-    {
-        pArgsCopy = malloc (kNumArgBytes);
-        if (pArgsCopy == nullptr)
-        {
-            return E_FAILED_TO_ALLOCATE_ARGS;
-        }
-        std::memcpy (pArgsCopy, kPArgs, kNumArgBytes);
-    }
+Error_t ThreadManager::createPeriodicThread (
+                                     pthread_t& kThread, ThreadFunc_t kFunc,
+                                     void* kPArgs, uint32_t kNumArgBytes, 
+                                     Priority_t kPriority, 
+                                     CpuSet_t kCpuAffinity, 
+                                     uint32_t kPeriodMs,
+                                     ErrorHandler_t kErrorHandlerFunc,
+                                     DeadlineParams_t kDeadlineParams)
+{
+    return this->createPeriodicThreadNs (kThread, kFunc, kPArgs, kNumArgBytes,
+                                         kPriority, kCpuAffinity, 
+                                         kPeriodMs * Time::NS_IN_MS,
+                                         kErrorHandlerFunc, kDeadlineParams);
+}
 
-    // 3) Initialize the thread attribute struct.
-    pthread_attr_t attr;
-    if (pthread_attr_init (&attr) != 0)
+Error_t ThreadManager::createPeriodicThreadNs (
+                                     pthread_t& kThread, ThreadFunc_t kFunc,
+                                     void* kPArgs, uint32_t kNumArgBytes, 
+                                     Priority_t kPriority, 
+                                     CpuSet_t kCpuAffinity, 
+                                     Time::TimeNs_t kPeriodNs,
+                                     ErrorHandler_t kErrorHandlerFunc,
+                                     DeadlineParams_t kDeadlineParams)
+{
+    // 1) Validate args. The rest of the params will be validated in the 
+    //    createPeriodicThreadImpl call.
+    if (kPArgs == nullptr && kNumArgBytes != 0)
     {
-        return E_FAILED_TO_INIT_THREAD_ATR;
+        return E_INVALID_ARGS_LENGTH;
     }
 
-    // 4) Set thread scheduling policy to SCHED_FIFO. This means the thread will 
-    //    only stop executing if a thread with higher priority is ready. Threads 
-    //    with the same priority will not be scheduled until this thread is 
-    //    blocked or has finished.
-    if (pthread_attr_setschedpolicy (&attr, SCHED_FIFO) != 0)
-    {
-        return E_FAILED_TO_SET_SCHED_POL;
-    }
+    // 2) Construct the thread's state, which holds a copy of its metadata 
+    //    and args, and create the thread.
+    PeriodicMetadata_t metadata = {kPeriodNs, kFunc, nullptr, 
+                                   kErrorHandlerFunc, OVERRUN_POLICY_SKIP,
+                                   kDeadlineParams};
+    std::unique_ptr<PeriodicThread> pPeriodic (
+                        new PeriodicThread (metadata, kPArgs, kNumArgBytes));
+    return this->createPeriodicThreadImpl (kThread, &periodicWrapperFunc, 
+                                           std::move (pPeriodic), kPriority, 
+                                           kCpuAffinity);
+}
 
-    // 5) Set the thread priority.
-    struct sched_param param;
-    param.__sched_priority = kPriority;
-    if (pthread_attr_setschedparam (&attr, &param) != 0)
+Error_t ThreadManager::getPeriodicThreadStats (
+                                        const pthread_t& kThread,
+                                        PeriodicThreadStats_t& kStatsRet)
+{
+    AtomicPeriodicThreadStats_t* pStats = nullptr;
+    Error_t ret = this->findPeriodicThreadStats (kThread, pStats);
+    if (ret != E_SUCCESS)
     {
-        return E_FAILED_TO_SET_PRIORITY;
+        return ret;
     }
 
-    // 6) Set pthread to inherit sched params from attr instead of parent 
-    //     thread.
-    if (pthread_attr_setinheritsched (&attr, PTHREAD_EXPLICIT_SCHED) != 0)
-    {
-        return E_FAILED_TO_SET_SCHED_INH;
-    }
+    readHistogram (pStats->releaseJitter, kStatsRet.releaseJitter);
+    readHistogram (pStats->execution, kStatsRet.execution);
+    readHistogram (pStats->response, kStatsRet.response);
 
-    // 7) Create the thread.
-    if (pthread_create (&kThread, &attr, (void *(*)(void*)) kFunc, pArgsCopy) 
-            != 0)
-    {
-        return E_FAILED_TO_CREATE_THREAD;
-    }
+    return E_SUCCESS;
+}
 
-    // 8) Set the CPU affinity of the new thread.
-    cpu_set_t cpuset;
-    CPU_ZERO (&cpuset);
-    if (kCpuAffinity == ThreadManager::Affinity_t::CORE_0)
-    {
-        CPU_SET (0, &cpuset);
-    }
-    else if (kCpuAffinity == ThreadManager::Affinity_t::CORE_1)
-    {
-        CPU_SET (1, &cpuset);
-    }
-    else 
+Error_t ThreadManager::writePeriodicThreadStats (
+                                const pthread_t& kThread,
+                                std::shared_ptr<DataVector> kPDv,
+                                const PeriodicThreadStatsDvConfig_t& kConfig)
+{
+    // 1) Verify DV not null.
+    if (kPDv == nullptr)
     {
-        CPU_SET (0, &cpuset);
-        CPU_SET (1, &cpuset);
+        return E_DATA_VECTOR_NULL;
     }
 
-    if (pthread_setaffinity_np (kThread, sizeof (cpu_set_t), &cpuset) != 0)
+    // 2) Read stats.
+    PeriodicThreadStats_t stats;
+    Error_t ret = this->getPeriodicThreadStats (kThread, stats);
+    if (ret != E_SUCCESS)
     {
-        return E_FAILED_TO_SET_AFFINITY;
+        return ret;
     }
 
-    // 9) Destroy thread attr struct. POSIX requires this function always 
-    //    succeed, so don't check return. Additionally, if this does fail, the 
-    //    consequence is a small amount of leaked memory, so if for some reason 
-    //    it does fail, tolerate this error by ignoring it.
-    pthread_attr_destroy (&attr);
-
-    // 10) Allocate a thread struct to keep track of thread and insert it at the
-    //     front of mThreadList.
-    struct Thread *pNewThread = (struct Thread *) 
-                                malloc (sizeof (struct Thread));
-    if (pNewThread == nullptr)
+    // 3) Write max and p99 of each histogram.
+    if (kPDv->write (kConfig.releaseJitterMaxNs, 
+                     stats.releaseJitter.maxNs)                != E_SUCCESS ||
+        kPDv->write (kConfig.releaseJitterP99Ns, 
+                     calcHistogramP99Ns (stats.releaseJitter)) != E_SUCCESS ||
+        kPDv->write (kConfig.executionMaxNs, 
+                     stats.execution.maxNs)                    != E_SUCCESS ||
+        kPDv->write (kConfig.executionP99Ns, 
+                     calcHistogramP99Ns (stats.execution))     != E_SUCCESS ||
+        kPDv->write (kConfig.responseMaxNs, 
+                     stats.response.maxNs)                     != E_SUCCESS ||
+        kPDv->write (kConfig.responseP99Ns, 
+                     calcHistogramP99Ns (stats.response))      != E_SUCCESS)
     {
-        return E_FAILED_TO_ALLOCATE_THREAD;
+        return E_DATA_VECTOR_WRITE;
     }
-    pNewThread->thread = kThread;
-    pNewThread->pArgs  = pArgsCopy;
-    pNewThread->next   = mThreadList;
-    mThreadList        = pNewThread;
 
     return E_SUCCESS;
 }
 
-Error_t ThreadManager::createPeriodicThread (
-                                     pthread_t& kThread, ThreadFunc_t kFunc,
-                                     void* kPArgs, uint32_t kNumArgBytes, 
-                                     Priority_t kPriority, 
-                                     Affinity_t kCpuAffinity, 
-                                     uint32_t kPeriodMs,
-                                     ErrorHandler_t kErrorHandlerFunc)
+uint32_t ThreadManager::calcHistogramP99Ns (const Histogram_t& kHistogram)
 {
-    // 1) Validate function ptrs and args. The rest of the params will be 
-    //    validated in the createThread call.
-    if (kFunc == nullptr || kErrorHandlerFunc == nullptr)
+    // 1) Sum counts instead of using numSamples, since the snapshot may not 
+    //    be consistent.
+    uint64_t numSamples = 0;
+    for (uint8_t i = 0; i < NUM_HISTOGRAM_BUCKETS; i++)
     {
-        return E_INVALID_POINTER;
-    } 
-    else if (kPArgs == nullptr && kNumArgBytes != 0)
+        numSamples += kHistogram.counts[i];
+    }
+    if (numSamples == 0)
     {
-        return E_INVALID_ARGS_LENGTH;
+        return 0;
     }
 
-    // 2) Copy args to a buffer with metadata at the beginning for use in the
-    //    wrappe. The original user-provided arguments will be passed to kFunc.
-    uint32_t numMetadataBytes = sizeof (kPeriodMs) + sizeof (kFunc) +
-                                sizeof (kErrorHandlerFunc);
-    uint32_t argsBufferSizeBytes = kNumArgBytes + numMetadataBytes;
-    uint8_t argsBuffer[argsBufferSizeBytes];
-
-    // 3) Store kPeriodMs in the buffer.
-    argsBuffer[3] = (kPeriodMs >> 24) & 0xFF;
-    argsBuffer[2] = (kPeriodMs >> 16) & 0xFF;
-    argsBuffer[1] = (kPeriodMs >> 8)  & 0xFF;
-    argsBuffer[0] =  kPeriodMs        & 0xFF;
-
-    // 4) Store kFunc in the buffer.
-    argsBuffer[7] = ((uint32_t) kFunc >> 24) & 0xFF;
-    argsBuffer[6] = ((uint32_t) kFunc >> 16) & 0xFF;
-    argsBuffer[5] = ((uint32_t) kFunc >> 8)  & 0xFF;
-    argsBuffer[4] =  (uint32_t) kFunc        & 0xFF;
-
-    // 5) Store kErrorHandlerFunc in the buffer.
-    argsBuffer[11] = ((uint32_t) kErrorHandlerFunc >> 24) & 0xFF;
-    argsBuffer[10] = ((uint32_t) kErrorHandlerFunc >> 16) & 0xFF;
-    argsBuffer[9]  = ((uint32_t) kErrorHandlerFunc >> 8)  & 0xFF;
-    argsBuffer[8]  =  (uint32_t) kErrorHandlerFunc        & 0xFF;
-
-    // 6) Copy the kFunc args to the rest of the buffer.
-    if (kNumArgBytes > 0)
+    // 2) Find the bucket containing the 99th percentile sample.
+    uint64_t p99Rank = (numSamples * 99 + 99) / 100;
+    uint64_t cumulative = 0;
+    uint8_t bucket = 0;
+    for (; bucket < NUM_HISTOGRAM_BUCKETS - 1; bucket++)
     {
-        std::memcpy (argsBuffer + numMetadataBytes, kPArgs, kNumArgBytes);
+        cumulative += kHistogram.counts[bucket];
+        if (cumulative >= p99Rank)
+        {
+            break;
+        }
     }
 
-    // 7) Create wrapper thread, which will call kFunc.
-    ThreadManager::ThreadFunc_t periodicWrapperFunc = 
-        (ThreadManager::ThreadFunc_t) &ThreadManager::periodicWrapperFunc;
-    Error_t ret = this->createThread (kThread, periodicWrapperFunc, argsBuffer,
-                                      argsBufferSizeBytes, kPriority, 
-                                      kCpuAffinity);
-
-    return ret;
+    // 3) The last bucket has no upper bound, so use the max. Otherwise use 
+    //    the bucket's upper bound, bounded by the max.
+    if (bucket == NUM_HISTOGRAM_BUCKETS - 1)
+    {
+        return kHistogram.maxNs;
+    }
+    return std::min (HISTOGRAM_BUCKET_BOUNDS_NS[bucket], kHistogram.maxNs);
 }
 
 
@@ -266,8 +411,9 @@ Error_t ThreadManager::waitForThread (pthread_t& kThread,
                 prev->next = curr->next;
             }
 
-            // Free args and thread struct. 
+            // Free args, periodic state, and thread struct. 
             free (curr->pArgs);
+            delete curr->pPeriodic;
             free (curr);
 
             // Thread found and freed, break out of loop.
@@ -290,7 +436,206 @@ Error_t ThreadManager::waitForThread (pthread_t& kThread,
     return E_SUCCESS;
 } 
 
-Error_t ThreadManager::verifyProcess (const uint8_t kPid, 
+uint8_t ThreadManager::getNumCpus ()
+{
+    long numCpus = sysconf (_SC_NPROCESSORS_ONLN);
+    if (numCpus < 1)
+    {
+        return 1;
+    }
+
+    return std::min (numCpus, (long) MAX_CPUS);
+}
+
+ThreadManager::CpuSet_t ThreadManager::getOnlineCpus ()
+{
+    // 1) Read the online CPU list. If it cannot be read, fall back to the 
+    //    first getNumCpus () CPUs.
+    std::ifstream onlineFile ("/sys/devices/system/cpu/online");
+    std::string list;
+    if (std::getline (onlineFile, list).fail () == true)
+    {
+        uint8_t numCpus = getNumCpus ();
+        return CpuSet_t (numCpus == MAX_CPUS ? 
+                             std::numeric_limits<uint64_t>::max () :
+                             ((uint64_t) 1 << numCpus) - 1);
+    }
+
+    // 2) The list is a comma-separated list of CPUs and inclusive ranges of
+    //    CPUs, e.g. "0-3,6". Add each to the set.
+    CpuSet_t cpus;
+    std::stringstream ranges (list);
+    std::string range;
+    while (std::getline (ranges, range, ','))
+    {
+        char* pEnd = nullptr;
+        unsigned long first = strtoul (range.c_str (), &pEnd, 10);
+        unsigned long last = *pEnd == '-' ? strtoul (pEnd + 1, nullptr, 10)
+                                          : first;
+        for (unsigned long cpu = first; cpu <= last && cpu < MAX_CPUS; cpu++)
+        {
+            cpus.mask |= (uint64_t) 1 << cpu;
+        }
+    }
+
+    return cpus;
+}
+
+Error_t ThreadManager::steerIrqs (const std::string& kDevName, 
+                                  CpuSet_t kCpus)
+{
+    // 1) Verify CPU set.
+    if (isValidCpuSet (kCpus) == false)
+    {
+        return E_INVALID_AFFINITY;
+    }
+
+    // 2) Find device's IRQs.
+    std::vector<uint32_t> irqs;
+    Error_t ret = findIrqs (kDevName, irqs);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+    if (irqs.empty () == true)
+    {
+        return E_IRQ_NOT_FOUND;
+    }
+
+    // 3) Build CPU list in the format used by smp_affinity_list, e.g. "0,2".
+    std::string cpuList;
+    for (uint8_t cpu = 0; cpu < MAX_CPUS; cpu++)
+    {
+        if (((kCpus.mask >> cpu) & 1) == 1)
+        {
+            cpuList += (cpuList.empty () ? "" : ",") + std::to_string (cpu);
+        }
+    }
+
+    // 4) Set each IRQ's affinity.
+    for (uint32_t irq : irqs)
+    {
+        std::ofstream affinityFile ("/proc/irq/" + std::to_string (irq) + 
+                                    "/smp_affinity_list");
+        if (affinityFile.is_open () == false)
+        {
+            return E_FAILED_TO_OPEN_FILE;
+        }
+        affinityFile << cpuList;
+        affinityFile.close ();
+        if (affinityFile.fail () == true)
+        {
+            return E_FAILED_TO_WRITE_FILE;
+        }
+    }
+
+    // 5) Set each IRQ thread's affinity. The kernel also moves IRQ threads to
+    //    follow their IRQ's affinity, but only when the IRQ next fires.
+    std::vector<std::pair<pid_t, std::string>> procs;
+    ret = readProcessNames (procs);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+    cpu_set_t cpuset;
+    toCpuSet (kCpus, cpuset);
+    for (uint32_t irq : irqs)
+    {
+        std::string prefix = "irq/" + std::to_string (irq) + "-";
+        for (std::pair<pid_t, std::string>& proc : procs)
+        {
+            if (proc.second.compare (0, prefix.size (), prefix) == 0 &&
+                sched_setaffinity (proc.first, sizeof (cpuset), &cpuset) != 0)
+            {
+                return E_FAILED_TO_SET_AFFINITY;
+            }
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t ThreadManager::findKernelThreads (
+                                    const std::string& kName,
+                                    std::vector<KernelThread_t>& kThreadsRet)
+{
+    std::vector<std::pair<pid_t, std::string>> procs;
+    Error_t ret = readProcessNames (procs);
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // Keep processes named <kName>/<cpu>.
+    kThreadsRet.clear ();
+    std::string prefix = kName + "/";
+    for (std::pair<pid_t, std::string>& proc : procs)
+    {
+        if (proc.second.compare (0, prefix.size (), prefix) != 0)
+        {
+            continue;
+        }
+        const char* pCpu = proc.second.c_str () + prefix.size ();
+        char* pEnd = nullptr;
+        long cpu = strtol (pCpu, &pEnd, 10);
+        if (pEnd == pCpu || *pEnd != '\0' || cpu < 0 || cpu >= MAX_CPUS)
+        {
+            continue;
+        }
+        kThreadsRet.push_back ({proc.first, (uint8_t) cpu});
+    }
+    std::sort (kThreadsRet.begin (), kThreadsRet.end (),
+               [] (const KernelThread_t& kA, const KernelThread_t& kB)
+               {
+                   return kA.pid < kB.pid;
+               });
+
+    return E_SUCCESS;
+}
+
+Error_t ThreadManager::findIrqs (const std::string& kDevName,
+                                 std::vector<uint32_t>& kIrqsRet)
+{
+    std::ifstream interruptsFile ("/proc/interrupts");
+    if (interruptsFile.is_open () == false)
+    {
+        return E_FAILED_TO_OPEN_FILE;
+    }
+
+    // Each IRQ line is "<irq>: <per-CPU counts> <controller info> <devices>",
+    // where devices is a comma-separated list. Skip lines for non-numeric 
+    // IRQs (e.g. "NMI:") and the header line.
+    kIrqsRet.clear ();
+    std::string line;
+    while (std::getline (interruptsFile, line))
+    {
+        char* pEnd = nullptr;
+        unsigned long irq = strtoul (line.c_str (), &pEnd, 10);
+        if (pEnd == line.c_str () || *pEnd != ':')
+        {
+            continue;
+        }
+
+        std::stringstream words (line);
+        std::string word;
+        while (words >> word)
+        {
+            if (word.back () == ',')
+            {
+                word.pop_back ();
+            }
+            if (word == kDevName)
+            {
+                kIrqsRet.push_back (irq);
+                break;
+            }
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+Error_t ThreadManager::verifyProcess (const pid_t kPid, 
                                       const std::string kExpectedName, 
                                       bool& kVerifiedRet)
 {
@@ -336,7 +681,7 @@ Error_t ThreadManager::verifyProcess (const uint8_t kPid,
     return E_SUCCESS;
 }
 
-Error_t ThreadManager::setKernelProcessPriority (const uint8_t kPid, 
+Error_t ThreadManager::setKernelProcessPriority (const pid_t kPid, 
                                                  const uint8_t kPriority)
 {
     // Only allow priorities between min and max SCHED_FIFO priorities.    
@@ -393,173 +738,391 @@ Error_t ThreadManager::initKernelSchedulingEnvironment ()
         return E_FAILED_TO_SET_AFFINITY;
     }
 
-    // 3) Verify that the hardcoded sw irq PID's map to the correct processes.
-    const std::string EXPECTED_KSOFTIRQD_0_NAME = "ksoftirqd/0";
-    const std::string EXPECTED_KSOFTIRQD_1_NAME = "ksoftirqd/1";
-    const std::string EXPECTED_KTIMERSOFTD_0_NAME = "ktimersoftd/0";
-    const std::string EXPECTED_KTIMERSOFTD_1_NAME = "ktimersoftd/1";
-
-    bool verified = false;
-    Error_t ret = ThreadManager::verifyProcess (KSOFTIRQD_0_PID, 
-                                                EXPECTED_KSOFTIRQD_0_NAME, 
-                                                verified);
-    if (ret != E_SUCCESS || verified == false)
+    // 3) Find the sw irq threads and verify there is a ksoftirqd thread for
+    //    each online CPU. ktimersoftd threads only exist on some RT kernels, 
+    //    but if there are any, verify there is one for each online CPU.
+    std::vector<KernelThread_t> ksoftirqds;
+    std::vector<KernelThread_t> ktimersoftds;
+    if (findKernelThreads (KSOFTIRQD_NAME, ksoftirqds) != E_SUCCESS ||
+        findKernelThreads (KTIMERSOFTD_NAME, ktimersoftds) != E_SUCCESS)
     {
         return E_FAILED_TO_VERIFY_PROCESS;
     }
-
-    ret = ThreadManager::verifyProcess (KSOFTIRQD_1_PID, 
-                                        EXPECTED_KSOFTIRQD_1_NAME, 
-                                        verified);
-    if (ret != E_SUCCESS || verified == false)
+    uint8_t numCpus = getNumCpus ();
+    if (ksoftirqds.size () < numCpus ||
+        (ktimersoftds.empty () == false && ktimersoftds.size () < numCpus))
     {
         return E_FAILED_TO_VERIFY_PROCESS;
     }
 
-    ret = ThreadManager::verifyProcess (KTIMERSOFTD_0_PID, 
-                                        EXPECTED_KTIMERSOFTD_0_NAME, 
-                                        verified);
-    if (ret != E_SUCCESS || verified == false)
+    // 4) Set the priorities of the sw irq threads.
+    ksoftirqds.insert (ksoftirqds.end (), ktimersoftds.begin (), 
+                       ktimersoftds.end ());
+    for (KernelThread_t& kthread : ksoftirqds)
     {
-        return E_FAILED_TO_VERIFY_PROCESS;
+        if (setKernelProcessPriority (kthread.pid, SW_IRQ_PRIORITY) 
+                != E_SUCCESS)
+        {
+            return E_FAILED_TO_SET_PRIORITY;
+        }
     }
 
-    ret = ThreadManager::verifyProcess (KTIMERSOFTD_1_PID, 
-                                        EXPECTED_KTIMERSOFTD_1_NAME, 
-                                        verified);
-    if (ret != E_SUCCESS || verified == false)
+    return E_SUCCESS;
+}
+
+void ThreadManager::recordSample (AtomicHistogram_t& kHistogram, uint32_t kNs)
+{
+    uint8_t bucket = 0;
+    while (bucket < NUM_HISTOGRAM_BUCKETS - 1 && 
+           kNs >= HISTOGRAM_BUCKET_BOUNDS_NS[bucket])
     {
-        return E_FAILED_TO_VERIFY_PROCESS;
+        bucket++;
     }
 
-    // 4) Set the priorities of the sw irq threads.
-    ret = ThreadManager::setKernelProcessPriority (
-                                             ThreadManager::KSOFTIRQD_0_PID, 
-                                             ThreadManager::SW_IRQ_PRIORITY);
-    if (ret != E_SUCCESS)
+    // Single writer, so load and store do not need to be a single atomic op.
+    std::atomic<uint32_t>& count = kHistogram.counts[bucket];
+    count.store (count.load (std::memory_order_relaxed) + 1, 
+                 std::memory_order_relaxed);
+    if (kNs > kHistogram.maxNs.load (std::memory_order_relaxed))
     {
-        return E_FAILED_TO_SET_PRIORITY;
+        kHistogram.maxNs.store (kNs, std::memory_order_relaxed);
     }
-    ret = ThreadManager::setKernelProcessPriority (
-                                             ThreadManager::KSOFTIRQD_1_PID, 
-                                             ThreadManager::SW_IRQ_PRIORITY);
-    if (ret != E_SUCCESS)
+    kHistogram.numSamples.store (
+        kHistogram.numSamples.load (std::memory_order_relaxed) + 1, 
+        std::memory_order_relaxed);
+}
+
+void ThreadManager::readHistogram (const AtomicHistogram_t& kHistogram,
+                                   Histogram_t& kHistogramRet)
+{
+    for (uint8_t i = 0; i < NUM_HISTOGRAM_BUCKETS; i++)
     {
-        return E_FAILED_TO_SET_PRIORITY;
+        kHistogramRet.counts[i] = 
+            kHistogram.counts[i].load (std::memory_order_relaxed);
     }
-    ret = ThreadManager::setKernelProcessPriority (
-                                             ThreadManager::KTIMERSOFTD_0_PID, 
-                                             ThreadManager::SW_IRQ_PRIORITY);
-    if (ret != E_SUCCESS)
+    kHistogramRet.maxNs = kHistogram.maxNs.load (std::memory_order_relaxed);
+    kHistogramRet.numSamples = 
+        kHistogram.numSamples.load (std::memory_order_relaxed);
+}
+
+Error_t ThreadManager::findPeriodicThreadStats (
+                                const pthread_t& kThread,
+                                AtomicPeriodicThreadStats_t*& kPStatsRet)
+{
+    for (struct Thread *curr = mThreadList; curr != nullptr; curr = curr->next)
     {
-        return E_FAILED_TO_SET_PRIORITY;
+        if (pthread_equal (curr->thread, kThread) != 0)
+        {
+            if (curr->pPeriodic == nullptr)
+            {
+                return E_NOT_PERIODIC_THREAD;
+            }
+            kPStatsRet = &curr->pPeriodic->stats;
+            return E_SUCCESS;
+        }
     }
-    ret = ThreadManager::setKernelProcessPriority (
-                                             ThreadManager::KTIMERSOFTD_1_PID, 
-                                             ThreadManager::SW_IRQ_PRIORITY);
-    if (ret != E_SUCCESS)
+
+    return E_THREAD_NOT_FOUND;
+}
+
+Error_t ThreadManager::createThreadImpl (
+                                    pthread_t& kThread,
+                                    ThreadFunc_t kFunc,
+                                    void* kPArgs, uint32_t kNumArgBytes,
+                                    Priority_t kPriority,
+                                    CpuSet_t kCpuAffinity,
+                                    std::unique_ptr<PeriodicThread> kPPeriodic)
+{
+    // 1) Validate params.
+    if (kFunc == nullptr)
+    {
+        return E_INVALID_POINTER;
+    }
+    else if (kPriority < ThreadManager::MIN_NEW_THREAD_PRIORITY ||
+             kPriority > ThreadManager::MAX_NEW_THREAD_PRIORITY)
+    {
+        return E_INVALID_PRIORITY;
+    }
+    else if (isValidCpuSet (kCpuAffinity) == false)
+    {
+        return E_INVALID_AFFINITY;
+    }
+    else if (kPArgs == nullptr && kNumArgBytes != 0)
+    {
+        return E_INVALID_ARGS_LENGTH;
+    }
+
+    // 2) Copy the passed in args to the heap.
+    void *pArgsCopy = nullptr;
+    if (kNumArgBytes > 0)
+    {
+        pArgsCopy = malloc (kNumArgBytes);
+        if (pArgsCopy == nullptr)
+        {
+            return E_FAILED_TO_ALLOCATE_ARGS;
+        }
+        std::memcpy (pArgsCopy, kPArgs, kNumArgBytes);
+    }
+
+    // 3) Initialize the thread attribute struct.
+    pthread_attr_t attr;
+    if (pthread_attr_init (&attr) != 0)
+    {
+        return E_FAILED_TO_INIT_THREAD_ATR;
+    }
+
+    // 4) Set thread scheduling policy to SCHED_FIFO. This means the thread will
+    //    only stop executing if a thread with higher priority is ready. Threads
+    //    with the same priority will not be scheduled until this thread is
+    //    blocked or has finished.
+    if (pthread_attr_setschedpolicy (&attr, SCHED_FIFO) != 0)
+    {
+        return E_FAILED_TO_SET_SCHED_POL;
+    }
+
+    // 5) Set the thread priority.
+    struct sched_param param;
+    param.__sched_priority = kPriority;
+    if (pthread_attr_setschedparam (&attr, &param) != 0)
     {
         return E_FAILED_TO_SET_PRIORITY;
     }
 
-    return E_SUCCESS;
-}
+    // 6) Set pthread to inherit sched params from attr instead of parent
+    //     thread.
+    if (pthread_attr_setinheritsched (&attr, PTHREAD_EXPLICIT_SCHED) != 0)
+    {
+        return E_FAILED_TO_SET_SCHED_INH;
+    }
 
-void* ThreadManager::periodicWrapperFunc (void* kRawArgs)
-{
-    // 1) Get metadata from argsBuffer.
-    uint8_t metadataIdx = 0;
-    uint32_t *argsBuffer = (uint32_t *) kRawArgs;
-    uint32_t periodMs = argsBuffer[metadataIdx++];
-    ThreadManager::ThreadFunc_t pFunc = 
-        (ThreadManager::ThreadFunc_t) argsBuffer[metadataIdx++];
-    ThreadManager::ErrorHandler_t pErrorHandlerFunc = 
-        (ThreadManager::ErrorHandler_t) argsBuffer[metadataIdx++];
+    // 7) Allocate a thread struct to keep track of the thread. Fill it before
+    //    the thread is created so that the periodic state it points to, if
+    //    any, is published to the thread by pthread_create.
+    struct Thread *pNewThread = (struct Thread *)
+                                malloc (sizeof (struct Thread));
+    if (pNewThread == nullptr)
+    {
+        return E_FAILED_TO_ALLOCATE_THREAD;
+    }
+    pNewThread->pArgs     = pArgsCopy;
+    pNewThread->pPeriodic = kPPeriodic.get ();
+
+    // 8) Create the thread. A periodic thread is passed its state instead of
+    //    a copy of the args.
+    void* pThreadArgs = kPPeriodic != nullptr ? (void*) kPPeriodic.get ()
+                                              : pArgsCopy;
+    if (pthread_create (&kThread, &attr, (void *(*)(void*)) kFunc,
+                        pThreadArgs) != 0)
+    {
+        free (pNewThread);
+        return E_FAILED_TO_CREATE_THREAD;
+    }
 
-    // 2) Set up periodic timer.
-    static const uint32_t NUM_MS_IN_S = 1000;
-    static const uint32_t NUM_NS_IN_MS = 1000000;
+    // 9) Insert the thread struct at the front of mThreadList. It now owns the
+    //    periodic state.
+    kPPeriodic.release ();
+    pNewThread->thread = kThread;
+    pNewThread->next   = mThreadList;
+    mThreadList        = pNewThread;
 
-    // 2a) Create the timer. Make nonblocking so can check if missed deadline.
-    int32_t timerFd = timerfd_create (CLOCK_MONOTONIC, TFD_NONBLOCK);
-    if (timerFd < 0)
+    // 10) Set the CPU affinity of the new thread.
+    cpu_set_t cpuset;
+    toCpuSet (kCpuAffinity, cpuset);
+    if (pthread_setaffinity_np (kThread, sizeof (cpu_set_t), &cpuset) != 0)
     {
-        return (void *) E_FAILED_TO_CREATE_TIMERFD;
+        return E_FAILED_TO_SET_AFFINITY;
     }
 
-    // 2b) Make the timer periodic.
-    struct itimerspec itval;
-    uint32_t sec = periodMs / NUM_MS_IN_S;
-    uint32_t ns = (periodMs - (sec * NUM_MS_IN_S)) * NUM_NS_IN_MS;
-    itval.it_interval.tv_sec = sec;
-    itval.it_interval.tv_nsec = ns;
-    itval.it_value.tv_sec = sec;
-    itval.it_value.tv_nsec = ns;
-    if (timerfd_settime (timerFd, 0, &itval, NULL) < 0)
+    // 11) Destroy thread attr struct. POSIX requires this function always
+    //     succeed, so don't check return. Additionally, if this does fail, the
+    //     consequence is a small amount of leaked memory, so if for some
+    //     reason it does fail, tolerate this error by ignoring it.
+    pthread_attr_destroy (&attr);
+
+    return E_SUCCESS;
+}
+
+Error_t ThreadManager::createPeriodicThreadImpl (
+                                   pthread_t& kThread, 
+                                   ThreadFunc_t kWrapperFunc,
+                                   std::unique_ptr<PeriodicThread> kPPeriodic,
+                                   Priority_t kPriority, 
+                                   CpuSet_t kCpuAffinity)
+{
+    // 1) Validate function ptrs and period. Exactly one of the thread 
+    //    function and task must be set. The rest of the params will be 
+    //    validated in the createThread call.
+    PeriodicMetadata_t& metadata = kPPeriodic->metadata;
+    if ((metadata.pFunc == nullptr) == (metadata.pTask == nullptr) || 
+        metadata.pErrorHandlerFunc == nullptr)
+    {
+        return E_INVALID_POINTER;
+    } 
+    else if (metadata.periodNs == 0)
+    {
+        return E_INVALID_PERIOD;
+    }
+    else if (metadata.overrunPolicy >= OVERRUN_POLICY_LAST)
     {
-        return (void *) E_FAILED_TO_ARM_TIMERFD;
+        return E_INVALID_ENUM;
     }
 
-    // 3) Enter periodic loop.
-    while (1)
+    // 2) If SCHED_DEADLINE is requested, validate its params. A deadline of 0
+    //    is replaced with the period. The kernel only admits SCHED_DEADLINE 
+    //    threads that may run on every CPU.
+    DeadlineParams_t& deadline = metadata.deadlineParams;
+    bool useDeadline = deadline.runtimeNs != 0;
+    if (useDeadline == true)
     {
-        // 3a) Call pFunc with the args buffer starting after metadata elements.
-        Error_t ret = static_cast<Error_t> (
-            reinterpret_cast<uint64_t> (pFunc(&argsBuffer[metadataIdx])));
-        if (ret != E_SUCCESS)
+        if (deadline.deadlineNs == 0)
         {
-            ret = pErrorHandlerFunc (ret);
-            if (ret != E_SUCCESS)
-            {
-                return (void *) ret;
-            }
+            deadline.deadlineNs = metadata.periodNs;
         }
-
-        // 3b) Set fd as non-blocking to be able to check for deadline miss.
-        int32_t flags = fcntl (timerFd, F_GETFL, 0);
-        if (flags == -1)
+        if (deadline.runtimeNs < MIN_DEADLINE_RUNTIME_NS ||
+            deadline.runtimeNs > deadline.deadlineNs ||
+            deadline.deadlineNs > metadata.periodNs)
         {
-            return (void *) E_FAILED_TO_GET_TIMER_FLAGS;
+            return E_INVALID_DEADLINE;
         }
-
-        flags |= O_NONBLOCK;
-        if (fcntl (timerFd, F_SETFL, flags) == -1)
+        if (kCpuAffinity.mask != CpuSet_t (Affinity_t::ALL).mask)
         {
-            return (void *) E_FAILED_TO_SET_TIMER_FLAGS;
+            return E_INVALID_AFFINITY;
         }
+    }
 
-        // 3c) Check for deadline miss.
-        int32_t readRet = 0;
-        uint64_t ticksSinceLastRead = 0;
-        readRet = read (timerFd, &ticksSinceLastRead, 
-                        sizeof (ticksSinceLastRead));
-        if (readRet < 0 && errno != EAGAIN)
+    // 3) Create wrapper thread, which will run the thread function or task.
+    //    The Thread Manager owns the state once the thread is created.
+    PeriodicThread* pPeriodic = kPPeriodic.get ();
+    Error_t ret = this->createThreadImpl (kThread, kWrapperFunc, nullptr, 0, 
+                                          kPriority, kCpuAffinity, 
+                                          std::move (kPPeriodic));
+    if (ret != E_SUCCESS)
+    {
+        return ret;
+    }
+
+    // 4) A thread can only switch itself to SCHED_DEADLINE, so if requested,
+    //    wait up to DEADLINE_SWITCH_TIMEOUT_NS for the new thread to report 
+    //    the result. Sleep while waiting so that the new thread can run on 
+    //    this CPU. On timeout, abandon the switch so that the thread exits 
+    //    once scheduled. It may not be scheduled for some time, so it is left
+    //    to the caller to wait for. On failure the thread exits immediately,
+    //    so join it before surfacing the error.
+    if (useDeadline == true)
+    {
+        const struct timespec POLL_PERIOD = {0, 100 * (long) Time::NS_IN_US};
+        AtomicSchedStatus_t* pSchedStatus = &pPeriodic->schedStatus;
+        struct timespec now;
+        clock_gettime (CLOCK_MONOTONIC, &now);
+        struct timespec timeout = now;
+        addPeriod (timeout, DEADLINE_SWITCH_TIMEOUT_NS / Time::NS_IN_S, 
+                   DEADLINE_SWITCH_TIMEOUT_NS % Time::NS_IN_S);
+        uint8_t state = SCHED_SWITCH_PENDING;
+        while ((state = pSchedStatus->state.load (std::memory_order_acquire))
+                   == SCHED_SWITCH_PENDING && 
+               isReached (now, timeout) == false)
         {
-            return (void *) E_FAILED_TO_READ_TIMERFD;
-        }
-        else if (ticksSinceLastRead > 0)
-        {
-            ret = pErrorHandlerFunc (E_MISSED_SCHEDULER_DEADLINE);
-            if (ret != E_SUCCESS)
-            {
-                return (void *) ret;
-            }
+            clock_nanosleep (CLOCK_MONOTONIC, 0, &POLL_PERIOD, nullptr);
+            clock_gettime (CLOCK_MONOTONIC, &now);
         }
 
-        // 3d) Set fd as blocking so can block until timer elapses.
-        flags &= ~O_NONBLOCK;
-        if (fcntl (timerFd, F_SETFL, flags) == -1)
+        if (state == SCHED_SWITCH_PENDING &&
+            pSchedStatus->state.compare_exchange_strong (
+                                    state, SCHED_SWITCH_ABANDONED,
+                                    std::memory_order_acq_rel) == true)
         {
-            return (void *) E_FAILED_TO_SET_TIMER_FLAGS;
+            return E_DEADLINE_SWITCH_TIMED_OUT;
         }
 
-        // 3e) Block until timer elapses and make sure timer only expired once.
-        readRet = read (timerFd, &ticksSinceLastRead, 
-                        sizeof (ticksSinceLastRead));
-        if (ticksSinceLastRead > 1)
+        ret = static_cast<Error_t> (pSchedStatus->ret.load ());
+        if (ret != E_SUCCESS)
         {
-            return (void *) E_TIMER_EXPIRED_MORE_THAN_ONCE;
+            Error_t _threadRet = E_SUCCESS;
+            this->waitForThread (kThread, _threadRet);
+            return ret;
         }
     }
+
+    return E_SUCCESS;
+}
+
+Error_t ThreadManager::initPeriodicThread (PeriodicThread& kPeriodic)
+{
+    // If requested, switch to SCHED_DEADLINE and report the result to the
+    // creating thread.
+    const DeadlineParams_t& deadline = kPeriodic.metadata.deadlineParams;
+    if (deadline.runtimeNs == 0)
+    {
+        return E_SUCCESS;
+    }
+    Error_t ret = setSchedDeadline (deadline.runtimeNs, deadline.deadlineNs,
+                                    kPeriodic.metadata.periodNs);
+    kPeriodic.schedStatus.ret.store (ret);
+
+    // If the creating thread timed out waiting for the result, exit without
+    // running.
+    uint8_t state = SCHED_SWITCH_PENDING;
+    if (kPeriodic.schedStatus.state.compare_exchange_strong (
+                                    state, SCHED_SWITCH_REPORTED,
+                                    std::memory_order_acq_rel) == false)
+    {
+        return E_DEADLINE_SWITCH_TIMED_OUT;
+    }
+
+    return ret;
+}
+
+void ThreadManager::addPeriod (struct timespec& kTime, time_t kPeriodS, 
+                               long kPeriodNs)
+{
+    kTime.tv_sec  += kPeriodS;
+    kTime.tv_nsec += kPeriodNs;
+    if (kTime.tv_nsec >= (long) Time::NS_IN_S)
+    {
+        kTime.tv_sec++;
+        kTime.tv_nsec -= Time::NS_IN_S;
+    }
+}
+
+uint32_t ThreadManager::elapsedNs (const struct timespec& kEnd, 
+                                   const struct timespec& kStart)
+{
+    int64_t ns = (int64_t) (kEnd.tv_sec - kStart.tv_sec) * Time::NS_IN_S + 
+                 (kEnd.tv_nsec - kStart.tv_nsec);
+    if (ns < 0)
+    {
+        return 0;
+    }
+    if (ns > std::numeric_limits<uint32_t>::max ())
+    {
+        return std::numeric_limits<uint32_t>::max ();
+    }
+    return (uint32_t) ns;
+}
+
+bool ThreadManager::isReached (const struct timespec& kNow, 
+                               const struct timespec& kTime)
+{
+    return kNow.tv_sec > kTime.tv_sec || 
+           (kNow.tv_sec == kTime.tv_sec && kNow.tv_nsec >= kTime.tv_nsec);
+}
+
+void* ThreadManager::periodicWrapperFunc (void* kRawArgs)
+{
+    PeriodicThread& periodic = *static_cast<PeriodicThread*> (kRawArgs);
+    Error_t ret = initPeriodicThread (periodic);
+    if (ret != E_SUCCESS)
+    {
+        return (void*) (uintptr_t) ret;
+    }
+
+    FuncTask_t task = {periodic.metadata.pFunc, periodic.args.data ()};
+    return (void*) (uintptr_t) periodicLoop (task, periodic.metadata, 
+                                             periodic.stats);
 }
 
+ThreadManager::PeriodicThread::PeriodicThread (
+                                        const PeriodicMetadata_t& kMetadata,
+                                        void* kPArgs, uint32_t kNumArgBytes) :
+    metadata (kMetadata),
+    args     ((uint8_t*) kPArgs, (uint8_t*) kPArgs + kNumArgBytes) {}
@@ -0,0 +1,70 @@
+/**
+ * In-memory FIFO backend for testing devices that read a DMA FIFO off target.
+ * Elements are pushed by the test and acquired in place by the device under
+ * test, like a target-to-host FIFO.
+ */
+
+#ifndef MOCK_FIFO_BACKEND_HPP
+#define MOCK_FIFO_BACKEND_HPP
+
+#include <vector>
+
+#include "FifoBackend.hpp"
+
+class MockFifoBackend final : public FifoBackend
+{
+
+    public:
+
+        /**
+         * Inherited from base. Records the requested depth.
+         */
+        virtual Error_t start (size_t kDepth);
+
+        /**
+         * Inherited from base.
+         */
+        virtual Error_t acquire (size_t kNumElems,
+                                 const uint32_t*& kPElemsRet,
+                                 bool& kAcquiredRet,
+                                 size_t& kNumRemainingRet);
+
+        /**
+         * Inherited from base.
+         */
+        virtual Error_t release (size_t kNumElems);
+
+        /**
+         * Push elements onto the FIFO, as the FPGA would.
+         *
+         * @param   kElems           Elements to push.
+         *
+         * @ret     E_SUCCESS        Elements pushed.
+         *          E_INCORRECT_SIZE Not started, or FIFO would overflow.
+         */
+        Error_t push (const std::vector<uint32_t>& kElems);
+
+        /**
+         * If set, acquire fails with E_FPGA_FIFO.
+         */
+        bool failAcquire = false;
+
+    private:
+
+        /**
+         * Depth requested on start. 0 if not started.
+         */
+        size_t mDepth = 0;
+
+        /**
+         * Elements in the FIFO, oldest first.
+         */
+        std::vector<uint32_t> mElems;
+
+        /**
+         * Number of elements acquired and not yet released.
+         */
+        size_t mNumAcquired = 0;
+};
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * NOTE: This file contains basic tests for the AnalogInBankDevice class but
+ * does not validate its analog read capabilities. See AnalogInDeviceTest.cpp.
+ */
+
+#include "AnalogInBankDevice.hpp"
+#include "FPGASession.hpp"
+#include "TestHelpers.hpp"
+
+/**
+ * Initializes the FPGA session, Data Vector, test device pointer, and test
+ * device config.
+ */
+#define INIT_TEST                                                              \
+    NiFpga_Session session;                                                    \
+    NiFpga_Status status;                                                      \
+    CHECK_SUCCESS (FPGASession::getSession (session, status));                 \
+    CHECK_EQUAL (NiFpga_Status_Success, status);                               \
+    std::shared_ptr<DataVector> pDv = nullptr;                                 \
+    CHECK_SUCCESS (DataVector::createNew (gDvConfig, pDv));                    \
+    std::unique_ptr<AnalogInBankDevice> pDevice = nullptr;                     \
+    AnalogInBankDevice::Config_t config = gDeviceConfig;
+
+/**
+ * DV config for test device.
+ */
+static DataVector::Config_t gDvConfig =
+{
+    // Region
+    {DV_REG_TEST0,
+
+    // Elements
+    {
+        DV_ADD_FLOAT  (DV_ELEM_TEST0, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST1, 0),
+        DV_ADD_UINT32 (DV_ELEM_TEST2, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST4, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST5, 0),
+    }},
+};
+
+/**
+ * Transfer function that always succeeds.
+ *
+ * @param   kV        Voltage.
+ * @param   kEngrRet  Engineering unit.
+ *
+ * @ret     E_SUCCESS Always succeeds.
+ */
+static Error_t successTransferFunc (float kV, float& kEngrRet)
+{
+    kEngrRet = kV;
+    return E_SUCCESS;
+}
+
+/**
+ * Transfer function that generates an error.
+ *
+ * @param   kV           Voltage.
+ * @param   kEngrRet     Engineering unit.
+ *
+ * @ret     E_TEST_ERROR Always returned.
+ */
+static Error_t errorTransferFunc (float kV, float& kEngrRet)
+{
+    return E_TEST_ERROR;
+}
+
+/**
+ * Example valid device config with two channels.
+ */
+static AnalogInBankDevice::Config_t gDeviceConfig =
+{
+    {
+        DV_ELEM_TEST0,
+        DV_ELEM_TEST1,
+        AnalogInDevice::MIN_PIN_NUMBER,
+        (AnalogInDevice::TransferFunc_t*) &successTransferFunc,
+        AnalogInDevice::RANGE_10V,
+        AnalogInDevice::MODE_DIFF,
+    },
+    {
+        DV_ELEM_TEST4,
+        DV_ELEM_TEST5,
+        (uint8_t) (AnalogInDevice::MIN_PIN_NUMBER + 1),
+        (AnalogInDevice::TransferFunc_t*) &successTransferFunc,
+        AnalogInDevice::RANGE_10V,
+        AnalogInDevice::MODE_DIFF,
+    },
+};
+
+TEST_GROUP (AnalogInBankDeviceTest)
+{
+};
+
+/**
+ * Tests invalid bank configs.
+ */
+TEST (AnalogInBankDeviceTest, InvalidConfig)
+{
+    INIT_TEST;
+
+    // No channels.
+    AnalogInBankDevice::Config_t emptyConfig;
+    CHECK_ERROR (E_EMPTY_CONFIG, Device::createNew (session, pDv, emptyConfig,
+                                                    pDevice));
+
+    // Duplicate pin.
+    config[1].pinNumber = config[0].pinNumber;
+    CHECK_ERROR (E_DUPLICATE_PIN, Device::createNew (session, pDv, config,
+                                                     pDevice));
+
+    // Oversampling channel.
+    config[1].pinNumber = gDeviceConfig[1].pinNumber;
+    config[1].oversampleRingSize = 4;
+    CHECK_ERROR (E_INVALID_CONFIG, Device::createNew (session, pDv, config,
+                                                      pDevice));
+
+    // Invalid channel config.
+    config[1].oversampleRingSize = 0;
+    config[1].dvElemOutputVolts = DV_ELEM_TEST2;
+    CHECK_ERROR (E_INVALID_ELEM, Device::createNew (session, pDv, config,
+                                                    pDevice));
+}
+
+/**
+ * Tests creating and running device with valid config.
+ */
+TEST (AnalogInBankDeviceTest, ValidConfig)
+{
+    INIT_TEST;
+
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    CHECK_SUCCESS (pDevice->run ());
+}
+
+/**
+ * Tests that transfer function errors are surfaced.
+ */
+TEST (AnalogInBankDeviceTest, ErrorTransferFunc)
+{
+    INIT_TEST;
+
+    config[1].pTransferFunc = 
+        (AnalogInDevice::TransferFunc_t*) &errorTransferFunc;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    CHECK_ERROR (E_TEST_ERROR, pDevice->run ());
+}
+
+/**
+ * Tests creating and running device with calibrated channels.
+ */
+TEST (AnalogInBankDeviceTest, Calibration)
+{
+    INIT_TEST;
+
+    config[0].pTransferFunc = nullptr;
+    config[0].calibration = {Calibration::CAL_POLYNOMIAL, {0, 1}, {}, {}};
+    config[1].pTransferFunc = nullptr;
+    config[1].calibration = {Calibration::CAL_PIECEWISE_LINEAR, {}, {0, 1},
+                             {0, 1}};
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    CHECK_SUCCESS (pDevice->run ());
+}
@@ -35,6 +35,8 @@ static DataVector::Config_t gDvConfig =
         DV_ADD_FLOAT  (DV_ELEM_TEST0, 0),
         DV_ADD_FLOAT  (DV_ELEM_TEST1, 0),
         DV_ADD_UINT32 (DV_ELEM_TEST2, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST4, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST5, 0),
     }},
 };
 
@@ -141,6 +143,26 @@ TEST (AnalogInDeviceTest, NullTransferFunc)
                                                        pDevice));
 }
 
+/**
+ * Tests calibration in device config. A calibrated device needs no transfer
+ * function.
+ */
+TEST (AnalogInDeviceTest, Calibration)
+{
+    INIT_TEST;
+
+    // Invalid calibration.
+    config.pTransferFunc = nullptr;
+    config.calibration = {Calibration::CAL_POLYNOMIAL, {}, {}, {}};
+    CHECK_ERROR (E_EMPTY_CONFIG, Device::createNew (session, pDv, config,
+                                                    pDevice));
+
+    // Valid calibration.
+    config.calibration.coeffs = {0, 1};
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    CHECK_SUCCESS (pDevice->run ());
+}
+
 /**
  * Tests invalid input range and mode in device config.
  */
@@ -193,4 +215,120 @@ TEST (AnalogInDeviceTest, ErrorTransferFunc)
     config.pTransferFunc = (AnalogInDevice::TransferFunc_t*) &errorTransferFunc;
     CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
     CHECK_ERROR (E_TEST_ERROR, pDevice->run ());
-}
\ No newline at end of file
+}
+
+/**
+ * Tests invalid oversampling config.
+ */
+TEST (AnalogInDeviceTest, InvalidOversample)
+{
+    INIT_TEST;
+
+    config.oversampleRingSize = 16;
+    config.dvElemOutputMin    = DV_ELEM_TEST4;
+    config.dvElemOutputMax    = DV_ELEM_TEST5;
+    config.dvElemNumSamples   = DV_ELEM_TEST2;
+
+    // Ring size not a power of 2.
+    config.oversampleRingSize = 12;
+    CHECK_ERROR (E_INCORRECT_SIZE, Device::createNew (session, pDv, config,
+                                                      pDevice));
+
+    // Min elem does not exist in DV.
+    config.oversampleRingSize = 16;
+    config.dvElemOutputMin = DV_ELEM_TEST3;
+    CHECK_ERROR (E_INVALID_ELEM, Device::createNew (session, pDv, config,
+                                                    pDevice));
+
+    // Sample count elem is wrong type.
+    config.dvElemOutputMin = DV_ELEM_TEST4;
+    config.dvElemNumSamples = DV_ELEM_TEST5;
+    CHECK_ERROR (E_INVALID_ELEM, Device::createNew (session, pDv, config,
+                                                    pDevice));
+}
+
+/**
+ * Tests oversampling. Each run aggregates the samples taken since the last 
+ * run, and the ring drops samples when full.
+ */
+TEST (AnalogInDeviceTest, Oversample)
+{
+    INIT_TEST;
+
+    config.oversampleRingSize = 4;
+    config.dvElemOutputMin    = DV_ELEM_TEST4;
+    config.dvElemOutputMax    = DV_ELEM_TEST5;
+    config.dvElemNumSamples   = DV_ELEM_TEST2;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+
+    // Aggregate 3 samples.
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        CHECK_SUCCESS (pDevice->sample ());
+    }
+    CHECK_SUCCESS (pDevice->run ());
+    float mean = 0;
+    float min = 0;
+    float max = 0;
+    uint32_t numSamples = 0;
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, mean));
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST4, min));
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST5, max));
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST2, numSamples));
+    CHECK_EQUAL (3, numSamples);
+    CHECK_TRUE (min <= mean && mean <= max);
+
+    // Fill ring. Samples past its size are dropped.
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        CHECK_SUCCESS (pDevice->sample ());
+    }
+    CHECK_ERROR (E_SAMPLE_RING_FULL, pDevice->sample ());
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST2, numSamples));
+    CHECK_EQUAL (4, numSamples);
+
+    // With no samples taken, run takes one itself.
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST2, numSamples));
+    CHECK_EQUAL (1, numSamples);
+}
+
+/**
+ * Tests that reserveSamples grows the ring to the next power of 2, and does 
+ * nothing if not oversampling.
+ */
+TEST (AnalogInDeviceTest, ReserveSamples)
+{
+    INIT_TEST;
+
+    // Not oversampling. Sampling is a no-op.
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    pDevice->reserveSamples (8);
+    CHECK_SUCCESS (pDevice->sample ());
+
+    // Ring of 4 grown to hold 5 samples holds 8.
+    config.oversampleRingSize = 4;
+    config.dvElemOutputMin    = DV_ELEM_TEST4;
+    config.dvElemOutputMax    = DV_ELEM_TEST5;
+    config.dvElemNumSamples   = DV_ELEM_TEST2;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    pDevice->reserveSamples (5);
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        CHECK_SUCCESS (pDevice->sample ());
+    }
+    CHECK_ERROR (E_SAMPLE_RING_FULL, pDevice->sample ());
+    CHECK_SUCCESS (pDevice->run ());
+    uint32_t numSamples = 0;
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST2, numSamples));
+    CHECK_EQUAL (8, numSamples);
+
+    // Reserving fewer samples does not shrink the ring.
+    pDevice->reserveSamples (2);
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        CHECK_SUCCESS (pDevice->sample ());
+    }
+    CHECK_ERROR (E_SAMPLE_RING_FULL, pDevice->sample ());
+}
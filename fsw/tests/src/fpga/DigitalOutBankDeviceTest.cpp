@@ -0,0 +1,99 @@
+/* All #include statements should come before the CppUTest include */
+
+#include <memory>
+
+#include "DataVector.hpp"
+#include "Errors.hpp"
+#include "DigitalOutBankDevice.hpp"
+#include "FPGASession.hpp"
+
+#include "TestHelpers.hpp"
+
+/**
+ * Initialize FPGA session and Data Vector.
+ */
+#define INIT_SESSION_AND_DV                                                    \
+    NiFpga_Session session;                                                    \
+    NiFpga_Status status;                                                      \
+    CHECK_SUCCESS (FPGASession::getSession (session, status));                 \
+    CHECK_EQUAL (NiFpga_Status_Success, status);                               \
+    DataVector::Config_t config =                                              \
+    {                                                                          \
+        {                                                                      \
+            {DV_REG_TEST0,                                                     \
+            {                                                                  \
+                DV_ADD_BOOL  (  DV_ELEM_TEST0,      false        ),            \
+                DV_ADD_BOOL  (  DV_ELEM_TEST1,      false        ),            \
+                DV_ADD_BOOL  (  DV_ELEM_TEST2,      false        ),            \
+                DV_ADD_BOOL  (  DV_ELEM_TEST3,      false        ),            \
+                DV_ADD_UINT8 (  DV_ELEM_TEST4,      0            ),            \
+            }},                                                                \
+        }                                                                      \
+    };                                                                         \
+    std::shared_ptr<DataVector> pDv;                                           \
+    CHECK_SUCCESS (DataVector::createNew (config, pDv));                       
+
+/**
+ * Bank config with two channels.
+ */
+static DigitalOutBankDevice::Config_t gDeviceConfig =
+{
+    {DV_ELEM_TEST0, DV_ELEM_TEST1, 5},
+    {DV_ELEM_TEST2, DV_ELEM_TEST3, 6},
+};
+
+TEST_GROUP (DigitalOutBankDeviceTest)
+{
+};
+
+/* Test invalid bank configs. */
+TEST (DigitalOutBankDeviceTest, InvalidConfig)
+{
+    INIT_SESSION_AND_DV;
+
+    // Verify no channels.
+    DigitalOutBankDevice::Config_t deviceConfig;
+    std::unique_ptr<DigitalOutBankDevice> pDevice;
+    CHECK_ERROR (Device::createNew (session, pDv, deviceConfig, pDevice),
+                 E_EMPTY_CONFIG); 
+
+    // Verify duplicate pin.
+    deviceConfig = gDeviceConfig;
+    deviceConfig[1].pinNumber = deviceConfig[0].pinNumber;
+    CHECK_ERROR (Device::createNew (session, pDv, deviceConfig, pDevice),
+                 E_DUPLICATE_PIN); 
+
+    // Verify invalid channel config.
+    deviceConfig = gDeviceConfig;
+    deviceConfig[1].dvElemFeedbackVal = DV_ELEM_TEST4;
+    CHECK_ERROR (Device::createNew (session, pDv, deviceConfig, pDevice),
+                 E_INVALID_ELEM); 
+}
+
+/* Test running the bank sets and reads back every pin. */
+TEST (DigitalOutBankDeviceTest, Run)
+{
+    // 1) Initialize FPGA, DV, and device.
+    INIT_SESSION_AND_DV;
+    DigitalOutBankDevice::Config_t deviceConfig = gDeviceConfig;
+    std::unique_ptr<DigitalOutBankDevice> pDevice;
+    CHECK_SUCCESS (Device::createNew (session, pDv, deviceConfig, pDevice)); 
+
+    // 2) Set one pin high, run, sleep, then run. Sleep since pin can take some
+    //    time before reflecting new output value.
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST0, true));
+    CHECK_SUCCESS (pDevice->run ());
+    TestHelpers::sleepMs (1);
+    CHECK_SUCCESS (pDevice->run ());
+
+    // 3) Verify feedback values.
+    bool feedbackVal = false;
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, feedbackVal));
+    CHECK_EQUAL (true, feedbackVal);
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST3, feedbackVal));
+    CHECK_EQUAL (false, feedbackVal);
+
+    // 4) Set pin low again.
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST0, false));
+    CHECK_SUCCESS (pDevice->run ());
+}
@@ -224,3 +224,39 @@ TEST (DigitalOutDeviceTest, DigitalOutOn)
     CHECK_SUCCESS (FPGASession::closeSession (status));
     CHECK_EQUAL (NiFpga_Status_Success, status);
 }
+
+/* Test that feedback is only read every feedbackDivisor runs. */
+TEST (DigitalOutDeviceTest, FeedbackDivisor)
+{
+    // 1) Initialize FPGA and DV. 
+    INIT_SESSION_AND_DV;
+
+    // 2) Initialize device with a high control value so that the pin is high
+    //    before the first run.
+    CHECK_SUCCESS (pDv->write (DV_ELEM_LED_CONTROL_VAL, true));
+    DigitalOutDevice::Config_t deviceConfig = 
+    {
+        DV_ELEM_LED_CONTROL_VAL, 
+        DV_ELEM_LED_FEEDBACK_VAL, 
+        5,
+        3
+    };
+    std::unique_ptr<DigitalOutDevice> pDigitalOutDevice;
+    CHECK_SUCCESS (Device::createNew (session, pDv, deviceConfig, 
+                                      pDigitalOutDevice)); 
+    TestHelpers::sleepMs (1);
+
+    // 3) Verify feedback is read on the first run and every third run after.
+    bool feedbackVal = false;
+    for (uint32_t i = 0; i < 7; i++)
+    {
+        CHECK_SUCCESS (pDv->write (DV_ELEM_LED_FEEDBACK_VAL, false));
+        CHECK_SUCCESS (pDigitalOutDevice->run ());
+        CHECK_SUCCESS (pDv->read (DV_ELEM_LED_FEEDBACK_VAL, feedbackVal));
+        CHECK_EQUAL (i % 3 == 0, feedbackVal);
+    }
+
+    // 4) Set pin low again.
+    CHECK_SUCCESS (pDv->write (DV_ELEM_LED_CONTROL_VAL, false));
+    CHECK_SUCCESS (pDigitalOutDevice->run ());
+}
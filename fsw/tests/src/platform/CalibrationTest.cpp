@@ -0,0 +1,97 @@
+#include "Calibration.hpp"
+#include "TestHelpers.hpp"
+
+/**
+ * Example valid polynomial calibration: 1 + 2v + 3v^2.
+ */
+static const Calibration::Config_t gPolyConfig =
+{
+    Calibration::CAL_POLYNOMIAL,
+    {1, 2, 3},
+    {},
+    {},
+};
+
+/**
+ * Example valid piecewise-linear calibration.
+ */
+static const Calibration::Config_t gTableConfig =
+{
+    Calibration::CAL_PIECEWISE_LINEAR,
+    {},
+    {-1, 0, 2},
+    {10, 20, 0},
+};
+
+TEST_GROUP (CalibrationTest)
+{
+};
+
+/**
+ * Tests invalid calibration configs.
+ */
+TEST (CalibrationTest, InvalidConfig)
+{
+    Calibration::Config_t config = gPolyConfig;
+
+    // Invalid type.
+    config.type = Calibration::CAL_LAST;
+    CHECK_ERROR (Calibration::verifyConfig (config), E_INVALID_ENUM);
+
+    // Polynomial without coefficients.
+    config.type = Calibration::CAL_POLYNOMIAL;
+    config.coeffs.clear ();
+    CHECK_ERROR (Calibration::verifyConfig (config), E_EMPTY_CONFIG);
+
+    // Table with one point.
+    config = gTableConfig;
+    config.pointsV = {0};
+    config.pointsEngr = {0};
+    CHECK_ERROR (Calibration::verifyConfig (config), E_EMPTY_CONFIG);
+
+    // Table with mismatched point counts.
+    config = gTableConfig;
+    config.pointsEngr.pop_back ();
+    CHECK_ERROR (Calibration::verifyConfig (config), E_INCORRECT_SIZE);
+
+    // Table voltages not strictly increasing.
+    config = gTableConfig;
+    config.pointsV[1] = config.pointsV[0];
+    CHECK_ERROR (Calibration::verifyConfig (config), E_INVALID_CONFIG);
+}
+
+/**
+ * Tests valid calibration configs.
+ */
+TEST (CalibrationTest, ValidConfig)
+{
+    Calibration::Config_t config = {Calibration::CAL_NONE, {}, {}, {}};
+    CHECK_SUCCESS (Calibration::verifyConfig (config));
+    CHECK_SUCCESS (Calibration::verifyConfig (gPolyConfig));
+    CHECK_SUCCESS (Calibration::verifyConfig (gTableConfig));
+}
+
+/**
+ * Tests evaluating each calibration type.
+ */
+TEST (CalibrationTest, Evaluate)
+{
+    // No calibration returns the voltage.
+    Calibration::Config_t config = {Calibration::CAL_NONE, {}, {}, {}};
+    CHECK_EQUAL (1.5, Calibration::evaluate (config, 1.5));
+
+    // Polynomial.
+    CHECK_EQUAL (1, Calibration::evaluate (gPolyConfig, 0));
+    CHECK_EQUAL (6, Calibration::evaluate (gPolyConfig, 1));
+    CHECK_EQUAL (2, Calibration::evaluate (gPolyConfig, -1));
+    CHECK_EQUAL (17, Calibration::evaluate (gPolyConfig, 2));
+
+    // Table at its points, between them, and extrapolated beyond both ends.
+    CHECK_EQUAL (10, Calibration::evaluate (gTableConfig, -1));
+    CHECK_EQUAL (20, Calibration::evaluate (gTableConfig, 0));
+    CHECK_EQUAL (0, Calibration::evaluate (gTableConfig, 2));
+    CHECK_EQUAL (15, Calibration::evaluate (gTableConfig, -0.5));
+    CHECK_EQUAL (10, Calibration::evaluate (gTableConfig, 1));
+    CHECK_EQUAL (0, Calibration::evaluate (gTableConfig, -2));
+    CHECK_EQUAL (-10, Calibration::evaluate (gTableConfig, 3));
+}
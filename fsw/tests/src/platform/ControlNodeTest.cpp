@@ -9,23 +9,29 @@
 /********************************* MACROS *************************************/
 
 /**
- * Fork a process, run ControlNode::entry, and verify process exits as 
- * expected.
+ * Fork a process, run ControlNode::entry with the provided communications mode
+ * and Device Node configs, and verify process exits as expected.
  *
  * @param  kNmConfig          Network Manager config.
  * @param  kDvConfig          Data Vector config.
  * @param  kSmConfig          State Machine config.
  * @param  kChConfig          Command Handler config.
  * @param  kFInitControllers  Function pointer to controller init function.
+ * @param  kCommsMode         Communications mode.
+ * @param  kDeviceNodes       Device Node configs.
  */
-#define TEST_ENTRY_EXIT_ON_ERROR(kNmConfig, kDvConfig, kSmConfig, kChConfig,   \
-                                 kFInitControllers)                            \
+#define TEST_ENTRY_COMMS_MODE_EXIT_ON_ERROR(kNmConfig, kDvConfig, kSmConfig,   \
+                                            kChConfig, kFInitControllers,      \
+                                            kCommsMode, kDeviceNodes)          \
 {                                                                              \
     pid_t pid = fork ();                                                       \
     if (pid == 0)                                                              \
     {                                                                          \
+        ControlNode::Options_t options;                                        \
+        options.commsMode = kCommsMode;                                        \
+        options.deviceNodes = kDeviceNodes;                                    \
         ControlNode::entry (kNmConfig, kDvConfig, kSmConfig, kChConfig,        \
-                            kFInitControllers);                                \
+                            kFInitControllers, options);                       \
         exit (EXIT_SUCCESS);                                                   \
     }                                                                          \
     else if (pid > 0)                                                          \
@@ -51,6 +57,62 @@
     }                                                                          \
 }
 
+/**
+ * Fork a process, run ControlNode::entry in early exit communications mode 
+ * with the provided Device Node configs, and verify process exits as expected.
+ *
+ * @param  kNmConfig          Network Manager config.
+ * @param  kDvConfig          Data Vector config.
+ * @param  kSmConfig          State Machine config.
+ * @param  kChConfig          Command Handler config.
+ * @param  kFInitControllers  Function pointer to controller init function.
+ * @param  kDeviceNodes       Device Node configs.
+ */
+#define TEST_ENTRY_DEVICE_NODES_EXIT_ON_ERROR(kNmConfig, kDvConfig, kSmConfig, \
+                                              kChConfig, kFInitControllers,    \
+                                              kDeviceNodes)                    \
+    TEST_ENTRY_COMMS_MODE_EXIT_ON_ERROR (                                      \
+                                    kNmConfig, kDvConfig, kSmConfig, kChConfig,\
+                                    kFInitControllers,                         \
+                                    ControlNode::COMMS_MODE_EARLY_EXIT,        \
+                                    kDeviceNodes)
+
+/**
+ * Fork a process, run ControlNode::entry in the provided communications mode 
+ * with the Platform v1 Device Nodes, and verify process exits as expected.
+ *
+ * @param  kNmConfig          Network Manager config.
+ * @param  kDvConfig          Data Vector config.
+ * @param  kSmConfig          State Machine config.
+ * @param  kChConfig          Command Handler config.
+ * @param  kFInitControllers  Function pointer to controller init function.
+ * @param  kCommsMode         Communications mode.
+ */
+#define TEST_ENTRY_MODE_EXIT_ON_ERROR(kNmConfig, kDvConfig, kSmConfig,         \
+                                      kChConfig, kFInitControllers,            \
+                                      kCommsMode)                              \
+    TEST_ENTRY_COMMS_MODE_EXIT_ON_ERROR (                                      \
+                                    kNmConfig, kDvConfig, kSmConfig, kChConfig,\
+                                    kFInitControllers, kCommsMode,             \
+                                    ControlNode::PLATFORM_V1_DEVICE_NODES)
+
+/**
+ * Fork a process, run ControlNode::entry with the Platform v1 Device Nodes, and
+ * verify process exits as expected.
+ *
+ * @param  kNmConfig          Network Manager config.
+ * @param  kDvConfig          Data Vector config.
+ * @param  kSmConfig          State Machine config.
+ * @param  kChConfig          Command Handler config.
+ * @param  kFInitControllers  Function pointer to controller init function.
+ */
+#define TEST_ENTRY_EXIT_ON_ERROR(kNmConfig, kDvConfig, kSmConfig, kChConfig,   \
+                                 kFInitControllers)                            \
+    TEST_ENTRY_DEVICE_NODES_EXIT_ON_ERROR (                                    \
+                                    kNmConfig, kDvConfig, kSmConfig, kChConfig,\
+                                    kFInitControllers,                         \
+                                    ControlNode::PLATFORM_V1_DEVICE_NODES)
+
 /**
  * Create a thread to simulate the Device and Ground nodes.
  *
@@ -791,6 +853,91 @@ TEST_GROUP (ControlNode)
     }
 };
 
+/* Test entry with no Device Nodes configured. */
+TEST (ControlNode, BadDeviceNodeConfigEmpty)
+{
+    std::vector<ControlNode::DeviceNodeConfig_t> deviceNodes;
+
+    // Create process that calls entry. Expect this process to exit due to a bad
+    // config.
+    TEST_ENTRY_DEVICE_NODES_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig, 
+                                           gSmConfig, gFInitControllersSuccess,
+                                           deviceNodes);
+};
+
+/* Test entry with a Device Node configured twice. */
+TEST (ControlNode, BadDeviceNodeConfigDupeNode)
+{
+    std::vector<ControlNode::DeviceNodeConfig_t> deviceNodes = 
+        ControlNode::PLATFORM_V1_DEVICE_NODES;
+    deviceNodes.push_back (deviceNodes[0]);
+
+    // Create process that calls entry. Expect this process to exit due to a bad
+    // config.
+    TEST_ENTRY_DEVICE_NODES_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig, 
+                                           gSmConfig, gFInitControllersSuccess,
+                                           deviceNodes);
+};
+
+/* Test entry with a region configured for two Device Nodes. */
+TEST (ControlNode, BadDeviceNodeConfigSharedRegion)
+{
+    std::vector<ControlNode::DeviceNodeConfig_t> deviceNodes =
+        ControlNode::PLATFORM_V1_DEVICE_NODES;
+    deviceNodes[1].cnToDnRegion = deviceNodes[0].cnToDnRegion;
+
+    // Create process that calls entry. Expect this process to exit due to a bad
+    // config.
+    TEST_ENTRY_DEVICE_NODES_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig,
+                                           gSmConfig, gFInitControllersSuccess,
+                                           deviceNodes);
+};
+
+/* Test entry with a Device Node whose Control Node to Device Node region is
+   also its Device Node to Control Node region. */
+TEST (ControlNode, BadDeviceNodeConfigSameRegion)
+{
+    std::vector<ControlNode::DeviceNodeConfig_t> deviceNodes =
+        ControlNode::PLATFORM_V1_DEVICE_NODES;
+    deviceNodes[0].dnToCnRegion = deviceNodes[0].cnToDnRegion;
+
+    // Create process that calls entry. Expect this process to exit due to a bad
+    // config.
+    TEST_ENTRY_DEVICE_NODES_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig,
+                                           gSmConfig, gFInitControllersSuccess,
+                                           deviceNodes);
+};
+
+/* Test entry with a non-Device Node configured as a Device Node. */
+TEST (ControlNode, BadDeviceNodeConfigNotDeviceNode)
+{
+    std::vector<ControlNode::DeviceNodeConfig_t> deviceNodes = 
+        ControlNode::PLATFORM_V1_DEVICE_NODES;
+    deviceNodes[0].node = NODE_GROUND;
+
+    // Create process that calls entry. Expect this process to exit due to a bad
+    // config.
+    TEST_ENTRY_DEVICE_NODES_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig, 
+                                           gSmConfig, gFInitControllersSuccess,
+                                           deviceNodes);
+};
+
+/* Test entry with a configured Device Node missing from the NM and DV 
+   configs. */
+TEST (ControlNode, BadConfigMissingConfiguredDeviceNode)
+{
+    std::vector<ControlNode::DeviceNodeConfig_t> deviceNodes = 
+        ControlNode::PLATFORM_V1_DEVICE_NODES;
+    deviceNodes.push_back ({NODE_DEVICE3, DV_REG_CN_TO_DN3, DV_REG_DN3_TO_CN, 
+                            DV_ELEM_DN3_RX_MISS_COUNT});
+
+    // Create process that calls entry. Expect this process to exit due to a bad
+    // config.
+    TEST_ENTRY_DEVICE_NODES_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig, 
+                                           gSmConfig, gFInitControllersSuccess,
+                                           deviceNodes);
+};
+
 /* Test entry with a bad DV config that does not contain a required region. No 
    need to init clock sync thread since DV initialized first. */
 TEST (ControlNode, BadDvConfigMissingRequiredRegion)
@@ -835,6 +982,47 @@ TEST (ControlNode, BadDvConfig)
                               gFInitControllersSuccess);
 };
 
+/* Test entry with an invalid communications mode. No need to init clock sync 
+   thread since the mode is verified before clock sync. */
+TEST (ControlNode, BadCommsMode)
+{
+    // Create process that calls entry. Expect this process to exit due to an
+    // invalid mode.
+    TEST_ENTRY_MODE_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig, gSmConfig, 
+                                   gFInitControllersSuccess,
+                                   ControlNode::COMMS_MODE_LAST);
+};
+
+/* Test entry in dedicated thread mode with a bad DV config. No need to init 
+   clock sync thread since DV initialized first. */
+TEST (ControlNode, DedicatedThreadBadDvConfig)
+{
+    // Remove a required region.
+    DataVector::Config_t dvConfig = gDvConfig;
+    dvConfig.erase (dvConfig.begin ());
+
+    // Create process that calls entry. Expect this process to exit due to a bad
+    // config.
+    TEST_ENTRY_MODE_EXIT_ON_ERROR (gNmConfig, dvConfig, gChConfig, gSmConfig, 
+                                   gFInitControllersSuccess,
+                                   ControlNode::COMMS_MODE_DEDICATED_THREAD);
+};
+
+/* Test entry in dedicated thread mode with a bad NM config. No need to init 
+   clock sync thread since NM initialized pre clock sync. */
+TEST (ControlNode, DedicatedThreadBadNmConfig)
+{
+    // Remove a required node.
+    NetworkManager::Config_t nmConfig = gNmConfig;
+    nmConfig.nodeToIp.erase (NODE_DEVICE0);
+
+    // Create process that calls entry. Expect this process to exit due to a bad
+    // config.
+    TEST_ENTRY_MODE_EXIT_ON_ERROR (nmConfig, gDvConfig, gChConfig, gSmConfig, 
+                                   gFInitControllersSuccess,
+                                   ControlNode::COMMS_MODE_DEDICATED_THREAD);
+};
+
 /* Test entry with a bad NM config that does not contain all required nodes. No 
    need to init clock sync thread since NM initialized pre clock sync. */
 TEST (ControlNode, BadNmConfigMissingNode)
@@ -1030,3 +1218,88 @@ TEST (ControlNode, Success)
     CHECK_EQUAL (MODE_SAFED, errorCtrlMode);
     CHECK_EQUAL (MODE_SAFED, missCtrlMode);
 };
+
+/* Test entry in dedicated thread mode with failed clock sync. */
+TEST (ControlNode, DedicatedThreadClockSyncFail)
+{
+    // Create thread to simulate Device Nodes during clock sync. Blocks on 
+    // waiting for clock sync msg.
+    CREATE_SIM_THREAD (false, false);
+
+    // Create process that calls entry. Expect this process to exit due to a 
+    // failed clock sync step before the comms thread is created.
+    TEST_ENTRY_MODE_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig, gSmConfig, 
+                                   gFInitControllersSuccess,
+                                   ControlNode::COMMS_MODE_DEDICATED_THREAD);
+
+    // Wait for node sim thread.
+    Error_t ret;
+    WAIT_FOR_THREAD (thread, pTm);
+};
+
+/* Test entry in dedicated thread mode with an error on controller 
+   initialization. */
+TEST (ControlNode, DedicatedThreadBadControllerInit)
+{
+    // Create thread to simulate Device Nodes during clock sync. Blocks on 
+    // waiting for clock sync msg.
+    CREATE_SIM_THREAD (true, false);
+
+    // Create process that calls entry. Expect this process to exit due to a 
+    // failed controller init before the comms thread is created.
+    TEST_ENTRY_MODE_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig, gSmConfig, 
+                                   gFInitControllersFail,
+                                   ControlNode::COMMS_MODE_DEDICATED_THREAD);
+
+    // Wait for node sim thread.
+    Error_t ret;
+    WAIT_FOR_THREAD (thread, pTm);
+};
+
+/* Test running through test State Machine successfully with communications on
+   the dedicated comms thread. */
+TEST (ControlNode, DedicatedThreadSuccess)
+{
+    // Create thread to simulate Device and Ground Nodes. 
+    CREATE_SIM_THREAD (true, true);
+
+    // Create process that calls entry. Expect this process to exit once the
+    // Control Node reaches STATE_F.
+    TEST_ENTRY_MODE_EXIT_ON_ERROR (gNmConfig, gDvConfig, gChConfig, gSmConfig, 
+                                   gFInitControllersSuccess,
+                                   ControlNode::COMMS_MODE_DEDICATED_THREAD);
+
+    // Wait for sim thread.
+    Error_t ret;
+    WAIT_FOR_THREAD (thread, pTm);
+
+    // Expect the comms thread to have exchanged data every loop.
+    uint32_t cnMsgsTxCount = 0;
+    uint32_t cnMsgsRxCount = 0;
+    CHECK_SUCCESS (gPTelemDv->read (DV_ELEM_CN_MSG_TX_COUNT, cnMsgsTxCount));
+    CHECK_SUCCESS (gPTelemDv->read (DV_ELEM_CN_MSG_RX_COUNT, cnMsgsRxCount));
+    CHECK_TRUE (cnMsgsTxCount > 3);
+    CHECK_TRUE (cnMsgsRxCount > 4);
+
+    // Expect no missed dn0-2 msgs. The comms thread has the full loop period
+    // to receive, so the delayed responses in STATE_E are not missed.
+    uint32_t dn0Misses = 0;
+    uint32_t dn1Misses = 0;
+    uint32_t dn2Misses = 0;
+    CHECK_SUCCESS (gPTelemDv->read (DV_ELEM_DN0_RX_MISS_COUNT, dn0Misses));
+    CHECK_SUCCESS (gPTelemDv->read (DV_ELEM_DN1_RX_MISS_COUNT, dn1Misses));
+    CHECK_SUCCESS (gPTelemDv->read (DV_ELEM_DN2_RX_MISS_COUNT, dn2Misses));
+    CHECK_EQUAL (0, dn0Misses);
+    CHECK_EQUAL (0, dn1Misses);
+    CHECK_EQUAL (0, dn2Misses);
+
+    // Expect 2 errors due to ErrorController (2 in STATE_D).
+    uint32_t numErrors = 0;
+    CHECK_SUCCESS (gPTelemDv->read (DV_ELEM_CN_ERROR_COUNT, numErrors));
+    CHECK_EQUAL (2, numErrors);
+
+    // Expect to end in STATE_F.
+    uint32_t state = STATE_A;
+    CHECK_SUCCESS (gPTelemDv->read (DV_ELEM_STATE, state));
+    CHECK_EQUAL (STATE_F, state);
+};
@@ -0,0 +1,147 @@
+#include "ControllerGraph.hpp"
+#include "TestController.hpp"
+
+/* All #include statements should come before the CppUTest include */
+#include "TestHelpers.hpp"
+
+/********************************* GLOBALS ************************************/
+
+/**
+ * Data Vector config.
+ */
+static DataVector::Config_t gDvConfig = 
+{
+    {DV_REG_TEST0,
+    {
+        DV_ADD_UINT8 (DV_ELEM_TEST_CONTROLLER_MODE, MODE_SAFED),
+        DV_ADD_UINT8 (DV_ELEM_TEST0,                0),
+        DV_ADD_UINT8 (DV_ELEM_TEST1,                0),
+        DV_ADD_UINT8 (DV_ELEM_TEST2,                0),
+        DV_ADD_UINT8 (DV_ELEM_TEST3,                0),
+        DV_ADD_UINT8 (DV_ELEM_TEST4,                0),
+    }},
+};
+
+/****************************** HELPER FUNCTIONS ******************************/
+
+/**
+ * Create a Test Controller and add it to a vector of Controllers.
+ *
+ * @param  kPDv      Data Vector.
+ * @param  kDeclared If true, declare kInputs and kOutputs.
+ * @param  kInputs   Elements the Controller reads.
+ * @param  kOutputs  Elements the Controller writes.
+ * @param  kPCtrls   Vector to add Controller to.
+ */
+static void addController (std::shared_ptr<DataVector> kPDv, bool kDeclared,
+                           std::vector<DataVectorElement_t> kInputs,
+                           std::vector<DataVectorElement_t> kOutputs,
+                           std::vector<std::unique_ptr<Controller>>& kPCtrls)
+{
+    std::unique_ptr<TestController> pCtrl = nullptr;
+    TestController::Config_t config = {true};
+    if (kDeclared == true)
+    {
+        CHECK_SUCCESS (Controller::createNew<TestController> (
+                           config, kPDv, DV_ELEM_TEST_CONTROLLER_MODE, pCtrl,
+                           kInputs, kOutputs));
+    }
+    else
+    {
+        CHECK_SUCCESS (Controller::createNew<TestController> (
+                           config, kPDv, DV_ELEM_TEST_CONTROLLER_MODE, pCtrl));
+    }
+    kPCtrls.push_back (std::move (pCtrl));
+}
+
+/**
+ * Create a Controller Graph and verify its levels.
+ *
+ * @param  kPCtrls           Controllers.
+ * @param  kExpectedLevels   Expected levels.
+ */
+static void checkLevels (std::vector<std::unique_ptr<Controller>>& kPCtrls,
+                         const ControllerGraph::Levels_t& kExpectedLevels)
+{
+    std::unique_ptr<ControllerGraph> pGraph = nullptr;
+    CHECK_SUCCESS (ControllerGraph::createNew (kPCtrls, pGraph));
+    CHECK_TRUE (pGraph->getLevels () == kExpectedLevels);
+}
+
+/********************************** TESTS *************************************/
+
+/* Test building the Controller Graph. */
+TEST_GROUP (ControllerGraph_Levels)
+{
+};
+
+/* Test a null Controller and an empty vector of Controllers. */
+TEST (ControllerGraph_Levels, InvalidAndEmpty)
+{
+    std::vector<std::unique_ptr<Controller>> pCtrls;
+    std::unique_ptr<ControllerGraph> pGraph = nullptr;
+    CHECK_SUCCESS (ControllerGraph::createNew (pCtrls, pGraph));
+    CHECK_TRUE (pGraph->getLevels ().empty ());
+
+    pCtrls.push_back (nullptr);
+    CHECK_ERROR (ControllerGraph::createNew (pCtrls, pGraph), 
+                 E_CONTROLLER_NULL);
+}
+
+/* Test that Controllers writing the same element are rejected. */
+TEST (ControllerGraph_Levels, WriteConflict)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+    std::vector<std::unique_ptr<Controller>> pCtrls;
+    addController (pDv, true, {DV_ELEM_TEST0}, {DV_ELEM_TEST1}, pCtrls);
+    addController (pDv, true, {DV_ELEM_TEST2}, {DV_ELEM_TEST3}, pCtrls);
+    addController (pDv, true, {DV_ELEM_TEST4}, {DV_ELEM_TEST1}, pCtrls);
+
+    std::unique_ptr<ControllerGraph> pGraph = nullptr;
+    CHECK_ERROR (ControllerGraph::createNew (pCtrls, pGraph), 
+                 E_WRITE_CONFLICT);
+}
+
+/* Test that independent Controllers share a level. */
+TEST (ControllerGraph_Levels, Independent)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+    std::vector<std::unique_ptr<Controller>> pCtrls;
+    addController (pDv, true, {DV_ELEM_TEST0}, {DV_ELEM_TEST1}, pCtrls);
+    addController (pDv, true, {DV_ELEM_TEST0}, {DV_ELEM_TEST2}, pCtrls);
+    addController (pDv, true, {}, {DV_ELEM_TEST3}, pCtrls);
+
+    checkLevels (pCtrls, {{0, 1, 2}});
+}
+
+/* Test read-after-write and write-after-read dependencies. */
+TEST (ControllerGraph_Levels, Dependencies)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+    std::vector<std::unique_ptr<Controller>> pCtrls;
+
+    // 0 writes 1. 1 reads 1 (after 0). 2 writes 0, which 0 reads (after 0). 
+    // 3 reads 2, which 1 writes (after 1). 4 is independent.
+    addController (pDv, true, {DV_ELEM_TEST0}, {DV_ELEM_TEST1}, pCtrls);
+    addController (pDv, true, {DV_ELEM_TEST1}, {DV_ELEM_TEST2}, pCtrls);
+    addController (pDv, true, {}, {DV_ELEM_TEST0}, pCtrls);
+    addController (pDv, true, {DV_ELEM_TEST2}, {DV_ELEM_TEST3}, pCtrls);
+    addController (pDv, true, {}, {DV_ELEM_TEST4}, pCtrls);
+
+    checkLevels (pCtrls, {{0, 4}, {1, 2}, {3}});
+}
+
+/* Test that a Controller without declared elements runs alone, between the
+   Controllers before and after it. */
+TEST (ControllerGraph_Levels, Undeclared)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+    std::vector<std::unique_ptr<Controller>> pCtrls;
+    addController (pDv, true, {DV_ELEM_TEST0}, {DV_ELEM_TEST1}, pCtrls);
+    addController (pDv, true, {DV_ELEM_TEST0}, {DV_ELEM_TEST2}, pCtrls);
+    addController (pDv, false, {}, {}, pCtrls);
+    addController (pDv, true, {DV_ELEM_TEST0}, {DV_ELEM_TEST3}, pCtrls);
+    addController (pDv, true, {DV_ELEM_TEST0}, {DV_ELEM_TEST4}, pCtrls);
+
+    checkLevels (pCtrls, {{0, 1}, {2}, {3, 4}});
+}
@@ -14,9 +14,67 @@ static DataVector::Config_t gDvConfig =
     {DV_REG_TEST0,
     {
         DV_ADD_UINT8 (DV_ELEM_TEST_CONTROLLER_MODE, MODE_SAFED),
+        DV_ADD_UINT8 (DV_ELEM_TEST0,                0),
+        DV_ADD_UINT8 (DV_ELEM_TEST1,                0),
+        DV_ADD_BOOL  (DV_ELEM_TEST2,                false),
     }},
 };
 
+/**
+ * Controller that binds its input and output. Writes the input plus 1 to the
+ * output when enabled and 0 when safed.
+ */
+class BoundTestController final : public Controller
+{
+    public:
+
+        /* Controller configuration. */
+        typedef struct Config
+        {
+            DataVectorElement_t inputElem;
+            DataVectorElement_t outputElem;
+        } Config_t;
+
+        BoundTestController (Config_t kConfig, 
+                             std::shared_ptr<DataVector> kPDataVector,
+                             DataVectorElement_t kDvModeElem) :
+            Controller (kPDataVector, kDvModeElem),
+            mConfig (kConfig), mInput (0), mOutput (0) {}
+
+        Error_t verifyConfig ()
+        {
+            return E_SUCCESS;
+        }
+
+    private:
+
+        Config_t mConfig;
+        uint8_t mInput;
+        uint8_t mOutput;
+
+        Error_t runEnabled ()
+        {
+            mOutput = mInput + 1;
+            return E_SUCCESS;
+        }
+
+        Error_t runSafed ()
+        {
+            mOutput = 0;
+            return E_SUCCESS;
+        }
+
+        Error_t bindIo ()
+        {
+            Error_t ret = bindInput (mConfig.inputElem, mInput);
+            if (ret != E_SUCCESS)
+            {
+                return ret;
+            }
+            return bindOutput (mConfig.outputElem, mOutput);
+        }
+};
+
 TEST_GROUP (ControllerTest)
 {
     void setup()
@@ -99,6 +157,57 @@ TEST (ControllerTest, InitInvalidDVElem)
     POINTERS_EQUAL (pInvalid.get (), nullptr);
 }
 
+/* Test initialization of controller with invalid declared inputs and 
+   outputs. */
+TEST (ControllerTest, InitInvalidIo)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+
+    std::unique_ptr<TestController> pInvalid = nullptr;
+    TestController::Config_t config = {true}; 
+    CHECK_ERROR (Controller::createNew<TestController> (
+                     config, pDv,
+                     DV_ELEM_TEST_CONTROLLER_MODE,
+                     pInvalid, {DV_ELEM_TEST0, DV_ELEM_TEST2}, {}),
+                 E_INVALID_ELEM);
+    POINTERS_EQUAL (pInvalid.get (), nullptr);
+    CHECK_ERROR (Controller::createNew<TestController> (
+                     config, pDv,
+                     DV_ELEM_TEST_CONTROLLER_MODE,
+                     pInvalid, {}, {DV_ELEM_TEST2}),
+                 E_INVALID_ELEM);
+    POINTERS_EQUAL (pInvalid.get (), nullptr);
+}
+
+/* Test declaring a controller's inputs and outputs. */
+TEST (ControllerTest, InitIo)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+
+    // Expect undeclared by default.
+    std::unique_ptr<TestController> pTestController = nullptr;
+    TestController::Config_t conConfig = {true};
+    CHECK_SUCCESS (Controller::createNew<TestController> (
+                       conConfig, pDv,
+                       DV_ELEM_TEST_CONTROLLER_MODE,
+                       pTestController));
+    CHECK_FALSE (pTestController->isIoDeclared ());
+    CHECK_TRUE (pTestController->getInputs ().empty ());
+    CHECK_TRUE (pTestController->getOutputs ().empty ());
+
+    // Expect the mode element to be added to the declared inputs.
+    CHECK_SUCCESS (Controller::createNew<TestController> (
+                       conConfig, pDv,
+                       DV_ELEM_TEST_CONTROLLER_MODE,
+                       pTestController, {DV_ELEM_TEST0}, {DV_ELEM_TEST1}));
+    CHECK_TRUE (pTestController->isIoDeclared ());
+    std::vector<DataVectorElement_t> expectedInputs = 
+        {DV_ELEM_TEST0, DV_ELEM_TEST_CONTROLLER_MODE};
+    std::vector<DataVectorElement_t> expectedOutputs = {DV_ELEM_TEST1};
+    CHECK_TRUE (pTestController->getInputs () == expectedInputs);
+    CHECK_TRUE (pTestController->getOutputs () == expectedOutputs);
+}
+
 /* Test mode setters and getters. */
 TEST (ControllerTest, SetMode)
 {
@@ -158,3 +267,64 @@ TEST (ControllerTest, Run)
     CHECK_SUCCESS (Log::verify (*gPExpectedLog, *gPTestLog, logsEqual));
     CHECK_TRUE (logsEqual); 
 }
+
+/* Test initialization of a bound controller with an element of the wrong 
+   type. */
+TEST (ControllerTest, InitInvalidBinding)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+
+    std::unique_ptr<BoundTestController> pInvalid = nullptr;
+    BoundTestController::Config_t config = {DV_ELEM_TEST0, DV_ELEM_TEST2};
+    CHECK_ERROR (Controller::createNew<BoundTestController> (
+                     config, pDv,
+                     DV_ELEM_TEST_CONTROLLER_MODE,
+                     pInvalid),
+                 E_INCORRECT_TYPE);
+    POINTERS_EQUAL (pInvalid.get (), nullptr);
+}
+
+/* Test running a bound controller in ENABLED and SAFED modes. */
+TEST (ControllerTest, RunBound)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+
+    std::unique_ptr<BoundTestController> pCtrl = nullptr;
+    BoundTestController::Config_t config = {DV_ELEM_TEST0, DV_ELEM_TEST1};
+    CHECK_SUCCESS (Controller::createNew<BoundTestController> (
+                       config, pDv,
+                       DV_ELEM_TEST_CONTROLLER_MODE,
+                       pCtrl));
+
+    // Expect the bound elements to be declared.
+    std::vector<DataVectorElement_t> expectedInputs = 
+        {DV_ELEM_TEST0, DV_ELEM_TEST_CONTROLLER_MODE};
+    std::vector<DataVectorElement_t> expectedOutputs = {DV_ELEM_TEST1};
+    CHECK_TRUE (pCtrl->isIoDeclared ());
+    CHECK_TRUE (pCtrl->getInputs () == expectedInputs);
+    CHECK_TRUE (pCtrl->getOutputs () == expectedOutputs);
+
+    // Expect the input and mode to be read before running and the output to 
+    // be written after.
+    uint8_t output = 0xFF;
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST0, (uint8_t) 5));
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST_CONTROLLER_MODE, 
+                               (uint8_t) MODE_ENABLED));
+    CHECK_SUCCESS (pCtrl->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, output));
+    CHECK_EQUAL (6, output);
+
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST_CONTROLLER_MODE, 
+                               (uint8_t) MODE_SAFED));
+    CHECK_SUCCESS (pCtrl->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, output));
+    CHECK_EQUAL (0, output);
+
+    // Expect an invalid mode to fail without writing the output.
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST1, (uint8_t) 0xFF));
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST_CONTROLLER_MODE, 
+                               (uint8_t) MODE_LAST));
+    CHECK_ERROR (pCtrl->run (), E_INVALID_ENUM);
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, output));
+    CHECK_EQUAL (0xFF, output);
+}
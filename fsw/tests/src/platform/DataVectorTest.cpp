@@ -3,6 +3,7 @@
 #include <sstream>
 #include <limits>
 #include <tuple>
+#include <unistd.h>
 
 #include "Errors.hpp"
 #include "DataVector.hpp"
@@ -1247,6 +1248,60 @@ TEST (DataVector_readWrite, SuccessfulWrite)
     checkMultiElemWriteSuccess ();
 }
 
+/* Test Data Vector bind, readBindings, and writeBindings methods. */
+TEST_GROUP (DataVector_bindings)
+{
+
+};
+
+/* Test binding invalid elem and elem with incorrect type. */
+TEST (DataVector_bindings, InvalidBind)
+{
+    // Create DV
+    INIT_DATA_VECTOR (gMultiElemConfig);
+
+    bool value = false;
+    DataVector::ElementBinding_t binding;
+    CHECK_ERROR (pDv->bind (DV_ELEM_TEST46, value, binding), E_INVALID_ELEM);
+    CHECK_ERROR (pDv->bind (DV_ELEM_TEST0, value, binding), E_INCORRECT_TYPE);
+}
+
+/* Test reading and writing bound elements. */
+TEST (DataVector_bindings, Success)
+{
+    // Create DV
+    INIT_DATA_VECTOR (gMultiElemConfig);
+
+    // Bind elements.
+    uint8_t  value8 = 0xFF;
+    uint16_t value16 = 0;
+    uint32_t value32 = 0;
+    std::vector<DataVector::ElementBinding_t> bindings (3);
+    CHECK_SUCCESS (pDv->bind (DV_ELEM_TEST0, value8, bindings[0]));
+    CHECK_SUCCESS (pDv->bind (DV_ELEM_TEST5, value16, bindings[1]));
+    CHECK_SUCCESS (pDv->bind (DV_ELEM_TEST7, value32, bindings[2]));
+
+    // Read initial values.
+    CHECK_SUCCESS (pDv->readBindings (bindings));
+    CHECK_EQUAL (0, value8);
+    CHECK_EQUAL (std::numeric_limits<uint16_t>::max (), value16);
+    CHECK_EQUAL (1, value32);
+
+    // Write new values and verify with read.
+    value8 = 1;
+    value16 = 2;
+    value32 = 3;
+    CHECK_SUCCESS (pDv->writeBindings (bindings));
+    CHECK_READ_SUCCESS (DV_ELEM_TEST0, value8,  (uint8_t)  1);
+    CHECK_READ_SUCCESS (DV_ELEM_TEST5, value16, (uint16_t) 2);
+    CHECK_READ_SUCCESS (DV_ELEM_TEST7, value32, (uint32_t) 3);
+
+    // Verify an empty set of bindings is a no-op.
+    std::vector<DataVector::ElementBinding_t> empty;
+    CHECK_SUCCESS (pDv->readBindings (empty));
+    CHECK_SUCCESS (pDv->writeBindings (empty));
+}
+
 /****************************** INCREMENT TESTS *******************************/
 
 DataVector::Config_t gIncrementConfig = 
@@ -1543,6 +1598,72 @@ TEST (DataVector_readRegionWriteRegion, Success)
     CHECK (dvBuf == dvExpBufAfterWrites);
 }
 
+/* Test reading an element from a region buffer with invalid params. */
+TEST (DataVector_readRegionWriteRegion, ReadFromRegionBufInvalid)
+{
+    // Create DV
+    INIT_DATA_VECTOR (gReadRegionWriteRegionConfig);
+
+    std::vector<uint8_t> reg0Buf = {0x7, 0x0};
+    uint8_t valUint8 = 0;
+    bool valBool = false;
+    float valFloat = 0;
+
+    // Region not in DV.
+    CHECK_ERROR (pDv->readFromRegionBuf (DV_REG_TEST2, reg0Buf, DV_ELEM_TEST0,
+                                         valUint8),
+                 E_INVALID_REGION);
+
+    // Buffer size does not match region.
+    std::vector<uint8_t> badSizeBuf (3);
+    CHECK_ERROR (pDv->readFromRegionBuf (DV_REG_TEST0, badSizeBuf,
+                                         DV_ELEM_TEST0, valUint8),
+                 E_INCORRECT_SIZE);
+
+    // Element not in DV.
+    CHECK_ERROR (pDv->readFromRegionBuf (DV_REG_TEST0, reg0Buf, DV_ELEM_TEST3,
+                                         valUint8),
+                 E_INVALID_ELEM);
+
+    // Incorrect type.
+    CHECK_ERROR (pDv->readFromRegionBuf (DV_REG_TEST0, reg0Buf, DV_ELEM_TEST0,
+                                         valBool),
+                 E_INCORRECT_TYPE);
+
+    // Element not in region.
+    CHECK_ERROR (pDv->readFromRegionBuf (DV_REG_TEST0, reg0Buf, DV_ELEM_TEST2,
+                                         valFloat),
+                 E_INVALID_ELEM);
+}
+
+/* Test reading elements from a region buffer. */
+TEST (DataVector_readRegionWriteRegion, ReadFromRegionBufSuccess)
+{
+    // Create DV
+    INIT_DATA_VECTOR (gReadRegionWriteRegionConfig);
+
+    std::vector<uint8_t> reg0Buf = {0x7, 0x0};
+    std::vector<uint8_t> reg1Buf = {0x00, 0x00, 0x80, 0x3f};
+    uint8_t valUint8 = 0;
+    bool valBool = true;
+    float valFloat = 0;
+    CHECK_SUCCESS (pDv->readFromRegionBuf (DV_REG_TEST0, reg0Buf,
+                                           DV_ELEM_TEST0, valUint8));
+    CHECK_SUCCESS (pDv->readFromRegionBuf (DV_REG_TEST0, reg0Buf,
+                                           DV_ELEM_TEST1, valBool));
+    CHECK_SUCCESS (pDv->readFromRegionBuf (DV_REG_TEST1, reg1Buf,
+                                           DV_ELEM_TEST2, valFloat));
+    CHECK_EQUAL (7, valUint8);
+    CHECK_EQUAL (false, valBool);
+    CHECK_EQUAL (1.0, valFloat);
+
+    // Verify the Data Vector was not modified.
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, valUint8));
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, valBool));
+    CHECK_EQUAL (0, valUint8);
+    CHECK_EQUAL (true, valBool);
+}
+
 /*********************** READDATAVECTOR/WRITEDATAVECTOR TESTS *************************/
 
 DataVector::Config_t gReadDataVectorWriteDataVectorConfig = {
@@ -1623,6 +1744,46 @@ TEST (DataVector_readDataVectorWriteDataVector, Success)
     CHECK (dvBuf == dvWriteBuf);
 }
 
+/* Test that prefaulting the Data Vector does not change its contents. */
+TEST (DataVector_readDataVectorWriteDataVector, Prefault)
+{
+    // Create DV
+    INIT_DATA_VECTOR (gReadDataVectorWriteDataVectorConfig);
+
+    CHECK_SUCCESS (pDv->prefault (false));
+
+    std::vector<uint8_t> dvBuf (2);
+    CHECK_SUCCESS (pDv->readDataVector (dvBuf));
+    std::vector<uint8_t> dvExpBuf = {0x0, 0x1};
+    CHECK (dvBuf == dvExpBuf);
+}
+
+/* Test that prefaulting the Data Vector with huge pages does not change its 
+   contents and that it can still be written. Requires a kernel built with 
+   transparent huge pages. */
+TEST (DataVector_readDataVectorWriteDataVector, PrefaultHugePages)
+{
+    if (access ("/sys/kernel/mm/transparent_hugepage/enabled", F_OK) != 0)
+    {
+        return;
+    }
+
+    // Create DV
+    INIT_DATA_VECTOR (gReadDataVectorWriteDataVectorConfig);
+
+    CHECK_SUCCESS (pDv->prefault (true));
+
+    std::vector<uint8_t> dvBuf (2);
+    CHECK_SUCCESS (pDv->readDataVector (dvBuf));
+    std::vector<uint8_t> dvExpBuf = {0x0, 0x1};
+    CHECK (dvBuf == dvExpBuf);
+
+    std::vector<uint8_t> dvWriteBuf = {0x2, 0x3};
+    CHECK_SUCCESS (pDv->writeDataVector (dvWriteBuf));
+    CHECK_SUCCESS (pDv->readDataVector (dvBuf));
+    CHECK (dvBuf == dvWriteBuf);
+}
+
 /**************************** SYNCHRONIZATION TESTS ***************************/
 
 /**
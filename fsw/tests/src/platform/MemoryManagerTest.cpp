@@ -0,0 +1,149 @@
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "MemoryManager.hpp"
+
+/* All #include statements should come before the CppUTest include */
+#include "TestHelpers.hpp"
+
+/********************************* GLOBALS ************************************/
+
+/**
+ * Number of pages in each test mapping.
+ */
+static const uint32_t NUM_PAGES = 16;
+
+/****************************** HELPER FUNCTIONS ******************************/
+
+/**
+ * Map NUM_PAGES pages of anonymous memory. None of the pages are faulted in
+ * unless memory is locked.
+ *
+ * @param  kPageSize  Page size.
+ *
+ * @ret    Mapping.
+ */
+static uint8_t* mapPages (uint32_t kPageSize)
+{
+    void* pMap = mmap (nullptr, NUM_PAGES * kPageSize, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    CHECK_TRUE (pMap != MAP_FAILED);
+    return (uint8_t*) pMap;
+}
+
+/**
+ * Write to each page of a NUM_PAGES mapping and return the number of minor
+ * page faults taken.
+ *
+ * @param  kPMap      Mapping.
+ * @param  kPageSize  Page size.
+ *
+ * @ret    Number of minor page faults.
+ */
+static uint64_t writePages (uint8_t* kPMap, uint32_t kPageSize)
+{
+    MemoryManager::PageFaults_t start = {0, 0};
+    MemoryManager::PageFaults_t end = {0, 0};
+    CHECK_SUCCESS (MemoryManager::getPageFaults (start));
+    for (uint32_t i = 0; i < NUM_PAGES; i++)
+    {
+        ((volatile uint8_t*) kPMap)[i * kPageSize] = 1;
+    }
+    CHECK_SUCCESS (MemoryManager::getPageFaults (end));
+    return end.minor - start.minor;
+}
+
+/********************************** TESTS *************************************/
+
+/* Test prefaulting buffers. */
+TEST_GROUP (MemoryManager_Prefault)
+{
+};
+
+/* Test prefaulting a null or empty buffer. */
+TEST (MemoryManager_Prefault, InvalidBuffer)
+{
+    uint8_t buf = 0;
+    CHECK_ERROR (MemoryManager::prefault (nullptr, 1, false),
+                 E_INVALID_POINTER);
+    CHECK_SUCCESS (MemoryManager::prefault (&buf, 0, false));
+}
+
+/* Test that writing to untouched pages faults and that writing to prefaulted
+   pages does not. */
+TEST (MemoryManager_Prefault, NoFaultsAfterPrefault)
+{
+    uint32_t pageSize = sysconf (_SC_PAGESIZE);
+
+    // Expect a fault per page without prefaulting.
+    uint8_t* pMap = mapPages (pageSize);
+    CHECK_TRUE (writePages (pMap, pageSize) >= NUM_PAGES);
+    munmap (pMap, NUM_PAGES * pageSize);
+
+    // Expect no faults after prefaulting. Prefault from an unaligned address
+    // to verify every page covered by the buffer is faulted in.
+    pMap = mapPages (pageSize);
+    CHECK_SUCCESS (MemoryManager::prefault (pMap + 1,
+                                            NUM_PAGES * pageSize - 1, false));
+    CHECK_EQUAL (0, writePages (pMap, pageSize));
+    munmap (pMap, NUM_PAGES * pageSize);
+}
+
+/* Test that prefaulting does not change a buffer's contents. */
+TEST (MemoryManager_Prefault, ContentsUnchanged)
+{
+    std::vector<uint8_t> buf (3 * sysconf (_SC_PAGESIZE));
+    for (uint32_t i = 0; i < buf.size (); i++)
+    {
+        buf[i] = i % 256;
+    }
+    CHECK_SUCCESS (MemoryManager::prefault (buf.data (), buf.size (), false));
+    for (uint32_t i = 0; i < buf.size (); i++)
+    {
+        CHECK_EQUAL (i % 256, buf[i]);
+    }
+}
+
+/* Test that the huge page allocator aligns allocations to whole huge pages 
+   only when asked to. */
+TEST (MemoryManager_Prefault, HugePageAllocator)
+{
+    typedef MemoryManager::HugePageAllocator<uint8_t> Allocator_t;
+    CHECK_EQUAL (MemoryManager::HUGE_PAGE_BYTES, 
+                 MemoryManager::toHugePageBytes (1));
+    CHECK_EQUAL (2 * MemoryManager::HUGE_PAGE_BYTES, 
+                 MemoryManager::toHugePageBytes (
+                                        MemoryManager::HUGE_PAGE_BYTES + 1));
+
+    // Aligned. Stays aligned as the buffer grows.
+    std::vector<uint8_t, Allocator_t> buf ((Allocator_t (true)));
+    buf.resize (1);
+    CHECK_EQUAL (0, (uintptr_t) buf.data () % MemoryManager::HUGE_PAGE_BYTES);
+    buf.resize (3 * MemoryManager::HUGE_PAGE_BYTES / 2);
+    CHECK_EQUAL (0, (uintptr_t) buf.data () % MemoryManager::HUGE_PAGE_BYTES);
+
+    // Allocators with different alignment are not equal.
+    CHECK_TRUE (Allocator_t (true) == Allocator_t (true));
+    CHECK_TRUE (Allocator_t (true) != Allocator_t (false));
+}
+
+/* Test locking all memory. */
+TEST_GROUP (MemoryManager_Lock)
+{
+    void teardown ()
+    {
+        munlockall ();
+    }
+};
+
+/* Test that memory mapped after locking is already faulted in. */
+TEST (MemoryManager_Lock, FutureMappingsPrefaulted)
+{
+    uint32_t pageSize = sysconf (_SC_PAGESIZE);
+    CHECK_SUCCESS (MemoryManager::lockAll (MemoryManager::STACK_PREFAULT_BYTES,
+                                           MemoryManager::HEAP_RESERVE_BYTES));
+
+    uint8_t* pMap = mapPages (pageSize);
+    CHECK_EQUAL (0, writePages (pMap, pageSize));
+    munmap (pMap, NUM_PAGES * pageSize);
+}
@@ -0,0 +1,51 @@
+#include "MockFifoBackend.hpp"
+
+Error_t MockFifoBackend::start (size_t kDepth)
+{
+    mDepth = kDepth;
+    return E_SUCCESS;
+}
+
+Error_t MockFifoBackend::acquire (size_t kNumElems,
+                                  const uint32_t*& kPElemsRet,
+                                  bool& kAcquiredRet,
+                                  size_t& kNumRemainingRet)
+{
+    if (failAcquire == true || mNumAcquired != 0)
+    {
+        return E_FPGA_FIFO;
+    }
+
+    kAcquiredRet = mElems.size () >= kNumElems;
+    if (kAcquiredRet == true)
+    {
+        kPElemsRet = mElems.data ();
+        mNumAcquired = kNumElems;
+    }
+    kNumRemainingRet = mElems.size () - mNumAcquired;
+
+    return E_SUCCESS;
+}
+
+Error_t MockFifoBackend::release (size_t kNumElems)
+{
+    if (kNumElems > mNumAcquired)
+    {
+        return E_FPGA_FIFO;
+    }
+
+    mElems.erase (mElems.begin (), mElems.begin () + kNumElems);
+    mNumAcquired -= kNumElems;
+    return E_SUCCESS;
+}
+
+Error_t MockFifoBackend::push (const std::vector<uint32_t>& kElems)
+{
+    if (mElems.size () + kElems.size () > mDepth)
+    {
+        return E_INCORRECT_SIZE;
+    }
+
+    mElems.insert (mElems.end (), kElems.begin (), kElems.end ());
+    return E_SUCCESS;
+}
@@ -456,6 +456,71 @@ TEST (NetworkManager_Send, SendInvalidNode)
     CHECK_DV (0, 0, 0, 0, 0, 0);
 }
 
+/* Group of tests to verify sendMult. */
+TEST_GROUP (NetworkManager_SendMult)
+{
+
+};
+
+/* Test sendMult with different size vectors. */
+TEST (NetworkManager_SendMult, DiffVectorSizes)
+{
+    INIT_NETWORK_MANAGERS
+
+    std::vector<Node_t> nodes = {NODE_DEVICE0, NODE_DEVICE1};
+    std::vector<std::vector<uint8_t>> sendBufs = {{0xff}};
+    CHECK_ERROR (pNmCtrl->sendMult (nodes, sendBufs), E_VECTORS_DIFF_SIZES);
+
+    // Expect no msgs tx'd/rx'd.
+    CHECK_DV (0, 0, 0, 0, 0, 0);
+}
+
+/* Test sendMult with an empty buffer. */
+TEST (NetworkManager_SendMult, EmptyBuffer)
+{
+    INIT_NETWORK_MANAGERS
+
+    std::vector<Node_t> nodes = {NODE_DEVICE0, NODE_DEVICE1};
+    std::vector<std::vector<uint8_t>> sendBufs = {{0xff}, {}};
+    CHECK_ERROR (pNmCtrl->sendMult (nodes, sendBufs), E_EMPTY_BUFFER);
+
+    // Expect no msgs tx'd/rx'd.
+    CHECK_DV (0, 0, 0, 0, 0, 0);
+}
+
+/* Test sendMult with an invalid node. Expect no messages sent. */
+TEST (NetworkManager_SendMult, InvalidNode)
+{
+    INIT_NETWORK_MANAGERS
+
+    std::vector<Node_t> nodes = {NODE_DEVICE0, NODE_DEVICE2};
+    std::vector<std::vector<uint8_t>> sendBufs = {{0xff}, {0x01}};
+    CHECK_ERROR (pNmCtrl->sendMult (nodes, sendBufs), E_INVALID_NODE);
+
+    // Expect no msgs tx'd/rx'd.
+    CHECK_DV (0, 0, 0, 0, 0, 0);
+}
+
+/* Send one message to each node and receive them successfully. */
+TEST (NetworkManager_SendMult, Success)
+{
+    INIT_NETWORK_MANAGERS
+
+    std::vector<Node_t> nodes = {NODE_DEVICE0, NODE_DEVICE1};
+    std::vector<std::vector<uint8_t>> sendBufs = {{0xff}, {0x01}};
+    std::vector<uint8_t> recvBuf (1, 0);
+    CHECK_SUCCESS (pNmCtrl->sendMult (nodes, sendBufs));
+
+    // Receive using recvBlock and verify buffers.
+    CHECK_SUCCESS (pNmDev0->recvBlock (NODE_CONTROL, recvBuf));
+    CHECK (sendBufs[0] == recvBuf);
+    CHECK_SUCCESS (pNmDev1->recvBlock (NODE_CONTROL, recvBuf));
+    CHECK (sendBufs[1] == recvBuf);
+
+    // Expect 2 msgs sent from ctrl and 1 msg rx'd by each dn.
+    CHECK_DV (2, 0, 0, 1, 0, 1);
+}
+
 /* Group of tests to verify recvBlock param checking. */
 TEST_GROUP (NetworkManager_RecvBlock)
 {
@@ -1095,6 +1160,56 @@ TEST (NetworkManager_RecvMult, MsgsRxdBeforeRecvMult)
     CHECK_DV (0, 2, 1, 0, 1, 0);
 }
 
+/* Test recvMult returns before timeout once all nodes have reported. */
+TEST (NetworkManager_RecvMult, ReturnOnAllReceived)
+{
+    INIT_NETWORK_MANAGERS
+
+    // Init Time Module to measure time recvMult takes.
+    Time* pTime;
+    Time::getInstance (pTime);
+
+    // Set up params.
+    const Time::TimeNs_t TIMEOUT_NS  = 100 * Time::NS_IN_MS;
+    std::vector<Node_t> nodes = {NODE_DEVICE0, NODE_DEVICE1};
+    std::vector<uint8_t> sendBuf0 = {0x10, 0x01};
+    std::vector<uint8_t> sendBuf1 = {0x01, 0x10};
+    std::vector<std::vector<uint8_t>> bufs (2);
+    bufs[0].resize (2);
+    bufs[1].resize (2);
+    std::vector<uint32_t> msgsReceived (2);
+
+    // Send messages to Control Node.
+    CHECK_SUCCESS (pNmDev0->send (NODE_CONTROL, sendBuf0));
+    CHECK_SUCCESS (pNmDev1->send (NODE_CONTROL, sendBuf1));
+
+    // Receive messages from Device Nodes. Time receive to ensure returns well
+    // before timeout.
+    Time::TimeNs_t startNs;
+    Time::TimeNs_t endNs;
+    pTime->getTimeNs (startNs);
+    CHECK_SUCCESS (pNmCtrl->recvMult (TIMEOUT_NS, nodes, bufs, msgsReceived,
+                                      true));
+    pTime->getTimeNs (endNs);
+
+    // Verify buffers match.
+    CHECK (bufs[0] == sendBuf0);
+    CHECK (bufs[1] == sendBuf1);
+
+    // Verify returned well before timeout.
+    Time::TimeNs_t elapsedNs = endNs - startNs;
+    CHECK (elapsedNs < SELECT_OVERHEAD_NS);
+
+    // Verify msgsReceived all set to 1.
+    for (uint8_t i = 0; i < msgsReceived.size (); i++)
+    {
+        CHECK_EQUAL (1, msgsReceived[i]);
+    }
+
+    // Expect all msgs tx'd/rx'd.
+    CHECK_DV (0, 2, 1, 0, 1, 0);
+}
+
 /* Test receiving no messages. */
 TEST (NetworkManager_RecvMult, NoMsgs)
 {
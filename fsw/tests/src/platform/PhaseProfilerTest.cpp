@@ -0,0 +1,286 @@
+#include <unistd.h>
+
+#include "PhaseProfiler.hpp"
+
+/* All #include statements should come before the CppUTest include */
+#include "TestHelpers.hpp"
+
+/********************************* MACROS *************************************/
+
+/**
+ * Initialize DV and profiler using global configs.
+ */
+#define INIT_PP_SUCCESS                                                        \
+    INIT_DATA_VECTOR (gDvConfig);                                              \
+    std::unique_ptr<PhaseProfiler> pPp = nullptr;                              \
+    CHECK_SUCCESS (PhaseProfiler::createNew (gPpConfig, pDv, pPp));
+
+/**
+ * Read a phase's stats from the DV.
+ *
+ * @param  kPhaseConfig  Phase config to read stats of.
+ */
+#define READ_STATS(kPhaseConfig)                                               \
+    uint32_t wallMinNs = 0;                                                    \
+    uint32_t wallMaxNs = 0;                                                    \
+    uint32_t wallP99Ns = 0;                                                    \
+    uint32_t cpuMinNs = 0;                                                     \
+    uint32_t cpuMaxNs = 0;                                                     \
+    uint32_t cpuP99Ns = 0;                                                     \
+    CHECK_SUCCESS (pDv->read (kPhaseConfig.wallMinNs, wallMinNs));             \
+    CHECK_SUCCESS (pDv->read (kPhaseConfig.wallMaxNs, wallMaxNs));             \
+    CHECK_SUCCESS (pDv->read (kPhaseConfig.wallP99Ns, wallP99Ns));             \
+    CHECK_SUCCESS (pDv->read (kPhaseConfig.cpuMinNs, cpuMinNs));               \
+    CHECK_SUCCESS (pDv->read (kPhaseConfig.cpuMaxNs, cpuMaxNs));               \
+    CHECK_SUCCESS (pDv->read (kPhaseConfig.cpuP99Ns, cpuP99Ns));
+
+/********************************* GLOBALS ************************************/
+
+/**
+ * Global DV config containing elems for 2 phases.
+ */
+static DataVector::Config_t gDvConfig =
+{
+    {DV_REG_TEST0,
+    {
+        DV_ADD_UINT32 ( DV_ELEM_TEST0,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST1,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST2,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST3,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST4,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST5,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST6,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST7,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST8,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST9,  0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST10, 0 ),
+        DV_ADD_UINT32 ( DV_ELEM_TEST11, 0 ),
+        DV_ADD_UINT8  ( DV_ELEM_TEST12, 0 ),
+    }},
+};
+
+/**
+ * Global valid profiler config.
+ */
+static PhaseProfiler::Config_t gPpConfig =
+{
+    {DV_ELEM_TEST0, DV_ELEM_TEST1, DV_ELEM_TEST2,
+     DV_ELEM_TEST3, DV_ELEM_TEST4, DV_ELEM_TEST5},
+    {DV_ELEM_TEST6, DV_ELEM_TEST7, DV_ELEM_TEST8,
+     DV_ELEM_TEST9, DV_ELEM_TEST10, DV_ELEM_TEST11},
+};
+
+/********************************** TESTS *************************************/
+
+/* Test config error handling. */
+TEST_GROUP (PhaseProfiler_Config)
+{
+};
+
+/* Test initialization of profiler with null DV. */
+TEST (PhaseProfiler_Config, NullDv)
+{
+    std::unique_ptr<PhaseProfiler> pPp = nullptr;
+    CHECK_ERROR (PhaseProfiler::createNew (gPpConfig, nullptr, pPp),
+                 E_DATA_VECTOR_NULL);
+}
+
+/* Test initialization of profiler with no phases. */
+TEST (PhaseProfiler_Config, EmptyConfig)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+
+    std::unique_ptr<PhaseProfiler> pPp = nullptr;
+    PhaseProfiler::Config_t ppConfig;
+    CHECK_ERROR (PhaseProfiler::createNew (ppConfig, pDv, pPp),
+                 E_EMPTY_CONFIG);
+}
+
+/* Test initialization of profiler with an element not in DV. */
+TEST (PhaseProfiler_Config, InvalidElem)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+
+    std::unique_ptr<PhaseProfiler> pPp = nullptr;
+    PhaseProfiler::Config_t ppConfig = gPpConfig;
+    ppConfig[1].cpuP99Ns = DV_ELEM_TEST13;
+    CHECK_ERROR (PhaseProfiler::createNew (ppConfig, pDv, pPp),
+                 E_INVALID_ELEM);
+}
+
+/* Test initialization of profiler with an element of the wrong type. */
+TEST (PhaseProfiler_Config, InvalidType)
+{
+    INIT_DATA_VECTOR (gDvConfig);
+
+    std::unique_ptr<PhaseProfiler> pPp = nullptr;
+    PhaseProfiler::Config_t ppConfig = gPpConfig;
+    ppConfig[0].wallMaxNs = DV_ELEM_TEST12;
+    CHECK_ERROR (PhaseProfiler::createNew (ppConfig, pDv, pPp),
+                 E_INVALID_TYPE);
+}
+
+/* Test successful initialization. */
+TEST (PhaseProfiler_Config, Success)
+{
+    INIT_PP_SUCCESS;
+}
+
+/* Test profiling phases. */
+TEST_GROUP (PhaseProfiler_Profile)
+{
+};
+
+/* Test starting and ending a phase not in the config. */
+TEST (PhaseProfiler_Profile, InvalidPhase)
+{
+    INIT_PP_SUCCESS;
+
+    CHECK_ERROR (pPp->startPhase (2), E_INVALID_PHASE);
+    CHECK_ERROR (pPp->endPhase (2), E_INVALID_PHASE);
+}
+
+/* Test ending a phase that was not started. */
+TEST (PhaseProfiler_Profile, NotStarted)
+{
+    INIT_PP_SUCCESS;
+
+    CHECK_ERROR (pPp->endPhase (0), E_PHASE_NOT_STARTED);
+
+    // Phase can only be ended once per start.
+    CHECK_SUCCESS (pPp->startPhase (0));
+    CHECK_SUCCESS (pPp->endPhase (0));
+    CHECK_ERROR (pPp->endPhase (0), E_PHASE_NOT_STARTED);
+}
+
+/* Test that stats are only written once a window fills and that the p99
+   excludes a single outlier. */
+TEST (PhaseProfiler_Profile, WindowStats)
+{
+    INIT_PP_SUCCESS;
+
+    // Fill all but one sample of phase 0's window. One sample sleeps to create
+    // an outlier.
+    const uint32_t SLEEP_US = 2000;
+    for (uint32_t i = 0; i < PhaseProfiler::WINDOW_SIZE - 1; i++)
+    {
+        CHECK_SUCCESS (pPp->startPhase (0));
+        if (i == 0)
+        {
+            usleep (SLEEP_US);
+        }
+        CHECK_SUCCESS (pPp->endPhase (0));
+    }
+
+    // Expect no stats written yet.
+    {
+        READ_STATS (gPpConfig[0]);
+        CHECK_EQUAL (0, wallMaxNs);
+        CHECK_EQUAL (0, cpuMaxNs);
+    }
+
+    // Fill the window.
+    CHECK_SUCCESS (pPp->startPhase (0));
+    CHECK_SUCCESS (pPp->endPhase (0));
+
+    // Expect stats written. Max includes the outlier but p99 does not. The
+    // thread was sleeping, so CPU time should not include the outlier.
+    {
+        READ_STATS (gPpConfig[0]);
+        CHECK_TRUE (wallMinNs <= wallP99Ns);
+        CHECK_TRUE (wallP99Ns <= wallMaxNs);
+        CHECK_TRUE (wallMaxNs >= SLEEP_US * Time::NS_IN_US);
+        CHECK_TRUE (wallP99Ns < SLEEP_US * Time::NS_IN_US);
+        CHECK_TRUE (cpuMinNs <= cpuP99Ns);
+        CHECK_TRUE (cpuP99Ns <= cpuMaxNs);
+        CHECK_TRUE (cpuMaxNs < SLEEP_US * Time::NS_IN_US);
+    }
+
+    // Expect phase 1 untouched.
+    {
+        READ_STATS (gPpConfig[1]);
+        CHECK_EQUAL (0, wallMinNs);
+        CHECK_EQUAL (0, wallMaxNs);
+        CHECK_EQUAL (0, wallP99Ns);
+        CHECK_EQUAL (0, cpuMinNs);
+        CHECK_EQUAL (0, cpuMaxNs);
+        CHECK_EQUAL (0, cpuP99Ns);
+    }
+}
+
+/* Test that the p99 is over a rolling window of the most recent samples and
+   that stats are written every WRITE_PERIOD samples once the window fills. */
+TEST (PhaseProfiler_Profile, RollingWindow)
+{
+    INIT_PP_SUCCESS;
+
+    // Fill phase 0's window. The first 2 samples sleep to create outliers, so
+    // the p99 (the window's second largest sample) includes an outlier.
+    const uint32_t SLEEP_US = 2000;
+    for (uint32_t i = 0; i < PhaseProfiler::WINDOW_SIZE; i++)
+    {
+        CHECK_SUCCESS (pPp->startPhase (0));
+        if (i < 2)
+        {
+            usleep (SLEEP_US);
+        }
+        CHECK_SUCCESS (pPp->endPhase (0));
+    }
+    {
+        READ_STATS (gPpConfig[0]);
+        CHECK_TRUE (wallP99Ns >= SLEEP_US * Time::NS_IN_US);
+    }
+
+    // Record all but one sample of the next write period. Expect no stats 
+    // written.
+    for (uint32_t i = 0; i < PhaseProfiler::WRITE_PERIOD - 1; i++)
+    {
+        CHECK_SUCCESS (pPp->startPhase (0));
+        CHECK_SUCCESS (pPp->endPhase (0));
+    }
+    {
+        READ_STATS (gPpConfig[0]);
+        CHECK_TRUE (wallP99Ns >= SLEEP_US * Time::NS_IN_US);
+    }
+
+    // Complete the write period. Both outliers have rolled out of the window,
+    // so the p99 no longer includes them, but the max still does.
+    CHECK_SUCCESS (pPp->startPhase (0));
+    CHECK_SUCCESS (pPp->endPhase (0));
+    {
+        READ_STATS (gPpConfig[0]);
+        CHECK_TRUE (wallP99Ns < SLEEP_US * Time::NS_IN_US);
+        CHECK_TRUE (wallMaxNs >= SLEEP_US * Time::NS_IN_US);
+    }
+}
+
+/* Test recording samples timed elsewhere. */
+TEST (PhaseProfiler_Profile, AddSample)
+{
+    INIT_PP_SUCCESS;
+
+    // Invalid phase.
+    CHECK_ERROR (pPp->addSample (gPpConfig.size (), 1, 1), E_INVALID_PHASE);
+
+    // Fill phase 1's window with samples 1 to WINDOW_SIZE ns of wall time and
+    // twice that of CPU time. Expect no stats written until the window fills.
+    for (uint32_t i = 1; i < PhaseProfiler::WINDOW_SIZE; i++)
+    {
+        CHECK_SUCCESS (pPp->addSample (1, i, 2 * i));
+    }
+    {
+        READ_STATS (gPpConfig[1]);
+        CHECK_EQUAL (0, wallMaxNs);
+    }
+    CHECK_SUCCESS (pPp->addSample (1, PhaseProfiler::WINDOW_SIZE, 
+                                   2 * PhaseProfiler::WINDOW_SIZE));
+    {
+        READ_STATS (gPpConfig[1]);
+        CHECK_EQUAL (1, wallMinNs);
+        CHECK_EQUAL (PhaseProfiler::WINDOW_SIZE, wallMaxNs);
+        CHECK_EQUAL (PhaseProfiler::WINDOW_SIZE - 1, wallP99Ns);
+        CHECK_EQUAL (2, cpuMinNs);
+        CHECK_EQUAL (2 * PhaseProfiler::WINDOW_SIZE, cpuMaxNs);
+        CHECK_EQUAL (2 * (PhaseProfiler::WINDOW_SIZE - 1), cpuP99Ns);
+    }
+}
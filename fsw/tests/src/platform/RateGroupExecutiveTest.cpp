@@ -0,0 +1,257 @@
+#include <unistd.h>
+
+#include "RateGroupExecutive.hpp"
+
+/* All #include statements should come before the CppUTest include */
+#include "TestHelpers.hpp"
+
+/********************************* MACROS *************************************/
+
+/**
+ * Initialize Rate Group Executive with a config.
+ *
+ * @param  kConfig  Config to initialize executive with.
+ */
+#define INIT_RGE_SUCCESS(kConfig)                                              \
+    std::unique_ptr<RateGroupExecutive> pRge = nullptr;                        \
+    CHECK_SUCCESS (RateGroupExecutive::createNew (kConfig, pRge));
+
+/********************************* GLOBALS ************************************/
+
+/**
+ * Number of minor frames in a major frame.
+ */
+static const uint8_t NUM_FRAMES =
+                              RateGroupExecutive::MINOR_FRAMES_PER_MAJOR_FRAME;
+
+/**
+ * Offset value indicating the executive should choose the task's offset.
+ */
+static const uint8_t AUTO = RateGroupExecutive::OFFSET_AUTO;
+
+/********************************** TESTS *************************************/
+
+/* Test config error handling. */
+TEST_GROUP (RateGroupExecutive_Config)
+{
+};
+
+/* Test initialization with a divisor of 0. */
+TEST (RateGroupExecutive_Config, ZeroDivisor)
+{
+    std::unique_ptr<RateGroupExecutive> pRge = nullptr;
+    RateGroupExecutive::Config_t config = {{1, 0}, {0, 0}};
+    CHECK_ERROR (RateGroupExecutive::createNew (config, pRge), E_INVALID_RATE);
+}
+
+/* Test initialization with a divisor that does not divide the major frame. */
+TEST (RateGroupExecutive_Config, DivisorNotFactor)
+{
+    std::unique_ptr<RateGroupExecutive> pRge = nullptr;
+    RateGroupExecutive::Config_t config = {{3, 0}};
+    CHECK_ERROR (RateGroupExecutive::createNew (config, pRge), E_INVALID_RATE);
+}
+
+/* Test initialization with an offset >= the divisor. */
+TEST (RateGroupExecutive_Config, InvalidOffset)
+{
+    std::unique_ptr<RateGroupExecutive> pRge = nullptr;
+    RateGroupExecutive::Config_t config = {{2, 2}};
+    CHECK_ERROR (RateGroupExecutive::createNew (config, pRge),
+                 E_INVALID_OFFSET);
+}
+
+/* Test successful initialization, including an empty config. */
+TEST (RateGroupExecutive_Config, Success)
+{
+    RateGroupExecutive::Config_t config = {{1, 0}, {100, 99}, {4, AUTO}};
+    INIT_RGE_SUCCESS (config);
+
+    RateGroupExecutive::Config_t emptyConfig;
+    std::unique_ptr<RateGroupExecutive> pRgeEmpty = nullptr;
+    CHECK_SUCCESS (RateGroupExecutive::createNew (emptyConfig, pRgeEmpty));
+    pRgeEmpty->startFrame ();
+    CHECK_FALSE (pRgeEmpty->isScheduled (0));
+}
+
+/* Test scheduling tasks in minor frames. */
+TEST_GROUP (RateGroupExecutive_Schedule)
+{
+};
+
+/* Test that tasks with fixed offsets run in the expected minor frames over
+   2 major frames. */
+TEST (RateGroupExecutive_Schedule, FixedOffsets)
+{
+    RateGroupExecutive::Config_t config =
+    {
+        {1,   0},
+        {2,   1},
+        {10,  3},
+        {100, 42},
+    };
+    INIT_RGE_SUCCESS (config);
+
+    std::vector<uint32_t> numRuns (config.size (), 0);
+    for (uint32_t i = 0; i < 2 * NUM_FRAMES; i++)
+    {
+        pRge->startFrame ();
+        uint8_t frame = i % NUM_FRAMES;
+        for (uint32_t task = 0; task < config.size (); task++)
+        {
+            bool expected = frame % config[task].divisor == config[task].offset;
+            CHECK_EQUAL (expected, pRge->isScheduled (task));
+            numRuns[task] += pRge->isScheduled (task) == true ? 1 : 0;
+        }
+    }
+
+    CHECK_EQUAL (200, numRuns[0]);
+    CHECK_EQUAL (100, numRuns[1]);
+    CHECK_EQUAL (20,  numRuns[2]);
+    CHECK_EQUAL (2,   numRuns[3]);
+}
+
+/* Test that an invalid task is never scheduled and has no rate. */
+TEST (RateGroupExecutive_Schedule, InvalidTask)
+{
+    RateGroupExecutive::Config_t config = {{1, 0}};
+    INIT_RGE_SUCCESS (config);
+
+    pRge->startFrame ();
+    CHECK_FALSE (pRge->isScheduled (1));
+
+    RateGroupExecutive::Rate_t rate = {0, 0};
+    CHECK_ERROR (pRge->getRate (1, rate), E_INVALID_TASK);
+}
+
+/* Test that OFFSET_AUTO tasks are spread across minor frames so that no
+   minor frame runs more tasks than necessary. */
+TEST (RateGroupExecutive_Schedule, AutoOffsets)
+{
+    // 10 tasks at 10 Hz and 1 fixed task at 50 Hz. With all offsets at 0,
+    // frame 0 would run 11 tasks. Spread, each minor frame runs at most 2.
+    RateGroupExecutive::Config_t config = {{2, 0}};
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        config.push_back ({10, AUTO});
+    }
+    INIT_RGE_SUCCESS (config);
+
+    // Expect each 10 Hz task to have a valid offset.
+    for (uint32_t task = 1; task < config.size (); task++)
+    {
+        RateGroupExecutive::Rate_t rate = {0, 0};
+        CHECK_SUCCESS (pRge->getRate (task, rate));
+        CHECK_EQUAL (10, rate.divisor);
+        CHECK_TRUE (rate.offset < 10);
+    }
+
+    // Expect first 10 Hz task placed in the lowest offset that avoids the
+    // 50 Hz task.
+    RateGroupExecutive::Rate_t rate = {0, 0};
+    CHECK_SUCCESS (pRge->getRate (1, rate));
+    CHECK_EQUAL (1, rate.offset);
+
+    // Expect fixed offset unchanged.
+    CHECK_SUCCESS (pRge->getRate (0, rate));
+    CHECK_EQUAL (0, rate.offset);
+
+    // Expect no more than 2 tasks in any minor frame.
+    for (uint32_t i = 0; i < NUM_FRAMES; i++)
+    {
+        pRge->startFrame ();
+        uint32_t numScheduled = 0;
+        for (uint32_t task = 0; task < config.size (); task++)
+        {
+            numScheduled += pRge->isScheduled (task) == true ? 1 : 0;
+        }
+        CHECK_TRUE (numScheduled <= 2);
+    }
+}
+
+/* Test timing rate groups to attribute frame overruns. */
+TEST_GROUP (RateGroupExecutive_Timing)
+{
+};
+
+/* Test timing a task not in the config. */
+TEST (RateGroupExecutive_Timing, InvalidTask)
+{
+    RateGroupExecutive::Config_t config = {{1, 0}};
+    INIT_RGE_SUCCESS (config);
+
+    CHECK_ERROR (pRge->startTask (1), E_INVALID_TASK);
+    CHECK_ERROR (pRge->endTask (1), E_INVALID_TASK);
+    CHECK_ERROR (pRge->addTaskTime (1, 0), E_INVALID_TASK);
+}
+
+/* Test that the heaviest rate group is the group that took the most time in
+   the current minor frame, and that times reset each minor frame. */
+TEST (RateGroupExecutive_Timing, HeaviestRateGroup)
+{
+    // 2 tasks in the 50 Hz group and 1 task in the 10 Hz group, all run in
+    // frame 0.
+    RateGroupExecutive::Config_t config = {{2, 0}, {10, 0}, {2, 0}};
+    INIT_RGE_SUCCESS (config);
+    const uint32_t SLEEP_US = 1000;
+
+    // Expect 0 before any task is timed.
+    uint8_t divisor = 0xFF;
+    pRge->startFrame ();
+    pRge->getHeaviestRateGroup (divisor);
+    CHECK_EQUAL (0, divisor);
+
+    // Frame 0: 10 Hz task takes longer than either 50 Hz task alone, but 50 Hz
+    // group takes longest in total.
+    CHECK_SUCCESS (pRge->startTask (0));
+    usleep (SLEEP_US);
+    CHECK_SUCCESS (pRge->endTask (0));
+    CHECK_SUCCESS (pRge->startTask (1));
+    usleep (3 * SLEEP_US / 2);
+    CHECK_SUCCESS (pRge->endTask (1));
+    CHECK_SUCCESS (pRge->startTask (2));
+    usleep (SLEEP_US);
+    CHECK_SUCCESS (pRge->endTask (2));
+    pRge->getHeaviestRateGroup (divisor);
+    CHECK_EQUAL (2, divisor);
+
+    // Frame 1: nothing timed, so expect times reset.
+    pRge->startFrame ();
+    pRge->getHeaviestRateGroup (divisor);
+    CHECK_EQUAL (0, divisor);
+
+    // Frame 2: only the 10 Hz task slept.
+    pRge->startFrame ();
+    CHECK_SUCCESS (pRge->startTask (0));
+    CHECK_SUCCESS (pRge->endTask (0));
+    CHECK_SUCCESS (pRge->startTask (1));
+    usleep (SLEEP_US);
+    CHECK_SUCCESS (pRge->endTask (1));
+    pRge->getHeaviestRateGroup (divisor);
+    CHECK_EQUAL (10, divisor);
+}
+
+/* Test that times measured by the caller are added to the task's rate group. 
+ */
+TEST (RateGroupExecutive_Timing, AddTaskTime)
+{
+    RateGroupExecutive::Config_t config = {{2, 0}, {10, 0}, {2, 0}};
+    INIT_RGE_SUCCESS (config);
+
+    // 50 Hz group takes longest in total.
+    uint8_t divisor = 0xFF;
+    pRge->startFrame ();
+    CHECK_SUCCESS (pRge->addTaskTime (0, 100));
+    CHECK_SUCCESS (pRge->addTaskTime (1, 150));
+    CHECK_SUCCESS (pRge->addTaskTime (2, 100));
+    pRge->getHeaviestRateGroup (divisor);
+    CHECK_EQUAL (2, divisor);
+
+    // 10 Hz group takes longest.
+    pRge->startFrame ();
+    pRge->startFrame ();
+    CHECK_SUCCESS (pRge->addTaskTime (0, 100));
+    CHECK_SUCCESS (pRge->addTaskTime (1, 150));
+    pRge->getHeaviestRateGroup (divisor);
+    CHECK_EQUAL (10, divisor);
+}
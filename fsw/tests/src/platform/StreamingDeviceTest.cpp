@@ -0,0 +1,220 @@
+/* All #include statements should come before the CppUTest include */
+#include <sstream>
+
+#include "StreamingDevice.hpp"
+#include "MockFifoBackend.hpp"
+
+#include "TestHelpers.hpp"
+
+/**
+ * Initializes the Data Vector, mock FIFO, test device pointer, and test device
+ * config. The device never uses the FPGA session since it reads the mock FIFO.
+ */
+#define INIT_TEST                                                              \
+    NiFpga_Session session = 0;                                                \
+    std::shared_ptr<DataVector> pDv = nullptr;                                 \
+    CHECK_SUCCESS (DataVector::createNew (gDvConfig, pDv));                    \
+    std::shared_ptr<MockFifoBackend> pFifo (new MockFifoBackend ());           \
+    std::unique_ptr<StreamingDevice> pDevice = nullptr;                        \
+    StreamingDevice::Config_t config = gDeviceConfig;                          \
+    config.pFifo = pFifo;
+
+/**
+ * Verify the device's DV outputs.
+ */
+#define CHECK_OUTPUTS(kExpMean, kExpMin, kExpMax, kExpNumSamples,              \
+                      kExpNumDropped)                                          \
+{                                                                              \
+    float macroVal = 0;                                                        \
+    uint32_t macroCount = 0;                                                   \
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, macroVal));                       \
+    CHECK_EQUAL (kExpMean, macroVal);                                          \
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, macroVal));                       \
+    CHECK_EQUAL (kExpMin, macroVal);                                           \
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST4, macroVal));                       \
+    CHECK_EQUAL (kExpMax, macroVal);                                           \
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST2, macroCount));                     \
+    CHECK_EQUAL ((uint32_t) kExpNumSamples, macroCount);                       \
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST3, macroCount));                     \
+    CHECK_EQUAL ((uint32_t) kExpNumDropped, macroCount);                       \
+}
+
+/**
+ * DV config for test device.
+ */
+static DataVector::Config_t gDvConfig =
+{
+    // Region
+    {DV_REG_TEST0,
+
+    // Elements
+    {
+        DV_ADD_FLOAT  (DV_ELEM_TEST0, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST1, 0),
+        DV_ADD_UINT32 (DV_ELEM_TEST2, 0),
+        DV_ADD_UINT32 (DV_ELEM_TEST3, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST4, 0),
+    }},
+};
+
+/**
+ * Unsigned integer fxp type, so that each sample converts to its raw value.
+ */
+static const NiFpga_FxpTypeInfo gIntTypeInfo = {0, 32, 32};
+
+/**
+ * Example valid device config. 4 samples per block, a FIFO of 2 blocks, and a
+ * recorder ring of 2 blocks.
+ */
+static StreamingDevice::Config_t gDeviceConfig =
+{
+    0,
+    nullptr,
+    8,
+    4,
+    2,
+    gIntTypeInfo,
+    DV_ELEM_TEST0,
+    DV_ELEM_TEST1,
+    DV_ELEM_TEST4,
+    DV_ELEM_TEST2,
+    DV_ELEM_TEST3,
+};
+
+TEST_GROUP (StreamingDeviceTest)
+{
+};
+
+/**
+ * Tests invalid DV output elems in device config.
+ */
+TEST (StreamingDeviceTest, InvalidOutputDvElem)
+{
+    INIT_TEST;
+
+    // Mean elem is wrong type.
+    config.dvElemOutputMean = DV_ELEM_TEST2;
+    CHECK_ERROR (Device::createNew (session, pDv, config, pDevice),
+                 E_INVALID_ELEM);
+
+    // Sample count elem is wrong type.
+    config.dvElemOutputMean = gDeviceConfig.dvElemOutputMean;
+    config.dvElemNumSamples = DV_ELEM_TEST0;
+    CHECK_ERROR (Device::createNew (session, pDv, config, pDevice),
+                 E_INVALID_ELEM);
+
+    // Dropped count elem does not exist in DV.
+    config.dvElemNumSamples = gDeviceConfig.dvElemNumSamples;
+    config.dvElemNumDropped = DV_ELEM_TEST5;
+    CHECK_ERROR (Device::createNew (session, pDv, config, pDevice),
+                 E_INVALID_ELEM);
+}
+
+/**
+ * Tests invalid block, FIFO, and recorder ring sizes in device config.
+ */
+TEST (StreamingDeviceTest, InvalidSize)
+{
+    INIT_TEST;
+
+    // Block size 0.
+    config.blockSize = 0;
+    CHECK_ERROR (Device::createNew (session, pDv, config, pDevice),
+                 E_INCORRECT_SIZE);
+
+    // FIFO depth not a multiple of block size.
+    config.blockSize = 3;
+    CHECK_ERROR (Device::createNew (session, pDv, config, pDevice),
+                 E_INCORRECT_SIZE);
+
+    // Recorder ring size not a power of 2.
+    config.blockSize = gDeviceConfig.blockSize;
+    config.numRecorderBlocks = 3;
+    CHECK_ERROR (Device::createNew (session, pDv, config, pDevice),
+                 E_INCORRECT_SIZE);
+
+    // Recorder ring size 0.
+    config.numRecorderBlocks = 0;
+    CHECK_ERROR (Device::createNew (session, pDv, config, pDevice),
+                 E_INCORRECT_SIZE);
+}
+
+/**
+ * Tests that each run writes the stats of the full blocks in the FIFO and
+ * leaves partial blocks for the next run.
+ */
+TEST (StreamingDeviceTest, Decimate)
+{
+    INIT_TEST;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+
+    // No samples. Stats unchanged.
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_OUTPUTS (0, 0, 0, 0, 0);
+
+    // Two full blocks.
+    CHECK_SUCCESS (pFifo->push ({1, 2, 3, 4, 5, 6, 7, 8}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_OUTPUTS (4.5, 1, 8, 8, 0);
+
+    // One full block and a partial block.
+    CHECK_SUCCESS (pFifo->push ({10, 2, 30, 4, 5, 6}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_OUTPUTS (11.5, 2, 30, 4, 1);
+
+    // Partial block completed.
+    CHECK_SUCCESS (pFifo->push ({7, 8}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_OUTPUTS (6.5, 5, 8, 4, 2);
+}
+
+/**
+ * Tests that blocks are recorded in order and dropped from the recording when
+ * the recorder ring is full.
+ */
+TEST (StreamingDeviceTest, Record)
+{
+    INIT_TEST;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    std::stringstream out;
+    uint32_t numBlocks = 0;
+
+    // Nothing to record.
+    CHECK_SUCCESS (pDevice->recordBlocks (out, numBlocks));
+    CHECK_EQUAL (0, numBlocks);
+
+    // Fill the recorder ring and drop a third block.
+    CHECK_SUCCESS (pFifo->push ({1, 2, 3, 4, 5, 6, 7, 8}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pFifo->push ({9, 10, 11, 12}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_OUTPUTS (10.5, 9, 12, 4, 1);
+
+    // Record the first two blocks.
+    CHECK_SUCCESS (pDevice->recordBlocks (out, numBlocks));
+    CHECK_EQUAL (2, numBlocks);
+
+    // Record a block after the ring wraps.
+    CHECK_SUCCESS (pFifo->push ({13, 14, 15, 16}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDevice->recordBlocks (out, numBlocks));
+    CHECK_EQUAL (1, numBlocks);
+
+    // Verify the recording.
+    std::string recording = out.str ();
+    const uint32_t expected[] = {1, 2, 3, 4, 5, 6, 7, 8, 13, 14, 15, 16};
+    CHECK_EQUAL (sizeof (expected), recording.size ());
+    MEMCMP_EQUAL (expected, recording.data (), sizeof (expected));
+}
+
+/**
+ * Tests that FIFO errors are surfaced.
+ */
+TEST (StreamingDeviceTest, FifoError)
+{
+    INIT_TEST;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+
+    pFifo->failAcquire = true;
+    CHECK_ERROR (pDevice->run (), E_FPGA_FIFO);
+}
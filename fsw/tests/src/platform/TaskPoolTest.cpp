@@ -0,0 +1,169 @@
+#include <unistd.h>
+#include <atomic>
+
+#include "TaskPool.hpp"
+
+/* All #include statements should come before the CppUTest include */
+#include "TestHelpers.hpp"
+
+/********************************* MACROS *************************************/
+
+/**
+ * Initialize Task Pool with a number of workers on CPU 0.
+ *
+ * @param  kNumWorkers  Number of workers.
+ */
+#define INIT_POOL_SUCCESS(kNumWorkers)                                         \
+    TaskPool::Config_t config = {                                              \
+        std::vector<ThreadManager::Affinity_t> (                               \
+                                    kNumWorkers,                               \
+                                    ThreadManager::Affinity_t::CORE_0),        \
+        ThreadManager::MIN_NEW_THREAD_PRIORITY};                               \
+    std::unique_ptr<TaskPool> pPool = nullptr;                                 \
+    CHECK_SUCCESS (TaskPool::createNew (config, pPool));
+
+/********************************* GLOBALS ************************************/
+
+/**
+ * Number of tasks run.
+ */
+static std::atomic<uint32_t> gNumRuns (0);
+
+/**
+ * Arg for recordThread.
+ */
+typedef struct ThreadArg
+{
+    pthread_t thread;
+    uint32_t  sleepUs;
+} ThreadArg_t;
+
+/****************************** TASK FUNCTIONS ********************************/
+
+/**
+ * Count task run and return the Error_t pointed to by kPArg.
+ */
+static Error_t countAndReturn (void* kPArg)
+{
+    gNumRuns++;
+    return *((Error_t*) kPArg);
+}
+
+/**
+ * Sleep then record the thread the task ran on.
+ */
+static Error_t recordThread (void* kPArg)
+{
+    ThreadArg_t* pArg = (ThreadArg_t*) kPArg;
+    usleep (pArg->sleepUs);
+    pArg->thread = pthread_self ();
+    return E_SUCCESS;
+}
+
+/********************************** TESTS *************************************/
+
+/* Test config error handling. */
+TEST_GROUP (TaskPool_Config)
+{
+};
+
+/* Test initialization with too many workers. */
+TEST (TaskPool_Config, TooManyWorkers)
+{
+    TaskPool::Config_t config = {
+        std::vector<ThreadManager::Affinity_t> (
+                                    TaskPool::MAX_WORKERS + 1,
+                                    ThreadManager::Affinity_t::CORE_0),
+        ThreadManager::MIN_NEW_THREAD_PRIORITY};
+    std::unique_ptr<TaskPool> pPool = nullptr;
+    CHECK_ERROR (TaskPool::createNew (config, pPool), E_INVALID_NUM_WORKERS);
+}
+
+/* Test initialization with an invalid worker priority. */
+TEST (TaskPool_Config, InvalidPriority)
+{
+    ThreadManager::Priority_t priority = 
+                                    ThreadManager::MAX_NEW_THREAD_PRIORITY + 1;
+    TaskPool::Config_t config = {{ThreadManager::Affinity_t::CORE_0}, priority};
+    std::unique_ptr<TaskPool> pPool = nullptr;
+    CHECK_ERROR (TaskPool::createNew (config, pPool), E_INVALID_PRIORITY);
+}
+
+/* Test running batches of tasks. */
+TEST_GROUP (TaskPool_Run)
+{
+    void setup ()
+    {
+        gNumRuns = 0;
+    }
+};
+
+/* Test running an empty batch. */
+TEST (TaskPool_Run, EmptyBatch)
+{
+    INIT_POOL_SUCCESS (1);
+
+    std::vector<TaskPool::Task_t> tasks;
+    CHECK_SUCCESS (pPool->run (tasks));
+}
+
+/* Test that every task runs exactly once per batch and that each task's
+   return value is stored, with 0, 1, and 2 workers. */
+TEST (TaskPool_Run, AllTasksRun)
+{
+    const uint32_t NUM_TASKS = 50;
+    const uint32_t NUM_BATCHES = 20;
+    std::vector<Error_t> rets (NUM_TASKS);
+    for (uint32_t i = 0; i < NUM_TASKS; i++)
+    {
+        rets[i] = i % 2 == 0 ? E_SUCCESS : E_INVALID_TASK;
+    }
+
+    for (uint8_t numWorkers = 0; numWorkers <= 2; numWorkers++)
+    {
+        INIT_POOL_SUCCESS (numWorkers);
+        gNumRuns = 0;
+        for (uint32_t batch = 0; batch < NUM_BATCHES; batch++)
+        {
+            std::vector<TaskPool::Task_t> tasks;
+            for (uint32_t i = 0; i < NUM_TASKS; i++)
+            {
+                tasks.push_back ({countAndReturn, &rets[i], E_LAST});
+            }
+            CHECK_SUCCESS (pPool->run (tasks));
+            for (uint32_t i = 0; i < NUM_TASKS; i++)
+            {
+                CHECK_ERROR (tasks[i].ret, rets[i]);
+            }
+        }
+        CHECK_EQUAL (NUM_TASKS * NUM_BATCHES, gNumRuns);
+    }
+}
+
+/* Test that tasks run on both the caller and the worker, and that the worker
+   steals from the caller when the caller is busy. */
+TEST (TaskPool_Run, WorkStealing)
+{
+    INIT_POOL_SUCCESS (1);
+
+    // The caller's range is tasks 0 and 1 and the worker's is tasks 2 and 3.
+    // The caller runs task 1 first, which sleeps long enough for the worker to
+    // finish its range and steal task 0.
+    std::vector<ThreadArg_t> args = {{0, 0}, {0, 20000}, {0, 0}, {0, 0}};
+    std::vector<TaskPool::Task_t> tasks;
+    for (ThreadArg_t& arg : args)
+    {
+        tasks.push_back ({recordThread, &arg, E_LAST});
+    }
+    CHECK_SUCCESS (pPool->run (tasks));
+
+    pthread_t caller = pthread_self ();
+    CHECK (pthread_equal (args[1].thread, caller) != 0);
+    CHECK (pthread_equal (args[0].thread, caller) == 0);
+    CHECK (pthread_equal (args[2].thread, caller) == 0);
+    CHECK (pthread_equal (args[3].thread, caller) == 0);
+    for (TaskPool::Task_t& task : tasks)
+    {
+        CHECK_SUCCESS (task.ret);
+    }
+}
@@ -126,8 +126,144 @@ static Error_t periodicErrorHandler (Error_t kError)
     return kError;
 }
 
+/**
+ * Global count of periodic function calls and deadline misses.
+ */
+static uint32_t gNumCalls = 0;
+static uint32_t gNumMisses = 0;
+
+/**
+ * Thread that increments the global call count.
+ *
+ * @param  _kRawArgs  Unused.
+ *
+ * @ret    E_SUCCESS  Successfully executed thread.
+ */
+static void* funcCount (void* _kRawArgs)
+{
+    gNumCalls++;
+    return (void *) E_SUCCESS;
+}
+
+/**
+ * Thread that increments the global call count and then sleeps for 20ms to 
+ * miss a 10ms deadline.
+ *
+ * @param  _kRawArgs  Unused.
+ *
+ * @ret    E_SUCCESS  Successfully executed thread.
+ */
+static void* funcCountMiss10MsDeadline (void* _kRawArgs)
+{
+    gNumCalls++;
+    TestHelpers::sleepMs (20);
+    return (void *) E_SUCCESS;
+}
+
+/**
+ * Count a missed scheduler deadline and continue.
+ *
+ * @param  kError     Error to handle.
+ *
+ * @ret    E_SUCCESS  Deadline miss handled.
+ */
+static Error_t periodicCountMissHandler (Error_t kError)
+{
+    // Verify error expected.
+    if (kError != E_MISSED_SCHEDULER_DEADLINE)
+    {
+        FAIL ("Unexpected periodic thread error");
+    }
+
+    gNumMisses++;
+    return E_SUCCESS;
+}
+
+/**
+ * Periodic task that counts its runs. Also callable, so that tests can verify
+ * run is preferred when a task has both. The thread runs a copy of the task, 
+ * so the counts are kept outside of it.
+ */
+struct CountTask
+{
+    uint32_t* pNumRuns;
+    uint32_t* pNumCalls;
+
+    Error_t run ()
+    {
+        (*pNumRuns)++;
+        return E_SUCCESS;
+    }
+
+    Error_t operator() ()
+    {
+        (*pNumCalls)++;
+        return E_SUCCESS;
+    }
+};
+
+/**
+ * Periodic task that overruns its period once, on its first run, by sleeping 
+ * for overrunMs.
+ */
+struct OverrunOnceTask
+{
+    uint32_t* pNumRuns;
+    uint32_t overrunMs;
+
+    Error_t run ()
+    {
+        if ((*pNumRuns)++ == 0)
+        {
+            TestHelpers::sleepMs (overrunMs);
+        }
+        return E_SUCCESS;
+    }
+};
+
+/**
+ * Linux SCHED_DEADLINE policy number. Not defined by all libc versions.
+ */
+static const int32_t SCHED_DEADLINE_POLICY = 6;
+
+/**
+ * Periodic task that records the scheduling policy it runs under.
+ */
+struct PolicyTask
+{
+    int32_t* pPolicy;
+
+    Error_t run ()
+    {
+        *pPolicy = sched_getscheduler (0);
+        return E_SUCCESS;
+    }
+};
+
 /********************************* TESTS **************************************/
 
+/**
+ * Find a per-CPU kernel thread's PID.
+ *
+ * @param  kName  Thread name without the /<cpu> suffix.
+ * @param  kCpu   CPU.
+ *
+ * @ret    PID, or -1 if not found.
+ */
+static pid_t findKernelThreadPid (const std::string kName, uint8_t kCpu)
+{
+    std::vector<ThreadManager::KernelThread_t> kthreads;
+    CHECK_SUCCESS (ThreadManager::findKernelThreads (kName, kthreads));
+    for (ThreadManager::KernelThread_t& kthread : kthreads)
+    {
+        if (kthread.cpu == kCpu)
+        {
+            return kthread.pid;
+        }
+    }
+    return -1;
+}
+
 TEST_GROUP (ThreadManagerInit)
 {
     // Reset priorities of software irq threads.
@@ -137,21 +273,80 @@ TEST_GROUP (ThreadManagerInit)
         const uint8_t KSOFTIRQD_PRIORITY = 8;
         const uint8_t KTIMERSOFTD_PRIORITY = 1;
 
-        CHECK_SUCCESS (ThreadManager::setKernelProcessPriority (
-                                                 ThreadManager::KSOFTIRQD_0_PID,
-                                                 KSOFTIRQD_PRIORITY));
-        CHECK_SUCCESS (ThreadManager::setKernelProcessPriority (
-                                             ThreadManager::KSOFTIRQD_1_PID,
-                                             KSOFTIRQD_PRIORITY));
-        CHECK_SUCCESS (ThreadManager::setKernelProcessPriority (
-                                           ThreadManager::KTIMERSOFTD_0_PID,
-                                           KTIMERSOFTD_PRIORITY));
-        CHECK_SUCCESS (ThreadManager::setKernelProcessPriority (
-                                           ThreadManager::KTIMERSOFTD_1_PID,
-                                           KTIMERSOFTD_PRIORITY));
+        std::vector<ThreadManager::KernelThread_t> kthreads;
+        CHECK_SUCCESS (ThreadManager::findKernelThreads ("ksoftirqd", 
+                                                         kthreads));
+        for (ThreadManager::KernelThread_t& kthread : kthreads)
+        {
+            CHECK_SUCCESS (ThreadManager::setKernelProcessPriority (
+                                                         kthread.pid,
+                                                         KSOFTIRQD_PRIORITY));
+        }
+        CHECK_SUCCESS (ThreadManager::findKernelThreads ("ktimersoftd", 
+                                                         kthreads));
+        for (ThreadManager::KernelThread_t& kthread : kthreads)
+        {
+            CHECK_SUCCESS (ThreadManager::setKernelProcessPriority (
+                                                       kthread.pid,
+                                                       KTIMERSOFTD_PRIORITY));
+        }
     }
 };
 
+/* Test finding the per-CPU software irq threads. */
+TEST (ThreadManagerInit, FindKernelThreads)
+{
+    // Expect exactly one ksoftirqd thread per online CPU, each verified by
+    // name.
+    std::vector<ThreadManager::KernelThread_t> kthreads;
+    CHECK_SUCCESS (ThreadManager::findKernelThreads ("ksoftirqd", kthreads));
+    CHECK_EQUAL (ThreadManager::getNumCpus (), kthreads.size ());
+    std::vector<bool> cpuFound (ThreadManager::getNumCpus (), false);
+    for (ThreadManager::KernelThread_t& kthread : kthreads)
+    {
+        CHECK_TRUE (kthread.cpu < cpuFound.size ());
+        CHECK_FALSE (cpuFound[kthread.cpu]);
+        cpuFound[kthread.cpu] = true;
+
+        bool verified = false;
+        CHECK_SUCCESS (ThreadManager::verifyProcess (
+                            kthread.pid, 
+                            "ksoftirqd/" + std::to_string (kthread.cpu), 
+                            verified));
+        CHECK_TRUE (verified);
+    }
+
+    // Expect no threads found for a name that does not exist.
+    CHECK_SUCCESS (ThreadManager::findKernelThreads ("not_my_name", kthreads));
+    CHECK_EQUAL (0, kthreads.size ());
+}
+
+/* Test getting the online CPUs. */
+TEST (ThreadManagerInit, GetOnlineCpus)
+{
+    // Expect one CPU per online CPU, and ALL to be the online CPUs.
+    ThreadManager::CpuSet_t cpus = ThreadManager::getOnlineCpus ();
+    CHECK_EQUAL (ThreadManager::getNumCpus (), 
+                 __builtin_popcountll (cpus.mask));
+    CHECK_EQUAL (cpus.mask, 
+                 ThreadManager::CpuSet_t (ThreadManager::Affinity_t::ALL).mask);
+}
+
+/* Test finding a device's IRQs. */
+TEST (ThreadManagerInit, FindIrqs)
+{
+    std::vector<uint32_t> irqs;
+    CHECK_SUCCESS (ThreadManager::findIrqs ("not_my_device", irqs));
+    CHECK_EQUAL (0, irqs.size ());
+
+    CHECK_ERROR (ThreadManager::steerIrqs ("not_my_device", 
+                                           ThreadManager::Affinity_t::CORE_0),
+                 E_IRQ_NOT_FOUND);
+    CHECK_ERROR (ThreadManager::steerIrqs ("not_my_device", 
+                                           ThreadManager::CpuSet_t (0)),
+                 E_INVALID_AFFINITY);
+}
+
 /* Test the verifyProcess function. */
 TEST (ThreadManagerInit, VerifyProcess)
 {
@@ -175,37 +370,39 @@ TEST (ThreadManagerInit, VerifyProcess)
 TEST (ThreadManagerInit, SetProcessPriority)
 {
     static const uint8_t DEFAULT_PRIORITY = 1;
+    pid_t ksoftirqd0Pid = findKernelThreadPid ("ksoftirqd", 0);
 
     // Set priority and verify. Sleep for 1ms to allow priority change to 
     // propagate. 
     CHECK_SUCCESS (ThreadManager::setKernelProcessPriority (
-                                    ThreadManager::KSOFTIRQD_0_PID,
+                                    ksoftirqd0Pid,
                                     ThreadManager::SW_IRQ_PRIORITY));
     TestHelpers::sleepMs (1);
     struct sched_param schedParam;
-    sched_getparam (ThreadManager::KSOFTIRQD_0_PID, &schedParam);
+    sched_getparam (ksoftirqd0Pid, &schedParam);
     CHECK_EQUAL (ThreadManager::SW_IRQ_PRIORITY, 
                  schedParam.__sched_priority);
     
     // Set priority back to default and verify. Sleep for 1ms to allow
     // priority change to propagate. 
     CHECK_SUCCESS (ThreadManager::setKernelProcessPriority (
-                                                 ThreadManager::KSOFTIRQD_0_PID, 
+                                                 ksoftirqd0Pid, 
                                                  DEFAULT_PRIORITY));
     TestHelpers::sleepMs (1);
-    sched_getparam (ThreadManager::KSOFTIRQD_0_PID, &schedParam);
+    sched_getparam (ksoftirqd0Pid, &schedParam);
     CHECK_EQUAL (DEFAULT_PRIORITY, schedParam.__sched_priority);
 }
 
 /* Test passing in an invalid priority to setProcessPriority. */
 TEST (ThreadManagerInit, SetProcessPriorityInvalidPri)
 {
+    pid_t ksoftirqd0Pid = findKernelThreadPid ("ksoftirqd", 0);
     CHECK_ERROR (ThreadManager::setKernelProcessPriority (
-                                    ThreadManager::KSOFTIRQD_0_PID,
+                                    ksoftirqd0Pid,
                                     sched_get_priority_max (SCHED_FIFO) + 1),
                  E_INVALID_PRIORITY)
     CHECK_ERROR (ThreadManager::setKernelProcessPriority (
-                                    ThreadManager::KSOFTIRQD_0_PID,
+                                    ksoftirqd0Pid,
                                     sched_get_priority_min (SCHED_FIFO) - 1),
                  E_INVALID_PRIORITY);
 }
@@ -231,18 +428,21 @@ TEST (ThreadManagerInit, ConstructTwo)
     // Verify software irq thread priorities set.
     struct sched_param schedParam;
 
-    sched_getparam (ThreadManager::KSOFTIRQD_0_PID, &schedParam);
-    CHECK_EQUAL (ThreadManager::SW_IRQ_PRIORITY, 
-                 schedParam.__sched_priority);
-    sched_getparam (ThreadManager::KSOFTIRQD_1_PID, &schedParam);
-    CHECK_EQUAL (ThreadManager::SW_IRQ_PRIORITY, 
-                 schedParam.__sched_priority);
-    sched_getparam (ThreadManager::KTIMERSOFTD_0_PID, &schedParam);
-    CHECK_EQUAL (ThreadManager::SW_IRQ_PRIORITY, 
-                 schedParam.__sched_priority);
-    sched_getparam (ThreadManager::KTIMERSOFTD_1_PID, &schedParam);
-    CHECK_EQUAL (ThreadManager::SW_IRQ_PRIORITY, 
-                 schedParam.__sched_priority);
+    std::vector<ThreadManager::KernelThread_t> kthreads;
+    CHECK_SUCCESS (ThreadManager::findKernelThreads ("ksoftirqd", kthreads));
+    for (ThreadManager::KernelThread_t& kthread : kthreads)
+    {
+        sched_getparam (kthread.pid, &schedParam);
+        CHECK_EQUAL (ThreadManager::SW_IRQ_PRIORITY, 
+                     schedParam.__sched_priority);
+    }
+    CHECK_SUCCESS (ThreadManager::findKernelThreads ("ktimersoftd", kthreads));
+    for (ThreadManager::KernelThread_t& kthread : kthreads)
+    {
+        sched_getparam (kthread.pid, &schedParam);
+        CHECK_EQUAL (ThreadManager::SW_IRQ_PRIORITY, 
+                     schedParam.__sched_priority);
+    }
 
     // Verify that the current thread sched policy and priority was set.
     int policy;
@@ -293,6 +493,22 @@ TEST (ThreadManagerCreate, CreateThreadInvalidParams)
                                         ThreadManager::MIN_NEW_THREAD_PRIORITY, 
                                         ThreadManager::Affinity_t::LAST),
                  E_INVALID_AFFINITY);
+    CHECK_ERROR (pThreadManager->createThread (
+                                        thread1, threadFunc, &args,
+                                        sizeof (args),
+                                        ThreadManager::MIN_NEW_THREAD_PRIORITY,
+                                        ThreadManager::CpuSet_t (0)),
+                 E_INVALID_AFFINITY);
+    uint8_t offlineCpu = 0;
+    while (((ThreadManager::getOnlineCpus ().mask >> offlineCpu) & 1) == 1)
+    {
+        offlineCpu++;
+    }
+    CHECK_ERROR (pThreadManager->createThread (
+                        thread1, threadFunc, &args, sizeof (args),
+                        ThreadManager::MIN_NEW_THREAD_PRIORITY,
+                        ThreadManager::CpuSet_t (1ULL << offlineCpu)),
+                 E_INVALID_AFFINITY);
 
     // Non-zero args length with nullptr args.
     CHECK_ERROR (pThreadManager->createThread (
@@ -542,6 +758,22 @@ TEST (ThreadManagerCreatePeriodic, CreateThreadInvalidParams)
                                         THREAD_PERIOD_MS, nullptr),
                  E_INVALID_POINTER);
 
+    // Invalid period.
+    CHECK_ERROR (pThreadManager->createPeriodicThread (
+                                        thread1, threadFunc, &args, 
+                                        sizeof (args), 
+                                        ThreadManager::MIN_NEW_THREAD_PRIORITY, 
+                                        ThreadManager::Affinity_t::ALL,
+                                        0, fErrorHandler),
+                 E_INVALID_PERIOD);
+    CHECK_ERROR (pThreadManager->createPeriodicThreadNs (
+                                        thread1, threadFunc, &args, 
+                                        sizeof (args), 
+                                        ThreadManager::MIN_NEW_THREAD_PRIORITY, 
+                                        ThreadManager::Affinity_t::ALL,
+                                        0, fErrorHandler),
+                 E_INVALID_PERIOD);
+
     // Expect both logs to be empty.
     VERIFY_LOGS;
 }
@@ -693,3 +925,699 @@ TEST (ThreadManagerCreatePeriodic, CreatePeriodicError)
     CHECK_EQUAL (E_INVALID_POINTER, ret);
 }
 
+/* Test creating and running a periodic thread with a sub-ms period. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicSubMsThread)
+{
+    const Time::TimeNs_t THREAD_PERIOD_NS = 500 * Time::NS_IN_US;
+    const uint32_t TIME_TO_SLEEP_MS = 100;
+    const uint32_t EXPECTED_NUM_CALLS = 
+        TIME_TO_SLEEP_MS * Time::NS_IN_MS / THREAD_PERIOD_NS;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    // Error handler. Fails the test on a deadline miss.
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+
+    // Create thread.
+    gNumCalls = 0;
+    pthread_t thread;
+    ThreadManager::ThreadFunc_t threadFunc = 
+        (ThreadManager::ThreadFunc_t) funcCount;
+    CHECK_SUCCESS (pThreadManager->createPeriodicThreadNs (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        THREAD_PERIOD_NS, fErrorHandler));
+
+    // Block for 100ms to allow thread to run 200 times.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+
+    // Clean up thread.
+    pthread_cancel (thread);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    CHECK_EQUAL (std::numeric_limits<uint32_t>::max (), ret);
+
+    // Verify call count. Allow for the time it takes the test thread to wake
+    // up from sleep.
+    CHECK_TRUE (gNumCalls >= EXPECTED_NUM_CALLS);
+    CHECK_TRUE (gNumCalls <= EXPECTED_NUM_CALLS + 2);
+}
+
+/* Test that missed release times are skipped instead of run back-to-back. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicDeadlineMissSkip)
+{
+    const uint32_t THREAD_PERIOD_MS = 10;
+    const uint32_t TIME_TO_SLEEP_MS = 95;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    // Error handler. Counts deadline misses and continues.
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicCountMissHandler;
+
+    // Create thread.
+    gNumCalls = 0;
+    gNumMisses = 0;
+    pthread_t thread;
+    ThreadManager::ThreadFunc_t threadFunc = 
+        (ThreadManager::ThreadFunc_t) funcCountMiss10MsDeadline;
+    CHECK_SUCCESS (pThreadManager->createPeriodicThread (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        THREAD_PERIOD_MS, fErrorHandler));
+
+    // Block for 95ms. Each call takes 20ms, so the release at 10ms is missed 
+    // and the thread next runs at 30ms. Expect calls at 0, 30, 60, and 90ms.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+
+    // Clean up thread.
+    pthread_cancel (thread);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    CHECK_EQUAL (std::numeric_limits<uint32_t>::max (), ret);
+
+    // Verify.
+    CHECK_EQUAL (4, gNumCalls);
+    CHECK_EQUAL (3, gNumMisses);
+}
+
+/* Test creating a periodic task with invalid params. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicTaskInvalidParams)
+{
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+    uint32_t numRuns = 0;
+    uint32_t numCalls = 0;
+    CountTask task = {&numRuns, &numCalls};
+    pthread_t thread;
+
+    // Null error handler.
+    CHECK_ERROR (pThreadManager->createPeriodicTask (
+                                        thread, task,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        Time::NS_IN_MS, nullptr),
+                 E_INVALID_POINTER);
+
+    // Zero period.
+    CHECK_ERROR (pThreadManager->createPeriodicTask (
+                                        thread, task,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        0, fErrorHandler),
+                 E_INVALID_PERIOD);
+
+    // Invalid priority.
+    CHECK_ERROR (pThreadManager->createPeriodicTask (
+                                        thread, task,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY 
+                                            + 1,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        Time::NS_IN_MS, fErrorHandler),
+                 E_INVALID_PRIORITY);
+
+    // Empty affinity.
+    CHECK_ERROR (pThreadManager->createPeriodicTask (
+                                        thread, task,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::CpuSet_t (0),
+                                        Time::NS_IN_MS, fErrorHandler),
+                 E_INVALID_AFFINITY);
+
+    // Verify task never ran.
+    CHECK_EQUAL (0, numRuns);
+    CHECK_EQUAL (0, numCalls);
+}
+
+/* Test running an object with a run method as a periodic task. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicTaskObject)
+{
+    const uint32_t THREAD_PERIOD_MS = 10;
+    const uint32_t TIME_TO_SLEEP_MS = 100;
+    const uint32_t EXPECTED_NUM_RUNS = TIME_TO_SLEEP_MS / THREAD_PERIOD_MS;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+
+    // Create thread. The task goes out of scope once the thread is created,
+    // so the thread must run its own copy.
+    uint32_t numRuns = 0;
+    uint32_t numCalls = 0;
+    pthread_t thread;
+    {
+        CountTask task = {&numRuns, &numCalls};
+        CHECK_SUCCESS (pThreadManager->createPeriodicTask (
+                                        thread, task,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        THREAD_PERIOD_MS * Time::NS_IN_MS, 
+                                        fErrorHandler));
+    }
+
+    // Block for 100ms to allow thread to run 10 times.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+
+    // Verify stats are recorded for the task's thread.
+    ThreadManager::PeriodicThreadStats_t stats;
+    CHECK_SUCCESS (pThreadManager->getPeriodicThreadStats (thread, stats));
+    CHECK_TRUE (stats.execution.numSamples >= EXPECTED_NUM_RUNS - 1);
+
+    // Clean up thread.
+    pthread_cancel (thread);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    CHECK_EQUAL (std::numeric_limits<uint32_t>::max (), ret);
+
+    // Verify run was called instead of the call operator.
+    CHECK_TRUE (numRuns >= EXPECTED_NUM_RUNS);
+    CHECK_TRUE (numRuns <= EXPECTED_NUM_RUNS + 1);
+    CHECK_EQUAL (0, numCalls);
+}
+
+/* Test that a task with OVERRUN_POLICY_SKIP drops the releases that passed 
+   during an overrun. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicTaskOverrunSkip)
+{
+    const uint32_t THREAD_PERIOD_MS = 10;
+    const uint32_t TIME_TO_SLEEP_MS = 55;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicCountMissHandler;
+
+    // Create thread.
+    gNumMisses = 0;
+    uint32_t numRuns = 0;
+    OverrunOnceTask task = {&numRuns, 25};
+    pthread_t thread;
+    CHECK_SUCCESS (pThreadManager->createPeriodicTask (
+                                        thread, task,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        THREAD_PERIOD_MS * Time::NS_IN_MS, 
+                                        fErrorHandler,
+                                        ThreadManager::OVERRUN_POLICY_SKIP));
+
+    // Block for 55ms. The first run ends at 25ms, so the releases at 10 and 
+    // 20ms are skipped. Expect runs at 0, 30, 40, and 50ms.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+
+    // Clean up thread.
+    pthread_cancel (thread);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    CHECK_EQUAL (std::numeric_limits<uint32_t>::max (), ret);
+
+    // Verify.
+    CHECK_EQUAL (4, numRuns);
+    CHECK_EQUAL (1, gNumMisses);
+}
+
+/* Test that a task with OVERRUN_POLICY_CATCH_UP runs the releases that passed
+   during an overrun back-to-back. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicTaskOverrunCatchUp)
+{
+    const uint32_t THREAD_PERIOD_MS = 10;
+    const uint32_t TIME_TO_SLEEP_MS = 55;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicCountMissHandler;
+
+    // Invalid policy.
+    uint32_t numRuns = 0;
+    OverrunOnceTask task = {&numRuns, 25};
+    pthread_t thread;
+    CHECK_ERROR (pThreadManager->createPeriodicTask (
+                                        thread, task,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        THREAD_PERIOD_MS * Time::NS_IN_MS, 
+                                        fErrorHandler,
+                                        ThreadManager::OVERRUN_POLICY_LAST),
+                 E_INVALID_ENUM);
+
+    // Create thread.
+    gNumMisses = 0;
+    CHECK_SUCCESS (pThreadManager->createPeriodicTask (
+                                      thread, task,
+                                      ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                      ThreadManager::Affinity_t::CORE_0,
+                                      THREAD_PERIOD_MS * Time::NS_IN_MS, 
+                                      fErrorHandler,
+                                      ThreadManager::OVERRUN_POLICY_CATCH_UP));
+
+    // Block for 55ms. The first run ends at 25ms, so the runs for the 10 and 
+    // 20ms releases follow immediately. The run for the 10ms release ends 
+    // after the 20ms release, but as it is catching up it does not report 
+    // another miss. Expect runs at 0, 25, 25, 30, 40, and 50ms.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+
+    // Clean up thread.
+    pthread_cancel (thread);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    CHECK_EQUAL (std::numeric_limits<uint32_t>::max (), ret);
+
+    // Verify.
+    CHECK_EQUAL (6, numRuns);
+    CHECK_EQUAL (1, gNumMisses);
+}
+
+/* Test that a task with OVERRUN_POLICY_CATCH_UP runs only the last 
+   MAX_CATCH_UP_PERIODS releases that passed during a long overrun. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicTaskOverrunCatchUpMax)
+{
+    const uint32_t THREAD_PERIOD_MS = 10;
+    const uint32_t OVERRUN_MS = 65;
+    const uint32_t TIME_TO_SLEEP_MS = 85;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicCountMissHandler;
+
+    // Create thread.
+    gNumMisses = 0;
+    uint32_t numRuns = 0;
+    OverrunOnceTask task = {&numRuns, OVERRUN_MS};
+    pthread_t thread;
+    CHECK_SUCCESS (pThreadManager->createPeriodicTask (
+                                      thread, task,
+                                      ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                      ThreadManager::Affinity_t::CORE_0,
+                                      THREAD_PERIOD_MS * Time::NS_IN_MS, 
+                                      fErrorHandler,
+                                      ThreadManager::OVERRUN_POLICY_CATCH_UP));
+
+    // Block for 85ms. The first run ends at 65ms, so the releases at 10 
+    // through 60ms have passed. The 10 and 20ms releases are skipped and the 
+    // runs for the last MAX_CATCH_UP_PERIODS releases follow immediately. 
+    // Expect runs at 0, 65, 65, 65, 65, 70, and 80ms.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+
+    // Clean up thread.
+    pthread_cancel (thread);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    CHECK_EQUAL (std::numeric_limits<uint32_t>::max (), ret);
+
+    // Verify.
+    CHECK_EQUAL (3 + ThreadManager::MAX_CATCH_UP_PERIODS, numRuns);
+    CHECK_EQUAL (1, gNumMisses);
+}
+
+/* Test creating a SCHED_DEADLINE periodic thread with invalid params. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicDeadlineInvalidParams)
+{
+    const Time::TimeNs_t PERIOD_NS = 10 * Time::NS_IN_MS;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+    ThreadManager::ThreadFunc_t threadFunc = 
+        (ThreadManager::ThreadFunc_t) funcNoArgs;
+    pthread_t thread;
+
+    // Runtime below kernel min.
+    ThreadManager::DeadlineParams_t params = 
+        {ThreadManager::MIN_DEADLINE_RUNTIME_NS - 1, 0};
+    CHECK_ERROR (pThreadManager->createPeriodicThreadNs (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::ALL,
+                                        PERIOD_NS, fErrorHandler, params),
+                 E_INVALID_DEADLINE);
+
+    // Runtime greater than deadline.
+    params = {2 * Time::NS_IN_MS, 1 * Time::NS_IN_MS};
+    CHECK_ERROR (pThreadManager->createPeriodicThreadNs (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::ALL,
+                                        PERIOD_NS, fErrorHandler, params),
+                 E_INVALID_DEADLINE);
+
+    // Runtime greater than period with deadline defaulted to period.
+    params = {PERIOD_NS + 1, 0};
+    CHECK_ERROR (pThreadManager->createPeriodicThreadNs (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::ALL,
+                                        PERIOD_NS, fErrorHandler, params),
+                 E_INVALID_DEADLINE);
+
+    // Deadline greater than period.
+    params = {1 * Time::NS_IN_MS, PERIOD_NS + 1};
+    CHECK_ERROR (pThreadManager->createPeriodicThreadNs (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::ALL,
+                                        PERIOD_NS, fErrorHandler, params),
+                 E_INVALID_DEADLINE);
+
+    // Affinity does not contain every CPU.
+    if (ThreadManager::getNumCpus () > 1)
+    {
+        params = {1 * Time::NS_IN_MS, 0};
+        CHECK_ERROR (pThreadManager->createPeriodicThreadNs (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        PERIOD_NS, fErrorHandler, params),
+                     E_INVALID_AFFINITY);
+    }
+}
+
+/* Test running a periodic task with SCHED_DEADLINE. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicDeadline)
+{
+    const Time::TimeNs_t PERIOD_NS = 10 * Time::NS_IN_MS;
+    const uint32_t TIME_TO_SLEEP_MS = 50;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+
+    // Create thread with 2ms of runtime every 10ms.
+    int32_t policy = SCHED_OTHER;
+    PolicyTask task = {&policy};
+    pthread_t thread;
+    ThreadManager::DeadlineParams_t params = {2 * Time::NS_IN_MS, 0};
+    CHECK_SUCCESS (pThreadManager->createPeriodicTask (
+                                        thread, task,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::ALL,
+                                        PERIOD_NS, fErrorHandler,
+                                        ThreadManager::OVERRUN_POLICY_SKIP,
+                                        params));
+
+    // Block to allow thread to run.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+
+    // Clean up thread.
+    pthread_cancel (thread);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    CHECK_EQUAL (std::numeric_limits<uint32_t>::max (), ret);
+
+    // Verify the task ran under SCHED_DEADLINE.
+    CHECK_EQUAL (SCHED_DEADLINE_POLICY, policy);
+}
+
+/* Test that SCHED_DEADLINE admission control errors are surfaced. Each thread
+   reserves a full CPU, so the kernel must reject a thread before every CPU is
+   reserved, since it always leaves some bandwidth to other threads. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicDeadlineAdmission)
+{
+    const Time::TimeNs_t PERIOD_NS = 10 * Time::NS_IN_MS;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+    ThreadManager::ThreadFunc_t threadFunc = 
+        (ThreadManager::ThreadFunc_t) funcNoArgs;
+    ThreadManager::DeadlineParams_t params = {PERIOD_NS, PERIOD_NS};
+
+    // Create threads until one is rejected.
+    std::vector<pthread_t> threads;
+    Error_t createRet = E_SUCCESS;
+    for (uint8_t i = 0; i <= ThreadManager::getNumCpus (); i++)
+    {
+        pthread_t thread;
+        createRet = pThreadManager->createPeriodicThreadNs (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::ALL,
+                                        PERIOD_NS, fErrorHandler, params);
+        if (createRet != E_SUCCESS)
+        {
+            break;
+        }
+        threads.push_back (thread);
+    }
+
+    // Clean up threads before verifying.
+    for (pthread_t& thread : threads)
+    {
+        pthread_cancel (thread);
+        CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    }
+
+    // Verify.
+    CHECK_EQUAL (E_DEADLINE_ADMISSION_FAILED, createRet);
+    CHECK_TRUE (threads.size () < ThreadManager::getNumCpus ());
+}
+
+/* Test running a lambda as a periodic task and returning its error. */
+TEST (ThreadManagerCreatePeriodic, CreatePeriodicTaskLambda)
+{
+    const uint32_t THREAD_PERIOD_MS = 10;
+    const uint32_t TIME_TO_SLEEP_MS = 50;
+    const uint32_t NUM_RUNS_BEFORE_ERROR = 3;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+
+    // Create thread. The lambda returns an error on its third run.
+    uint32_t numRuns = 0;
+    auto fTask = [&numRuns] () 
+    { 
+        return ++numRuns == NUM_RUNS_BEFORE_ERROR ? E_INVALID_POINTER 
+                                                  : E_SUCCESS; 
+    };
+    pthread_t thread;
+    CHECK_SUCCESS (pThreadManager->createPeriodicTask (
+                                        thread, fTask,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        THREAD_PERIOD_MS * Time::NS_IN_MS, 
+                                        fErrorHandler));
+
+    // Block for 50ms to allow thread to run until the error.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+
+    // Clean up thread and verify the error was returned.
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+    CHECK_EQUAL (E_INVALID_POINTER, ret);
+    CHECK_EQUAL (NUM_RUNS_BEFORE_ERROR, numRuns);
+}
+
+TEST_GROUP (ThreadManagerPeriodicStats)
+{
+};
+
+/* Test reading stats of threads that are not tracked or not periodic. */
+TEST (ThreadManagerPeriodicStats, InvalidThread)
+{
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    // Thread not created by Thread Manager.
+    ThreadManager::PeriodicThreadStats_t stats;
+    CHECK_ERROR (pThreadManager->getPeriodicThreadStats (pthread_self (), 
+                                                         stats),
+                 E_THREAD_NOT_FOUND);
+
+    // Non-periodic thread.
+    pthread_t thread;
+    ThreadManager::ThreadFunc_t threadFunc = 
+        (ThreadManager::ThreadFunc_t) funcNoArgs;
+    CHECK_SUCCESS (pThreadManager->createThread (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MIN_NEW_THREAD_PRIORITY, 
+                                        ThreadManager::Affinity_t::ALL));
+    CHECK_ERROR (pThreadManager->getPeriodicThreadStats (thread, stats),
+                 E_NOT_PERIODIC_THREAD);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+}
+
+/* Test that stats are recorded each period. */
+TEST (ThreadManagerPeriodicStats, RecordStats)
+{
+    const uint32_t THREAD_PERIOD_MS = 10;
+    const uint32_t TIME_TO_SLEEP_MS = 95;
+    const uint32_t EXPECTED_NUM_SAMPLES = 10;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    // Error handler. Fails the test on a deadline miss.
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+
+    // Create thread.
+    pthread_t thread;
+    ThreadManager::ThreadFunc_t threadFunc = 
+        (ThreadManager::ThreadFunc_t) funcCount;
+    CHECK_SUCCESS (pThreadManager->createPeriodicThread (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        THREAD_PERIOD_MS, fErrorHandler));
+
+    // Block for 95ms to allow thread to run 10 times and read stats.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+    ThreadManager::PeriodicThreadStats_t stats;
+    CHECK_SUCCESS (pThreadManager->getPeriodicThreadStats (thread, stats));
+
+    // Clean up thread.
+    pthread_cancel (thread);
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+
+    // Verify each histogram has a sample per period and that the counts sum 
+    // to the number of samples.
+    std::vector<ThreadManager::Histogram_t> histograms = 
+        {stats.releaseJitter, stats.execution, stats.response};
+    for (ThreadManager::Histogram_t& histogram : histograms)
+    {
+        CHECK_EQUAL (EXPECTED_NUM_SAMPLES, histogram.numSamples);
+        uint32_t sum = 0;
+        for (uint8_t i = 0; i < ThreadManager::NUM_HISTOGRAM_BUCKETS; i++)
+        {
+            sum += histogram.counts[i];
+        }
+        CHECK_EQUAL (histogram.numSamples, sum);
+        CHECK_TRUE (histogram.maxNs < THREAD_PERIOD_MS * Time::NS_IN_MS);
+    }
+
+    // Response time includes release jitter and execution time.
+    CHECK_TRUE (stats.response.maxNs >= stats.execution.maxNs);
+    CHECK_TRUE (stats.response.maxNs >= stats.releaseJitter.maxNs);
+}
+
+/* Test mirroring stats to the Data Vector. */
+TEST (ThreadManagerPeriodicStats, WriteStats)
+{
+    const uint32_t THREAD_PERIOD_MS = 10;
+    const uint32_t TIME_TO_SLEEP_MS = 50;
+
+    INIT_THREAD_MANAGER_AND_LOGS;
+
+    DataVector::Config_t dvConfig = 
+    {
+        {DV_REG_TEST0,
+        {
+            DV_ADD_UINT32 ( DV_ELEM_TEST0, 0 ),
+            DV_ADD_UINT32 ( DV_ELEM_TEST1, 0 ),
+            DV_ADD_UINT32 ( DV_ELEM_TEST2, 0 ),
+            DV_ADD_UINT32 ( DV_ELEM_TEST3, 0 ),
+            DV_ADD_UINT32 ( DV_ELEM_TEST4, 0 ),
+            DV_ADD_UINT32 ( DV_ELEM_TEST5, 0 ),
+            DV_ADD_UINT8  ( DV_ELEM_TEST6, 0 ),
+        }},
+    };
+    INIT_DATA_VECTOR (dvConfig);
+    ThreadManager::PeriodicThreadStatsDvConfig_t statsConfig = 
+    {
+        DV_ELEM_TEST0, DV_ELEM_TEST1, DV_ELEM_TEST2, 
+        DV_ELEM_TEST3, DV_ELEM_TEST4, DV_ELEM_TEST5
+    };
+
+    // Error handler. Fails the test on a deadline miss.
+    ThreadManager::ErrorHandler_t fErrorHandler = 
+        (ThreadManager::ErrorHandler_t) periodicErrorHandler;
+
+    // Create thread.
+    pthread_t thread;
+    ThreadManager::ThreadFunc_t threadFunc = 
+        (ThreadManager::ThreadFunc_t) funcCount;
+    CHECK_SUCCESS (pThreadManager->createPeriodicThread (
+                                        thread, threadFunc, nullptr, 0,
+                                        ThreadManager::MAX_NEW_THREAD_PRIORITY,
+                                        ThreadManager::Affinity_t::CORE_0,
+                                        THREAD_PERIOD_MS, fErrorHandler));
+
+    // Let thread run, then cancel it and wait for it to exit so that stats 
+    // no longer change. The thread remains tracked until waited on.
+    TestHelpers::sleepMs (TIME_TO_SLEEP_MS);
+    pthread_cancel (thread);
+    TestHelpers::sleepMs (THREAD_PERIOD_MS);
+
+    // Null DV.
+    CHECK_ERROR (pThreadManager->writePeriodicThreadStats (thread, nullptr, 
+                                                           statsConfig),
+                 E_DATA_VECTOR_NULL);
+
+    // Element of wrong type.
+    ThreadManager::PeriodicThreadStatsDvConfig_t badConfig = statsConfig;
+    badConfig.responseP99Ns = DV_ELEM_TEST6;
+    CHECK_ERROR (pThreadManager->writePeriodicThreadStats (thread, pDv, 
+                                                           badConfig),
+                 E_DATA_VECTOR_WRITE);
+
+    // Success.
+    ThreadManager::PeriodicThreadStats_t stats;
+    CHECK_SUCCESS (pThreadManager->getPeriodicThreadStats (thread, stats));
+    CHECK_SUCCESS (pThreadManager->writePeriodicThreadStats (thread, pDv, 
+                                                             statsConfig));
+    std::vector<uint32_t> expected = 
+    {
+        stats.releaseJitter.maxNs,
+        ThreadManager::calcHistogramP99Ns (stats.releaseJitter),
+        stats.execution.maxNs,
+        ThreadManager::calcHistogramP99Ns (stats.execution),
+        stats.response.maxNs,
+        ThreadManager::calcHistogramP99Ns (stats.response),
+    };
+    std::vector<DataVectorElement_t> elems = 
+    {
+        DV_ELEM_TEST0, DV_ELEM_TEST1, DV_ELEM_TEST2, 
+        DV_ELEM_TEST3, DV_ELEM_TEST4, DV_ELEM_TEST5
+    };
+    for (uint8_t i = 0; i < elems.size (); i++)
+    {
+        uint32_t val = 0;
+        CHECK_SUCCESS (pDv->read (elems[i], val));
+        CHECK_EQUAL (expected[i], val);
+    }
+    CHECK_TRUE (expected[4] > 0);
+
+    // Clean up thread.
+    CHECK_SUCCESS (pThreadManager->waitForThread (thread, ret));
+}
+
+/* Test estimating the 99th percentile of a histogram. */
+TEST (ThreadManagerPeriodicStats, CalcP99)
+{
+    const uint8_t LAST_BUCKET = ThreadManager::NUM_HISTOGRAM_BUCKETS - 1;
+    ThreadManager::Histogram_t histogram = {};
+
+    // Empty histogram.
+    CHECK_EQUAL (0, ThreadManager::calcHistogramP99Ns (histogram));
+
+    // All samples in first bucket. Bounded by max.
+    histogram.counts[0] = 100;
+    histogram.maxNs = 500;
+    histogram.numSamples = 100;
+    CHECK_EQUAL (500, ThreadManager::calcHistogramP99Ns (histogram));
+
+    // 1 outlier in last bucket is excluded from p99.
+    histogram.counts[0] = 99;
+    histogram.counts[LAST_BUCKET] = 1;
+    histogram.maxNs = 100 * Time::NS_IN_MS;
+    CHECK_EQUAL (ThreadManager::HISTOGRAM_BUCKET_BOUNDS_NS[0], 
+                 ThreadManager::calcHistogramP99Ns (histogram));
+
+    // 2 outliers in a middle bucket are included in p99.
+    histogram.counts[0] = 98;
+    histogram.counts[LAST_BUCKET] = 0;
+    histogram.counts[5] = 2;
+    histogram.maxNs = ThreadManager::HISTOGRAM_BUCKET_BOUNDS_NS[5] - 1;
+    CHECK_EQUAL (histogram.maxNs, 
+                 ThreadManager::calcHistogramP99Ns (histogram));
+    histogram.maxNs = 100 * Time::NS_IN_MS;
+    CHECK_EQUAL (ThreadManager::HISTOGRAM_BUCKET_BOUNDS_NS[5], 
+                 ThreadManager::calcHistogramP99Ns (histogram));
+
+    // 2 outliers in last bucket. p99 is max.
+    histogram.counts[5] = 0;
+    histogram.counts[LAST_BUCKET] = 2;
+    CHECK_EQUAL (histogram.maxNs, 
+                 ThreadManager::calcHistogramP99Ns (histogram));
+}
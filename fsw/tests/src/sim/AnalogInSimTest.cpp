@@ -0,0 +1,178 @@
+/**
+ * Tests of the analog input conversion pipeline against scripted voltages.
+ * These must be linked against the simulated FPGA. See SimFpgaTest.cpp.
+ */
+
+/* All #include statements should come before the CppUTest include */
+#include <memory>
+
+#include "AnalogInBankDevice.hpp"
+#include "FPGASession.hpp"
+#include "SimFpga.hpp"
+
+#include "TestHelpers.hpp"
+
+/**
+ * Number of channels in the test bank. One per analog input pin.
+ */
+static const uint32_t NUM_CHANNELS = 16;
+
+/**
+ * Tolerance of an engineering unit evaluated by the bank versus by a single
+ * device, which the compiler may evaluate with different rounding.
+ */
+static const float ENGR_TOLERANCE = 1e-4;
+
+/**
+ * Resets the simulation and initializes the FPGA session, and a Data Vector
+ * with a voltage and engineering unit elem for each channel of the bank and of
+ * an equivalent set of single devices.
+ */
+#define INIT_SIM_AND_DV                                                        \
+    SimFpga::reset ();                                                         \
+    NiFpga_Session session;                                                    \
+    NiFpga_Status status;                                                      \
+    CHECK_SUCCESS (FPGASession::getSession (session, status));                 \
+    CHECK_EQUAL (NiFpga_Status_Success, status);                               \
+    DataVector::Config_t dvConfig = {{DV_REG_TEST0, {}}};                      \
+    for (uint32_t i = 0; i < 4 * NUM_CHANNELS; i++)                            \
+    {                                                                          \
+        dvConfig[0].elems.push_back (                                          \
+            DV_ADD_FLOAT ((DataVectorElement_t) (DV_ELEM_TEST0 + i), 0));      \
+    }                                                                          \
+    std::shared_ptr<DataVector> pDv;                                           \
+    CHECK_SUCCESS (DataVector::createNew (dvConfig, pDv));
+
+/**
+ * Transfer function that doubles the voltage.
+ *
+ * @param   kV        Voltage.
+ * @param   kEngrRet  Engineering unit.
+ *
+ * @ret     E_SUCCESS Always succeeds.
+ */
+static Error_t doubleTransferFunc (float kV, float& kEngrRet)
+{
+    kEngrRet = 2 * kV;
+    return E_SUCCESS;
+}
+
+/**
+ * Build a config for each channel, cycling through linear, cubic, table, and
+ * transfer function conversions. Channel i reads pin i.
+ *
+ * @param   kFirstElem  Elem of channel 0's voltage. Each channel's voltage and
+ *                      engineering unit elems follow in order.
+ *
+ * @ret     Channel configs.
+ */
+static AnalogInBankDevice::Config_t makeConfig (
+                                           DataVectorElement_t kFirstElem)
+{
+    static const Calibration::Config_t calibrations[] =
+    {
+        {Calibration::CAL_POLYNOMIAL, {0.5, 2}, {}, {}},
+        {Calibration::CAL_POLYNOMIAL, {1, -2, 0.25, 0.125}, {}, {}},
+        {Calibration::CAL_PIECEWISE_LINEAR, {}, {-10, 0, 10}, {0, 50, 75}},
+        {Calibration::CAL_NONE, {}, {}, {}},
+    };
+
+    AnalogInBankDevice::Config_t config;
+    for (uint32_t i = 0; i < NUM_CHANNELS; i++)
+    {
+        config.push_back ({
+            (DataVectorElement_t) (kFirstElem + 2 * i),
+            (DataVectorElement_t) (kFirstElem + 2 * i + 1),
+            (uint8_t) i,
+            &doubleTransferFunc,
+            AnalogInDevice::RANGE_10V,
+            AnalogInDevice::MODE_RSE,
+            0,
+            DV_ELEM_TEST0,
+            DV_ELEM_TEST0,
+            DV_ELEM_TEST0,
+            calibrations[i % 4]});
+    }
+    return config;
+}
+
+TEST_GROUP (AnalogInSimTest)
+{
+};
+
+/* Test that the bank converts each channel as a single device would. */
+TEST (AnalogInSimTest, BankMatchesDevices)
+{
+    INIT_SIM_AND_DV;
+
+    // Script a different voltage on each pin.
+    for (uint32_t i = 0; i < NUM_CHANNELS; i++)
+    {
+        CHECK_SUCCESS (SimFpga::setAnalogIn (
+                            i, {SimFpga::WAVE_CONSTANT, -9 + 1.1f * i, 0, 0}));
+    }
+
+    // Run the bank, and a single device per channel.
+    AnalogInBankDevice::Config_t bankConfig = makeConfig (DV_ELEM_TEST0);
+    std::unique_ptr<AnalogInBankDevice> pBank;
+    CHECK_SUCCESS (Device::createNew (session, pDv, bankConfig, pBank));
+    CHECK_SUCCESS (pBank->run ());
+    AnalogInBankDevice::Config_t deviceConfigs = makeConfig (
+        (DataVectorElement_t) (DV_ELEM_TEST0 + 2 * NUM_CHANNELS));
+    for (AnalogInDevice::Config_t& deviceConfig : deviceConfigs)
+    {
+        std::unique_ptr<AnalogInDevice> pDevice;
+        CHECK_SUCCESS (Device::createNew (session, pDv, deviceConfig,
+                                          pDevice));
+        CHECK_SUCCESS (pDevice->run ());
+    }
+
+    // Voltages are identical and engineering units agree.
+    for (uint32_t i = 0; i < NUM_CHANNELS; i++)
+    {
+        float bankVolts = 0;
+        float bankEngr = 0;
+        float deviceVolts = 0;
+        float deviceEngr = 0;
+        CHECK_SUCCESS (pDv->read (bankConfig[i].dvElemOutputVolts, bankVolts));
+        CHECK_SUCCESS (pDv->read (bankConfig[i].dvElemOutputEngr, bankEngr));
+        CHECK_SUCCESS (pDv->read (deviceConfigs[i].dvElemOutputVolts,
+                                  deviceVolts));
+        CHECK_SUCCESS (pDv->read (deviceConfigs[i].dvElemOutputEngr,
+                                  deviceEngr));
+        DOUBLES_EQUAL (-9 + 1.1f * i, bankVolts, 0.001);
+        CHECK_EQUAL (deviceVolts, bankVolts);
+        DOUBLES_EQUAL (deviceEngr, bankEngr, ENGR_TOLERANCE);
+    }
+
+    // Spot check one conversion of each kind.
+    float engr = 0;
+    CHECK_SUCCESS (pDv->read (bankConfig[0].dvElemOutputEngr, engr));
+    DOUBLES_EQUAL (0.5 + 2 * -9, engr, 0.01);
+    CHECK_SUCCESS (pDv->read (bankConfig[2].dvElemOutputEngr, engr));
+    DOUBLES_EQUAL (5 * (10 - 6.8), engr, 0.01);
+    CHECK_SUCCESS (pDv->read (bankConfig[3].dvElemOutputEngr, engr));
+    DOUBLES_EQUAL (2 * -5.7, engr, 0.01);
+}
+
+/* Test that the bank converts negative full scale and zero counts exactly. */
+TEST (AnalogInSimTest, FxpSignExtension)
+{
+    INIT_SIM_AND_DV;
+    AnalogInBankDevice::Config_t config = makeConfig (DV_ELEM_TEST0);
+    config.resize (2);
+    std::unique_ptr<AnalogInBankDevice> pBank;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pBank));
+
+    CHECK_SUCCESS (SimFpga::setAnalogIn (0, {SimFpga::WAVE_CONSTANT, -10, 0,
+                                             0}));
+    CHECK_SUCCESS (SimFpga::setAnalogIn (1, {SimFpga::WAVE_CONSTANT, 0, 0,
+                                             0}));
+    CHECK_SUCCESS (pBank->run ());
+
+    float volts = 0;
+    CHECK_SUCCESS (pDv->read (config[0].dvElemOutputVolts, volts));
+    DOUBLES_EQUAL (-10, volts, 0.001);
+    CHECK_SUCCESS (pDv->read (config[1].dvElemOutputVolts, volts));
+    CHECK_EQUAL (0, volts);
+}
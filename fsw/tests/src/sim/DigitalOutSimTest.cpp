@@ -0,0 +1,126 @@
+/**
+ * Tests of the FPGA transactions made by the digital output devices. These
+ * count simulated NiFpga calls, so must be linked against the simulated FPGA.
+ * See SimFpgaTest.cpp.
+ */
+
+/* All #include statements should come before the CppUTest include */
+#include <memory>
+
+#include "DigitalOutBankDevice.hpp"
+#include "FPGASession.hpp"
+#include "SimFpga.hpp"
+
+#include "TestHelpers.hpp"
+
+/**
+ * Number of channels in the test bank.
+ */
+static const uint32_t NUM_CHANNELS = 16;
+
+/**
+ * Resets the simulation and initializes the FPGA session, and a Data Vector
+ * with a control and feedback elem for each channel.
+ */
+#define INIT_SIM_AND_DV                                                        \
+    SimFpga::reset ();                                                         \
+    NiFpga_Session session;                                                    \
+    NiFpga_Status status;                                                      \
+    CHECK_SUCCESS (FPGASession::getSession (session, status));                 \
+    CHECK_EQUAL (NiFpga_Status_Success, status);                               \
+    DataVector::Config_t dvConfig = {{DV_REG_TEST0, {}}};                      \
+    for (uint32_t i = 0; i < 2 * NUM_CHANNELS; i++)                            \
+    {                                                                          \
+        dvConfig[0].elems.push_back (                                          \
+            DV_ADD_BOOL ((DataVectorElement_t) (DV_ELEM_TEST0 + i), false));   \
+    }                                                                          \
+    std::shared_ptr<DataVector> pDv;                                           \
+    CHECK_SUCCESS (DataVector::createNew (dvConfig, pDv));
+
+/**
+ * Build a bank config with NUM_CHANNELS channels on pins 5 and up.
+ *
+ * @param   kFeedbackDivisor   Feedback divisor of every channel.
+ *
+ * @ret     Bank config.
+ */
+static DigitalOutBankDevice::Config_t makeBankConfig (
+                                                 uint32_t kFeedbackDivisor)
+{
+    DigitalOutBankDevice::Config_t config;
+    for (uint32_t i = 0; i < NUM_CHANNELS; i++)
+    {
+        config.push_back ({
+            (DataVectorElement_t) (DV_ELEM_TEST0 + 2 * i),
+            (DataVectorElement_t) (DV_ELEM_TEST0 + 2 * i + 1),
+            (uint8_t) (DigitalOutDevice::MIN_PIN_NUMBER + i),
+            kFeedbackDivisor});
+    }
+    return config;
+}
+
+TEST_GROUP (DigitalOutSimTest)
+{
+};
+
+/* Test that a device only writes its pin when the control value changes. */
+TEST (DigitalOutSimTest, DeviceWritesOnChange)
+{
+    INIT_SIM_AND_DV;
+    DigitalOutDevice::Config_t config = {DV_ELEM_TEST0, DV_ELEM_TEST1, 5, 0};
+    std::unique_ptr<DigitalOutDevice> pDevice;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+
+    // Unchanged control value. Feedback read only.
+    uint64_t numCalls = SimFpga::getNumCalls ();
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_EQUAL (numCalls + 1, SimFpga::getNumCalls ());
+
+    // Changed control value. One write and one read.
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST0, true));
+    numCalls = SimFpga::getNumCalls ();
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_EQUAL (numCalls + 2, SimFpga::getNumCalls ());
+    bool val = false;
+    CHECK_SUCCESS (SimFpga::getDigitalOut (5, val));
+    CHECK_TRUE (val);
+}
+
+/* Test that a bank only writes changed pins and reads due feedback. */
+TEST (DigitalOutSimTest, BankWritesOnChange)
+{
+    INIT_SIM_AND_DV;
+    DigitalOutBankDevice::Config_t config = makeBankConfig (NUM_CHANNELS);
+    std::unique_ptr<DigitalOutBankDevice> pDevice;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+
+    // First run reads every pin's feedback.
+    uint64_t numCalls = SimFpga::getNumCalls ();
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_EQUAL (numCalls + NUM_CHANNELS, SimFpga::getNumCalls ());
+
+    // Unchanged control values with feedback not due. No FPGA calls.
+    numCalls = SimFpga::getNumCalls ();
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_EQUAL (numCalls, SimFpga::getNumCalls ());
+
+    // One changed control value. One write.
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST6, true));
+    numCalls = SimFpga::getNumCalls ();
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_EQUAL (numCalls + 1, SimFpga::getNumCalls ());
+    bool val = false;
+    CHECK_SUCCESS (SimFpga::getDigitalOut (8, val));
+    CHECK_TRUE (val);
+
+    // Feedback due again after NUM_CHANNELS runs.
+    for (uint32_t i = 3; i < NUM_CHANNELS; i++)
+    {
+        CHECK_SUCCESS (pDevice->run ());
+    }
+    numCalls = SimFpga::getNumCalls ();
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_EQUAL (numCalls + NUM_CHANNELS, SimFpga::getNumCalls ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST7, val));
+    CHECK_TRUE (val);
+}
@@ -0,0 +1,154 @@
+/**
+ * Tests of the Sample Trigger. The IO bitfile does not generate sample ticks,
+ * so these must be linked against the simulated FPGA. See SimFpgaTest.cpp.
+ */
+
+/* All #include statements should come before the CppUTest include */
+#include <memory>
+
+#include "FPGASession.hpp"
+#include "SampleTrigger.hpp"
+#include "SimFpga.hpp"
+
+#include "TestHelpers.hpp"
+
+/**
+ * Resets the simulation and initializes the FPGA session, Data Vector, and
+ * Sample Trigger config.
+ */
+#define INIT_TEST                                                              \
+    SimFpga::reset ();                                                         \
+    NiFpga_Session session;                                                    \
+    NiFpga_Status status;                                                      \
+    CHECK_SUCCESS (FPGASession::getSession (session, status));                 \
+    CHECK_EQUAL (NiFpga_Status_Success, status);                               \
+    std::shared_ptr<DataVector> pDv = nullptr;                                 \
+    CHECK_SUCCESS (DataVector::createNew (gDvConfig, pDv));                    \
+    SampleTrigger::Config_t config = gConfig;                                  \
+    std::unique_ptr<SampleTrigger> pSt = nullptr;
+
+/**
+ * DV config for tests.
+ */
+static DataVector::Config_t gDvConfig =
+{
+    // Region
+    {DV_REG_TEST0,
+
+    // Elements
+    {
+        DV_ADD_UINT64 (DV_ELEM_TEST0, 0),
+        DV_ADD_UINT32 (DV_ELEM_TEST1, 0),
+    }},
+};
+
+/**
+ * Example valid Sample Trigger config.
+ */
+static const SampleTrigger::Config_t gConfig =
+{
+    NiFpga_Irq_0,
+    2,
+    DV_ELEM_TEST0,
+    DV_ELEM_TEST1,
+};
+
+TEST_GROUP (SampleTriggerTest)
+{
+};
+
+/**
+ * Tests invalid configs.
+ */
+TEST (SampleTriggerTest, InvalidConfig)
+{
+    INIT_TEST;
+
+    // Null DV.
+    CHECK_ERROR (SampleTrigger::createNew (config, session, nullptr, pSt),
+                 E_DATA_VECTOR_NULL);
+
+    // No IRQs.
+    config.irqs = 0;
+    CHECK_ERROR (SampleTrigger::createNew (config, session, pDv, pSt),
+                 E_INVALID_CONFIG);
+
+    // No timeout.
+    config.irqs = gConfig.irqs;
+    config.timeoutMs = 0;
+    CHECK_ERROR (SampleTrigger::createNew (config, session, pDv, pSt),
+                 E_INVALID_CONFIG);
+
+    // Sample time elem is wrong type.
+    config.timeoutMs = gConfig.timeoutMs;
+    config.dvElemSampleTimeNs = DV_ELEM_TEST1;
+    CHECK_ERROR (SampleTrigger::createNew (config, session, pDv, pSt),
+                 E_INVALID_ELEM);
+
+    // Miss count elem does not exist in DV.
+    config.dvElemSampleTimeNs = gConfig.dvElemSampleTimeNs;
+    config.dvElemMissCount = DV_ELEM_TEST2;
+    CHECK_ERROR (SampleTrigger::createNew (config, session, pDv, pSt),
+                 E_INVALID_ELEM);
+}
+
+/**
+ * Tests waiting for periodic ticks. Each wait returns on a tick and writes its
+ * time.
+ */
+TEST (SampleTriggerTest, Ticks)
+{
+    INIT_TEST;
+    CHECK_SUCCESS (SampleTrigger::createNew (config, session, pDv, pSt));
+    CHECK_SUCCESS (SimFpga::setPeriodicIrqs (NiFpga_Irq_0,
+                                             500 * Time::NS_IN_US));
+
+    bool ticked = false;
+    uint64_t sampleTimeNs = 0;
+    uint32_t missCount = 0;
+    uint64_t lastSampleTimeNs = 0;
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        CHECK_SUCCESS (pSt->waitForTick (ticked));
+        CHECK_TRUE (ticked);
+        CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, sampleTimeNs));
+        CHECK_TRUE (sampleTimeNs > lastSampleTimeNs);
+        lastSampleTimeNs = sampleTimeNs;
+    }
+
+    CHECK_SUCCESS (SimFpga::setPeriodicIrqs (0, 0));
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, missCount));
+    CHECK_EQUAL (0, missCount);
+}
+
+/**
+ * Tests that a tick asserted before the wait is stale and ignored, and that a
+ * timeout is counted as a miss.
+ */
+TEST (SampleTriggerTest, StaleTickAndTimeout)
+{
+    INIT_TEST;
+    CHECK_SUCCESS (SampleTrigger::createNew (config, session, pDv, pSt));
+
+    bool ticked = false;
+    uint64_t sampleTimeNs = 0;
+    uint32_t missCount = 0;
+
+    // Stale tick. Times out.
+    SimFpga::assertIrqs (NiFpga_Irq_0);
+    CHECK_SUCCESS (pSt->waitForTick (ticked));
+    CHECK_FALSE (ticked);
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, missCount));
+    CHECK_EQUAL (1, missCount);
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, sampleTimeNs));
+    CHECK_EQUAL (0, sampleTimeNs);
+
+    // Other IRQs do not tick.
+    CHECK_SUCCESS (SimFpga::setPeriodicIrqs (NiFpga_Irq_1,
+                                             500 * Time::NS_IN_US));
+    CHECK_SUCCESS (pSt->waitForTick (ticked));
+    CHECK_FALSE (ticked);
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST1, missCount));
+    CHECK_EQUAL (2, missCount);
+    CHECK_SUCCESS (SimFpga::setPeriodicIrqs (0, 0));
+}
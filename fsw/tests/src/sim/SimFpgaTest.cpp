@@ -0,0 +1,306 @@
+/**
+ * Tests for the simulated FPGA. These must be linked against
+ * fsw/fpga/sim/SimFpga.cpp instead of NiFpga.c, together with the tests in
+ * fsw/tests/src/fpga, which then run on a host without an sbRIO.
+ */
+
+/* All #include statements should come before the CppUTest include */
+#include <sstream>
+#include <thread>
+
+#include "AnalogInDevice.hpp"
+#include "DigitalOutDevice.hpp"
+#include "FPGASession.hpp"
+#include "SimFpga.hpp"
+#include "StreamingDevice.hpp"
+#include "Time.hpp"
+
+#include "TestHelpers.hpp"
+
+/**
+ * Resets the simulation and gets the FPGA session.
+ */
+#define INIT_SIM                                                               \
+    SimFpga::reset ();                                                         \
+    NiFpga_Session session;                                                    \
+    NiFpga_Status status;                                                      \
+    CHECK_SUCCESS (FPGASession::getSession (session, status));                 \
+    CHECK_EQUAL (NiFpga_Status_Success, status);
+
+/**
+ * Initializes the simulation, Data Vector, and an analog input device on pin
+ * 0.
+ */
+#define INIT_ANALOG_IN                                                         \
+    INIT_SIM;                                                                  \
+    std::shared_ptr<DataVector> pDv = nullptr;                                 \
+    CHECK_SUCCESS (DataVector::createNew (gDvConfig, pDv));                    \
+    AnalogInDevice::Config_t config =                                          \
+    {                                                                          \
+        DV_ELEM_TEST0,                                                         \
+        DV_ELEM_TEST1,                                                         \
+        0,                                                                     \
+        &identityTransferFunc,                                                 \
+        AnalogInDevice::RANGE_10V,                                             \
+        AnalogInDevice::MODE_RSE,                                              \
+    };                                                                         \
+    std::unique_ptr<AnalogInDevice> pDevice = nullptr;                         \
+    float volts = 0;
+
+/**
+ * Tolerance of a simulated analog input read, which is quantized to the pin's
+ * fxp type.
+ */
+static const float AIN_TOLERANCE_V = 0.001;
+
+/**
+ * DV config for test devices.
+ */
+static DataVector::Config_t gDvConfig =
+{
+    // Region
+    {DV_REG_TEST0,
+
+    // Elements
+    {
+        DV_ADD_FLOAT  (DV_ELEM_TEST0, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST1, 0),
+        DV_ADD_UINT32 (DV_ELEM_TEST2, 0),
+        DV_ADD_UINT32 (DV_ELEM_TEST3, 0),
+        DV_ADD_FLOAT  (DV_ELEM_TEST4, 0),
+        DV_ADD_BOOL   (DV_ELEM_TEST5, false),
+        DV_ADD_BOOL   (DV_ELEM_TEST6, false),
+    }},
+};
+
+/**
+ * Transfer function that returns the voltage.
+ *
+ * @param   kV        Voltage.
+ * @param   kEngrRet  Engineering unit.
+ *
+ * @ret     E_SUCCESS Always succeeds.
+ */
+static Error_t identityTransferFunc (float kV, float& kEngrRet)
+{
+    kEngrRet = kV;
+    return E_SUCCESS;
+}
+
+TEST_GROUP (SimFpgaTest)
+{
+};
+
+/**
+ * Tests invalid simulation parameters.
+ */
+TEST (SimFpgaTest, InvalidParams)
+{
+    INIT_SIM;
+
+    SimFpga::Waveform_t waveform = {SimFpga::WAVE_CONSTANT, 1, 0, 0};
+    CHECK_ERROR (SimFpga::setAnalogIn (16, waveform), E_OUT_OF_BOUNDS);
+    waveform.wave = SimFpga::WAVE_LAST;
+    CHECK_ERROR (SimFpga::setAnalogIn (0, waveform), E_INVALID_ENUM);
+    CHECK_ERROR (SimFpga::setDigitalIn (4, true), E_OUT_OF_BOUNDS);
+    CHECK_ERROR (SimFpga::setLoopback (5, 28), E_OUT_OF_BOUNDS);
+    bool val = false;
+    CHECK_ERROR (SimFpga::getDigitalOut (28, val), E_OUT_OF_BOUNDS);
+    CHECK_ERROR (SimFpga::pushFifo (0, {1}), E_FPGA_FIFO);
+}
+
+/**
+ * Tests that analog inputs read their scripted waveforms, clipped to the
+ * configured range.
+ */
+TEST (SimFpgaTest, AnalogIn)
+{
+    INIT_ANALOG_IN;
+
+    // Unscripted pin reads 0V.
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, volts));
+    DOUBLES_EQUAL (0, volts, AIN_TOLERANCE_V);
+
+    // Constant.
+    CHECK_SUCCESS (SimFpga::setAnalogIn (0, {SimFpga::WAVE_CONSTANT, -3.5, 0,
+                                             0}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, volts));
+    DOUBLES_EQUAL (-3.5, volts, AIN_TOLERANCE_V);
+
+    // Sine at a quarter period.
+    CHECK_SUCCESS (SimFpga::setAnalogIn (0, {SimFpga::WAVE_SINE, 1, 2, 10}));
+    SimFpga::setTimeNs (25 * Time::NS_IN_MS);
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, volts));
+    DOUBLES_EQUAL (3, volts, AIN_TOLERANCE_V);
+
+    // Square in its second half period.
+    CHECK_SUCCESS (SimFpga::setAnalogIn (0, {SimFpga::WAVE_SQUARE, 1, 2,
+                                             10}));
+    SimFpga::setTimeNs (75 * Time::NS_IN_MS);
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, volts));
+    DOUBLES_EQUAL (-1, volts, AIN_TOLERANCE_V);
+
+    // Ramp at three quarters of a period.
+    CHECK_SUCCESS (SimFpga::setAnalogIn (0, {SimFpga::WAVE_RAMP, 0, 4, 10}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, volts));
+    DOUBLES_EQUAL (2, volts, AIN_TOLERANCE_V);
+
+    // Clipped to a 2V range.
+    config.range = AnalogInDevice::RANGE_2V;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+    CHECK_SUCCESS (SimFpga::setAnalogIn (0, {SimFpga::WAVE_CONSTANT, 5, 0,
+                                             0}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, volts));
+    DOUBLES_EQUAL (2, volts, AIN_TOLERANCE_V);
+}
+
+/**
+ * Tests digital output readback, loopback, and scripted input levels.
+ */
+TEST (SimFpgaTest, DigitalIO)
+{
+    INIT_SIM;
+    std::shared_ptr<DataVector> pDv = nullptr;
+    CHECK_SUCCESS (DataVector::createNew (gDvConfig, pDv));
+    DigitalOutDevice::Config_t config = {DV_ELEM_TEST5, DV_ELEM_TEST6, 5};
+    std::unique_ptr<DigitalOutDevice> pDevice = nullptr;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+
+    // Output pin reads back the value it drives.
+    bool val = false;
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST5, true));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST6, val));
+    CHECK_TRUE (val);
+    CHECK_SUCCESS (SimFpga::getDigitalOut (5, val));
+    CHECK_TRUE (val);
+
+    // Input pin reads its scripted level, then the pin it is wired to.
+    NiFpga_Bool in = NiFpga_False;
+    CHECK_SUCCESS (SimFpga::setDigitalIn (6, true));
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_ReadBool (session, NiFpga_IO_IndicatorBool_inDIO6,
+                                  &in));
+    CHECK_EQUAL (NiFpga_True, in);
+    CHECK_SUCCESS (SimFpga::setLoopback (6, 5));
+    CHECK_SUCCESS (pDv->write (DV_ELEM_TEST5, false));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_ReadBool (session, NiFpga_IO_IndicatorBool_inDIO6,
+                                  &in));
+    CHECK_EQUAL (NiFpga_False, in);
+}
+
+/**
+ * Tests that simulated calls are counted and take the configured latency.
+ */
+TEST (SimFpgaTest, Latency)
+{
+    INIT_SIM;
+    uint32_t val = 0;
+
+    Time* pTime = nullptr;
+    CHECK_SUCCESS (Time::getInstance (pTime));
+    Time::TimeNs_t startNs = 0;
+    Time::TimeNs_t endNs = 0;
+    SimFpga::setLatencyNs (Time::NS_IN_MS, 0);
+    CHECK_SUCCESS (pTime->getTimeNs (startNs));
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_ReadU32 (session, 0, &val));
+    CHECK_SUCCESS (pTime->getTimeNs (endNs));
+    CHECK (endNs - startNs >= Time::NS_IN_MS);
+    CHECK_EQUAL (1, SimFpga::getNumCalls ());
+}
+
+/**
+ * Tests asserting, waiting on, and acknowledging IRQs.
+ */
+TEST (SimFpgaTest, Irqs)
+{
+    INIT_SIM;
+    NiFpga_IrqContext context = nullptr;
+    uint32_t irqsAsserted = 0;
+    NiFpga_Bool timedOut = NiFpga_False;
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_ReserveIrqContext (session, &context));
+
+    // Times out with no IRQs asserted.
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_WaitOnIrqs (session, context, NiFpga_Irq_0, 1,
+                                    &irqsAsserted, &timedOut));
+    CHECK_EQUAL (NiFpga_True, timedOut);
+    CHECK_EQUAL (0, irqsAsserted);
+
+    // Only IRQs waited on are returned, until acknowledged.
+    SimFpga::assertIrqs (NiFpga_Irq_0 | NiFpga_Irq_1);
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_WaitOnIrqs (session, context, NiFpga_Irq_0,
+                                    NiFpga_InfiniteTimeout, &irqsAsserted,
+                                    &timedOut));
+    CHECK_EQUAL (NiFpga_False, timedOut);
+    CHECK_EQUAL (NiFpga_Irq_0, irqsAsserted);
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_AcknowledgeIrqs (session, NiFpga_Irq_0));
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_WaitOnIrqs (session, context, NiFpga_Irq_0, 1,
+                                    &irqsAsserted, &timedOut));
+    CHECK_EQUAL (NiFpga_True, timedOut);
+
+    // Periodic IRQs wake a waiting thread.
+    CHECK_SUCCESS (SimFpga::setPeriodicIrqs (NiFpga_Irq_2, Time::NS_IN_MS));
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_WaitOnIrqs (session, context, NiFpga_Irq_2, 1000,
+                                    &irqsAsserted, &timedOut));
+    CHECK_EQUAL (NiFpga_False, timedOut);
+    CHECK_EQUAL (NiFpga_Irq_2, irqsAsserted);
+    CHECK_SUCCESS (SimFpga::setPeriodicIrqs (0, 0));
+
+    CHECK_EQUAL (NiFpga_Status_Success,
+                 NiFpga_UnreserveIrqContext (session, context));
+}
+
+/**
+ * Tests streaming FIFO elements through a StreamingDevice reading the
+ * simulated FPGA FIFO, across the end of the FIFO's ring.
+ */
+TEST (SimFpgaTest, Fifo)
+{
+    INIT_SIM;
+    std::shared_ptr<DataVector> pDv = nullptr;
+    CHECK_SUCCESS (DataVector::createNew (gDvConfig, pDv));
+    StreamingDevice::Config_t config =
+    {
+        0, nullptr, 4, 2, 4, {0, 32, 32}, DV_ELEM_TEST0, DV_ELEM_TEST1,
+        DV_ELEM_TEST4, DV_ELEM_TEST2, DV_ELEM_TEST3,
+    };
+    std::unique_ptr<StreamingDevice> pDevice = nullptr;
+    CHECK_SUCCESS (Device::createNew (session, pDv, config, pDevice));
+
+    // Fill, drain, then push across the end of the ring.
+    float mean = 0;
+    CHECK_SUCCESS (SimFpga::pushFifo (0, {1, 2, 3, 4}));
+    CHECK_ERROR (SimFpga::pushFifo (0, {5}), E_FPGA_FIFO);
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, mean));
+    CHECK_EQUAL (2.5, mean);
+    CHECK_SUCCESS (SimFpga::pushFifo (0, {5, 6, 7}));
+    CHECK_SUCCESS (pDevice->run ());
+    CHECK_SUCCESS (pDv->read (DV_ELEM_TEST0, mean));
+    CHECK_EQUAL (5.5, mean);
+
+    // Verify the recording.
+    std::stringstream out;
+    uint32_t numBlocks = 0;
+    CHECK_SUCCESS (pDevice->recordBlocks (out, numBlocks));
+    CHECK_EQUAL (3, numBlocks);
+    const uint32_t expected[] = {1, 2, 3, 4, 5, 6};
+    CHECK_EQUAL (sizeof (expected), out.str ().size ());
+    MEMCMP_EQUAL (expected, out.str ().data (), sizeof (expected));
+}